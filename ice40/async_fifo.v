@@ -0,0 +1,50 @@
+/*
+  Dual-clock FIFO in block RAM, for crossing between clock domains.
+
+  The write and read pointers are passed to the other domain Gray-coded
+  through a synchroniser (see clocked_bus_slave.v), so full and empty are
+  conservative: they may stay asserted a few clocks after the other side
+  has popped/pushed, but are never wrong in the unsafe direction.
+
+  r_data is the entry at the head of the FIFO, valid whenever empty is
+  deasserted (the pointer synchronisation delay is longer than the block
+  RAM read latency). AW must be at least 2.
+*/
+module async_fifo #(parameter W=16, AW=4)
+   (input wclk, input push, input wire[W-1:0] w_data, output full,
+    input rclk, input pop, output reg[W-1:0] r_data, output empty);
+
+   reg[W-1:0] mem[0:(1<<AW)-1];
+   reg[AW:0] w_bin = 0, w_gray = 0;
+   reg[AW:0] r_bin = 0, r_gray = 0;
+   wire[AW:0] w_bin_next, w_gray_next, r_bin_next, r_gray_next;
+   wire[AW:0] s_r_gray;		// r_gray, synchronised to wclk
+   wire[AW:0] s_w_gray;		// w_gray, synchronised to rclk
+
+   synchroniser #(AW+1) sync_r2w(r_gray, wclk, s_r_gray);
+   synchroniser #(AW+1) sync_w2r(w_gray, rclk, s_w_gray);
+
+   assign w_bin_next = w_bin + {{AW{1'b0}}, push & ~full};
+   assign w_gray_next = (w_bin_next >> 1) ^ w_bin_next;
+   assign r_bin_next = r_bin + {{AW{1'b0}}, pop & ~empty};
+   assign r_gray_next = (r_bin_next >> 1) ^ r_bin_next;
+
+   // Full when the write pointer is one lap ahead of the read pointer; in
+   // Gray code that is the top two bits inverted and the rest equal.
+   assign full = (w_gray == {~s_r_gray[AW:AW-1], s_r_gray[AW-2:0]});
+   assign empty = (r_gray == s_w_gray);
+
+   always @(posedge wclk) begin
+      if (push & ~full)
+	mem[w_bin[AW-1:0]] <= w_data;
+      w_bin <= w_bin_next;
+      w_gray <= w_gray_next;
+   end
+
+   // Read ahead at the next pointer, so r_data always shows the head.
+   always @(posedge rclk) begin
+      r_data <= mem[r_bin_next[AW-1:0]];
+      r_bin <= r_bin_next;
+      r_gray <= r_gray_next;
+   end
+endmodule
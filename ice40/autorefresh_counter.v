@@ -39,10 +39,9 @@
 
 
 //--------------------------------------------------------------------------------------------------
-// Description : LFSR Based auto refresh counter. It provided 5 counters for counts:
-//               500, 750, 1000, 1500 and 2000 cycles. Users of this counter must appropriately
-//               select the AUTO_REFRESH_COUNT in the package based on the freq and refresh
-//               cycle requirements of SDRAM under consideration. 
+// Description : Auto refresh counter. o_refresh_count_done pulses once every
+//               AUTO_REFRESH_COUNT cycles while enabled. sdram_controller derives
+//               AUTO_REFRESH_COUNT from the clock frequency and refresh interval.
 // -------------------------------------------------------------------------------------------------
 
 
@@ -56,104 +55,22 @@ module autorefresh_counter(
     `include "sdram_defines.v"
 
     parameter AUTO_REFRESH_COUNT = 1500;
-   
-    generate
-        if (AUTO_REFRESH_COUNT == 2000) begin
-            reg [10:0] lfsr_reg_i;
-            wire       lfsr_lsb_i,lfsr_count_match_i;
 
-            xnor(lfsr_lsb_i,lfsr_reg_i[10],lfsr_reg_i[8]);
-            assign lfsr_count_match_i = (lfsr_reg_i == 11'h5D3);
+    reg [15:0] count_i;
+    wire       count_match_i;
 
-            always @(posedge i_sys_clk,posedge i_sys_rst) begin
-                if(i_sys_rst) begin
-                    lfsr_reg_i <= 0;
-                    o_refresh_count_done <= 0;
-                end
-                else begin
-                    if(i_autorefresh_enable)
-                        lfsr_reg_i <= lfsr_count_match_i ? 11'h0 : {lfsr_reg_i[9:0],lfsr_lsb_i};
-                    o_refresh_count_done <= lfsr_count_match_i;
-                end
-            end
-        end
-        else if (AUTO_REFRESH_COUNT == 1500) begin
-            reg [10:0] lfsr_reg_i;
-            wire       lfsr_lsb_i,lfsr_count_match_i;
-
-            xnor(lfsr_lsb_i,lfsr_reg_i[10],lfsr_reg_i[8]);
-            assign lfsr_count_match_i = (lfsr_reg_i == 11'h17);
-
-            always @(posedge i_sys_clk,posedge i_sys_rst) begin
-                if(i_sys_rst) begin
-                    lfsr_reg_i <= 0;
-                    o_refresh_count_done <= 0;
-                end
-                else begin
-                    if(i_autorefresh_enable)
-                        lfsr_reg_i <= lfsr_count_match_i ? 11'h0 : {lfsr_reg_i[9:0],lfsr_lsb_i};
-                    o_refresh_count_done <= lfsr_count_match_i;
-                end
-            end
-        end
-        else if (AUTO_REFRESH_COUNT == 1000) begin
-            reg [9:0] lfsr_reg_i;
-            wire      lfsr_lsb_i,lfsr_count_match_i;
-
-            xnor(lfsr_lsb_i,lfsr_reg_i[9],lfsr_reg_i[6]);
-            assign lfsr_count_match_i = (lfsr_reg_i == 10'h2B2);
+    assign count_match_i = (count_i == AUTO_REFRESH_COUNT - 1);
 
-            always @(posedge i_sys_clk,posedge i_sys_rst) begin
-                if(i_sys_rst) begin
-                    lfsr_reg_i <= 0;
-                    o_refresh_count_done <= 0;
-                end
-                else begin
-                    if(i_autorefresh_enable)
-                        lfsr_reg_i <= lfsr_count_match_i ? 10'h0 : {lfsr_reg_i[8:0],lfsr_lsb_i};
-                    o_refresh_count_done <= lfsr_count_match_i;
-                end
-            end
+    always @(posedge i_sys_clk,posedge i_sys_rst) begin
+        if(i_sys_rst) begin
+            count_i <= 0;
+            o_refresh_count_done <= 0;
         end
-        else if (AUTO_REFRESH_COUNT == 750) begin
-            reg [9:0] lfsr_reg_i;
-            wire      lfsr_lsb_i,lfsr_count_match_i;
-
-            xnor(lfsr_lsb_i,lfsr_reg_i[9],lfsr_reg_i[6]);
-            assign lfsr_count_match_i = (lfsr_reg_i == 10'h373);
-
-            always @(posedge i_sys_clk,posedge i_sys_rst) begin
-                if(i_sys_rst) begin
-                    lfsr_reg_i <= 0;
-                    o_refresh_count_done <= 0;
-                end
-                else begin
-                    if(i_autorefresh_enable)
-                        lfsr_reg_i <= lfsr_count_match_i ? 10'h0 : {lfsr_reg_i[8:0],lfsr_lsb_i};
-                    o_refresh_count_done <= lfsr_count_match_i;
-                end
-            end  
-        end
-        else if (AUTO_REFRESH_COUNT == 500) begin
-            
-            reg [8:0] lfsr_reg_i;
-            wire      lfsr_lsb_i,lfsr_count_match_i;
-
-            xnor(lfsr_lsb_i,lfsr_reg_i[8],lfsr_reg_i[4]);
-            assign lfsr_count_match_i = (lfsr_reg_i == 9'h21);
-
-            always @(posedge i_sys_clk,posedge i_sys_rst) begin
-                if(i_sys_rst) begin
-                    lfsr_reg_i <= 0;
-                    o_refresh_count_done <= 0;
-                end
-                else begin
-                    if(i_autorefresh_enable)
-                        lfsr_reg_i <= lfsr_count_match_i ? 9'h0 : {lfsr_reg_i[7:0],lfsr_lsb_i};
-                    o_refresh_count_done <= lfsr_count_match_i;
-                end
-            end
+        else begin
+            if(i_autorefresh_enable)
+                count_i <= count_match_i ? 16'h0 : count_i + 1;
+            o_refresh_count_done <= i_autorefresh_enable && count_match_i;
         end
-    endgenerate
+    end
 
 endmodule
@@ -16,14 +16,28 @@ module synchroniser #(parameter W=1)
 endmodule
 
 
+/*
+  NWAIT handshake: nwait is driven low as soon as NE goes low, and released
+  once the read data is on the bus or the write has been handed to the
+  client. So each FSMC access takes as long as the FPGA actually needs,
+  instead of a fixed worst case.
+
+  The client can stall an access further by asserting rd_wait (read data not
+  yet available) or wr_wait (write cannot be accepted yet), based on
+  r_adr/w_adr. rd_wait must also be asserted in the do_read cycle if
+  read_data is not valid there; r_taken marks the cycle read_data is taken.
+  While wr_wait is asserted, do_write is held back.
+*/
 module clocked_bus_slave #(parameter ADRW=1, DATW=1)
   (input aNE, aNOE, aNWE,
    input wire [ADRW-1:0] aAn, input wire[DATW-1:0] aDn,
    input 		 clk,
    output wire[ADRW-1:0] r_adr, output wire[ADRW-1:0] w_adr,
    output reg 		 do_read, input wire[DATW-1:0] read_data,
-   output reg 		 do_write, output reg[DATW-1:0] w_data,
-   output 		 io_output, output wire[DATW-1:0] io_data);
+   output reg 		 do_write, output wire[DATW-1:0] w_data,
+   output 		 io_output, output wire[DATW-1:0] io_data,
+   input 		 rd_wait, input wr_wait, output nwait,
+   output 		 r_taken);
 
    wire sNE, sNOE, sNWE;
    reg[ADRW-1:0] sAn_r;
@@ -37,8 +51,8 @@ module clocked_bus_slave #(parameter ADRW=1, DATW=1)
    wire next_do_write, next_do_read;
 
    // States for one-hot state machine.
-   reg st_idle=1, st_write=0, st_read1=0, st_read2=0;
-   wire next_st_idle, next_st_write, next_st_read1, next_st_read2;
+   reg st_idle=1, st_wwait=0, st_write=0, st_read1=0, st_read2=0;
+   wire next_st_idle, next_st_wwait, next_st_write, next_st_read1, next_st_read2;
 
    synchroniser sync_NE(aNE, clk, sNE);
    synchroniser sync_NOE(aNOE, clk, sNOE);
@@ -46,6 +60,7 @@ module clocked_bus_slave #(parameter ADRW=1, DATW=1)
 
    always @(posedge clk) begin
       st_idle <= next_st_idle;
+      st_wwait <= next_st_wwait;
       st_write <= next_st_write;
       st_read1 <= next_st_read1;
       st_read2 <= next_st_read2;
@@ -72,23 +87,44 @@ module clocked_bus_slave #(parameter ADRW=1, DATW=1)
       data signal is stable at this point.
     */
    assign next_wDn = st_idle & ~sNE & ~sNWE ? aDn : wDn;
-   // Trigger a register write when NWE goes low.
-   assign next_do_write = st_idle & ~sNE & ~sNWE;
-   assign next_st_write = (st_idle | st_write) & (~sNE & ~sNWE);
+   /* Wait in st_wwait (with the address and data latched) until the client
+      can take the write, then trigger a register write.
+    */
+   assign next_st_wwait = (st_idle | (st_wwait & wr_wait)) & (~sNE & ~sNWE);
+   assign next_do_write = st_wwait & ~wr_wait & ~sNE & ~sNWE;
+   assign next_st_write = ((st_wwait & ~wr_wait) | st_write) & (~sNE & ~sNWE);
 
    /* Incoming read. */
    assign next_do_read = st_idle & ~sNE & ~sNOE;
-   /* Wait one cycle for register read data to become available. */
-   assign next_st_read1 = st_idle & ~sNE & ~sNOE;
+   /* Wait one cycle for register read data to become available, or more
+      while the client asserts rd_wait.
+    */
+   assign next_st_read1 = (st_idle | (st_read1 & rd_wait)) & ~sNE & ~sNOE;
    /* Put read data on the bus while NOE is asserted. */
-   assign next_st_read2 = (st_read1 | st_read2) & ~sNE & ~sNOE;
+   assign next_st_read2 = ((st_read1 & ~rd_wait) | st_read2) & ~sNE & ~sNOE;
 
    assign next_st_idle = ((st_read1 | st_read2) & (sNOE | sNE)) |
-			 (st_write & (sNWE | sNE)) |
+			 ((st_wwait | st_write) & (sNWE | sNE)) |
 			 (st_idle & (sNE | (sNOE & sNWE)));
 
-   /* Latch register read data one cycle after asserting do_read. */
-   assign next_rDn = st_read1 ? read_data : rDn;
+   /* Latch register read data one cycle after asserting do_read (or when
+      the client stops waiting).
+    */
+   assign r_taken = st_read1 & ~rd_wait;
+   assign next_rDn = r_taken ? read_data : rDn;
+   /* Hold the access until done. This uses the raw aNE, so NWAIT is asserted
+      without synchronisation delay. Once released it stays released until NE
+      goes high, even if the state machine has already left st_read2 or
+      st_write (NOE/NWE go high before NE at the end of the access), so the
+      FSMC never sees NWAIT asserted again within the same access.
+    */
+   reg acc_done = 0;
+   always @(posedge clk or posedge aNE)
+     if (aNE)
+       acc_done <= 0;
+     else if ((next_st_read2 & ~st_read2) | (next_st_write & ~st_write))
+       acc_done <= 1;
+   assign nwait = aNE | acc_done;
    /* Output data during read after latching read data. */
    assign io_output = st_read2 & next_st_read2;
    assign io_data = rDn;
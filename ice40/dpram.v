@@ -0,0 +1,18 @@
+/*
+  Simple dual-port RAM: one write port and one registered read port, both on
+  the same clock. Written so that yosys maps it to iCE40 block RAM
+  (SB_RAM40_4K, 256x16 per block).
+*/
+module dpram #(parameter W=16, AW=8)
+   (input clk,
+    input we, input wire[AW-1:0] w_adr, input wire[W-1:0] w_data,
+    input wire[AW-1:0] r_adr, output reg[W-1:0] r_data);
+
+   reg[W-1:0] mem[0:(1<<AW)-1];
+
+   always @(posedge clk) begin
+      if (we)
+	mem[w_adr] <= w_data;
+      r_data <= mem[r_adr];
+   end
+endmodule
@@ -0,0 +1,35 @@
+/*
+  Synchronous FIFO in block RAM (see dpram.v).
+
+  r_data is the entry at the head of the FIFO. Due to the registered block
+  RAM read, it is valid from the second clock after a push into an empty
+  FIFO, or after a pop. level counts entries, including one being popped.
+  clr empties the FIFO, taking priority over push and pop.
+*/
+module fifo #(parameter W=16, AW=8)
+   (input clk, input clr,
+    input push, input wire[W-1:0] w_data,
+    input pop, output wire[W-1:0] r_data,
+    output wire[AW:0] level, output wire empty, output wire full);
+
+   reg[AW:0] w_ptr = 0, r_ptr = 0;
+
+   dpram #(.W(W), .AW(AW))
+     mem(clk, push & ~full, w_ptr[AW-1:0], w_data, r_ptr[AW-1:0], r_data);
+
+   assign level = w_ptr - r_ptr;
+   assign empty = (w_ptr == r_ptr);
+   assign full = (level[AW] == 1'b1);
+
+   always @(posedge clk) begin
+      if (clr) begin
+	 w_ptr <= 0;
+	 r_ptr <= 0;
+      end else begin
+	 if (push & ~full)
+	   w_ptr <= w_ptr + 1;
+	 if (pop & ~empty)
+	   r_ptr <= r_ptr + 1;
+      end
+   end
+endmodule
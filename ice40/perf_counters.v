@@ -0,0 +1,26 @@
+/*
+  Bank of N 32-bit event counters.
+
+  Each clock, counter i counts up if ev[i] is set. q is the counter selected
+  by sel (0 for sel >= N). clr zeroes all counters, taking priority over
+  counting.
+*/
+module perf_counters #(parameter N=1, SELW=4)
+   (input clk,
+    input wire[N-1:0] ev, input clr,
+    input wire[SELW-1:0] sel, output wire[31:0] q);
+
+   reg[32*N-1:0] cnt = 0;
+   integer i;
+
+   always @(posedge clk) begin
+      for (i = 0; i < N; i = i + 1) begin
+	 if (clr)
+	   cnt[32*i +: 32] <= 0;
+	 else if (ev[i])
+	   cnt[32*i +: 32] <= cnt[32*i +: 32] + 1;
+      end
+   end
+
+   assign q = (sel < N) ? cnt[{sel, 5'd0} +: 32] : 32'd0;
+endmodule
@@ -0,0 +1,43 @@
+/*
+  Direct-mapped read cache in block RAM, for single-word reads.
+
+  adr is the word address to look up; hit and q are valid when adr has been
+  stable for one clock (block RAM read latency). A line is filled by writing
+  its words with fill_we/fill_off/fill_data while adr is in the line, and
+  then marking it valid with fill_done. inv invalidates the line containing
+  inv_adr, inv_all invalidates everything. An invalidate of the line being
+  marked valid in the same clock wins, as the fill may hold stale data.
+*/
+module read_cache #(parameter IDXW=6, OFFW=4)
+   (input clk,
+    input wire[23:0] adr, output hit, output wire[15:0] q,
+    input fill_we, input wire[OFFW-1:0] fill_off, input wire[15:0] fill_data,
+    input fill_done,
+    input inv, input wire[23:0] inv_adr, input inv_all);
+
+   localparam TAGW = 24 - IDXW - OFFW;
+
+   reg[(1<<IDXW)-1:0] valid = 0;
+   wire[IDXW-1:0] idx;
+   wire[TAGW-1:0] tag_q;
+
+   assign idx = adr[IDXW+OFFW-1:OFFW];
+
+   dpram #(.W(TAGW), .AW(IDXW))
+     tags(clk, fill_done, idx, adr[23:IDXW+OFFW], idx, tag_q);
+   dpram #(.W(16), .AW(IDXW+OFFW))
+     lines(clk, fill_we, {idx, fill_off}, fill_data, adr[IDXW+OFFW-1:0], q);
+
+   assign hit = valid[idx] & (tag_q == adr[23:IDXW+OFFW]);
+
+   always @(posedge clk) begin
+      if (inv_all)
+	valid <= 0;
+      else begin
+	 if (fill_done)
+	   valid[idx] <= 1;
+	 if (inv)
+	   valid[inv_adr[IDXW+OFFW-1:OFFW]] <= 0;
+      end
+   end
+endmodule
@@ -0,0 +1,30 @@
+/*
+  Small synchronous FIFO in registers, for a few wide entries.
+
+  Unlike fifo.v, r_data is the entry at the head of the FIFO in the clock
+  right after a push into an empty FIFO or a pop, so a consumer can take
+  one entry per clock. level counts entries, including one being popped.
+*/
+module reg_fifo #(parameter W=16, AW=1)
+   (input clk,
+    input push, input wire[W-1:0] w_data,
+    input pop, output wire[W-1:0] r_data,
+    output wire[AW:0] level, output wire empty, output wire full);
+
+   reg[W-1:0] mem[0:(1<<AW)-1];
+   reg[AW:0] w_ptr = 0, r_ptr = 0;
+
+   assign r_data = mem[r_ptr[AW-1:0]];
+   assign level = w_ptr - r_ptr;
+   assign empty = (w_ptr == r_ptr);
+   assign full = (level[AW] == 1'b1);
+
+   always @(posedge clk) begin
+      if (push & ~full) begin
+	 mem[w_ptr[AW-1:0]] <= w_data;
+	 w_ptr <= w_ptr + 1;
+      end
+      if (pop & ~empty)
+	r_ptr <= r_ptr + 1;
+   end
+endmodule
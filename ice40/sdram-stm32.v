@@ -1,26 +1,87 @@
 parameter DW = 16;
 parameter AW = 8;
 
+// Requested main clock frequency in kHz. The PLL gets as close as it can,
+// and all SDRAM timing is derived from the resulting frequency. Eg. 36000,
+// 79500, 99000, 108000.
+parameter CLK_KHZ = 79500;
+
 parameter PERIPH_REG_ADR_LOW = 8'h00;
 parameter PERIPH_REG_ADR_HIGH = 8'h01;
 parameter PERIPH_REG_DATA = 8'h02;
+parameter PERIPH_REG_BURST_LEN = 8'h03;
+parameter PERIPH_REG_BURST_STATUS = 8'h04;
+parameter PERIPH_REG_BURST_DATA = 8'h05;
+parameter PERIPH_REG_WQ_STATUS = 8'h06;
+parameter PERIPH_REG_STREAM_ADR = 8'h07;
+parameter PERIPH_REG_DATA_STREAM = 8'h08;
+parameter PERIPH_REG_STREAM_LEVEL = 8'h09;
+parameter PERIPH_REG_WIN_BASE = 8'h0a;
+parameter PERIPH_REG_CACHE_HITS = 8'h0b;
+parameter PERIPH_REG_CACHE_MISSES = 8'h0c;
+parameter PERIPH_REG_PERF_SEL = 8'h0d;
+parameter PERIPH_REG_PERF_LO = 8'h0e;
+parameter PERIPH_REG_PERF_HI = 8'h0f;
+parameter PERIPH_REG_PWR_PD_IDLE = 8'h10;
+parameter PERIPH_REG_PWR_SR_IDLE = 8'h11;
+parameter PERIPH_REG_PWR_WAKE = 8'h12;
+// 32-bit register pairs, low half first; 8'h13 is skipped so that each
+// pair is at a 32-bit aligned MCU address.
+parameter PERIPH_REG_ADR32_LO = 8'h14;
+parameter PERIPH_REG_ADR32_HI = 8'h15;
+parameter PERIPH_REG_DATA32_LO = 8'h16;
+parameter PERIPH_REG_DATA32_HI = 8'h17;
+parameter PERIPH_REG_BIST_CTRL = 8'h18;
+parameter PERIPH_REG_BIST_FAIL_SEL = 8'h19;
+parameter PERIPH_REG_BIST_LEN_LO = 8'h1a;
+parameter PERIPH_REG_BIST_LEN_HI = 8'h1b;
+parameter PERIPH_REG_BIST_ERR_LO = 8'h1c;
+parameter PERIPH_REG_BIST_ERR_HI = 8'h1d;
+parameter PERIPH_REG_BIST_FAIL_LO = 8'h1e;
+parameter PERIPH_REG_BIST_FAIL_HI = 8'h1f;
+parameter PERIPH_REG_BIST_FAIL_MASK = 8'h20;
+parameter PERIPH_REG_CP_FILL = 8'h21;
+parameter PERIPH_REG_CP_SRC_LO = 8'h22;
+parameter PERIPH_REG_CP_SRC_HI = 8'h23;
+parameter PERIPH_REG_CP_DST_LO = 8'h24;
+parameter PERIPH_REG_CP_DST_HI = 8'h25;
+parameter PERIPH_REG_CP_LEN_LO = 8'h26;
+parameter PERIPH_REG_CP_LEN_HI = 8'h27;
+parameter PERIPH_REG_CP_CTRL = 8'h28;
+parameter PERIPH_REG_CP_STATUS = 8'h29;
+parameter PERIPH_REG_AT_OP = 8'h2a;
+parameter PERIPH_REG_AT_ARG_LO = 8'h2c;
+parameter PERIPH_REG_AT_ARG_HI = 8'h2d;
+parameter PERIPH_REG_AT_CMP_LO = 8'h2e;
+parameter PERIPH_REG_AT_CMP_HI = 8'h2f;
+parameter PERIPH_REG_AT_RESULT_LO = 8'h30;
+parameter PERIPH_REG_AT_RESULT_HI = 8'h31;
+parameter PERIPH_REG_RANGE_LEN_LO = 8'h32;
+parameter PERIPH_REG_RANGE_LEN_HI = 8'h33;
+parameter PERIPH_REG_CRC_CTRL = 8'h34;
+parameter PERIPH_REG_CRC_LO = 8'h36;
+parameter PERIPH_REG_CRC_HI = 8'h37;
+parameter PERIPH_REG_SUM_LO = 8'h38;
+parameter PERIPH_REG_SUM_HI = 8'h39;
+parameter PERIPH_REG_SCAN_CTRL = 8'h3a;
+parameter PERIPH_REG_SCAN_KEY = 8'h3b;
+parameter PERIPH_REG_SCAN_MASK = 8'h3c;
+parameter PERIPH_REG_SCAN_RESULT_LO = 8'h3e;
+parameter PERIPH_REG_SCAN_RESULT_HI = 8'h3f;
+parameter PERIPH_REG_SCAN_INDEX_LO = 8'h40;
+parameter PERIPH_REG_SCAN_INDEX_HI = 8'h41;
 
 
-module pllclk (input ext_clock, output pll_clock, input nrst, output lock);
+// freq = 12 MHz * (DIVF+1) / 2**DIVQ (DIVR=0). See top for the divisors.
+module pllclk #(parameter DIVF=52, DIVQ=3)
+   (input ext_clock, output pll_clock, input nrst, output lock);
    wire dummy_out;
    wire bypass, lock1;
 
    assign bypass = 1'b0;
 
-   // DIVR=0 DIVF=71 DIVQ=3  freq=12/1*72/8 = 108   MHz
-   // DIVR=0 DIVF=52 DIVQ=3  freq=12/1*53/8 =  79.5 MHz
-   // DIVR=0 DIVF=65 DIVQ=3  freq=12/1*66/8 =  99   MHz
-   // DIVR=0 DIVF=47 DIVQ=4  freq=12/1*48/16 = 36   MHz
    SB_PLL40_CORE #(.FEEDBACK_PATH("SIMPLE"), .PLLOUT_SELECT("GENCLK"),
-		   //.DIVR(4'd0), .DIVF(7'b1000111), .DIVQ(3'b011),    // 108 MHz
-		   .DIVR(4'd0), .DIVF(7'b0110100), .DIVQ(3'b011),    // 79.5 MHz
-		   //.DIVR(4'd0), .DIVF(7'b1000001), .DIVQ(3'b011),    // 99 MHz
-		   //.DIVR(4'd0), .DIVF(7'b0101111), .DIVQ(3'b100),  // 36 MHz
+		   .DIVR(4'd0), .DIVF(DIVF), .DIVQ(DIVQ),
 		   .FILTER_RANGE(3'b001)
    ) mypll1 (.REFERENCECLK(ext_clock),
 	    .PLLOUTGLOBAL(pll_clock), .PLLOUTCORE(dummy_out), .LOCK(lock1),
@@ -54,15 +115,34 @@ module top (
    output 	  mem_cs2
 );
 
+   // PLL divisors for CLK_KHZ from the 12 MHz crystal. DIVQ is the smallest
+   // that puts the VCO (12 MHz * (DIVF+1)) in its 533-1066 MHz range, and
+   // DIVF the nearest for that DIVQ.
+   function integer pll_divq(input integer khz);
+      integer q;
+      begin
+	 pll_divq = 6;
+	 for (q = 6; q >= 1; q = q - 1)
+	   if ((khz << q) >= 533000)
+	     pll_divq = q;
+      end
+   endfunction
+
+   localparam PLL_DIVQ = pll_divq(CLK_KHZ);
+   localparam PLL_DIVF = ((CLK_KHZ << PLL_DIVQ) + 6000) / 12000 - 1;
+   // Actual main clock frequency in kHz.
+   localparam PLL_KHZ = (12000 * (PLL_DIVF + 1)) >> PLL_DIVQ;
+
    // Main clock, from PLL.
    wire      clk;
    wire      pll_nrst, lock;
    assign pll_nrst = 1'b1;
-   pllclk my_pll(crystal_clk, clk, pll_nrst, lock);
+   pllclk #(.DIVF(PLL_DIVF), .DIVQ(PLL_DIVQ))
+     my_pll(crystal_clk, clk, pll_nrst, lock);
 
    // Reset control (the sdram controller needs a reset signal).
    reg 		  st_after_startup = 0;
-   reg [1:0] 	  startup_counter = 0'b00;
+   reg [1:0] 	  startup_counter = 2'b00;
    always @(posedge clk) begin
       startup_counter <= startup_counter + 1;
       if (startup_counter == 2'b11)
@@ -97,17 +177,61 @@ module top (
    wire [AW-1:0] fsmc_r_adr;
    wire [AW-1:0] fsmc_w_adr;
    wire 	 fsmc_do_read;
-   wire [DW-1:0] fsmc_r_data;
+   reg [DW-1:0]  fsmc_r_data;
    wire 	 fsmc_do_write;
    wire [DW-1:0] fsmc_w_data;
+   wire 	 fsmc_rd_wait, fsmc_wr_wait, fsmc_nwait, fsmc_r_taken;
+
+   wire 	 fsmc_stream_pop;
+   // Streaming data port FIFO head (see below), which the synchronous bus
+   // slave moves into its own clock domain ahead of time.
+   reg 		 sf_ready = 0;	// Head of stream FIFO is valid
+   wire [DW-1:0] sf_q;
+   wire 	 stream_restart;
+   // FSMC byte lane enables NBL0/NBL1 (active low, PE0/PE1 on the STM32),
+   // wired to sdram_gpio4/5. They go through the bus slave as two extra
+   // data bits, so they are sampled together with the write data.
+   wire [1:0] 	 fsmc_nbl;	// NBL at the FSMC pins
+   wire [1:0] 	 fsmc_w_nbl;	// NBL with fsmc_w_data
+   wire [1:0] 	 fsmc_io_nbl_unused;
+
+`ifdef FSMC_NBL
+   assign fsmc_nbl = {sdram_gpio5, sdram_gpio4};
+`else
+   assign fsmc_nbl = 2'b00;
+`endif
+
+`ifdef FSMC_SYNC
+   // Synchronous PSRAM mode, clocked from FSMC_CLK (PD3 on the STM32) wired
+   // to sdram_gpio3. The first data beat is at FSMC DataLatency + 2 clocks.
+   // sdram_gpio3 is not a global buffer input pin, so the clock is put on a
+   // global net through SB_GB; see TIMING_MHZ in the Makefile.
+   wire 	 fsmc_clk;
+   SB_GB fsmc_clk_gb(.USER_SIGNAL_TO_GLOBAL_BUFFER(sdram_gpio3),
+		     .GLOBAL_BUFFER_OUTPUT(fsmc_clk));
 
-   clocked_bus_slave #(.ADRW(AW), .DATW(DW))
+   sync_bus_slave #(.ADRW(AW), .DATW(DW+2), .FIRST_DATA(2),
+		    .DATA_STREAM_REG(PERIPH_REG_DATA_STREAM),
+		    .STREAM_ADR_REG(PERIPH_REG_STREAM_ADR))
+     my_bus_slave(fsmc_clk, aNE, aNOE, aNWE,
+		  aA, {fsmc_nbl, aDn_input},
+		  clk, fsmc_r_adr, fsmc_w_adr,
+		  fsmc_do_read, {2'b00, fsmc_r_data},
+		  fsmc_do_write, {fsmc_w_nbl, fsmc_w_data},
+		  fsmc_io_d_output, {fsmc_io_nbl_unused, aDn_output},
+		  fsmc_rd_wait, fsmc_wr_wait, fsmc_nwait, fsmc_r_taken,
+		  sf_ready, {2'b00, sf_q}, fsmc_stream_pop, stream_restart);
+`else
+   clocked_bus_slave #(.ADRW(AW), .DATW(DW+2))
      my_bus_slave(aNE, aNOE, aNWE,
-		  aA, aDn_input,
+		  aA, {fsmc_nbl, aDn_input},
 		  clk, fsmc_r_adr, fsmc_w_adr,
-		  fsmc_do_read, fsmc_r_data,
-		  fsmc_do_write, fsmc_w_data,
-		  fsmc_io_d_output, aDn_output);
+		  fsmc_do_read, {2'b00, fsmc_r_data},
+		  fsmc_do_write, {fsmc_w_nbl, fsmc_w_data},
+		  fsmc_io_d_output, {fsmc_io_nbl_unused, aDn_output},
+		  fsmc_rd_wait, fsmc_wr_wait, fsmc_nwait, fsmc_r_taken);
+   assign fsmc_stream_pop = 1'b0;
+`endif
 
 
    // SDRAM controller.
@@ -117,14 +241,28 @@ module top (
    wire 	 sdram_ack;
    wire [12:0] 	 sdram_o_addr;
    wire [1:0] 	 sdram_o_blkaddr;
-   wire 	 sdram_casn, sdram_cke, sdram_csn, sdram_dqm, sdram_rasn, sdram_wen, sdram_o_clk;
-   reg [DW-1:0]  sdram_data_in;
-   reg [DW-1:0]  sdram_data_out;
+   wire 	 sdram_casn, sdram_cke, sdram_csn, sdram_rasn, sdram_wen, sdram_o_clk;
+   wire [3:0] 	 sdram_dqm;
+   wire [DW-1:0] sdram_data_out;
    reg [26:0] 	 sdram_i_addr;
-   reg 		 sdram_adv;
+   reg 		 sdram_adv = 0;
    wire 	 sdram_i_clk;
    wire 	 sdram_rst;
-   reg 		 sdram_rwn;
+   wire [26:0] 	 sdram_next_addr;
+   wire 	 sdram_next_valid;
+   wire 	 sdram_data_next;
+   wire 	 sdram_pipe_ready;
+   wire [1:0] 	 sdram_power_state;
+   wire 	 sdram_wake;
+   reg [15:0] 	 pwr_pd_idle = 0;	// Idle clocks before power-down
+   reg [15:0] 	 pwr_sr_idle = 0;	// Idle 256-clock units before self-refresh
+   // Request towards the controller, from either single-word or burst path.
+   wire [26:0] 	 sdram_req_addr;
+   wire 	 sdram_req_rwn;
+   wire 	 sdram_req_adv;
+   wire [9:0] 	 sdram_req_len;
+   wire [DW-1:0] sdram_req_data;
+   wire [1:0] 	 sdram_req_dqm;
 
    // Some dummy / not-used sdram controller signals.
    wire 	 sdram_data_req, sdram_write_done, sdram_read_done,
@@ -138,7 +276,7 @@ module top (
    assign mem_cke = sdram_cke;
    assign mem_cs1 = sdram_csn;
    assign mem_cs2 = 1;
-   assign mem_dqm = sdram_dqm;
+   assign mem_dqm = sdram_dqm[1:0];
    assign mem_ras = sdram_rasn;
    assign mem_we = sdram_wen;
    assign mem_clk = sdram_o_clk;
@@ -148,12 +286,15 @@ module top (
    assign sdram_loadmod_req = 0;
    assign sdram_burststop_req = 0;
    assign sdram_disable_active = 0;
-   assign sdram_disable_precharge = 0;
+   // Leave rows open after read/write (no auto-precharge). The controller
+   // tracks the open row in each bank, so accesses to the same row as the
+   // previous access in that bank skip the activate and precharge.
+   assign sdram_disable_precharge = 1;
    assign sdram_precharge_req = 0;
    assign sdram_powerdown = 0;
    assign sdram_disable_autorefresh = 0;
 
-   sdram_controller
+   sdram_controller #(.CLK_KHZ(PLL_KHZ))
      sdram(.o_data_valid(sdram_data_valid),
 	   .o_data_req(sdram_data_req),
 	   .o_busy(sdram_busy),
@@ -171,18 +312,22 @@ module top (
 	   .o_sdram_clk(sdram_o_clk),
            .o_write_done(sdram_write_done),
 	   .o_read_done(sdram_read_done),
+	   .o_data_next(sdram_data_next),
+	   .o_pipe_ready(sdram_pipe_ready),
+	   .o_power_state(sdram_power_state),
+	   .o_wake(sdram_wake),
 
-           .i_data(sdram_data_in),
+           .i_data(sdram_req_data),
            .o_data(sdram_data_out),
            .i_sdram_dq(sdram_i_dq),
            .o_sdram_dq(sdram_o_dq),
            .o_sdram_busdir(sdram_busdir),
 
-           .i_addr(sdram_i_addr),
-	   .i_adv(sdram_adv),
+           .i_addr(sdram_req_addr),
+	   .i_adv(sdram_req_adv),
 	   .i_clk(sdram_i_clk),
 	   .i_rst(sdram_rst),
-	   .i_rwn(sdram_rwn),
+	   .i_rwn(sdram_req_rwn),
            .i_selfrefresh_req(sdram_selfrefresh_req),
 	   .i_loadmod_req(sdram_loadmod_req),
 	   .i_burststop_req(sdram_burststop_req),
@@ -190,116 +335,1021 @@ module top (
 	   .i_disable_precharge(sdram_disable_precharge),
 	   .i_precharge_req(sdram_precharge_req),
 	   .i_power_down(sdram_powerdown),
-	   .i_disable_autorefresh(sdram_disable_autorefresh));
+	   .i_disable_autorefresh(sdram_disable_autorefresh),
+	   .i_next_addr(sdram_next_addr),
+	   .i_next_valid(sdram_next_valid),
+	   .i_burst_len(sdram_req_len),
+	   .i_dqm({2'b00, sdram_req_dqm}),
+	   .i_powerdown_idle(pwr_pd_idle),
+	   .i_selfrefresh_idle(pwr_sr_idle));
 
 
    reg [26:0] 	 cur_adr; // Value of peripheral register "address" (bits 1..27)
    wire 	 cur_status_busy; // Value of peripheral register "address" (bit 0)
    reg [15:0] 	 cur_value;	// Value of peripheral register "data"
+   reg [1:0] 	 cur_nbl = 2'b00; // Byte lanes of last write to "data"
    wire 	 sdram_idle;
+   wire 	 sdram_ready;
    wire 	 decode_adr_low, decode_adr_high, decode_data;
+   wire 	 decode_burst_len, decode_burst_status, decode_burst_data;
+   wire 	 decode_stream_adr, decode_data_stream;
+   wire 	 decode_win_base, decode_window_w;
+   wire 	 decode_cache_hits, decode_cache_misses;
+   wire 	 decode_perf_sel;
+   wire 	 decode_pwr_pd_idle, decode_pwr_sr_idle;
+   wire 	 decode_adr32_lo, decode_adr32_hi, decode_data32;
+   wire 	 read_data32;
+   wire 	 decode_bist_ctrl, decode_bist_fail_sel;
+   wire 	 decode_bist_len_lo, decode_bist_len_hi;
+   wire 	 bist_start, bist_busy;
+   wire 	 decode_cp_fill, decode_cp_ctrl, decode_cp_status;
+   wire 	 decode_cp_src_lo, decode_cp_src_hi;
+   wire 	 decode_cp_dst_lo, decode_cp_dst_hi;
+   wire 	 decode_cp_len_lo, decode_cp_len_hi;
+   wire 	 cp_busy, cp_pending, cp_full, cp_inv;
+   wire 	 decode_at_op, decode_at_arg_lo, decode_at_arg_hi;
+   wire 	 decode_at_cmp_lo, decode_at_cmp_hi;
+   wire 	 at_busy, at_pending, at_inv;
+   wire [23:0] 	 at_inv_adr;
+   wire 	 decode_range_len_lo, decode_range_len_hi, decode_crc_ctrl;
+   wire 	 decode_scan_ctrl, decode_scan_key, decode_scan_mask;
+   wire 	 rdr_busy, rdr_pending;
+   reg [14:0] 	 adr32_lo;	// Low half of a 32-bit address write
    // State machine states.
-   reg 		 st_pending_read, st_doing_read, st_pending_write, st_doing_write;
+   reg 		 st_pending_read, st_doing_read;
+   reg 		 st_finishing_write = 0;	// Queued write acked, not yet done
+   reg 		 st_lookup = 0, st_pending_fill = 0;
+   wire 	 read_busy;
+   reg 		 rd_result_pending = 0;	// Read data not yet delivered
+   wire 	 rd_done;
+   wire [DW-1:0] rd_data;
+
+   // Posted write queue. Writes from the MCU are queued as {address, byte
+   // lanes, data} and complete in the background, so the MCU only needs to
+   // wait when the queue is full. Reads and bursts wait until the queue has
+   // drained, which keeps them ordered after all earlier writes. The byte
+   // lanes (FSMC NBL, active low) become the DQM mask of the SDRAM write, so
+   // a byte store is a single write instead of a read-modify-write.
+   wire 	 wq_push, wq_pop, wq_empty, wq_full;
+   wire [8:0] 	 wq_level;
+   wire [23:0] 	 wq_adr;
+   wire [1:0] 	 wq_nbl;
+   wire [DW-1:0] wq_data;
+   wire [24+2+DW-1:0] wq_w_entry;
+   reg 		 wq_fresh = 0;	// Head not read out of the block RAM yet
+
+   // Request queue of the single-word path: writes moved from the write
+   // queue, and line fills after cache misses, in order. Its head goes to
+   // the controller as soon as that is ready, which for a read is already
+   // in the CAS latency of the previous one, and the next entry follows
+   // the clock after the ack. While a request runs, the next one is at the
+   // head, for the look-ahead hint.
+   wire 	 rq_push, rq_pop, rq_empty, rq_full, rq_more, fill_go;
+   wire [1:0] 	 rq_level;
+   wire 	 rq_rwn;
+   wire [26:0] 	 rq_adr;
+   wire [1:0] 	 rq_nbl;
+   wire [DW-1:0] rq_data;
+
+   reg_fifo #(.W(1+27+2+DW), .AW(1))
+     req_queue(clk,
+	       rq_push, wq_pop ? {1'b0, 3'b000, wq_adr, wq_nbl, wq_data} :
+	       {1'b1, sdram_i_addr[26:4], 4'b0000, 2'b00, {DW{1'b0}}},
+	       rq_pop, {rq_rwn, rq_adr, rq_nbl, rq_data},
+	       rq_level, rq_empty, rq_full);
+
+   fifo #(.W(24+2+DW), .AW(8))
+     write_queue(clk, 1'b0,
+		 wq_push, wq_w_entry,
+		 wq_pop, {wq_adr, wq_nbl, wq_data},
+		 wq_level, wq_empty, wq_full);
+
+   // Streaming data port. Writing PERIPH_REG_STREAM_ADR sets the stream
+   // address (bits 15:1 low address, high bits from the address high
+   // register); bit 0 selects write (1) or read (0) streaming. Each write to
+   // PERIPH_REG_DATA_STREAM posts a write through the write queue and each
+   // read returns the next word, then the stream address is incremented.
+   // For read streaming, words are prefetched in row-bounded bursts into a
+   // FIFO; PERIPH_REG_STREAM_LEVEL tells how many words are ready. Words
+   // already prefetched do not see later writes to the same address.
+   localparam [23:0] STREAM_CHUNK = 24'd64;
+   reg [23:0] 	 stream_adr;	// Address of next DATA_STREAM access
+   reg 		 stream_rwn = 0;	// Set while read streaming
+   reg [23:0] 	 pf_adr;		// Address of next word to prefetch
+   reg 		 pf_drop = 0;	// Discard rest of prefetch after restart
+   wire 	 stream_pop;
+   wire 	 sf_push, sf_empty, sf_full;
+   wire [8:0] 	 sf_level;
+   wire 	 pf_start, pf_busy;
+   wire [23:0] 	 pf_count;
+   wire [23:0] 	 pf_sd_adr, pf_next_adr;
+   wire 	 pf_sd_rwn, pf_sd_adv;
+   wire [9:0] 	 pf_sd_len;
+
+   fifo #(.W(DW), .AW(8))
+     stream_fifo(clk, stream_restart,
+		 sf_push, sdram_data_out,
+		 stream_pop, sf_q,
+		 sf_level, sf_empty, sf_full);
+
+   sdram_burst prefetch(clk,
+			pf_start, 1'b1, pf_adr, STREAM_CHUNK, pf_adr,
+			pf_busy, pf_count,
+			pf_sd_adr, pf_sd_rwn, pf_sd_len, pf_sd_adv, pf_next_adr,
+			sdram_ready, sdram_ack, sdram_data_valid, sdram_write_done);
+
+   assign stream_restart = fsmc_do_write & decode_stream_adr;
+   // In synchronous FSMC mode, the bus slave pops words ahead of time into
+   // its own clock domain instead.
+   assign stream_pop = (fsmc_r_taken &
+			(fsmc_r_adr == PERIPH_REG_DATA_STREAM)) |
+		       fsmc_stream_pop;
+   assign sf_push = pf_busy & sdram_data_valid & !pf_drop;
+   // Prefetch a chunk when there is room for it and nothing else wants the
+   // sdram controller. Any FSMC write may start another operation this same
+   // cycle, so hold off for those.
+   assign pf_start = stream_rwn & !pf_busy &
+		     ({15'd0, sf_level} <= 24'd256 - STREAM_CHUNK) &
+		     !fsmc_do_write & wq_empty & rq_empty &
+		     !st_finishing_write & !read_busy &
+		     !cp_busy & !rdr_busy & !at_pending;
+
+   always @(posedge clk) begin
+      if (stream_restart) begin
+	 stream_adr <= {cur_adr[23:15], fsmc_w_data[15:1]};
+	 pf_adr <= {cur_adr[23:15], fsmc_w_data[15:1]};
+	 stream_rwn <= !fsmc_w_data[0];
+      end else begin
+	 if (stream_pop | (fsmc_do_write & decode_data_stream))
+	   stream_adr <= stream_adr + 1;
+	 if (pf_start)
+	   pf_adr <= pf_adr + STREAM_CHUNK;
+      end
+
+      if (stream_restart & pf_busy)
+	pf_drop <= 1;
+      else if (!pf_busy)
+	pf_drop <= 0;
+
+      // The FIFO output is valid from the second cycle of being non-empty
+      // without a pop (block RAM read latency).
+      sf_ready <= !sf_empty & !stream_pop & !stream_restart;
+   end
+
+   // Memory-mapped window. FSMC addresses with the top address bit set map
+   // directly to 128 SDRAM words starting at the window base. Writing
+   // PERIPH_REG_WIN_BASE sets the base like a write to the low address
+   // register does, but only bits 15:8 are used (the window is aligned to
+   // its size). Window writes are posted through the write queue, window
+   // reads are done as single-word reads; the FSMC access is stalled with
+   // NWAIT while the queue cannot take a write or the read data is pending.
+   reg [16:0] 	 win_base;	// Window base, word address bits 23:7
+   reg 		 win_pending = 0; // Window read waiting for the read path
+   reg 		 read_to_win = 0; // Current single-word read is for window
+   reg 		 win_ready = 0;	// win_rdata holds data for window read
+   reg [DW-1:0]  win_rdata;
+   reg [23:0] 	 win_rd_adr;	// SDRAM word address of the pending read
+   wire 	 win_read;
+
+   // Stall FSMC accesses that need the sdram: window accesses as above,
+   // reads of the data register while a single-word read is in progress,
+   // stream reads until prefetched data is available, posted writes while
+   // the write queue cannot take them, any write to the low address (read
+   // or write trigger) while a read, burst or self-test is running, and the
+   // atomic and copy engine registers as described below. So the MCU need
+   // not poll. PERF_LO reads also wait a clock, see the performance counters.
+   assign fsmc_rd_wait =
+     (win_read & (fsmc_do_read | !win_ready)) |
+     ((fsmc_r_adr == PERIPH_REG_DATA) & rd_result_pending) |
+     ((fsmc_r_adr == PERIPH_REG_DATA_STREAM) & stream_rwn & !sf_ready) |
+     (((fsmc_r_adr == PERIPH_REG_AT_RESULT_LO) |
+       (fsmc_r_adr == PERIPH_REG_AT_RESULT_HI)) & at_pending) |
+     ((fsmc_r_adr == PERIPH_REG_PERF_LO) & fsmc_do_read);
+   assign fsmc_wr_wait =
+     ((fsmc_w_adr[AW-1] | decode_data_stream | decode_data32) &
+      (wq_full | read_busy)) |
+     (decode_adr_low & (read_busy | (fsmc_w_data[0] & wq_full))) |
+     (decode_cp_ctrl & cp_full) | (decode_at_op & at_pending);
+
+   always @(posedge clk) begin
+      if (fsmc_do_write & decode_win_base)
+	win_base <= {cur_adr[23:15], fsmc_w_data[15:8]};
+
+      if (fsmc_do_read & win_read) begin
+	 win_pending <= 1;
+	 win_ready <= 0;
+	 win_rd_adr <= read_data32 ? cur_adr[23:0] + {23'd0, fsmc_r_adr[0]} :
+		       {win_base, fsmc_r_adr[6:0]};
+      end else if (win_pending & !read_busy) begin
+	 // Start the read through the single-word read path.
+	 win_pending <= 0;
+	 read_to_win <= 1;
+      end else if (read_to_win & rd_done) begin
+	 read_to_win <= 0;
+	 win_ready <= 1;
+	 win_rdata <= rd_data;
+      end
+   end
+
+   // Burst transfers. The MCU fills/empties a 256-word block RAM buffer
+   // through PERIPH_REG_BURST_DATA (auto-incrementing index), and the burst
+   // engine moves the buffer to/from SDRAM at one word per clock.
+   reg [8:0] 	 burst_len;	// Value of peripheral register "burst length"
+   reg [7:0] 	 bbuf_idx;	// FSMC side index into burst buffer
+   reg [7:0] 	 bbuf_sd_idx;	// SDRAM side index into burst buffer
+   wire [DW-1:0] bbuf_q;
+   wire 	 bbuf_we;
+   wire [7:0] 	 bbuf_w_adr, bbuf_r_adr;
+   wire [DW-1:0] bbuf_w_data;
+   wire 	 burst_start, burst_busy;
+   wire [23:0] 	 burst_count;
+   wire [23:0] 	 burst_sd_adr, burst_next_adr;
+   wire 	 burst_sd_rwn, burst_sd_adv;
+   wire [9:0] 	 burst_sd_len;
+
+   sdram_burst my_burst(clk,
+			burst_start, !fsmc_w_data[0],
+			{cur_adr[23:15], fsmc_w_data[15:1]}, {15'd0, burst_len},
+			burst_sd_adr + {14'd0, burst_sd_len},
+			burst_busy, burst_count,
+			burst_sd_adr, burst_sd_rwn, burst_sd_len, burst_sd_adv,
+			burst_next_adr,
+			sdram_ready, sdram_ack, sdram_data_valid, sdram_write_done);
+
+   dpram #(.W(DW), .AW(8))
+     burst_buf(clk, bbuf_we, bbuf_w_adr, bbuf_w_data, bbuf_r_adr, bbuf_q);
 
-   // For debugging, can expose signals here on sdram pcb gpio header.
-   assign sdram_gpio1 = 1'b0;
-   assign sdram_gpio2 = 1'b0;
+   // While a burst runs, the SDRAM side owns both buffer ports.
+   assign bbuf_we = burst_busy ? (burst_sd_rwn & sdram_data_valid) :
+		    (fsmc_do_write & decode_burst_data);
+   assign bbuf_w_adr = burst_busy ? bbuf_sd_idx : bbuf_idx;
+   assign bbuf_w_data = burst_busy ? sdram_data_out : fsmc_w_data;
+   assign bbuf_r_adr = burst_busy ? bbuf_sd_idx : bbuf_idx;
+
+   // Read cache for single-word reads (register protocol and window), 64
+   // lines of 16 words. A read waits for the write queue to drain, then looks
+   // up the cache (st_lookup). On a miss, the whole line is read with one
+   // burst (st_doing_read), and the data is delivered when the requested
+   // word comes by. Writes from the write queue invalidate the line they
+   // hit, as do atomic operations; burst writes, the self-test and the
+   // copy engine invalidate the whole cache.
+   reg [3:0] 	 fill_cnt;
+   wire 	 rd_go, cache_hit;
+   wire [DW-1:0] cache_q;
+   reg [15:0] 	 cache_hits = 0, cache_misses = 0;
+
+   read_cache #(.IDXW(6), .OFFW(4))
+     my_cache(clk, sdram_i_addr[23:0], cache_hit, cache_q,
+	      st_doing_read & sdram_data_valid, fill_cnt, sdram_data_out,
+	      st_doing_read & sdram_data_valid & (fill_cnt == 4'hf),
+	      wq_pop | at_inv,
+	      at_inv ? at_inv_adr : wq_adr,
+	      (burst_start & fsmc_w_data[0]) | bist_start | cp_inv);
+
+   // A fill goes into the request queue behind the writes before it.
+   assign rd_go = st_pending_read & wq_empty & !pf_busy & !cp_busy &
+		  !rdr_busy & !at_pending;
+   assign rd_done = (st_lookup & cache_hit) |
+		    (st_doing_read & sdram_data_valid &
+		     (fill_cnt == sdram_i_addr[3:0]));
+   assign rd_data = st_lookup ? cache_q : sdram_data_out;
+
+   always @(posedge clk) begin
+      if (st_lookup)
+	fill_cnt <= 0;
+      else if (st_doing_read & sdram_data_valid)
+	fill_cnt <= fill_cnt + 1;
 
-   // Decode FSMC read request.
-   // We have no side effects on reads, so we can ignore fsmc_do_read and just
-   // decode combinatorially the read address to provide the data-to-read.
+      if (fsmc_do_write & decode_cache_hits)
+	cache_hits <= 0;
+      else if (st_lookup & cache_hit)
+	cache_hits <= cache_hits + 1;
+      if (fsmc_do_write & decode_cache_misses)
+	cache_misses <= 0;
+      else if (st_lookup & !cache_hit)
+	cache_misses <= cache_misses + 1;
+   end
+
+   // Performance counters. Write PERIPH_REG_PERF_SEL to select a counter
+   // (bits 3:0), with bit 15 set to clear all counters. Reading
+   // PERIPH_REG_PERF_LO returns the low half of the selected counter and
+   // latches the high half for a following read of PERIPH_REG_PERF_HI. Both
+   // halves are taken in the do_read cycle (the read waits a clock for
+   // that), and the high half goes to PERIPH_REG_PERF_HI when the read is
+   // taken.
+   // SDRAM commands are decoded from the command pins; a refresh lasts from
+   // the precharge-all or refresh command until the controller is idle, and
+   // stalls are cycles in a refresh while a request is waiting.
+   localparam PERF_ACTIVATE = 0, PERF_READ = 1, PERF_WRITE = 2,
+     PERF_PRECHARGE = 3, PERF_REFRESH = 4, PERF_IDLE = 5, PERF_BUSY = 6,
+     PERF_REFRESH_STALL = 7, PERF_FSMC_READ = 8, PERF_FSMC_WRITE = 9,
+     PERF_POWERDOWN = 10, PERF_SELFREFRESH = 11, PERF_WAKE = 12,
+     PERF_N = 13;
+   reg [3:0] 	 perf_sel = 0;
+   reg [15:0] 	 perf_hi;
+   reg [31:0] 	 perf_rd;	// Counter as of the last PERF_LO read
+   reg 		 in_refresh = 0;
+   wire [PERF_N-1:0] perf_ev;
+   wire [31:0] 	 perf_q;
+   wire 	 perf_clr;
+   wire 	 cmd_active, cmd_read, cmd_write, cmd_precharge, cmd_refresh;
+   wire 	 sdram_wanted;
+
+   perf_counters #(.N(PERF_N), .SELW(4))
+     my_perf(clk, perf_ev, perf_clr, perf_sel, perf_q);
+
+   assign cmd_active = !sdram_csn & !sdram_rasn & sdram_casn & sdram_wen;
+   assign cmd_read = !sdram_csn & sdram_rasn & !sdram_casn & sdram_wen;
+   assign cmd_write = !sdram_csn & sdram_rasn & !sdram_casn & !sdram_wen;
+   assign cmd_precharge = !sdram_csn & !sdram_rasn & sdram_casn & !sdram_wen;
+   // Self-refresh entry is the refresh command with CKE low; count that
+   // under PERF_SELFREFRESH instead.
+   assign cmd_refresh = !sdram_csn & !sdram_rasn & !sdram_casn & sdram_wen &
+			sdram_cke;
+   assign sdram_wanted = !wq_empty | !rq_empty | st_pending_read |
+			 st_pending_fill |
+			 burst_busy | pf_busy | bist_busy | cp_pending |
+			 at_pending | rdr_pending;
+
+   assign perf_ev[PERF_ACTIVATE] = cmd_active;
+   assign perf_ev[PERF_READ] = cmd_read;
+   assign perf_ev[PERF_WRITE] = cmd_write;
+   assign perf_ev[PERF_PRECHARGE] = cmd_precharge;
+   assign perf_ev[PERF_REFRESH] = cmd_refresh;
+   assign perf_ev[PERF_IDLE] = sdram_idle;
+   assign perf_ev[PERF_BUSY] = sdram_init_done & sdram_busy;
+   assign perf_ev[PERF_REFRESH_STALL] = in_refresh & sdram_wanted;
+   assign perf_ev[PERF_FSMC_READ] = fsmc_r_taken;
+   assign perf_ev[PERF_FSMC_WRITE] = fsmc_do_write;
+   assign perf_ev[PERF_POWERDOWN] = (sdram_power_state == 2'b01);
+   assign perf_ev[PERF_SELFREFRESH] = sdram_power_state[1];
+   assign perf_ev[PERF_WAKE] = sdram_wake;
+   assign perf_clr = fsmc_do_write & decode_perf_sel & fsmc_w_data[15];
+
+   always @(posedge clk) begin
+      if (fsmc_do_write & decode_perf_sel)
+	perf_sel <= fsmc_w_data[3:0];
+      if (fsmc_do_read & (fsmc_r_adr == PERIPH_REG_PERF_LO))
+	perf_rd <= perf_q;
+      if (fsmc_r_taken & (fsmc_r_adr == PERIPH_REG_PERF_LO))
+	perf_hi <= perf_rd[31:16];
+
+      if (cmd_refresh | (cmd_precharge & mem_a[10]))
+	in_refresh <= 1;
+      else if (sdram_idle)
+	in_refresh <= 0;
+   end
+
+   // Power management, see sdram_controller. PERIPH_REG_PWR_PD_IDLE is the
+   // number of idle clocks before power-down, PERIPH_REG_PWR_SR_IDLE the
+   // number of 256-clock units before self-refresh, 0 disables. Reading
+   // PERIPH_REG_PWR_WAKE gives the wake-up latency, in clocks, of the last
+   // request that found the SDRAM in power-down or self-refresh. Time spent
+   // in each state and waiting for wake-up is in the performance counters.
+   reg [15:0] 	 pwr_wake_cnt = 0, pwr_wake_last = 0;
+
+   always @(posedge clk) begin
+      if (fsmc_do_write & decode_pwr_pd_idle)
+	pwr_pd_idle <= fsmc_w_data;
+      if (fsmc_do_write & decode_pwr_sr_idle)
+	pwr_sr_idle <= fsmc_w_data;
+
+      if (sdram_wake) begin
+	 if (pwr_wake_cnt != 16'hffff)
+	   pwr_wake_cnt <= pwr_wake_cnt + 1;
+      end else begin
+	 if (pwr_wake_cnt != 0)
+	   pwr_wake_last <= pwr_wake_cnt;
+	 pwr_wake_cnt <= 0;
+      end
+   end
+
+   // Memory self-test, see sdram_bist. Set the start address with
+   // PERIPH_REG_ADR32 (or the address registers, without triggering an
+   // access) and the length in words with PERIPH_REG_BIST_LEN_LO/HI, then
+   // write PERIPH_REG_BIST_CTRL to start: bits 1:0 select the pattern,
+   // bits 15:8 are the seed. Reading it gives the busy flag in bit 15 and
+   // the number of recorded failing addresses in bits 11:8. The error
+   // count is in PERIPH_REG_BIST_ERR_LO/HI, the or of all failing bits in
+   // PERIPH_REG_BIST_FAIL_MASK, and PERIPH_REG_BIST_FAIL_LO/HI give the
+   // failing address selected with PERIPH_REG_BIST_FAIL_SEL, in the format
+   // of the address registers. Like a burst, the test has the SDRAM to
+   // itself: any FSMC access that needs the SDRAM stalls until it is done,
+   // so poll PERIPH_REG_BIST_CTRL only.
+   reg [24:0] 	 bist_len = 0;
+   reg [2:0] 	 bist_fail_sel = 0;
+   wire [31:0] 	 bist_errors;
+   wire [15:0] 	 bist_fail_mask;
+   wire [3:0] 	 bist_nfail;
+   wire [23:0] 	 bist_fail_adr;
+   wire [23:0] 	 bist_sd_adr, bist_next_adr;
+   wire 	 bist_sd_rwn, bist_sd_adv;
+   wire [9:0] 	 bist_sd_len;
+   wire [DW-1:0] bist_wdata;
+
+   sdram_bist #(.NFAIL(8), .LENW(25))
+     my_bist(clk,
+	     bist_start, fsmc_w_data[1:0], fsmc_w_data[15:8],
+	     cur_adr[23:0], bist_len,
+	     bist_busy, bist_errors, bist_fail_mask, bist_nfail,
+	     bist_fail_sel, bist_fail_adr,
+	     bist_sd_adr, bist_sd_rwn, bist_sd_len, bist_sd_adv,
+	     bist_next_adr, bist_wdata,
+	     sdram_ready, sdram_ack, sdram_data_valid, sdram_data_out,
+	     sdram_data_next, sdram_write_done);
+
+   assign bist_start = fsmc_do_write & decode_bist_ctrl & !cur_status_busy;
+
+   always @(posedge clk) begin
+      if (fsmc_do_write & decode_bist_len_lo)
+	bist_len[15:0] <= fsmc_w_data;
+      if (fsmc_do_write & decode_bist_len_hi)
+	bist_len[24:16] <= fsmc_w_data[8:0];
+      if (fsmc_do_write & decode_bist_fail_sel)
+	bist_fail_sel <= fsmc_w_data[2:0];
+   end
+
+   // Copy and fill engine, see sdram_copy. A descriptor is set up in
+   // PERIPH_REG_CP_SRC_LO/HI and PERIPH_REG_CP_DST_LO/HI (byte addresses,
+   // in the format of the address registers), PERIPH_REG_CP_LEN_LO/HI
+   // (words) and PERIPH_REG_CP_FILL, and queued by writing
+   // PERIPH_REG_CP_CTRL: bit 0 selects fill (1) or copy (0), bit 1 raises
+   // the interrupt (sdram_gpio2) when it is done. The setup registers keep
+   // their values, so a following descriptor only needs what changes. While
+   // the queue is full, the write to PERIPH_REG_CP_CTRL is stalled with
+   // NWAIT. PERIPH_REG_CP_STATUS reads as {pending, interrupt, queue full,
+   // queue level (5 bits), descriptors done (8 bits)}; writing bit 14
+   // clears the interrupt. Chunks are run like prefetches, when nothing
+   // else wants the SDRAM. Queued descriptors count as busy in the address
+   // register, so sdram_flush() waits for them, and a burst or self-test is
+   // only started once they are done.
+   reg [23:0] 	 cp_src, cp_dst;
+   reg [24:0] 	 cp_len;
+   reg [15:0] 	 cp_fill_val;
+   wire 	 cp_push, cp_go, cp_irq;
+   wire 	 bg_go;		// A background engine may start a chunk
+   reg 		 bg_turn = 0;	// Range reader's turn if both want to start
+   wire [4:0] 	 cp_level;
+   wire [7:0] 	 cp_done;
+   wire [23:0] 	 cp_sd_adr, cp_next_adr;
+   wire 	 cp_sd_rwn, cp_sd_adv;
+   wire [9:0] 	 cp_sd_len;
+   wire [DW-1:0] cp_wdata;
+
+   sdram_copy #(.QAW(4), .CHUNK(512), .LENW(25))
+     my_copy(clk,
+	     cp_push, fsmc_w_data[0], fsmc_w_data[1],
+	     fsmc_w_data[0] ? {8'h00, cp_fill_val} : cp_src, cp_dst, cp_len,
+	     cp_full, cp_level,
+	     cp_go, cp_busy, cp_pending, cp_done, cp_irq,
+	     fsmc_do_write & decode_cp_status & fsmc_w_data[14], cp_inv,
+	     cp_sd_adr, cp_sd_rwn, cp_sd_len, cp_sd_adv, cp_next_adr, cp_wdata,
+	     sdram_ready, sdram_ack, sdram_data_valid, sdram_data_out,
+	     sdram_data_next, sdram_write_done);
+
+   assign cp_push = fsmc_do_write & decode_cp_ctrl & !cp_full;
+   // Same conditions as for starting a prefetch, which goes first. The
+   // copy engine and the range reader take turns.
+   assign bg_go = !fsmc_do_write & wq_empty & rq_empty &
+		  !st_finishing_write & !read_busy &
+		  !pf_busy & !pf_start & !at_pending;
+   assign cp_go = bg_go & !rdr_busy & (!rdr_pending | !bg_turn);
+
+   always @(posedge clk) begin
+      if (cp_busy)
+	bg_turn <= 1;
+      else if (rdr_busy)
+	bg_turn <= 0;
+
+      if (fsmc_do_write & decode_cp_src_lo)
+	cp_src[14:0] <= fsmc_w_data[15:1];
+      if (fsmc_do_write & decode_cp_src_hi)
+	cp_src[23:15] <= fsmc_w_data[8:0];
+      if (fsmc_do_write & decode_cp_dst_lo)
+	cp_dst[14:0] <= fsmc_w_data[15:1];
+      if (fsmc_do_write & decode_cp_dst_hi)
+	cp_dst[23:15] <= fsmc_w_data[8:0];
+      if (fsmc_do_write & decode_cp_len_lo)
+	cp_len[15:0] <= fsmc_w_data;
+      if (fsmc_do_write & decode_cp_len_hi)
+	cp_len[24:16] <= fsmc_w_data[8:0];
+      if (fsmc_do_write & decode_cp_fill)
+	cp_fill_val <= fsmc_w_data;
+   end
+
+   // Atomic operations, see sdram_atomic. Set the address with
+   // PERIPH_REG_ADR32 (32-bit operations need an aligned one), the operand
+   // with PERIPH_REG_AT_ARG_LO/HI and, for compare-and-swap, the expected
+   // value with PERIPH_REG_AT_CMP_LO/HI, then write PERIPH_REG_AT_OP: bits
+   // 2:0 select add, swap, compare-and-swap, and, or, xor, bit 4 a 32-bit
+   // operation. The operands are latched then, so the next ones can be set
+   // up at once. The old value is read from PERIPH_REG_AT_RESULT_LO/HI; the
+   // read, and the next write of PERIPH_REG_AT_OP, are stalled until the
+   // operation is done. It is done after the writes queued before it, and
+   // before single-word reads, copy chunks and prefetches that are waiting.
+   reg [31:0] 	 at_arg, at_cmp;
+   wire 	 at_go;
+   wire [31:0] 	 at_result;
+   wire [23:0] 	 at_sd_adr, at_next_adr;
+   wire 	 at_sd_rwn, at_sd_adv;
+   wire [9:0] 	 at_sd_len;
+   wire [DW-1:0] at_wdata;
+
+   sdram_atomic
+     my_atomic(clk,
+	       fsmc_do_write & decode_at_op, fsmc_w_data[2:0], fsmc_w_data[4],
+	       cur_adr[23:0], at_arg, at_cmp,
+	       at_go, at_pending, at_busy, at_result, at_inv, at_inv_adr,
+	       at_sd_adr, at_sd_rwn, at_sd_len, at_sd_adv, at_next_adr,
+	       at_wdata,
+	       sdram_ready, sdram_ack, sdram_data_valid, sdram_data_out,
+	       sdram_data_next, sdram_write_done);
+
+   assign at_go = wq_empty & rq_empty &
+		  !st_finishing_write & !st_lookup & !st_pending_fill & !st_doing_read &
+		  !burst_busy & !bist_busy & !pf_busy & !pf_start & !cp_busy &
+		  !rdr_busy;
+
+   always @(posedge clk) begin
+      if (fsmc_do_write & decode_at_arg_lo)
+	at_arg[15:0] <= fsmc_w_data;
+      if (fsmc_do_write & decode_at_arg_hi)
+	at_arg[31:16] <= fsmc_w_data;
+      if (fsmc_do_write & decode_at_cmp_lo)
+	at_cmp[15:0] <= fsmc_w_data;
+      if (fsmc_do_write & decode_at_cmp_hi)
+	at_cmp[31:16] <= fsmc_w_data;
+   end
+
+   // Near-memory CRC and scan, see sdram_reader, sdram_crc and sdram_scan.
+   // Set the start address with PERIPH_REG_ADR32 and the length in words
+   // with PERIPH_REG_RANGE_LEN_LO/HI, then write PERIPH_REG_CRC_CTRL or
+   // PERIPH_REG_SCAN_CTRL to start. Both share the range reader. The range
+   // is read in chunks like a copy, taking turns with the copy engine,
+   // after the writes queued before the start; writes queued while it runs
+   // may or may not be seen. PERIPH_REG_CRC_CTRL and PERIPH_REG_SCAN_CTRL
+   // read as {busy, 15'd0}, busy while either runs; a start while busy is
+   // ignored. A running range counts as busy in the address register, like
+   // queued copies.
+   //
+   // When the CRC is done, PERIPH_REG_CRC_LO/HI hold the CRC-32 of the
+   // range, taken as bytes in MCU (little-endian) order, and
+   // PERIPH_REG_SUM_LO/HI the sum of its words.
+   //
+   // For a scan, PERIPH_REG_SCAN_CTRL bits 2:0 are the operation (find,
+   // count, min, max, sum), bit 3 makes it signed and bits 15:8 are the
+   // stride, with the key and mask in PERIPH_REG_SCAN_KEY and
+   // PERIPH_REG_SCAN_MASK. The results are in PERIPH_REG_SCAN_RESULT_LO/HI
+   // and PERIPH_REG_SCAN_INDEX_LO/HI. A find stops reading after the chunk
+   // where it matched.
+   reg [24:0] 	 range_len;
+   reg 		 rdr_to_scan = 0; // Range goes to the scan, not the CRC
+   reg [15:0] 	 scan_key, scan_mask = 16'hffff;
+   wire 	 rdr_start, rdr_go, rdr_valid, crc_busy;
+   wire 	 crc_start, scan_start, scan_busy, scan_found, nm_busy;
+   wire [DW-1:0] rdr_data;
+   wire [31:0] 	 crc_q, crc_sum, scan_result, scan_index;
+   wire [23:0] 	 rdr_sd_adr, rdr_next_adr;
+   wire 	 rdr_sd_rwn, rdr_sd_adv;
+   wire [9:0] 	 rdr_sd_len;
+
+   sdram_reader #(.CHUNK(512), .LENW(25))
+     my_reader(clk,
+	       rdr_start, cur_adr[23:0], range_len,
+	       rdr_go, rdr_to_scan & scan_found, rdr_busy, rdr_pending,
+	       rdr_valid, rdr_data,
+	       rdr_sd_adr, rdr_sd_rwn, rdr_sd_len, rdr_sd_adv, rdr_next_adr,
+	       sdram_ready, sdram_ack, sdram_data_valid, sdram_data_out,
+	       sdram_write_done);
+
+   sdram_crc
+     my_crc(clk, crc_start, rdr_valid & !rdr_to_scan, rdr_data,
+	    crc_busy, crc_q, crc_sum);
+
+   sdram_scan #(.LENW(25))
+     my_scan(clk,
+	     scan_start, fsmc_w_data[2:0], fsmc_w_data[3],
+	     scan_key, scan_mask, fsmc_w_data[15:8],
+	     rdr_valid & rdr_to_scan, rdr_data,
+	     scan_busy, scan_found, scan_result, scan_index);
+
+   assign nm_busy = rdr_pending | crc_busy | scan_busy;
+   assign crc_start = fsmc_do_write & decode_crc_ctrl & !nm_busy;
+   assign scan_start = fsmc_do_write & decode_scan_ctrl & !nm_busy;
+   assign rdr_start = crc_start | scan_start;
+   assign rdr_go = bg_go & !cp_busy & (!cp_pending | bg_turn);
+
+   always @(posedge clk) begin
+      if (crc_start | scan_start)
+	rdr_to_scan <= scan_start;
+      if (fsmc_do_write & decode_scan_key)
+	scan_key <= fsmc_w_data;
+      if (fsmc_do_write & decode_scan_mask)
+	scan_mask <= fsmc_w_data;
+      if (fsmc_do_write & decode_range_len_lo)
+	range_len[15:0] <= fsmc_w_data;
+      if (fsmc_do_write & decode_range_len_hi)
+	range_len[24:16] <= fsmc_w_data[8:0];
+   end
+
+   // Controller request comes from the burst, self-test, atomic, copy,
+   // range reader or prefetch engine while it is busy. Otherwise
+   // single-word writes and line fills come from the request queue.
+   assign sdram_req_addr = burst_busy ? {3'b000, burst_sd_adr} :
+			   bist_busy ? {3'b000, bist_sd_adr} :
+			   at_busy ? {3'b000, at_sd_adr} :
+			   cp_busy ? {3'b000, cp_sd_adr} :
+			   rdr_busy ? {3'b000, rdr_sd_adr} :
+			   pf_busy ? {3'b000, pf_sd_adr} :
+			   rq_adr;
+   assign sdram_req_rwn = burst_busy ? burst_sd_rwn :
+			  bist_busy ? bist_sd_rwn :
+			  at_busy ? at_sd_rwn :
+			  cp_busy ? cp_sd_rwn :
+			  rdr_busy ? rdr_sd_rwn :
+			  pf_busy ? pf_sd_rwn : rq_rwn;
+   assign sdram_req_adv = burst_busy ? burst_sd_adv :
+			  bist_busy ? bist_sd_adv :
+			  at_busy ? at_sd_adv :
+			  cp_busy ? cp_sd_adv :
+			  rdr_busy ? rdr_sd_adv :
+			  pf_busy ? pf_sd_adv : sdram_adv;
+   assign sdram_req_len = burst_busy ? burst_sd_len :
+			  bist_busy ? bist_sd_len :
+			  at_busy ? at_sd_len :
+			  cp_busy ? cp_sd_len :
+			  rdr_busy ? rdr_sd_len :
+			  pf_busy ? pf_sd_len : (rq_rwn ? 10'd16 : 10'd1);
+   assign sdram_req_data = burst_busy ? bbuf_q :
+			   bist_busy ? bist_wdata :
+			   at_busy ? at_wdata :
+			   cp_busy ? cp_wdata : rq_data;
+   assign sdram_req_dqm = (burst_busy | bist_busy | at_busy | cp_busy) ?
+			  2'b00 : rq_nbl;
+
+   // Bank look-ahead hint. The burst, BIST, atomic, copy, reader and
+   // prefetch engines know where their next request goes; when that is in
+   // another bank, its row gets opened during the current access. For the
+   // single-word path, the next request is at the head of the request
+   // queue once the controller has taken the current one, or else at the
+   // head of the write queue.
+   assign sdram_next_addr = burst_busy ? {3'b000, burst_next_adr} :
+			    bist_busy ? {3'b000, bist_next_adr} :
+			    at_busy ? {3'b000, at_next_adr} :
+			    cp_busy ? {3'b000, cp_next_adr} :
+			    rdr_busy ? {3'b000, rdr_next_adr} :
+			    pf_busy ? {3'b000, pf_next_adr} :
+			    !rq_empty ? rq_adr : {3'b000, wq_adr};
+   assign sdram_next_valid = burst_busy | bist_busy | at_busy | cp_busy |
+			     rdr_busy | pf_busy | !rq_empty |
+			     (!wq_empty & !wq_fresh);
+
+   // FSMC NWAIT, wired from the sdram pcb gpio header to PD6 on the STM32.
+   assign sdram_gpio1 = fsmc_nwait;
+   // Copy engine interrupt, active high.
+   assign sdram_gpio2 = cp_irq;
+
+   // Decode FSMC read request: the data is decoded combinatorially from the
+   // read address. Some reads have side effects, done on fsmc_r_taken
+   // elsewhere, once the FSMC has taken the data: BURST_DATA advances the
+   // buffer index, DATA32_HI the address, PERF_LO latches the high half into
+   // PERF_HI, and DATA_STREAM pops the stream FIFO. The synchronous bus
+   // slave may read a register that is then not taken, so nothing may
+   // change on fsmc_do_read but what the read itself needs: a window read
+   // starts an SDRAM read there.
    always @(*) begin
+      if (win_read)
+	fsmc_r_data = win_rdata;
+      else
       case (fsmc_r_adr)
-	PERIPH_REG_ADR_LOW:
+	PERIPH_REG_ADR_LOW, PERIPH_REG_ADR32_LO:
 	  fsmc_r_data = {cur_adr[14:0], cur_status_busy};
-	PERIPH_REG_ADR_HIGH:
+	PERIPH_REG_ADR_HIGH, PERIPH_REG_ADR32_HI:
 	  fsmc_r_data = {4'b0000, cur_adr[26:15]};
 	PERIPH_REG_DATA:
 	  fsmc_r_data = cur_value;
+	PERIPH_REG_BURST_LEN:
+	  fsmc_r_data = {7'b0000000, burst_len};
+	PERIPH_REG_BURST_STATUS:
+	  fsmc_r_data = {burst_count[14:0], burst_busy};
+	PERIPH_REG_BURST_DATA:
+	  fsmc_r_data = bbuf_q;
+	PERIPH_REG_WQ_STATUS:
+	  fsmc_r_data = {wq_full, 6'b000000, wq_level};
+	PERIPH_REG_STREAM_ADR:
+	  fsmc_r_data = {stream_adr[14:0], stream_rwn};
+	PERIPH_REG_DATA_STREAM:
+	  fsmc_r_data = sf_q;
+	PERIPH_REG_STREAM_LEVEL:
+	  fsmc_r_data = {7'b0000000, sf_level};
+	PERIPH_REG_WIN_BASE:
+	  fsmc_r_data = {win_base[7:0], 8'h00};
+	PERIPH_REG_CACHE_HITS:
+	  fsmc_r_data = cache_hits;
+	PERIPH_REG_CACHE_MISSES:
+	  fsmc_r_data = cache_misses;
+	PERIPH_REG_PERF_SEL:
+	  fsmc_r_data = {12'h000, perf_sel};
+	PERIPH_REG_PERF_LO:
+	  fsmc_r_data = perf_rd[15:0];
+	PERIPH_REG_PERF_HI:
+	  fsmc_r_data = perf_hi;
+	PERIPH_REG_PWR_PD_IDLE:
+	  fsmc_r_data = pwr_pd_idle;
+	PERIPH_REG_PWR_SR_IDLE:
+	  fsmc_r_data = pwr_sr_idle;
+	PERIPH_REG_PWR_WAKE:
+	  fsmc_r_data = pwr_wake_last;
+	PERIPH_REG_BIST_CTRL:
+	  fsmc_r_data = {bist_busy, 3'b000, bist_nfail, 8'h00};
+	PERIPH_REG_BIST_FAIL_SEL:
+	  fsmc_r_data = {13'd0, bist_fail_sel};
+	PERIPH_REG_BIST_LEN_LO:
+	  fsmc_r_data = bist_len[15:0];
+	PERIPH_REG_BIST_LEN_HI:
+	  fsmc_r_data = {7'd0, bist_len[24:16]};
+	PERIPH_REG_BIST_ERR_LO:
+	  fsmc_r_data = bist_errors[15:0];
+	PERIPH_REG_BIST_ERR_HI:
+	  fsmc_r_data = bist_errors[31:16];
+	PERIPH_REG_BIST_FAIL_LO:
+	  fsmc_r_data = {bist_fail_adr[14:0], 1'b0};
+	PERIPH_REG_BIST_FAIL_HI:
+	  fsmc_r_data = {7'd0, bist_fail_adr[23:15]};
+	PERIPH_REG_BIST_FAIL_MASK:
+	  fsmc_r_data = bist_fail_mask;
+	PERIPH_REG_CP_FILL:
+	  fsmc_r_data = cp_fill_val;
+	PERIPH_REG_CP_SRC_LO:
+	  fsmc_r_data = {cp_src[14:0], 1'b0};
+	PERIPH_REG_CP_SRC_HI:
+	  fsmc_r_data = {7'd0, cp_src[23:15]};
+	PERIPH_REG_CP_DST_LO:
+	  fsmc_r_data = {cp_dst[14:0], 1'b0};
+	PERIPH_REG_CP_DST_HI:
+	  fsmc_r_data = {7'd0, cp_dst[23:15]};
+	PERIPH_REG_CP_LEN_LO:
+	  fsmc_r_data = cp_len[15:0];
+	PERIPH_REG_CP_LEN_HI:
+	  fsmc_r_data = {7'd0, cp_len[24:16]};
+	PERIPH_REG_CP_STATUS:
+	  fsmc_r_data = {cp_pending, cp_irq, cp_full, cp_level, cp_done};
+	PERIPH_REG_AT_OP:
+	  fsmc_r_data = {at_pending, 15'd0};
+	PERIPH_REG_AT_ARG_LO:
+	  fsmc_r_data = at_arg[15:0];
+	PERIPH_REG_AT_ARG_HI:
+	  fsmc_r_data = at_arg[31:16];
+	PERIPH_REG_AT_CMP_LO:
+	  fsmc_r_data = at_cmp[15:0];
+	PERIPH_REG_AT_CMP_HI:
+	  fsmc_r_data = at_cmp[31:16];
+	PERIPH_REG_AT_RESULT_LO:
+	  fsmc_r_data = at_result[15:0];
+	PERIPH_REG_AT_RESULT_HI:
+	  fsmc_r_data = at_result[31:16];
+	PERIPH_REG_RANGE_LEN_LO:
+	  fsmc_r_data = range_len[15:0];
+	PERIPH_REG_RANGE_LEN_HI:
+	  fsmc_r_data = {7'd0, range_len[24:16]};
+	PERIPH_REG_CRC_CTRL, PERIPH_REG_SCAN_CTRL:
+	  fsmc_r_data = {nm_busy, 15'd0};
+	PERIPH_REG_CRC_LO:
+	  fsmc_r_data = crc_q[15:0];
+	PERIPH_REG_CRC_HI:
+	  fsmc_r_data = crc_q[31:16];
+	PERIPH_REG_SUM_LO:
+	  fsmc_r_data = crc_sum[15:0];
+	PERIPH_REG_SUM_HI:
+	  fsmc_r_data = crc_sum[31:16];
+	PERIPH_REG_SCAN_KEY:
+	  fsmc_r_data = scan_key;
+	PERIPH_REG_SCAN_MASK:
+	  fsmc_r_data = scan_mask;
+	PERIPH_REG_SCAN_RESULT_LO:
+	  fsmc_r_data = scan_result[15:0];
+	PERIPH_REG_SCAN_RESULT_HI:
+	  fsmc_r_data = scan_result[31:16];
+	PERIPH_REG_SCAN_INDEX_LO:
+	  fsmc_r_data = scan_index[15:0];
+	PERIPH_REG_SCAN_INDEX_HI:
+	  fsmc_r_data = scan_index[31:16];
 	default:
 	  fsmc_r_data = 16'd0;
       endcase // case fsmc_r_adr
    end
 
-   assign cur_status_busy = (st_pending_write | st_doing_write |
-			       st_pending_read | st_doing_read);
+   // Busy while anything is outstanding, including queued writes, so that
+   // polling the busy bit after a write still waits for it to complete.
+   assign cur_status_busy = (!wq_empty | !rq_empty | st_finishing_write |
+			       st_pending_read | st_lookup | st_pending_fill |
+			       st_doing_read | burst_busy | pf_busy | bist_busy |
+			       cp_pending | at_pending | rdr_pending);
+   assign read_busy = st_pending_read | st_lookup | st_pending_fill |
+		      st_doing_read | burst_busy | bist_busy;
 
    // Decode write addresses.
    assign decode_adr_low = (fsmc_w_adr == PERIPH_REG_ADR_LOW);
    assign decode_adr_high = (fsmc_w_adr == PERIPH_REG_ADR_HIGH);
    assign decode_data = (fsmc_w_adr == PERIPH_REG_DATA);
+   assign decode_burst_len = (fsmc_w_adr == PERIPH_REG_BURST_LEN);
+   assign decode_burst_status = (fsmc_w_adr == PERIPH_REG_BURST_STATUS);
+   assign decode_burst_data = (fsmc_w_adr == PERIPH_REG_BURST_DATA);
+   assign decode_stream_adr = (fsmc_w_adr == PERIPH_REG_STREAM_ADR);
+   assign decode_data_stream = (fsmc_w_adr == PERIPH_REG_DATA_STREAM);
+   assign decode_win_base = (fsmc_w_adr == PERIPH_REG_WIN_BASE);
+   assign decode_cache_hits = (fsmc_w_adr == PERIPH_REG_CACHE_HITS);
+   assign decode_cache_misses = (fsmc_w_adr == PERIPH_REG_CACHE_MISSES);
+   assign decode_perf_sel = (fsmc_w_adr == PERIPH_REG_PERF_SEL);
+   assign decode_pwr_pd_idle = (fsmc_w_adr == PERIPH_REG_PWR_PD_IDLE);
+   assign decode_pwr_sr_idle = (fsmc_w_adr == PERIPH_REG_PWR_SR_IDLE);
+   assign decode_window_w = fsmc_w_adr[AW-1];
+   assign decode_adr32_lo = (fsmc_w_adr == PERIPH_REG_ADR32_LO);
+   assign decode_adr32_hi = (fsmc_w_adr == PERIPH_REG_ADR32_HI);
+   assign decode_data32 = (fsmc_w_adr == PERIPH_REG_DATA32_LO) |
+			  (fsmc_w_adr == PERIPH_REG_DATA32_HI);
+   assign read_data32 = (fsmc_r_adr == PERIPH_REG_DATA32_LO) |
+			(fsmc_r_adr == PERIPH_REG_DATA32_HI);
+   assign win_read = fsmc_r_adr[AW-1] | read_data32;
+   assign decode_bist_ctrl = (fsmc_w_adr == PERIPH_REG_BIST_CTRL);
+   assign decode_bist_fail_sel = (fsmc_w_adr == PERIPH_REG_BIST_FAIL_SEL);
+   assign decode_bist_len_lo = (fsmc_w_adr == PERIPH_REG_BIST_LEN_LO);
+   assign decode_bist_len_hi = (fsmc_w_adr == PERIPH_REG_BIST_LEN_HI);
+   assign decode_cp_fill = (fsmc_w_adr == PERIPH_REG_CP_FILL);
+   assign decode_cp_src_lo = (fsmc_w_adr == PERIPH_REG_CP_SRC_LO);
+   assign decode_cp_src_hi = (fsmc_w_adr == PERIPH_REG_CP_SRC_HI);
+   assign decode_cp_dst_lo = (fsmc_w_adr == PERIPH_REG_CP_DST_LO);
+   assign decode_cp_dst_hi = (fsmc_w_adr == PERIPH_REG_CP_DST_HI);
+   assign decode_cp_len_lo = (fsmc_w_adr == PERIPH_REG_CP_LEN_LO);
+   assign decode_cp_len_hi = (fsmc_w_adr == PERIPH_REG_CP_LEN_HI);
+   assign decode_cp_ctrl = (fsmc_w_adr == PERIPH_REG_CP_CTRL);
+   assign decode_cp_status = (fsmc_w_adr == PERIPH_REG_CP_STATUS);
+   assign decode_at_op = (fsmc_w_adr == PERIPH_REG_AT_OP);
+   assign decode_at_arg_lo = (fsmc_w_adr == PERIPH_REG_AT_ARG_LO);
+   assign decode_at_arg_hi = (fsmc_w_adr == PERIPH_REG_AT_ARG_HI);
+   assign decode_at_cmp_lo = (fsmc_w_adr == PERIPH_REG_AT_CMP_LO);
+   assign decode_at_cmp_hi = (fsmc_w_adr == PERIPH_REG_AT_CMP_HI);
+   assign decode_range_len_lo = (fsmc_w_adr == PERIPH_REG_RANGE_LEN_LO);
+   assign decode_range_len_hi = (fsmc_w_adr == PERIPH_REG_RANGE_LEN_HI);
+   assign decode_crc_ctrl = (fsmc_w_adr == PERIPH_REG_CRC_CTRL);
+   assign decode_scan_ctrl = (fsmc_w_adr == PERIPH_REG_SCAN_CTRL);
+   assign decode_scan_key = (fsmc_w_adr == PERIPH_REG_SCAN_KEY);
+   assign decode_scan_mask = (fsmc_w_adr == PERIPH_REG_SCAN_MASK);
+
+   // Writing burst status starts a burst, like a write to low address does
+   // for a single word: bits 15:1 are the low start address, bit 0 selects
+   // write (1) or read (0). Length is taken from the burst length register.
+   assign burst_start = fsmc_do_write & decode_burst_status & !cur_status_busy;
+
+   always @(posedge clk) begin
+      // The buffer holds 256 words; longer bursts are cut to that, which
+      // the MCU can see when reading the length back.
+      if (fsmc_do_write & decode_burst_len)
+	burst_len <= (fsmc_w_data > 256) ? 9'd256 : fsmc_w_data[8:0];
+
+      // Writing the length or starting a burst rewinds the FSMC side index.
+      if ((fsmc_do_write & decode_burst_len) | burst_start)
+	bbuf_idx <= 0;
+      else if ((fsmc_do_write & decode_burst_data) |
+	       (fsmc_r_taken & (fsmc_r_adr == PERIPH_REG_BURST_DATA)))
+	bbuf_idx <= bbuf_idx + 1;
+
+      if (burst_start)
+	bbuf_sd_idx <= 0;
+      else if (burst_busy & (burst_sd_rwn ? sdram_data_valid : sdram_data_next))
+	bbuf_sd_idx <= bbuf_sd_idx + 1;
+   end
 
    // Handle FSMC write, as well as updating cur_value from SDRAM read.
    always @(posedge clk) begin
       if (fsmc_do_write & decode_adr_low) begin
 	 cur_adr[14:0] <= fsmc_w_data[15:1];
-	 // Writes to low address triggers a read/write operation.
-	 if (!cur_status_busy) begin
+	 // Writes to low address triggers a read/write operation. Writes go
+	 // into the write queue (wq_push), reads are started here.
+	 if (!read_busy & !fsmc_w_data[0]) begin
 	    // Note: use newly written address low bits fsmc_w_data[15:1], not old!
-	    sdram_i_addr <= {27{cur_adr[26:15], fsmc_w_data[15:1]}};
-	 if (fsmc_w_data[0]) begin
-	       // Start a write.
-	       sdram_rwn <= 0;
-	       sdram_data_in <= cur_value;
-	    end else begin
-	       // Start a read.
-	       sdram_rwn <= 1;
-	    end
+	    sdram_i_addr <= {cur_adr[26:15], fsmc_w_data[15:1]};
 	 end
       end
+      if (win_pending & !read_busy)
+	sdram_i_addr <= {3'b000, win_rd_adr};
 
       if (fsmc_do_write & decode_adr_high)
 	 cur_adr[26:15] <= fsmc_w_data[11:0];
 
-      if (fsmc_do_write & decode_data)
-	cur_value <= fsmc_w_data[15:0];
-      else if (st_doing_read & sdram_data_valid)
-	 cur_value <= sdram_data_out;
+      // 32-bit accesses. The FSMC splits them into two 16-bit accesses, low
+      // half first. An address write only takes effect with the high half,
+      // so the address is never seen half updated, and does not trigger an
+      // operation. Data accesses transfer the word at the address with the
+      // low half and the next word with the high half, then advance the
+      // address by the two words.
+      if (fsmc_do_write & decode_adr32_lo)
+	adr32_lo <= fsmc_w_data[15:1];
+      if (fsmc_do_write & decode_adr32_hi)
+	cur_adr <= {fsmc_w_data[11:0], adr32_lo};
+      if ((fsmc_do_write & (fsmc_w_adr == PERIPH_REG_DATA32_HI)) |
+	  (fsmc_r_taken & (fsmc_r_adr == PERIPH_REG_DATA32_HI)))
+	cur_adr <= cur_adr + 2;
+
+      // A byte store to the data register only sets that byte, and the
+      // write triggered from it then only writes that byte.
+      if (fsmc_do_write & decode_data) begin
+	 if (!fsmc_w_nbl[0])
+	   cur_value[7:0] <= fsmc_w_data[7:0];
+	 if (!fsmc_w_nbl[1])
+	   cur_value[15:8] <= fsmc_w_data[15:8];
+	 cur_nbl <= fsmc_w_nbl;
+      end else if (rd_done & !read_to_win) begin
+	 cur_value <= rd_data;
+	 cur_nbl <= 2'b00;
+      end
    end
 
    assign sdram_idle = sdram_init_done & !sdram_busy;
+   // The burst and prefetch engines may present their next read while the
+   // controller is still in the CAS latency of the previous one; a page hit
+   // is then issued without an idle cycle in between, so back-to-back row
+   // chunks run with only the CAS latency as gap.
+   assign sdram_ready = sdram_init_done & (!sdram_busy | sdram_pipe_ready);
 
    // Handle address valid (sdram_adv) assertion - this is what starts
    // a request towards the sdram controller.
-   // The sdram_adv signal is asserted the cycle after a read/write request
-   // from the STM32 has arrived and the sdram controller is idle. It remains
-   // asserted until acknowledged by the sdram controller.
-   // ToDo: could maybe assert adv already when setting _pending, to
-   // allow back-to-back operation and save one clockcycle?
+   // The sdram_adv signal is asserted the cycle after a request has been
+   // pushed into the request queue or is waiting there, and the sdram
+   // controller is ready. It remains asserted until acknowledged by the
+   // sdram controller, when the request is popped. If another one follows,
+   // it is presented in the next clock, which after a read is still in its
+   // CAS latency, so that a page-hit read is issued there; anything else
+   // waits in the controller.
+   assign rq_pop = sdram_adv & sdram_ack;
+   assign rq_more = (rq_level > 2'd1) | rq_push;
    always @(posedge clk) begin
-      if ((st_pending_read | st_pending_write) & sdram_idle)
+      if (rq_pop)
+	sdram_adv <= rq_more;
+      else if ((!rq_empty | rq_push) & sdram_ready)
 	sdram_adv <= 1;
-      else if ((st_doing_read | st_doing_write) & sdram_ack)
-	sdram_adv <= 0;
    end
 
+   // Write is triggered by writing a 1 to the low bit of address. It is
+   // queued; while the queue is full, the FSMC write is stalled with NWAIT
+   // (fsmc_wr_wait), so the push below always succeeds. A queued write
+   // moves on into the request queue while that has room, so the next one
+   // is at the head of the write queue, for the look-ahead hint, by the
+   // time the controller takes the current one.
+   assign wq_push = fsmc_do_write &
+		    ((decode_adr_low & fsmc_w_data[0]) | decode_data_stream |
+		     decode_window_w | decode_data32) &
+		    !wq_full & !read_busy;
+   assign wq_w_entry =
+     decode_window_w ? {win_base, fsmc_w_adr[6:0], fsmc_w_nbl, fsmc_w_data} :
+     decode_data_stream ? {stream_adr, fsmc_w_nbl, fsmc_w_data} :
+     decode_data32 ? {cur_adr[23:0] + {23'd0, fsmc_w_adr[0]}, fsmc_w_nbl,
+		      fsmc_w_data} :
+     {cur_adr[23:15], fsmc_w_data[15:1], cur_nbl, cur_value};
+   assign wq_pop = !wq_empty & !wq_fresh & !rq_full & !st_pending_fill &
+		   !pf_busy & !cp_busy & !at_busy & !rdr_busy;
+   assign fill_go = (st_pending_fill | (st_lookup & !cache_hit)) & !rq_full;
+   assign rq_push = wq_pop | fill_go;
+
    // State changes.
    always @(posedge clk) begin
-      // Write is triggered by writing a 1 to the low bit of address.
-      if (fsmc_do_write & decode_adr_low & !cur_status_busy & fsmc_w_data[0])
-	st_pending_write <= 1;
-      else if (st_pending_write & sdram_idle)
-	st_pending_write <= 0;
-
-      // Read is triggered by writing a 0 to the low bit of address.
-      if (fsmc_do_write & decode_adr_low & !cur_status_busy & !fsmc_w_data[0])
-	st_pending_read <= 1;
-      else if (st_pending_read & sdram_idle)
+      // The block RAM output follows a pop or a push into the empty queue
+      // a clock later.
+      wq_fresh <= wq_pop | (wq_push & wq_empty);
+
+      // Read is triggered by writing a 0 to the low bit of address, or by
+      // an FSMC read in the window. It is started once the write queue is
+      // empty, as a cache lookup.
+      if ((fsmc_do_write & decode_adr_low & !read_busy & !fsmc_w_data[0]) |
+	  (win_pending & !read_busy)) begin
+	 st_pending_read <= 1;
+	 rd_result_pending <= 1;
+      end else if (rd_go)
 	st_pending_read <= 0;
+      if (rd_done)
+	rd_result_pending <= 0;
+
+      st_lookup <= rd_go;
 
-      if (st_pending_read & sdram_idle)
+      // A line fill is queued behind the writes still in the request queue.
+      // Only the fill returns read data while the single-word path has the
+      // controller, so the line is counted from its data from here on.
+      if (st_lookup & !cache_hit & rq_full)
+	st_pending_fill <= 1;
+      else if (fill_go)
+	st_pending_fill <= 0;
+
+      if (fill_go)
 	st_doing_read <= 1;
-      else if (st_doing_read & sdram_data_valid)
+      else if (st_doing_read & sdram_data_valid & (fill_cnt == 4'hf))
 	st_doing_read <= 0;
 
-      if (st_pending_write & sdram_idle)
-	st_doing_write <= 1;
-      else if (st_doing_write & sdram_write_done) begin
-	st_doing_write <= 0;
-      end
-      // Maybe could use sdram_ack instead of sdram_write_done, but let's keep
-      // things simple for now. A better write optimisation would anyway be
-      // to have a write queue.
+      // The engines wait for sdram_write_done of their own writes, so they
+      // must not start before that of the last queued write has passed.
+      if (rq_pop & !rq_rwn)
+	st_finishing_write <= 1;
+      else if (sdram_write_done)
+	st_finishing_write <= 0;
    end
 
 endmodule
@@ -0,0 +1,122 @@
+/*
+  Atomic read-modify-write of a 16- or 32-bit SDRAM word.
+
+  start latches an operation: op on the word at word address adr (two
+  words, low half first, with size32), with operand arg and, for
+  compare-and-swap, cmp. It is pending until done; once go allows, the
+  word is read with one request and the new value written back with the
+  next, while owning the controller (busy) so nothing else can get in
+  between. The controller leaves the row open after the read, so unless a
+  refresh comes in between, the write needs no activate. result is the old
+  value, valid when pending has dropped. inv pulses when the write starts,
+  for the read cache.
+
+  OP_CAS writes arg only if the old value equals cmp; otherwise there is
+  no write.
+*/
+module sdram_atomic
+   (input clk,
+    input 		  start, input wire[2:0] op, input size32,
+    input wire[23:0] 	  adr, input wire[31:0] arg, input wire[31:0] cmp,
+    input 		  go, output wire pending, output busy,
+    output reg[31:0] 	  result, output inv, output wire[23:0] inv_adr,
+    // Towards sdram controller.
+    output wire[23:0] 	  sd_adr, output wire sd_rwn,
+    output wire[9:0] 	  sd_len, output wire sd_adv,
+    output wire[23:0] 	  next_adr, output reg[15:0] wdata,
+    input 		  sd_ready, input sd_ack,
+    input 		  sd_data_valid, input wire[15:0] sd_data,
+    input 		  sd_data_next, input sd_write_done);
+
+   localparam OP_ADD = 3'd0, OP_SWAP = 3'd1, OP_CAS = 3'd2, OP_AND = 3'd3,
+     OP_OR = 3'd4, OP_XOR = 3'd5;
+
+   reg [2:0] op_r;
+   reg size32_r;
+   reg [23:0] adr_r;
+   reg [31:0] arg_r, cmp_r;
+   reg [31:0] nv;		// New value
+   reg pend = 0;
+   reg st_read = 0, st_write = 0;
+   reg b_start = 0, b_rwn;
+   reg w_idx;			// Word of nv to write next
+   reg r_idx;			// Word of result read next
+   wire b_busy;
+   wire [1:0] b_count_unused;
+   wire [31:0] old, sum, alu;
+   wire match;
+
+   sdram_burst #(.LENW(2))
+     atomic_burst(clk,
+		  b_start, b_rwn, adr_r, {size32_r, !size32_r}, adr_r,
+		  b_busy, b_count_unused,
+		  sd_adr, sd_rwn, sd_len, sd_adv, next_adr,
+		  sd_ready, sd_ack, sd_data_valid, sd_write_done);
+
+   assign pending = pend;
+   assign busy = st_read | st_write;
+   assign inv = b_start & !b_rwn;
+   assign inv_adr = adr_r;
+
+   // The 16-bit operations use the low half.
+   assign old = size32_r ? result : {16'h0000, result[15:0]};
+   assign sum = old + arg_r;
+   assign match = size32_r ? (old == cmp_r) : (old[15:0] == cmp_r[15:0]);
+   assign alu = (op_r == OP_ADD) ? sum :
+		(op_r == OP_SWAP) ? arg_r :
+		(op_r == OP_CAS) ? arg_r :
+		(op_r == OP_AND) ? (old & arg_r) :
+		(op_r == OP_OR) ? (old | arg_r) :
+		(old ^ arg_r);
+
+   always @(posedge clk) begin
+      b_start <= 0;
+
+      if (start & !pend) begin
+	 op_r <= op;
+	 size32_r <= size32;
+	 adr_r <= adr;
+	 arg_r <= arg;
+	 cmp_r <= cmp;
+	 pend <= 1;
+      end
+
+      if (pend & !busy & !b_start & go) begin
+	 b_rwn <= 1;
+	 b_start <= 1;
+	 r_idx <= 0;
+	 result <= 0;
+	 st_read <= 1;
+      end
+
+      if (st_read & sd_data_valid) begin
+	 if (r_idx)
+	   result[31:16] <= sd_data;
+	 else
+	   result[15:0] <= sd_data;
+	 r_idx <= 1;
+      end
+
+      // The read is complete; write back, right after it.
+      if (st_read & !b_start & !b_busy) begin
+	 st_read <= 0;
+	 nv <= alu;
+	 w_idx <= 0;
+	 if (op_r != OP_CAS || match) begin
+	    b_rwn <= 0;
+	    b_start <= 1;
+	    st_write <= 1;
+	 end else
+	   pend <= 0;
+      end
+
+      // The controller takes each word the cycle after sd_data_next.
+      wdata <= w_idx ? nv[31:16] : nv[15:0];
+      if (st_write & sd_data_next)
+	w_idx <= 1;
+      if (st_write & !b_start & !b_busy) begin
+	 st_write <= 0;
+	 pend <= 0;
+      end
+   end
+endmodule
@@ -0,0 +1,241 @@
+/*
+  Built-in self-test of the SDRAM, at burst rate.
+
+  start runs the test selected by pat over len words from word address adr.
+  A test is a sequence of elements; each element writes the pattern to the
+  range, reads it back and checks it, or both. The SDRAM side goes through
+  an sdram_burst engine and connects to the controller like the other
+  multi-word clients. wdata is the write data; like the block RAM output
+  of the burst buffer, it is registered, as the controller takes the word
+  in the cycle after sd_data_next.
+
+  Patterns (seed varies them between runs):
+    PAT_ADDR   each word holds its own address, low 16 bits xor bits 23:16
+               in the high byte, xor {seed, seed}. Finds any single
+               address line fault: two addresses that differ in one bit
+               get patterns that differ in one bit. (Not all aliases are
+               found; no 16-bit pattern can tell all 24-bit addresses
+               apart.)
+    PAT_LFSR   pseudo-random words from a 32-bit LFSR seeded from seed.
+    PAT_WALK   a single one bit, at position (address + seed[3:0]) mod 16;
+               seed[4] inverts it (walking zeros). Every data line is
+               toggled against all the others.
+    PAT_MARCH  March C- with background {seed, seed}:
+               up(w0); up(r0,w1); up(r1,w0); down(r0,w1); down(r1,w0); r0.
+               To keep bursts, each (r,w) element is done per block of
+               MARCH_BLOCK words: the block is read and checked, then
+               written, blocks in ascending or descending address order.
+  The first three are one write and one read pass over the whole range.
+
+  Every mismatching word counts in errors, its bit differences are or'ed
+  into fail_mask, and the addresses of the first NFAIL are recorded:
+  nfail is how many, fail_adr is the one selected by fail_sel. All are
+  cleared at start, and valid when busy has dropped.
+*/
+module sdram_bist #(parameter NFAIL=8, LENW=25)
+   (input clk,
+    // Control and results.
+    input 		  start, input wire[1:0] pat, input wire[7:0] seed,
+    input wire[23:0] 	  adr, input wire[LENW-1:0] len,
+    output 		  busy,
+    output reg[31:0] 	  errors, output reg[15:0] fail_mask,
+    output reg[3:0] 	  nfail,
+    input wire[2:0] 	  fail_sel, output wire[23:0] fail_adr,
+    // Towards sdram controller.
+    output wire[23:0] 	  sd_adr, output wire sd_rwn,
+    output wire[9:0] 	  sd_len, output wire sd_adv,
+    output wire[23:0] 	  next_adr, output reg[15:0] wdata,
+    input 		  sd_ready, input sd_ack,
+    input 		  sd_data_valid, input wire[15:0] sd_data,
+    input 		  sd_data_next, input sd_write_done);
+
+   localparam PAT_ADDR = 2'd0, PAT_LFSR = 2'd1, PAT_WALK = 2'd2,
+     PAT_MARCH = 2'd3;
+   localparam [LENW-1:0] MARCH_BLOCK = 256;
+
+   // Next LFSR state, 16 steps of x^32+x^22+x^2+x+1, so that each word
+   // gets 16 new bits.
+   function [31:0] lfsr_next(input [31:0] s);
+      integer k;
+      begin
+	 lfsr_next = s;
+	 for (k = 0; k < 16; k = k + 1)
+	   lfsr_next = lfsr_next[0] ? (lfsr_next >> 1) ^ 32'h80200003 :
+		       (lfsr_next >> 1);
+      end
+   endfunction
+
+   // Expected data of the word at a; l is the LFSR state for this word,
+   // inv selects the complement of the March background.
+   function [15:0] pattern(input [1:0] p, input [7:0] sd, input [23:0] a,
+			   input [31:0] l, input inv);
+      reg [3:0] sh;
+      begin
+	 sh = a[3:0] + sd[3:0];
+	 case (p)
+	   PAT_ADDR: pattern = a[15:0] ^ {a[23:16], 8'h00} ^ {sd, sd};
+	   PAT_LFSR: pattern = l[15:0];
+	   PAT_WALK: pattern = (16'h0001 << sh) ^ {16{sd[4]}};
+	   default: pattern = {sd, sd} ^ {16{inv}};
+	 endcase
+      end
+   endfunction
+
+   // States for one-hot state machine.
+   reg st_idle=1, st_elem=0, st_chunk=0, st_read=0, st_write=0;
+   reg [1:0] pat_r;
+   reg [7:0] seed_r;
+   reg [23:0] base;
+   reg [LENW-1:0] len_r;
+   reg [LENW-1:0] left;		// Words of the element not yet done
+   reg [23:0] c_adr;		// Current block
+   reg [LENW-1:0] c_len;
+   reg [23:0] wr_adr, rd_adr;	// Address of next word written / read
+   reg [31:0] wr_lfsr, rd_lfsr;
+   reg b_start = 0, b_rwn;
+   wire b_busy;
+   wire [LENW-1:0] b_count_unused;
+   wire [LENW-1:0] blk;		// Length of next block
+   wire [23:0] blk_adr;		// Start of next block
+   wire [23:0] after_adr;	// Start of the burst after this one
+   wire nxt_down;		// Next element is descending
+   wire [23:0] top_adr;		// First block of a descending element
+   // Check pipeline.
+   reg c1_valid = 0;
+   reg [15:0] c1_got, c1_exp;
+   reg [23:0] c1_adr;
+   reg [23:0] fails[0:NFAIL-1];
+
+   // Elements of the current test:
+   // {last, read, read inverted, write, write inverted, descending}.
+   reg [2:0] elem;
+   reg [5:0] el;
+   wire el_last, el_rd, el_rd_inv, el_wr, el_wr_inv, el_down;
+
+   always @(*) begin
+      if (pat_r != PAT_MARCH)
+	el = (elem == 0) ? 6'b000100 : 6'b110000;
+      else
+	case (elem)
+	  0: el = 6'b000100;
+	  1: el = 6'b010110;
+	  2: el = 6'b011100;
+	  3: el = 6'b010111;
+	  4: el = 6'b011101;
+	  default: el = 6'b110000;
+	endcase
+   end
+
+   assign {el_last, el_rd, el_rd_inv, el_wr, el_wr_inv, el_down} = el;
+
+   sdram_burst #(.LENW(LENW))
+     bist_burst(clk,
+		b_start, b_rwn, c_adr, c_len, after_adr,
+		b_busy, b_count_unused,
+		sd_adr, sd_rwn, sd_len, sd_adv, next_adr,
+		sd_ready, sd_ack, sd_data_valid, sd_write_done);
+
+   assign busy = ~st_idle | c1_valid;
+   assign blk = (pat_r == PAT_MARCH && left > MARCH_BLOCK) ? MARCH_BLOCK : left;
+   assign blk_adr = el_down ? base + left[23:0] - blk[23:0] :
+		    base + len_r[23:0] - left[23:0];
+   assign fail_adr = fails[fail_sel];
+   // A block's read is followed by its write, if the element has one, and
+   // then the next block, or the first block of the next element (the two
+   // descending March elements follow elements 2 and 3).
+   assign nxt_down = (pat_r == PAT_MARCH) & ((elem == 2) | (elem == 3));
+   assign top_adr = base + len_r[23:0] -
+		    ((len_r > MARCH_BLOCK) ? MARCH_BLOCK[23:0] : len_r[23:0]);
+   assign after_adr = (st_read & el_wr) ? c_adr :
+		      (left != 0) ? blk_adr :
+		      nxt_down ? top_adr : base;
+
+   always @(posedge clk) begin
+      b_start <= 0;
+
+      if (st_idle & start) begin
+	 pat_r <= pat;
+	 seed_r <= seed;
+	 base <= adr;
+	 len_r <= len;
+	 elem <= 0;
+	 errors <= 0;
+	 fail_mask <= 0;
+	 nfail <= 0;
+	 st_idle <= 0;
+	 st_elem <= 1;
+      end
+
+      if (st_elem) begin
+	 left <= len_r;
+	 wr_lfsr <= {seed_r, 8'h5a, ~seed_r, 8'ha5};
+	 rd_lfsr <= {seed_r, 8'h5a, ~seed_r, 8'ha5};
+	 st_elem <= 0;
+	 st_chunk <= 1;
+      end
+
+      // Start the next block of the element: a read, followed by a write
+      // when the element has both.
+      if (st_chunk) begin
+	 st_chunk <= 0;
+	 if (left == 0) begin
+	    if (el_last)
+	      st_idle <= 1;
+	    else begin
+	       elem <= elem + 1;
+	       st_elem <= 1;
+	    end
+	 end else begin
+	    c_adr <= blk_adr;
+	    c_len <= blk;
+	    left <= left - blk;
+	    rd_adr <= blk_adr;
+	    wr_adr <= blk_adr;
+	    b_rwn <= el_rd;
+	    b_start <= 1;
+	    if (el_rd)
+	      st_read <= 1;
+	    else
+	      st_write <= 1;
+	 end
+      end
+
+      if (st_read & !b_start & !b_busy) begin
+	 st_read <= 0;
+	 if (el_wr) begin
+	    b_rwn <= 0;
+	    b_start <= 1;
+	    st_write <= 1;
+	 end else
+	   st_chunk <= 1;
+      end
+      if (st_write & !b_start & !b_busy) begin
+	 st_write <= 0;
+	 st_chunk <= 1;
+      end
+
+      wdata <= pattern(pat_r, seed_r, wr_adr, wr_lfsr, el_wr_inv);
+      if (st_write & sd_data_next) begin
+	 wr_adr <= wr_adr + 1;
+	 wr_lfsr <= lfsr_next(wr_lfsr);
+      end
+
+      // Check read data, one pipeline stage after it arrives.
+      c1_valid <= st_read & sd_data_valid;
+      if (st_read & sd_data_valid) begin
+	 c1_got <= sd_data;
+	 c1_exp <= pattern(pat_r, seed_r, rd_adr, rd_lfsr, el_rd_inv);
+	 c1_adr <= rd_adr;
+	 rd_adr <= rd_adr + 1;
+	 rd_lfsr <= lfsr_next(rd_lfsr);
+      end
+      if (c1_valid & (c1_got != c1_exp)) begin
+	 errors <= errors + 1;
+	 fail_mask <= fail_mask | (c1_got ^ c1_exp);
+	 if (nfail < NFAIL) begin
+	    fails[nfail[2:0]] <= c1_adr;
+	    nfail <= nfail + 1;
+	 end
+      end
+   end
+endmodule
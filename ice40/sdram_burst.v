@@ -0,0 +1,107 @@
+/*
+  Multi-word transfer engine in front of the sdram controller.
+
+  A client starts a transfer of `len' words at word address `adr'. The
+  transfer is split at row boundaries into one controller request per row
+  (the controller streams one column per clock within the open row). Read
+  data arrives on the controller's o_data_valid/o_data, and write data is
+  taken from the controller's i_data on o_data_next; the client connects to
+  those directly while `busy' is asserted.
+
+  Read requests are pipelined: as soon as the controller has acknowledged
+  one chunk, the next one is presented, while sd_ready says the controller
+  can take it (idle, or in the CAS latency of the previous read), so the
+  controller can issue it without waiting for the data of the previous one.
+  next_adr is the address of the controller request after the current one,
+  as a hint for the controller's bank look-ahead: the next chunk, or
+  after_adr during the last one, where the client says what it does next.
+*/
+module sdram_burst #(parameter LENW=24, COLW=9)
+   (input clk,
+    // Client side.
+    input 		  start, input rwn,
+    input wire[23:0] 	  adr, input wire[LENW-1:0] len,
+    input wire[23:0] 	  after_adr,
+    output 		  busy, output reg[LENW-1:0] count,
+    // Towards sdram controller.
+    output reg[23:0] 	  sd_adr, output reg sd_rwn,
+    output reg[COLW:0] 	  sd_len, output reg sd_adv,
+    output wire[23:0] 	  next_adr,
+    input 		  sd_ready, input sd_ack,
+    input 		  sd_data_valid, input sd_write_done);
+
+   // States for one-hot state machine.
+   reg st_idle=1, st_next=0, st_pending=0, st_doing=0;
+   reg[23:0] cur_adr;		// Start of next row-sized chunk
+   reg[LENW-1:0] left;		// Words not yet requested
+   reg[LENW-1:0] rd_left = 0;	// Read words still to arrive
+   reg[LENW-1:0] req_len;	// Length of the request to the controller
+   wire[COLW:0] room;		// Words from cur_adr to end of its row
+   // left and room zero-extended to a common width, and the smaller one.
+   wire[LENW+COLW:0] left_x, room_x, chunk_x;
+   wire[COLW:0] chunk;
+
+   assign room = (1 << COLW) - {1'b0, cur_adr[COLW-1:0]};
+   assign left_x = {{COLW+1{1'b0}}, left};
+   assign room_x = {{LENW{1'b0}}, room};
+   assign chunk_x = (left_x < room_x) ? left_x : room_x;
+   assign chunk = chunk_x[COLW:0];
+   assign busy = ~st_idle | (rd_left != 0);
+   assign next_adr = (left != 0) ? cur_adr : after_adr;
+
+   always @(posedge clk) begin
+      if (~busy & start) begin
+	 cur_adr <= adr;
+	 left <= len;
+	 rd_left <= rwn ? len : 0;
+	 count <= 0;
+	 sd_rwn <= rwn;
+	 st_idle <= 0;
+	 st_next <= 1;
+      end
+
+      // Set up the request for the next chunk, or finish. The request goes
+      // out at once if the controller can take it.
+      if (st_next) begin
+	 st_next <= 0;
+	 if (left == 0)
+	   st_idle <= 1;
+	 else begin
+	    sd_adr <= cur_adr;
+	    sd_len <= chunk;
+	    req_len <= chunk_x[LENW-1:0];
+	    cur_adr <= cur_adr + {{23-COLW{1'b0}}, chunk};
+	    left <= left - chunk_x[LENW-1:0];
+	    if (sd_ready) begin
+	       sd_adv <= 1;
+	       st_doing <= 1;
+	    end else
+	      st_pending <= 1;
+	 end
+      end
+
+      // Same handshake with the controller as for single-word accesses in top.
+      if (st_pending & sd_ready) begin
+	 sd_adv <= 1;
+	 st_pending <= 0;
+	 st_doing <= 1;
+      end else if (st_doing & sd_ack) begin
+	 sd_adv <= 0;
+	 // The read data follows by itself; go on with the next chunk.
+	 if (sd_rwn) begin
+	    st_doing <= 0;
+	    st_next <= 1;
+	 end
+      end
+
+      if (sd_rwn & (rd_left != 0) & sd_data_valid) begin
+	 count <= count + 1;
+	 rd_left <= rd_left - 1;
+      end
+      if (st_doing & ~sd_rwn & sd_write_done) begin
+	 count <= count + req_len;
+	 st_doing <= 0;
+	 st_next <= 1;
+      end
+   end
+endmodule
@@ -69,6 +69,10 @@ module sdram_control_fsm (
                           i_disable_precharge, // Disable precharge, keep open for next read/write
                           i_precharge_req,
                           i_power_down,
+                          i_next_addr, // Address of the next request, for bank look-ahead
+                          i_next_valid,
+                          i_burst_len, // Number of words (columns) to read/write, within one row
+                          i_dqm,       // Byte mask for the write data on i_data, 1 = not written
                           o_ack,
                           o_autoref_ack,
                           o_busy,
@@ -86,7 +90,10 @@ module sdram_control_fsm (
                           i_sdram_dq,
                           o_sdram_dqm,       // sdr data
                           o_write_done,      // Write to SDRAM is completed
-                          o_read_done        // Read from SDRAM is completed
+                          o_read_done,       // Read from SDRAM is completed
+                          o_data_next,       // Write data consumed, present next word on i_data
+                          o_pipe_ready,      // Next request may be presented already
+                          o_power_state      // Power-down / self-refresh, see below
                           );
 
 `include "sdram_defines.v"
@@ -110,11 +117,12 @@ module sdram_control_fsm (
     parameter NUM_CLK_WAIT = 1;
     parameter NUM_CLK_SELFREFRESH2ACTIVE = 5;
     parameter NUM_CLK_WRITE_RECOVERY_DELAY = 2;
+    parameter NUM_CLK_ACTIVE2PRECHARGE = 4;
     parameter MODEREG_BURST_LENGTH = 3'b010;
     parameter SDRAM_BURST_PAGE = 3'b111;
     parameter MODEREG_WRITE_BURST_MODE = 1'b0;
     parameter MODEREG_OPERATION_MODE = 2'b00;
-    parameter MODEREG_CAS_LATENCY = 2;
+    parameter [2:0] MODEREG_CAS_LATENCY = 2;
     parameter MODEREG_BURST_TYPE = 1'b0;   
    
     
@@ -136,6 +144,10 @@ module sdram_control_fsm (
     input        i_precharge_req;
     input        i_power_down;   
     input [ROWADDR_MSB:COLADDR_LSB] i_addr;
+    input [ROWADDR_MSB:COLADDR_LSB] i_next_addr;
+    input                           i_next_valid;
+    input [SDRAM_COL_WIDTH:0]       i_burst_len;
+    input [SDRAM_DQM_WIDTH-1:0]     i_dqm;
 
     
     /*******************************************************************************
@@ -159,6 +171,9 @@ module sdram_control_fsm (
 
     output                           o_write_done;
     output                           o_read_done;
+    output                           o_data_next;
+    output                           o_pipe_ready;
+    output [1:0]                     o_power_state;
    
    
 
@@ -198,7 +213,190 @@ module sdram_control_fsm (
     reg                             read_done_i;    
     
 
-    assign o_sdram_dqm = {`SDRAM_DQM_LEN{sdram_dqm_i}};
+    /*******************************************************************************
+     * Byte writes. The WRITE command is on the SDRAM pins the cycle after the
+     * WRITE state, together with its data on i_data, and DQM has no latency for
+     * writes, so i_dqm is applied combinationally in that cycle. The client
+     * presents i_dqm along with i_data.
+     ******************************************************************************/
+    reg                             write_cmd_i;
+
+    always @(posedge i_clk or posedge i_rst)
+        if (i_rst)
+            write_cmd_i <= #WIREDLY 0;
+        else
+            write_cmd_i <= #WIREDLY (cmd_fsm_states_i == CMD_STATE_WRITE_BURST) ||
+                                    (cmd_fsm_states_i == CMD_STATE_WRITE_AUTOPRECHARGE);
+
+    assign o_sdram_dqm = {`SDRAM_DQM_LEN{sdram_dqm_i}} |
+                         (write_cmd_i ? i_dqm : {SDRAM_DQM_WIDTH{1'b0}});
+    
+    
+    /*******************************************************************************
+     * Open row tracking. When i_disable_precharge is asserted, reads and writes
+     * are issued without auto-precharge and the row is left open. The row open
+     * in each bank is remembered here, so that an access to an already open row
+     * (page hit) can skip the ACTIVE, and an access to another row in the same
+     * bank (page miss) only needs to precharge that one bank first.
+     ******************************************************************************/
+    wire [SDRAM_BLKADR_WIDTH-1:0]   req_bank_i;
+    wire [SDRAM_ROW_WIDTH-1:0]      req_row_i;
+    reg [SDRAM_ROW_WIDTH-1:0]       open_row_i [0:(1<<SDRAM_BLKADR_WIDTH)-1];
+    reg [(1<<SDRAM_BLKADR_WIDTH)-1:0] row_open_i;
+    wire                            page_hit_i;
+    wire                            page_miss_i;
+    reg [(1<<SDRAM_BLKADR_WIDTH)-1:0] precharge_ok_i; // tRAS and tWR met, per bank
+
+    assign req_bank_i = i_addr[BLKADDR_MSB:BLKADDR_LSB];
+    assign req_row_i = i_addr[ROWADDR_MSB:ROWADDR_LSB];
+    assign page_hit_i = row_open_i[req_bank_i] && (open_row_i[req_bank_i] == req_row_i);
+    assign page_miss_i = row_open_i[req_bank_i] && (open_row_i[req_bank_i] != req_row_i);
+
+    /*******************************************************************************
+     * Bank look-ahead. The command bus is idle in the first cycle of the CAS
+     * latency of a read and of the data phase of a write. If the next request
+     * (i_next_addr) is for another bank, use that slot to prepare its bank:
+     * ACTIVE the row if the bank is idle, or PRECHARGE the bank if a different row
+     * is open there. This overlaps tRCD/tRP of the next request with the current
+     * one. Only done when the remaining cycles of the current access cover tRCD
+     * and tRP for the given timing parameters.
+     ******************************************************************************/
+    parameter LOOKAHEAD_READ_OK  = (NUM_CLK_CL + 2 > NUM_CLK_ACTIVE2RW_DELAY) &&
+                                   (NUM_CLK_CL + 2 > NUM_CLK_PRECHARGE_PERIOD);
+    parameter LOOKAHEAD_WRITE_OK = (NUM_CLK_WAIT + 3 > NUM_CLK_ACTIVE2RW_DELAY) &&
+                                   (NUM_CLK_WAIT + 3 > NUM_CLK_PRECHARGE_PERIOD);
+
+    wire [SDRAM_BLKADR_WIDTH-1:0]   next_bank_i;
+    wire [SDRAM_ROW_WIDTH-1:0]      next_row_i;
+    wire                            lookahead_slot_i;
+    wire                            lookahead_act_i;
+    wire                            lookahead_pre_i;
+
+    assign next_bank_i = i_next_addr[BLKADDR_MSB:BLKADDR_LSB];
+    assign next_row_i = i_next_addr[ROWADDR_MSB:ROWADDR_LSB];
+    assign lookahead_slot_i = i_disable_precharge && i_next_valid &&
+                              (next_bank_i != req_bank_i) && (clk_count_i == 1) &&
+                              ((LOOKAHEAD_READ_OK && cmd_fsm_states_i == CMD_STATE_CAS_LATENCY) ||
+                               (LOOKAHEAD_WRITE_OK && cmd_fsm_states_i == CMD_STATE_WRITE_DATA));
+    assign lookahead_act_i = lookahead_slot_i && !row_open_i[next_bank_i];
+    assign lookahead_pre_i = lookahead_slot_i && row_open_i[next_bank_i] &&
+                             (open_row_i[next_bank_i] != next_row_i) &&
+                             precharge_ok_i[next_bank_i];
+
+    /*******************************************************************************
+     * Per-bank precharge timing. A bank may only be precharged tRAS after its
+     * ACTIVE and tWR after its last WRITE. Each bank has a counter for both,
+     * loaded when the command is issued and counting down to 0. PRECHARGE_BANK,
+     * PRECHARGE_ALL and the look-ahead precharge wait until they have expired.
+     ******************************************************************************/
+    reg [4*(1<<SDRAM_BLKADR_WIDTH)-1:0] ras_count_i;
+    reg [4*(1<<SDRAM_BLKADR_WIDTH)-1:0] wr_count_i;
+    wire                            write_issue_i;
+    integer                         bank_i;
+
+    assign write_issue_i = (cmd_fsm_states_i == CMD_STATE_WRITE_BURST) ||
+                           (cmd_fsm_states_i == CMD_STATE_WRITE_AUTOPRECHARGE);
+
+    always @(posedge i_clk or posedge i_rst)
+        if (i_rst) begin
+            ras_count_i <= #WIREDLY 0;
+            wr_count_i <= #WIREDLY 0;
+        end else
+            for (bank_i = 0; bank_i < (1<<SDRAM_BLKADR_WIDTH); bank_i = bank_i + 1) begin
+                if ((cmd_fsm_states_i == CMD_STATE_ACTIVE &&
+                     req_bank_i == bank_i[SDRAM_BLKADR_WIDTH-1:0]) ||
+                    (lookahead_act_i && next_bank_i == bank_i[SDRAM_BLKADR_WIDTH-1:0]))
+                    ras_count_i[4*bank_i +: 4] <= #WIREDLY NUM_CLK_ACTIVE2PRECHARGE - 1;
+                else if (ras_count_i[4*bank_i +: 4] != 0)
+                    ras_count_i[4*bank_i +: 4] <= #WIREDLY ras_count_i[4*bank_i +: 4] - 1;
+                if (write_issue_i && req_bank_i == bank_i[SDRAM_BLKADR_WIDTH-1:0])
+                    wr_count_i[4*bank_i +: 4] <= #WIREDLY NUM_CLK_WRITE_RECOVERY_DELAY - 1;
+                else if (wr_count_i[4*bank_i +: 4] != 0)
+                    wr_count_i[4*bank_i +: 4] <= #WIREDLY wr_count_i[4*bank_i +: 4] - 1;
+            end
+
+    always @(*)
+        for (bank_i = 0; bank_i < (1<<SDRAM_BLKADR_WIDTH); bank_i = bank_i + 1)
+            precharge_ok_i[bank_i] = (ras_count_i[4*bank_i +: 4] == 0) &&
+                                     (wr_count_i[4*bank_i +: 4] == 0);
+
+    /*******************************************************************************
+     * Read pipelining. Reads need no bus turnaround and their data comes out of
+     * read_pipe_i independently of the command state, so a page-hit read
+     * presented during the CAS latency of the previous one is issued without
+     * going through IDLE: from CAS_LATENCY once o_ack has gone (before that the
+     * client may still be presenting the read just taken), else from READ_DATA.
+     * Leaving CAS_LATENCY early restarts the CAS latency count for the new read,
+     * so the last read's data is out before IDLE is reached. In CAS_LATENCY, the
+     * row may have been opened by the look-ahead just before, so tRCD is checked
+     * on the bank's tRAS counter. o_pipe_ready tells the client it may present
+     * the next request already; anything that cannot be pipelined just waits for
+     * IDLE. This also holds in the last cycle of a write (DATAIN2ACTIVE), so that
+     * the next request is there when IDLE is reached and a page-hit write follows
+     * without a gap. A row opened by the look-ahead in the first CAS latency cycle
+     * must still satisfy tRCD when read from READ_DATA, and per-column data only
+     * works with the burst length 1 mode.
+     ******************************************************************************/
+    parameter PIPELINE_READ_OK = (NUM_CLK_CL >= NUM_CLK_ACTIVE2RW_DELAY) &&
+                                 (NUM_CLK_READ == 1);
+
+    wire                            read_pipeline_i;
+    wire                            read_early_i;   // Taken from CAS_LATENCY
+
+    assign read_pipeline_i = PIPELINE_READ_OK && i_adv && i_rwn &&
+                             (i_disable_active || page_hit_i) &&
+                             !(i_refresh_req || i_selfrefresh_req || i_loadmod_req ||
+                               i_precharge_req || i_power_down);
+    assign read_early_i = read_pipeline_i && !o_ack &&
+                          (cmd_fsm_states_i == CMD_STATE_CAS_LATENCY) &&
+                          (ras_count_i[{req_bank_i, 2'b00} +: 4] + NUM_CLK_ACTIVE2RW_DELAY <=
+                           NUM_CLK_ACTIVE2PRECHARGE);
+    assign o_pipe_ready = (cmd_fsm_states_i == CMD_STATE_CAS_LATENCY) ||
+                          (cmd_fsm_states_i == CMD_STATE_READ_DATA) ||
+                          (cmd_fsm_states_i == CMD_STATE_DATAIN2ACTIVE);
+
+    /*******************************************************************************
+     * Low power states: 2'b01 in power-down, 2'b10 in self-refresh, 2'b11 while
+     * waiting for tXSR after self-refresh, 2'b00 otherwise. In power-down and
+     * self-refresh, o_busy and o_ack stay low, so that the client can present a
+     * request, which the power management takes as the reason to wake up.
+     ******************************************************************************/
+    assign o_power_state = (cmd_fsm_states_i == CMD_STATE_POWER_DOWN_MODE) ? 2'b01 :
+                           (cmd_fsm_states_i == CMD_STATE_SELFREFRESH) ? 2'b10 :
+                           (cmd_fsm_states_i == CMD_STATE_SELFREFRESH_DELAY) ? 2'b11 :
+                           2'b00;
+
+    always @(posedge i_clk or posedge i_rst)
+        if (i_rst)
+            row_open_i <= #WIREDLY 0;
+        else
+            case (cmd_fsm_states_i)
+                CMD_STATE_ACTIVE:
+                    row_open_i[req_bank_i] <= #WIREDLY i_disable_precharge;
+                CMD_STATE_CAS_LATENCY,
+                CMD_STATE_WRITE_DATA:
+                    if (lookahead_act_i)
+                        row_open_i[next_bank_i] <= #WIREDLY 1'b1;
+                    else if (lookahead_pre_i)
+                        row_open_i[next_bank_i] <= #WIREDLY 1'b0;
+                CMD_STATE_PRECHARGE_BANK:
+                    row_open_i[req_bank_i] <= #WIREDLY 1'b0;
+                CMD_STATE_READ_AUTOPRECHARGE,
+                CMD_STATE_WRITE_AUTOPRECHARGE:
+                    if (!i_disable_precharge)
+                        row_open_i[req_bank_i] <= #WIREDLY 1'b0;
+                CMD_STATE_PRECHARGE,
+                CMD_STATE_PRECHARGE_ALL:
+                    row_open_i <= #WIREDLY 0;
+                default:
+                    ;
+            endcase
+
+    always @(posedge i_clk)
+        if (cmd_fsm_states_i == CMD_STATE_ACTIVE)
+            open_row_i[req_bank_i] <= #WIREDLY req_row_i;
+        else if (lookahead_act_i)
+            open_row_i[next_bank_i] <= #WIREDLY next_row_i;
     
     
     /*******************************************************************************
@@ -247,6 +445,37 @@ module sdram_control_fsm (
      
     assign o_write_done = write_done_i && (!write_done_reg_i);
     assign o_read_done = read_done_i && (!read_done_reg_i);
+
+    /*******************************************************************************
+     * Multi-word transfers. The mode register stays at burst length 1; a request
+     * with i_burst_len > 1 instead issues one READ/WRITE per clock to consecutive
+     * columns of the open row (READ_BURST/WRITE_BURST states), ending with the
+     * normal READ/WRITE_AUTOPRECHARGE state for the last column. This streams one
+     * word per clock like a programmed burst, but any length from 1 to a full
+     * page can be used without reloading the mode register, and single word
+     * accesses are unchanged. The requester must keep the transfer within a row.
+     ******************************************************************************/
+    reg [SDRAM_COL_WIDTH:0]         burst_col_i;    // column offset of current command
+    wire [4:0]                      read_cmd_state_i;
+    wire [4:0]                      write_cmd_state_i;
+
+    assign read_cmd_state_i = (i_burst_len > 1) ? CMD_STATE_READ_BURST :
+                              CMD_STATE_READ_AUTOPRECHARGE;
+    assign write_cmd_state_i = (i_burst_len > 1) ? CMD_STATE_WRITE_BURST :
+                               CMD_STATE_WRITE_AUTOPRECHARGE;
+
+    always @(posedge i_clk or posedge i_rst)
+        if (i_rst)
+            burst_col_i <= #WIREDLY 0;
+        else if (cmd_fsm_states_i == CMD_STATE_READ_BURST ||
+                 cmd_fsm_states_i == CMD_STATE_WRITE_BURST)
+            burst_col_i <= #WIREDLY burst_col_i + 1;
+        else
+            burst_col_i <= #WIREDLY 0;
+
+    // One word of write data is taken from i_data in each cycle a WRITE is issued.
+    assign o_data_next = (cmd_fsm_states_i == CMD_STATE_WRITE_BURST) ||
+                         (cmd_fsm_states_i == CMD_STATE_WRITE_AUTOPRECHARGE);
    
     /*******************************************************************************
      * Initialization FSM
@@ -322,7 +551,10 @@ module sdram_control_fsm (
             case (cmd_fsm_states_i)
                 
                 CMD_STATE_IDLE:   // wait until refresh, load mode, read/write strobe asserted
-                    if (i_selfrefresh_req && o_init_done) 
+                    if ((i_selfrefresh_req || i_refresh_req) && o_init_done && (|row_open_i)) begin
+                        if (&precharge_ok_i)
+                            cmd_fsm_states_i <= #WIREDLY CMD_STATE_PRECHARGE_ALL;
+                    end else if (i_selfrefresh_req && o_init_done) 
                         cmd_fsm_states_i <= #WIREDLY CMD_STATE_SELFREFRESH;
                     else if (i_refresh_req && o_init_done) 
                         cmd_fsm_states_i <= #WIREDLY CMD_STATE_AUTOREFRESH;
@@ -333,37 +565,54 @@ module sdram_control_fsm (
                     else if (i_power_down && o_init_done)
                         cmd_fsm_states_i <= #WIREDLY CMD_STATE_POWER_DOWN_MODE;
                     else if (i_adv && o_init_done)
-                        if (i_disable_active)
-                            cmd_fsm_states_i <= #WIREDLY (i_rwn)?CMD_STATE_READ_AUTOPRECHARGE :
-                                                CMD_STATE_WRITE_AUTOPRECHARGE;
+                        if (i_disable_active || page_hit_i)
+                            cmd_fsm_states_i <= #WIREDLY (i_rwn) ? read_cmd_state_i :
+                                                write_cmd_state_i;
+                        else if (page_miss_i) begin
+                            // Wait in IDLE until the bank may be precharged.
+                            if (precharge_ok_i[req_bank_i])
+                                cmd_fsm_states_i <= #WIREDLY CMD_STATE_PRECHARGE_BANK;
+                        end
                         else
                             cmd_fsm_states_i <= #WIREDLY CMD_STATE_ACTIVE;
                 
                 CMD_STATE_ACTIVE: // activate row/bank addr
                     if (NUM_CLK_ACTIVE2RW_DELAY == 0)
-                        cmd_fsm_states_i <= #WIREDLY (i_rwn) ? CMD_STATE_READ_AUTOPRECHARGE :
-                                            CMD_STATE_WRITE_AUTOPRECHARGE;
+                        cmd_fsm_states_i <= #WIREDLY (i_rwn) ? read_cmd_state_i :
+                                            write_cmd_state_i;
                     else 
                         cmd_fsm_states_i <= #WIREDLY CMD_STATE_ACTIVE2RW_DELAY;
                 
                 CMD_STATE_ACTIVE2RW_DELAY:   // wait until ACTIVE2RW_DELAY satisfied
                     if (`DONE_ACTIVE2RW_DELAY)
-                        cmd_fsm_states_i <= #WIREDLY (i_rwn) ? CMD_STATE_READ_AUTOPRECHARGE :
-                                            CMD_STATE_WRITE_AUTOPRECHARGE;
+                        cmd_fsm_states_i <= #WIREDLY (i_rwn) ? read_cmd_state_i :
+                                            write_cmd_state_i;
+                
+                CMD_STATE_READ_BURST:  // Read one column per clock, last one in READ_AUTOPRECHARGE
+                    if (burst_col_i == i_burst_len - 2)
+                        cmd_fsm_states_i <= #WIREDLY CMD_STATE_READ_AUTOPRECHARGE;
                 
                 CMD_STATE_READ_AUTOPRECHARGE:  // Enable col/bank addr for read with auto-precharge
                     cmd_fsm_states_i <= #WIREDLY CMD_STATE_CAS_LATENCY;
                 
                 CMD_STATE_CAS_LATENCY:     // Wait for CASn latency
-                    if (`DONE_CAS_LATENCY) 
+                    if (read_early_i)
+                        cmd_fsm_states_i <= #WIREDLY read_cmd_state_i;
+                    else if (`DONE_CAS_LATENCY) 
                         cmd_fsm_states_i <= #WIREDLY CMD_STATE_READ_DATA;
                 
                 CMD_STATE_READ_DATA:  // read data phase
                     if (i_burststop_req) 
                         cmd_fsm_states_i <= #WIREDLY CMD_STATE_BURSTSTOP_READ;
+                    else if ((`DONE_READ_BURST) && read_pipeline_i)
+                        cmd_fsm_states_i <= #WIREDLY read_cmd_state_i;
                     else if (`DONE_READ_BURST) 
                         cmd_fsm_states_i <= #WIREDLY CMD_STATE_IDLE;
                 
+                CMD_STATE_WRITE_BURST:  // Write one column per clock, last one in WRITE_AUTOPRECHARGE
+                    if (burst_col_i == i_burst_len - 2)
+                        cmd_fsm_states_i <= #WIREDLY CMD_STATE_WRITE_AUTOPRECHARGE;
+                
                 CMD_STATE_WRITE_AUTOPRECHARGE: // Enable col/bank addr for write with auto-precharge
                     cmd_fsm_states_i <= #WIREDLY CMD_STATE_WRITE_DATA;
                 
@@ -428,6 +677,22 @@ module sdram_control_fsm (
                     if (`DONE_PRECHARGE_PERIOD) 
                         cmd_fsm_states_i <= #WIREDLY CMD_STATE_IDLE;
               
+                CMD_STATE_PRECHARGE_BANK: // Page miss - close the row open in the requested bank
+                    cmd_fsm_states_i <= #WIREDLY (NUM_CLK_PRECHARGE_PERIOD == 0) ?
+                                        CMD_STATE_ACTIVE : CMD_STATE_PRECHARGE_BANK_DELAY;
+              
+                CMD_STATE_PRECHARGE_BANK_DELAY: // Satisfy precharge period, then open the new row
+                    if (`DONE_PRECHARGE_PERIOD) 
+                        cmd_fsm_states_i <= #WIREDLY CMD_STATE_ACTIVE;
+              
+                CMD_STATE_PRECHARGE_ALL: // Close all open rows before (self) refresh
+                    cmd_fsm_states_i <= #WIREDLY CMD_STATE_PRECHARGE_ALL_DELAY;
+              
+                CMD_STATE_PRECHARGE_ALL_DELAY: // Satisfy precharge period
+                    if (`DONE_PRECHARGE_PERIOD) 
+                        cmd_fsm_states_i <= #WIREDLY (i_selfrefresh_req) ? CMD_STATE_SELFREFRESH :
+                                            CMD_STATE_AUTOREFRESH;
+              
                 CMD_STATE_POWER_DOWN_MODE : // Power down mode
                     if (!i_power_down)
                         cmd_fsm_states_i <= #WIREDLY CMD_STATE_IDLE;  
@@ -466,10 +731,8 @@ module sdram_control_fsm (
 
                 CMD_STATE_BURSTSTOP_WRITE,
                 CMD_STATE_BURSTSTOP_READ,
-                CMD_STATE_SELFREFRESH,
                 CMD_STATE_READ_AUTOPRECHARGE,
                 CMD_STATE_WRITE_AUTOPRECHARGE,
-                CMD_STATE_POWER_DOWN_MODE,
                 CMD_STATE_LOAD_MODEREG:
                     o_ack      <= #WIREDLY 1;
                 
@@ -498,12 +761,13 @@ module sdram_control_fsm (
                 
                 CMD_STATE_ACTIVE,
                     CMD_STATE_ACTIVE2RW_DELAY,
+                    CMD_STATE_READ_BURST,
                     CMD_STATE_READ_AUTOPRECHARGE,
                     CMD_STATE_CAS_LATENCY,
+                    CMD_STATE_WRITE_BURST,
                     CMD_STATE_WRITE_AUTOPRECHARGE,
                     CMD_STATE_WRITE_DATA,
                     CMD_STATE_AUTOREFRESH,
-                    CMD_STATE_SELFREFRESH,
                     CMD_STATE_BURSTSTOP_WRITE,
                     CMD_STATE_PRECHARGE,
                     CMD_STATE_LOAD_MODEREG,
@@ -515,7 +779,10 @@ module sdram_control_fsm (
                     CMD_STATE_LOAD_MODEREG_DELAY,
                     CMD_STATE_AUTOREFRESH_DELAY,
                     CMD_STATE_PRECHARGE_DELAY,
-                    CMD_STATE_POWER_DOWN_MODE,
+                    CMD_STATE_PRECHARGE_BANK,
+                    CMD_STATE_PRECHARGE_BANK_DELAY,
+                    CMD_STATE_PRECHARGE_ALL,
+                    CMD_STATE_PRECHARGE_ALL_DELAY,
                     CMD_STATE_SELFREFRESH_DELAY:
                         o_busy <= #WIREDLY 1;
                 
@@ -535,85 +802,97 @@ module sdram_control_fsm (
     /*******************************************************************************
      * Reset Clock Counter generating logic
      ******************************************************************************/
-    always @(init_fsm_states_i or cmd_fsm_states_i or clk_count_i or i_burststop_req)
+    always @(*)
         case (init_fsm_states_i)
             
             INIT_STATE_PRECHARGEALL:
-                reset_clk_counter_i <= #WIREDLY (NUM_CLK_PRECHARGE_PERIOD == 0) ? 1 : 0;
+                reset_clk_counter_i = (NUM_CLK_PRECHARGE_PERIOD == 0) ? 1 : 0;
             
             INIT_STATE_AUTOREFRESH_1,
                 INIT_STATE_AUTOREFRESH_2:
-                    reset_clk_counter_i <= #WIREDLY (NUM_CLK_AUTOREFRESH_PERIOD == 0) ? 1 : 0;
+                    reset_clk_counter_i = (NUM_CLK_AUTOREFRESH_PERIOD == 0) ? 1 : 0;
             
             INIT_STATE_IDLE:
-                reset_clk_counter_i <= #WIREDLY 1;
+                reset_clk_counter_i = 1;
             
             INIT_STATE_PRECHARGE_DELAY:
-                reset_clk_counter_i <= #WIREDLY (`DONE_PRECHARGE_PERIOD) ? 1 : 0;
+                reset_clk_counter_i = (`DONE_PRECHARGE_PERIOD) ? 1 : 0;
             
             INIT_STATE_LOAD_MODEREG_DELAY:
-                reset_clk_counter_i <= #WIREDLY (`DONE_LOAD_MODEREG_DELAY) ? 1 : 0;
+                reset_clk_counter_i = (`DONE_LOAD_MODEREG_DELAY) ? 1 : 0;
             
             INIT_STATE_AUTOREFRESH_DELAY_1,
                 INIT_STATE_AUTOREFRESH_DELAY_2:
-                    reset_clk_counter_i <= #WIREDLY (`DONE_AUTOREFRESH_PERIOD) ? 1 : 0;
+                    reset_clk_counter_i = (`DONE_AUTOREFRESH_PERIOD) ? 1 : 0;
             
             INIT_STATE_INIT_DONE:
                 case (cmd_fsm_states_i)
                     
                     CMD_STATE_ACTIVE:
-                        reset_clk_counter_i <= #WIREDLY (NUM_CLK_ACTIVE2RW_DELAY == 0) ? 1 : 0;
+                        reset_clk_counter_i = (NUM_CLK_ACTIVE2RW_DELAY == 0) ? 1 : 0;
                     
                     CMD_STATE_IDLE:
-                        reset_clk_counter_i <= #WIREDLY 1;
+                        reset_clk_counter_i = 1;
                     
                     CMD_STATE_ACTIVE2RW_DELAY:
-                        reset_clk_counter_i <= #WIREDLY (`DONE_ACTIVE2RW_DELAY) ? 1 : 0;
+                        reset_clk_counter_i = (`DONE_ACTIVE2RW_DELAY) ? 1 : 0;
                     
                     CMD_STATE_AUTOREFRESH_DELAY:
-                        reset_clk_counter_i <= #WIREDLY (`DONE_AUTOREFRESH_PERIOD) ? 1 : 0;
+                        reset_clk_counter_i = (`DONE_AUTOREFRESH_PERIOD) ? 1 : 0;
                     
                     CMD_STATE_SELFREFRESH:
-                        reset_clk_counter_i <= #WIREDLY 1;
+                        reset_clk_counter_i = 1;
                     
                     CMD_STATE_SELFREFRESH_DELAY:
-                        reset_clk_counter_i <= #WIREDLY (`DONE_SELFREFRESH2ACTIVE_DELAY) ? 1 : 0;
+                        reset_clk_counter_i = (`DONE_SELFREFRESH2ACTIVE_DELAY) ? 1 : 0;
                     
                     CMD_STATE_CAS_LATENCY:
-                        reset_clk_counter_i <= #WIREDLY (`DONE_CAS_LATENCY) ? 1 : 0;
+                        reset_clk_counter_i = ((`DONE_CAS_LATENCY) || read_early_i) ? 1 : 0;
                     
                     CMD_STATE_READ_DATA:
-                        reset_clk_counter_i <= #WIREDLY (clk_count_i == NUM_CLK_READ) ? 1 : 0;
+                        reset_clk_counter_i = ((`DONE_READ_BURST) ||
+                                                (clk_count_i == NUM_CLK_READ)) ? 1 : 0;
                     
                     CMD_STATE_WRITE_DATA:
-                        reset_clk_counter_i <= #WIREDLY ((`DONE_WRITE_BURST) || (i_burststop_req)) ?
+                        reset_clk_counter_i = ((`DONE_WRITE_BURST) || (i_burststop_req)) ?
                                                1 : 0;
 
                     CMD_STATE_LOAD_MODEREG_DELAY:
-                        reset_clk_counter_i <= #WIREDLY (`DONE_LOAD_MODEREG_DELAY) ? 1 : 0;
+                        reset_clk_counter_i = (`DONE_LOAD_MODEREG_DELAY) ? 1 : 0;
                     
                     CMD_STATE_BURSTSTOP_WRITE:
-                        reset_clk_counter_i <= #WIREDLY 1;
+                        reset_clk_counter_i = 1;
 
                     CMD_STATE_BURSTSTOP_WRITE_DELAY:
-                        reset_clk_counter_i <= #WIREDLY (`DONE_WRITE_RECOVERY_DELAY) ? 1 : 0;
+                        reset_clk_counter_i = (`DONE_WRITE_RECOVERY_DELAY) ? 1 : 0;
 
                     CMD_STATE_BURSTSTOP_READ:
-                        reset_clk_counter_i <= #WIREDLY 1;
+                        reset_clk_counter_i = 1;
 
                     CMD_STATE_BURSTSTOP_READ_DELAY:
-                        reset_clk_counter_i <= #WIREDLY (`DONE_CAS_LATENCY) ? 1 : 0;
+                        reset_clk_counter_i = (`DONE_CAS_LATENCY) ? 1 : 0;
 
                     CMD_STATE_PRECHARGE:
-                        reset_clk_counter_i <= #WIREDLY (`DONE_PRECHARGE_PERIOD) ? 1 : 0;
+                        reset_clk_counter_i = (`DONE_PRECHARGE_PERIOD) ? 1 : 0;
+
+                    CMD_STATE_PRECHARGE_BANK:
+                        reset_clk_counter_i = (NUM_CLK_PRECHARGE_PERIOD == 0) ? 1 : 0;
+
+                    CMD_STATE_PRECHARGE_BANK_DELAY,
+                    CMD_STATE_PRECHARGE_ALL_DELAY:
+                        reset_clk_counter_i = (`DONE_PRECHARGE_PERIOD) ? 1 : 0;
+
+                    CMD_STATE_READ_BURST,
+                    CMD_STATE_WRITE_BURST:
+                        reset_clk_counter_i = 1;
 
                     default:
-                        reset_clk_counter_i <= #WIREDLY 0;
+                        reset_clk_counter_i = 0;
                     
                 endcase
             
             default:
-                reset_clk_counter_i <= #WIREDLY 0;
+                reset_clk_counter_i = 0;
             
         endcase
     /*******************************************************************************
@@ -660,11 +939,26 @@ module sdram_control_fsm (
 
     /*******************************************************************************
      * Tristate Control/output enable logic for CPU data bus
+     * read_pipe_i delays each issued READ command by the CAS latency, so every
+     * column of a multi-word transfer gets its own data valid cycle. For burst
+     * lengths > 1 programmed in the mode register, the READ_DATA state covers
+     * the remaining words of the burst.
      ******************************************************************************/
+    reg [NUM_CLK_CL:0]         read_pipe_i;
+
+    always @(posedge i_clk or posedge i_rst)
+        if (i_rst)
+            read_pipe_i <= #WIREDLY 0;
+        else
+            read_pipe_i <= #WIREDLY {read_pipe_i[NUM_CLK_CL-1:0],
+                                     (cmd_fsm_states_i == CMD_STATE_READ_BURST) ||
+                                     (cmd_fsm_states_i == CMD_STATE_READ_AUTOPRECHARGE)};
+
     always @(posedge i_clk or posedge i_rst)
         if (i_rst)
             cpu_den_i <= #WIREDLY 0;
-        else if ((cmd_fsm_states_i == CMD_STATE_READ_DATA) || 
+        else if (read_pipe_i[NUM_CLK_CL] ||
+                 ((NUM_CLK_READ > 1) && (cmd_fsm_states_i == CMD_STATE_READ_DATA)) || 
                  (cmd_fsm_states_i == CMD_STATE_BURSTSTOP_READ) || 
                  (cmd_fsm_states_i == CMD_STATE_BURSTSTOP_READ_DELAY))
             cpu_den_i <= #WIREDLY 1;
@@ -696,9 +990,11 @@ module sdram_control_fsm (
     always @(posedge i_clk or posedge i_rst)
         if  (i_rst)
             sdram_dq_en_i <= #WIREDLY 0;
-        else if (cmd_fsm_states_i == CMD_STATE_WRITE_AUTOPRECHARGE)
+        else if (cmd_fsm_states_i == CMD_STATE_WRITE_AUTOPRECHARGE ||
+                 cmd_fsm_states_i == CMD_STATE_WRITE_BURST)
             sdram_dq_en_i <= #WIREDLY 1;
-        else if (cmd_fsm_states_i == CMD_STATE_READ_AUTOPRECHARGE)
+        else if (cmd_fsm_states_i == CMD_STATE_READ_AUTOPRECHARGE ||
+                 cmd_fsm_states_i == CMD_STATE_READ_BURST)
             sdram_dq_en_i <= #WIREDLY 0;
 
     /*******************************************************************************
@@ -743,6 +1039,7 @@ module sdram_control_fsm (
                     if (!i_rwn) 
                         read_data_req_i      <= #WIREDLY 1;
                 CMD_STATE_WRITE_DATA,
+                    CMD_STATE_WRITE_BURST,
                     CMD_STATE_WRITE_AUTOPRECHARGE:
                         read_data_req_i      <= #WIREDLY 1;
                 
@@ -765,26 +1062,31 @@ module sdram_control_fsm (
      * Packing columm address to SDRAM address bus based on sdram column width
      ******************************************************************************/
     wire [12:0]                   col_addr_i;
+    wire [COLADDR_MSB:COLADDR_LSB] col_i;   // start column plus offset within transfer
     
+    assign col_i = i_addr[COLADDR_MSB:COLADDR_LSB] + burst_col_i[SDRAM_COL_WIDTH-1:0];
+    // Auto-precharge only on the last column of a multi-word transfer.
     assign col_addr_i[10] = ((i_disable_precharge) || 
+                             (cmd_fsm_states_i == CMD_STATE_READ_BURST) ||
+                             (cmd_fsm_states_i == CMD_STATE_WRITE_BURST) ||
                              (MODEREG_BURST_LENGTH == SDRAM_BURST_PAGE)) ? 1'b0 : 1'b1;
     generate
         if (SDRAM_COL_WIDTH == 8) begin
-            assign col_addr_i[9:0] = {2'b00, i_addr[COLADDR_MSB:COLADDR_LSB]};
+            assign col_addr_i[9:0] = {2'b00, col_i[COLADDR_MSB:COLADDR_LSB]};
         end
         else if (SDRAM_COL_WIDTH == 9) begin
-            assign col_addr_i[9:0] = {1'b0, i_addr[COLADDR_MSB:COLADDR_LSB]};
+            assign col_addr_i[9:0] = {1'b0, col_i[COLADDR_MSB:COLADDR_LSB]};
         end
         else if (SDRAM_COL_WIDTH == 10) begin
-            assign col_addr_i[9:0] = i_addr[COLADDR_MSB:COLADDR_LSB];
+            assign col_addr_i[9:0] = col_i[COLADDR_MSB:COLADDR_LSB];
         end
         else if (SDRAM_COL_WIDTH == 11) begin
-            assign col_addr_i[11] = i_addr[COLADDR_MSB];
-            assign col_addr_i[9:0] = i_addr[COLADDR_MSB-1:COLADDR_LSB];
+            assign col_addr_i[11] = col_i[COLADDR_MSB];
+            assign col_addr_i[9:0] = col_i[COLADDR_MSB-1:COLADDR_LSB];
         end
         else if (SDRAM_COL_WIDTH == 12) begin
-            assign col_addr_i[12:11] = i_addr[COLADDR_MSB:COLADDR_MSB-1];
-            assign col_addr_i[9:0] = i_addr[COLADDR_MSB-2:COLADDR_LSB];
+            assign col_addr_i[12:11] = col_i[COLADDR_MSB:COLADDR_MSB-1];
+            assign col_addr_i[9:0] = col_i[COLADDR_MSB-2:COLADDR_LSB];
         end
     endgenerate
     
@@ -830,7 +1132,7 @@ module sdram_control_fsm (
                     o_sdram_cke <= #WIREDLY 1;
                     o_sdram_blkaddr  <= #WIREDLY 2'b00;
                     o_sdram_addr   <= #WIREDLY {
-                                                2'b00,
+                                                3'b000,
                                                 MODEREG_WRITE_BURST_MODE,
                                                 MODEREG_OPERATION_MODE,
                                                 MODEREG_CAS_LATENCY,
@@ -846,17 +1148,36 @@ module sdram_control_fsm (
                         CMD_STATE_ACTIVE2RW_DELAY,
                         CMD_STATE_AUTOREFRESH_DELAY,
                         CMD_STATE_SELFREFRESH_DELAY,
-                        CMD_STATE_CAS_LATENCY,
                         CMD_STATE_READ_DATA,
                         CMD_STATE_BURSTSTOP_WRITE_DELAY,
-                        CMD_STATE_BURSTSTOP_READ_DELAY,
-                        CMD_STATE_WRITE_DATA:  begin
+                        CMD_STATE_BURSTSTOP_READ_DELAY:  begin
                             `SDR_CMD_SIGNALS <= #WIREDLY SDRAM_CMD_NOP;
                             o_sdram_cke <= #WIREDLY 1;
                             o_sdram_blkaddr  <= #WIREDLY 2'b11;
                             o_sdram_addr   <= #WIREDLY  {`SDRAM_ABUS_LEN{1'b1}};
                         end
                         
+                        //Look-ahead ACTIVE/PRECHARGE for the next bank, else NOP.
+                        //DQM kept low so it cannot mask data of the current access.
+                        CMD_STATE_CAS_LATENCY,
+                        CMD_STATE_WRITE_DATA:
+                            if (lookahead_act_i) begin
+                                `SDR_CMD_SIGNALS <= #WIREDLY {SDRAM_CMD_ACTIVE[4:1], 1'b0};
+                                o_sdram_cke <= #WIREDLY 1;
+                                o_sdram_blkaddr  <= #WIREDLY next_bank_i;
+                                o_sdram_addr   <= #WIREDLY next_row_i;
+                            end else if (lookahead_pre_i) begin
+                                `SDR_CMD_SIGNALS <= #WIREDLY {SDRAM_CMD_PRECHARGE[4:1], 1'b0};
+                                o_sdram_cke <= #WIREDLY 1;
+                                o_sdram_blkaddr  <= #WIREDLY next_bank_i;
+                                o_sdram_addr   <= #WIREDLY {`SDRAM_ABUS_LEN{1'b0}};
+                            end else begin
+                                `SDR_CMD_SIGNALS <= #WIREDLY SDRAM_CMD_NOP;
+                                o_sdram_cke <= #WIREDLY 1;
+                                o_sdram_blkaddr  <= #WIREDLY 2'b11;
+                                o_sdram_addr   <= #WIREDLY  {`SDRAM_ABUS_LEN{1'b1}};
+                            end
+                        
                         CMD_STATE_ACTIVE: begin
                             `SDR_CMD_SIGNALS <= #WIREDLY SDRAM_CMD_ACTIVE;
                             o_sdram_cke <= #WIREDLY 1;
@@ -864,14 +1185,16 @@ module sdram_control_fsm (
                             o_sdram_addr   <= #WIREDLY i_addr[ROWADDR_MSB:ROWADDR_LSB];//row
                         end
                         
-                        CMD_STATE_READ_AUTOPRECHARGE:  begin
+                        CMD_STATE_READ_BURST,
+                            CMD_STATE_READ_AUTOPRECHARGE:  begin
                             `SDR_CMD_SIGNALS <= #WIREDLY SDRAM_CMD_READ;
                             o_sdram_cke <= #WIREDLY 1;
                             o_sdram_blkaddr  <= #WIREDLY i_addr[BLKADDR_MSB:BLKADDR_LSB];//bank
                             o_sdram_addr[`SDRAM_ABUS_LEN - 1:0]   <= #WIREDLY col_addr_i;
                         end
                         
-                        CMD_STATE_WRITE_AUTOPRECHARGE: begin
+                        CMD_STATE_WRITE_BURST,
+                            CMD_STATE_WRITE_AUTOPRECHARGE: begin
                             `SDR_CMD_SIGNALS <= #WIREDLY SDRAM_CMD_WRITE;
                             o_sdram_cke <= #WIREDLY 1;
                             o_sdram_blkaddr  <= #WIREDLY i_addr[BLKADDR_MSB:BLKADDR_LSB];//bank
@@ -902,13 +1225,22 @@ module sdram_control_fsm (
                             o_sdram_addr   <= #WIREDLY i_addr[`SDRAM_ABUS_LEN - 1 : 0];
                         end
                         
-                        CMD_STATE_PRECHARGE: begin
+                        CMD_STATE_PRECHARGE,
+                            CMD_STATE_PRECHARGE_ALL: begin
                             `SDR_CMD_SIGNALS <= #WIREDLY SDRAM_CMD_PRECHARGE;
                             o_sdram_cke <= #WIREDLY 1;
                             o_sdram_blkaddr  <= #WIREDLY  2'b11;
                             o_sdram_addr   <= #WIREDLY {`SDRAM_ABUS_LEN{1'b1}};
                         end
                         
+                        //A10 low: precharge only the bank selected by BA
+                        CMD_STATE_PRECHARGE_BANK: begin
+                            `SDR_CMD_SIGNALS <= #WIREDLY SDRAM_CMD_PRECHARGE;
+                            o_sdram_cke <= #WIREDLY 1;
+                            o_sdram_blkaddr  <= #WIREDLY i_addr[BLKADDR_MSB:BLKADDR_LSB];//bank
+                            o_sdram_addr   <= #WIREDLY {`SDRAM_ABUS_LEN{1'b0}};
+                        end
+                        
                         CMD_STATE_BURSTSTOP_READ,
                             CMD_STATE_BURSTSTOP_WRITE: begin
                                 `SDR_CMD_SIGNALS <= #WIREDLY SDRAM_CMD_BURSTSTOP;
@@ -978,6 +1310,12 @@ module sdram_control_fsm (
          CMD_STATE_PRECHARGE             :  state_ASCII = "CMD_STATE_PRECHARGE               ";    
          CMD_STATE_PRECHARGE_DELAY       :  state_ASCII = "CMD_STATE_PRECHARGE_DELAY         ";
          CMD_STATE_POWER_DOWN_MODE       :  state_ASCII = "CMD_STATE_POWER_DOWN_MODE         ";
+         CMD_STATE_PRECHARGE_BANK        :  state_ASCII = "CMD_STATE_PRECHARGE_BANK          ";
+         CMD_STATE_PRECHARGE_BANK_DELAY  :  state_ASCII = "CMD_STATE_PRECHARGE_BANK_DELAY    ";
+         CMD_STATE_PRECHARGE_ALL         :  state_ASCII = "CMD_STATE_PRECHARGE_ALL           ";
+         CMD_STATE_PRECHARGE_ALL_DELAY   :  state_ASCII = "CMD_STATE_PRECHARGE_ALL_DELAY     ";
+         CMD_STATE_READ_BURST            :  state_ASCII = "CMD_STATE_READ_BURST              ";
+         CMD_STATE_WRITE_BURST           :  state_ASCII = "CMD_STATE_WRITE_BURST             ";
          
          
          default:                  state_ASCII = "%Error                ";
@@ -56,7 +56,8 @@ module sdram_controller (/*AUTOARG*/
     
                          o_sdram_addr, o_sdram_blkaddr, o_sdram_casn, o_sdram_cke, 
                          o_sdram_csn, o_sdram_dqm, o_sdram_rasn, o_sdram_wen, o_sdram_clk,
-                         o_write_done, o_read_done,
+                         o_write_done, o_read_done, o_data_next, o_pipe_ready,
+                         o_power_state, o_wake,
 
                          // Inouts
 `ifdef DISABLE_CPU_IO_BUS
@@ -72,7 +73,9 @@ module sdram_controller (/*AUTOARG*/
 
                          // Inputs
                          i_addr, i_adv, i_clk, i_rst, i_rwn, 
-                         i_selfrefresh_req, i_loadmod_req, i_burststop_req, i_disable_active, i_disable_precharge, i_precharge_req, i_power_down, i_disable_autorefresh
+                         i_selfrefresh_req, i_loadmod_req, i_burststop_req, i_disable_active, i_disable_precharge, i_precharge_req, i_power_down, i_disable_autorefresh,
+                         i_next_addr, i_next_valid, i_burst_len, i_dqm,
+                         i_powerdown_idle, i_selfrefresh_idle
                          );
 
 `include "sdram_defines.v"
@@ -109,7 +112,7 @@ module sdram_controller (/*AUTOARG*/
     parameter ROWADDR_LSB = 11;
     defparam U0.ROWADDR_LSB = ROWADDR_LSB;
 
-    parameter MODEREG_CAS_LATENCY = 2;
+    parameter [2:0] MODEREG_CAS_LATENCY = 2;
     defparam U0.MODEREG_CAS_LATENCY = MODEREG_CAS_LATENCY;
 
     parameter MODEREG_BURST_LENGTH = 3'b000;
@@ -126,25 +129,39 @@ module sdram_controller (/*AUTOARG*/
    
     parameter SDRAM_PAGE_LEN = 256;
        
-    parameter CLK_PERIOD = 10;
+    // Clock frequency, in kHz. All delays below, and the refresh counter,
+    // are derived from it.
+    parameter CLK_KHZ = 100000;
+
+    // Clock period and delays in ps.
+    parameter CLK_PERIOD = 1000000000 / CLK_KHZ;
     
     parameter LOAD_MODEREG_DELAY = 2*CLK_PERIOD;
     
-    parameter PRECHARE_PERIOD = CLK_PERIOD/2 + 22;
+    parameter PRECHARE_PERIOD = CLK_PERIOD/2 + 22000;
     
-    parameter AUTOREFRESH_PERIOD = CLK_PERIOD/2 + 67;
+    parameter AUTOREFRESH_PERIOD = CLK_PERIOD/2 + 67000;
             
-    parameter ACTIVE2RW_DELAY = CLK_PERIOD/2 + 22;
+    parameter ACTIVE2RW_DELAY = CLK_PERIOD/2 + 22000;
             
-    parameter WRITE_RECOVERY_DELAY = CLK_PERIOD/2 + CLK_PERIOD + 8;
+    parameter WRITE_RECOVERY_DELAY = CLK_PERIOD/2 + CLK_PERIOD + 8000;
          
-    parameter DATAIN2ACTIVE = CLK_PERIOD/2 + 37;
+    parameter DATAIN2ACTIVE = CLK_PERIOD/2 + 37000;
          
-    parameter DATAIN2PRECHARGE = CLK_PERIOD + 14;
+    parameter DATAIN2PRECHARGE = CLK_PERIOD + 14000;
          
     parameter LDMODEREG2ACTIVE = 2 * CLK_PERIOD;
          
-    parameter SELFREFRESH2ACTIVE_DELAY = CLK_PERIOD + 44;
+    parameter SELFREFRESH2ACTIVE_DELAY = CLK_PERIOD + 44000;
+
+    // Minimum time in self-refresh (tRAS).
+    parameter SELFREFRESH_MIN_PERIOD = 42000;
+
+    // Minimum ACTIVE to PRECHARGE time of a bank (tRAS).
+    parameter ACTIVE2PRECHARGE_DELAY = 44000;
+
+    // Average refresh interval, 64 ms / 8192 rows.
+    parameter REFRESH_INTERVAL_NS = 7800;
     
     parameter NUM_CLK_CL    = (MODEREG_CAS_LATENCY == SDRAM_CAS_LATENCY_2 ) ? 2 :
                               (MODEREG_CAS_LATENCY == SDRAM_CAS_LATENCY_3) ? 3 :
@@ -167,18 +184,27 @@ module sdram_controller (/*AUTOARG*/
                                4; // default, for SDRAM_BURST_LEN_4
     defparam U0.NUM_CLK_WRITE = NUM_CLK_WRITE;
       
-    parameter AUTO_REFRESH_COUNT = 1500;
+    parameter AUTO_REFRESH_COUNT = REFRESH_INTERVAL_NS * CLK_KHZ / 1000000;
     defparam U2.AUTO_REFRESH_COUNT = AUTO_REFRESH_COUNT;
 
     parameter NUM_CLK_LOAD_MODEREG_DELAY = LOAD_MODEREG_DELAY/CLK_PERIOD;
+    defparam U0.NUM_CLK_LOAD_MODEREG_DELAY = NUM_CLK_LOAD_MODEREG_DELAY;
     parameter NUM_CLK_PRECHARGE_PERIOD    = PRECHARE_PERIOD/CLK_PERIOD;
+    defparam U0.NUM_CLK_PRECHARGE_PERIOD = NUM_CLK_PRECHARGE_PERIOD;
     parameter NUM_CLK_AUTOREFRESH_PERIOD = AUTOREFRESH_PERIOD/CLK_PERIOD;
+    defparam U0.NUM_CLK_AUTOREFRESH_PERIOD = NUM_CLK_AUTOREFRESH_PERIOD;
     parameter NUM_CLK_ACTIVE2RW_DELAY    = ACTIVE2RW_DELAY/CLK_PERIOD;
+    defparam U0.NUM_CLK_ACTIVE2RW_DELAY = NUM_CLK_ACTIVE2RW_DELAY;
     parameter NUM_CLK_DATAIN2ACTIVE      = DATAIN2ACTIVE/CLK_PERIOD;
     parameter NUM_CLK_DATAIN2PRECHARGE   = DATAIN2PRECHARGE/CLK_PERIOD;
     parameter NUM_CLK_LDMODEREG2ACTIVE   = LDMODEREG2ACTIVE/CLK_PERIOD;
     parameter NUM_CLK_SELFREFRESH2ACTIVE = SELFREFRESH2ACTIVE_DELAY/CLK_PERIOD;
+    defparam U0.NUM_CLK_SELFREFRESH2ACTIVE = NUM_CLK_SELFREFRESH2ACTIVE;
+    parameter NUM_CLK_SELFREFRESH_MIN    = SELFREFRESH_MIN_PERIOD/CLK_PERIOD + 1;
     parameter NUM_CLK_WRITE_RECOVERY_DELAY   = WRITE_RECOVERY_DELAY/CLK_PERIOD;
+    defparam U0.NUM_CLK_WRITE_RECOVERY_DELAY = NUM_CLK_WRITE_RECOVERY_DELAY;
+    parameter NUM_CLK_ACTIVE2PRECHARGE   = ACTIVE2PRECHARGE_DELAY/CLK_PERIOD + 1;
+    defparam U0.NUM_CLK_ACTIVE2PRECHARGE = NUM_CLK_ACTIVE2PRECHARGE;
 
     parameter NUM_CLK_WAIT = (NUM_CLK_DATAIN2ACTIVE < 3) ? 0 : NUM_CLK_DATAIN2ACTIVE - 3;    
     defparam U0.NUM_CLK_WAIT = NUM_CLK_WAIT;
@@ -199,6 +225,12 @@ module sdram_controller (/*AUTOARG*/
     input                           i_precharge_req;
     input                           i_power_down;
     input                           i_disable_autorefresh;
+    input [26:0]                    i_next_addr; // Look-ahead hint, address of next request
+    input                           i_next_valid;
+    input [SDRAM_COL_WIDTH:0]       i_burst_len; // Words to transfer, must stay within one row
+    input [3:0]                     i_dqm;       // Byte mask for write data, 1 = byte not written
+    input [15:0]                    i_powerdown_idle;   // Idle clocks before power-down, 0 = never
+    input [15:0]                    i_selfrefresh_idle; // Idle 256-clock units before self-refresh
    
    
     
@@ -221,26 +253,34 @@ module sdram_controller (/*AUTOARG*/
 
     output                          o_write_done;
     output                          o_read_done;
+    output                          o_data_next;    // Write data taken, present next word
+    output                          o_pipe_ready;   // Next request may be presented already
+    output [1:0]                    o_power_state;  // From U0, low power state
+    output                          o_wake;         // Request waiting for wake-up
    
     
     /*AUTOINOUT*/
 `ifdef DISABLE_CPU_IO_BUS
-    input [31:0]                    i_data;            // To/From U0 of sdram_control_fsm.v
-    output [31:0]                   o_data;            // To/From U0 of sdram_control_fsm.v
+    input [CPU_DATA_WIDTH-1:0]      i_data;            // To/From U0 of sdram_control_fsm.v
+    output [CPU_DATA_WIDTH-1:0]     o_data;            // To/From U0 of sdram_control_fsm.v
 `else
-    inout [31:0]                    io_data;            // To/From U0 of sdram_control_fsm.v
+    inout [CPU_DATA_WIDTH-1:0]      io_data;            // To/From U0 of sdram_control_fsm.v
 `endif
     //HUSK inout [31:0]                    io_sdram_dq;            // To/From U0 of sdram_control_fsm.v
-    input [31:0]                    i_sdram_dq;
-    output [31:0]                   o_sdram_dq;
+    input [SDRAM_DATA_WIDTH-1:0]    i_sdram_dq;
+    output [SDRAM_DATA_WIDTH-1:0]   o_sdram_dq;
     output                          o_sdram_busdir; //HUSK
     
     wire                            delay_done150us_i;     // To U0 of sdram_control_fsm.v
     wire                            refresh_count_done_i;   // From U2 of autorefresh_counter.v
     wire                            autoref_ack_i, init_done_i, sdrctl_busyn_i;
+    wire                            power_down_i, selfrefresh_i;
+    wire                            sys_clk_i, sys_rst_i;
     
-    reg                             latch_ref_req_i;
     reg                             refresh_req_i;
+    reg signed [4:0]                refresh_owed_i;
+    reg [4:0]                       idle_count_i;
+    wire                            refresh_due_i;
     reg                             autorefresh_enable_i;
     wire                            cpu_den_i;
     wire [CPU_DATA_WIDTH-1:0]       cpu_datain_i;            // To/From U0 of sdram_control_fsm.v
@@ -260,15 +300,21 @@ module sdram_controller (/*AUTOARG*/
     reg                              power_down_reg3_i;
    
 
+    //Stop the SDRAM clock in power-down, but only once the FSM is there and
+    //CKE low has been clocked in; start it again as soon as power-down ends.
     always @(posedge i_clk or posedge i_rst)  begin
         if (i_rst) begin
-            power_down_reg1_i <= 1'b0; end
+            power_down_reg1_i <= 1'b0;
+            power_down_reg2_i <= 1'b0;
+            power_down_reg3_i <= 1'b0; end
         else begin
-            power_down_reg1_i <= i_power_down; end           
+            power_down_reg1_i <= power_down_i && (o_power_state == 2'b01);
+            power_down_reg2_i <= power_down_i && power_down_reg1_i;
+            power_down_reg3_i <= power_down_i && power_down_reg2_i; end
     end
            
        
-    assign o_sdram_clk = i_clk ? ~(power_down_reg1_i) : 1'b0;
+    assign o_sdram_clk = i_clk ? ~(power_down_reg3_i) : 1'b0;
     assign o_init_done = init_done_i;
     assign sys_clk_i = i_clk;
     assign sys_rst_i = i_rst;
@@ -294,6 +340,9 @@ module sdram_controller (/*AUTOARG*/
                           .o_sdram_dqm          (o_sdram_dqm[SDRAM_DQM_WIDTH-1:0]),
                           .o_write_done         (o_write_done),
                           .o_read_done          (o_read_done),
+                          .o_data_next          (o_data_next),
+                          .o_pipe_ready         (o_pipe_ready),
+                          .o_power_state        (o_power_state),
                           // Inouts
                           .i_data          (i_data[CPU_DATA_WIDTH-1:0]),
                           .o_data          (cpu_dataout_i[CPU_DATA_WIDTH-1:0]),
@@ -309,13 +358,17 @@ module sdram_controller (/*AUTOARG*/
                           .i_adv           (i_adv),
                           .i_delay_done_100us   (delay_done150us_i),
                           .i_refresh_req        (refresh_req_i),
-                          .i_selfrefresh_req    (i_selfrefresh_req),
+                          .i_selfrefresh_req    (selfrefresh_i),
                           .i_loadmod_req        (i_loadmod_req),
                           .i_burststop_req      (i_burststop_req),
                           .i_disable_active     (i_disable_active),
                           .i_disable_precharge  (i_disable_precharge),
                           .i_precharge_req      (i_precharge_req),
-                          .i_power_down         (i_power_down),
+                          .i_power_down         (power_down_i),
+                          .i_next_addr          (i_next_addr[ROWADDR_MSB:COLADDR_LSB]),
+                          .i_next_valid         (i_next_valid),
+                          .i_burst_len          (i_burst_len),
+                          .i_dqm                (i_dqm[SDRAM_DQM_WIDTH-1:0]),
                           .i_addr           (i_addr[ROWADDR_MSB:COLADDR_LSB]));
     
     delay_gen150us U1 (/*AUTOINST*/
@@ -333,23 +386,89 @@ module sdram_controller (/*AUTOARG*/
                            .i_sys_rst           (sys_rst_i),
                            .i_autorefresh_enable(autorefresh_enable_i));
 
-    //Latch auto refresh request and clear it after ack 
+    //Refresh scheduling. refresh_owed_i counts refresh intervals elapsed minus
+    //refreshes done. A refresh is issued:
+    // - when the controller has been idle for REFRESH_IDLE_DELAY clocks, as
+    //   long as fewer than REFRESH_PULLIN_MAX refreshes were done ahead;
+    // - when one is owed and no request is waiting;
+    // - regardless of requests, once REFRESH_POSTPONE_MAX are owed.
+    //So refreshes are done early in idle time, postponed under traffic (up to
+    //the JEDEC limit of 8), and caught up back-to-back when the traffic pauses.
+    parameter REFRESH_POSTPONE_MAX = 8;
+    parameter REFRESH_PULLIN_MAX = 8;
+    parameter REFRESH_IDLE_DELAY = 16;
+
     always @(posedge i_clk or posedge i_rst)
         if (i_rst)
-            latch_ref_req_i <= #WIREDLY 0;
-        else if (latch_ref_req_i && autoref_ack_i)  
-            latch_ref_req_i <= #WIREDLY 0;
-        else
-            latch_ref_req_i <= #WIREDLY refresh_count_done_i;
-    
-    //Issue refresh request when SDRAM Controller initialization done and is not busy
+            refresh_owed_i <= #WIREDLY 0;
+        else if (refresh_count_done_i && ~autoref_ack_i)
+            refresh_owed_i <= #WIREDLY refresh_owed_i + 1;
+        else if (autoref_ack_i && ~refresh_count_done_i)
+            refresh_owed_i <= #WIREDLY refresh_owed_i - 1;
+
+    always @(posedge i_clk or posedge i_rst)
+        if (i_rst)
+            idle_count_i <= #WIREDLY 0;
+        else if (~init_done_i || sdrctl_busyn_i || i_adv)
+            idle_count_i <= #WIREDLY 0;
+        else if (idle_count_i != REFRESH_IDLE_DELAY)
+            idle_count_i <= #WIREDLY idle_count_i + 1;
+
+    assign refresh_due_i =
+        (refresh_owed_i >= REFRESH_POSTPONE_MAX) ||
+        (refresh_owed_i > 0 && ~i_adv) ||
+        (refresh_owed_i > -REFRESH_PULLIN_MAX &&
+         idle_count_i == REFRESH_IDLE_DELAY);
+
+    //Power management. With no request for i_powerdown_idle clocks, the SDRAM
+    //is put in power-down (CKE low, clock stopped), and after
+    //i_selfrefresh_idle*256 clocks in self-refresh; 0 disables either. The FSM
+    //keeps o_busy low in these states, so the client presents its next request
+    //as usual, and that wakes the SDRAM up; o_wake is high while a request
+    //waits for this. Power-down is also left whenever a refresh is due, as the
+    //SDRAM does not refresh itself there. Self-refresh is held for at least
+    //tRAS once entered.
+    reg [23:0]                      power_idle_i;
+    reg [3:0]                       selfrefresh_time_i;
+    wire                            powerdown_want_i, selfrefresh_want_i;
+
+    always @(posedge i_clk or posedge i_rst)
+        if (i_rst)
+            power_idle_i <= #WIREDLY 0;
+        else if (~init_done_i || i_adv)
+            power_idle_i <= #WIREDLY 0;
+        else if (power_idle_i != 24'hffffff)
+            power_idle_i <= #WIREDLY power_idle_i + 1;
+
+    always @(posedge i_clk)
+        if (o_power_state != 2'b10)
+            selfrefresh_time_i <= #WIREDLY 0;
+        else if (selfrefresh_time_i != NUM_CLK_SELFREFRESH_MIN)
+            selfrefresh_time_i <= #WIREDLY selfrefresh_time_i + 1;
+
+    assign selfrefresh_want_i = (i_selfrefresh_idle != 0) &&
+                                (power_idle_i >= {i_selfrefresh_idle, 8'h00});
+    assign powerdown_want_i = (i_powerdown_idle != 0) &&
+                              (power_idle_i >= {8'h00, i_powerdown_idle}) && ~selfrefresh_want_i;
+
+    assign selfrefresh_i = i_selfrefresh_req ||
+                           (selfrefresh_want_i && ~i_adv) ||
+                           (o_power_state == 2'b10 &&
+                            selfrefresh_time_i != NUM_CLK_SELFREFRESH_MIN);
+    assign power_down_i = i_power_down ||
+                          (powerdown_want_i && ~i_adv && ~refresh_due_i);
+    assign o_wake = i_adv && (o_power_state != 2'b00);
+
+    //Issue refresh request when SDRAM Controller initialization done. It is held
+    //while the controller is busy, so that the FSM takes it in the next IDLE
+    //before a request that is already waiting (and stops pipelining reads).
     always @(posedge i_clk or posedge i_rst)
         if (i_rst)
             refresh_req_i <= #WIREDLY 0;
         else if (i_disable_autorefresh)
             refresh_req_i <= #WIREDLY 0;
-        else if (init_done_i && ~sdrctl_busyn_i)  
-            refresh_req_i <= #WIREDLY latch_ref_req_i;
+        else if (init_done_i)
+            refresh_req_i <= #WIREDLY refresh_due_i;
         else
             refresh_req_i <= #WIREDLY 0;
     
@@ -357,7 +476,7 @@ module sdram_controller (/*AUTOARG*/
     always @(posedge i_clk or posedge i_rst)
         if (i_rst)
             autorefresh_enable_i <= #WIREDLY 0;
-        else if (init_done_i && ~i_selfrefresh_req)  
+        else if (init_done_i && ~selfrefresh_i)  
             autorefresh_enable_i <= #WIREDLY 1;
         else
             autorefresh_enable_i <= #WIREDLY 0;
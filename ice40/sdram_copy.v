@@ -0,0 +1,146 @@
+/*
+  SDRAM to SDRAM copy and fill engine, with a descriptor queue.
+
+  push queues a descriptor: fill (1) or copy (0) of len words to word
+  address dst, from word address src or with the fill value in src[15:0].
+  irq asks for the interrupt line to be raised when it is done. Up to
+  2**QAW descriptors are queued; full must be checked before pushing.
+
+  Descriptors are done in order, in chunks of up to CHUNK words, each
+  started when go allows (so other SDRAM traffic gets in between chunks)
+  and owning the controller while busy. A copy chunk is read with one
+  burst into a block RAM buffer and written back from it with another; a
+  fill chunk is just the write. Copies go upwards, so an overlapping copy
+  to a higher address is only correct if dst - src >= CHUNK. inv pulses at
+  the start of each write, for the read cache. pending is set while any
+  descriptor is queued or in progress. done_cnt counts finished
+  descriptors, and irq_out stays set from the end of one with irq until
+  irq_clr.
+*/
+module sdram_copy #(parameter QAW=4, CHUNK=512, LENW=25)
+   (input clk,
+    // Descriptor queue.
+    input 		  push, input fill, input irq,
+    input wire[23:0] 	  src, input wire[23:0] dst,
+    input wire[LENW-1:0]  len,
+    output 		  full, output wire[QAW:0] level,
+    // Status.
+    input 		  go, output busy, output pending,
+    output wire[7:0] 	  done_cnt, output wire irq_out,
+    input 		  irq_clr, output inv,
+    // Towards sdram controller.
+    output wire[23:0] 	  sd_adr, output wire sd_rwn,
+    output wire[9:0] 	  sd_len, output wire sd_adv,
+    output wire[23:0] 	  next_adr, output wire[15:0] wdata,
+    input 		  sd_ready, input sd_ack,
+    input 		  sd_data_valid, input wire[15:0] sd_data,
+    input 		  sd_data_next, input sd_write_done);
+
+   localparam DESCW = 1 + 1 + LENW + 24 + 24;
+   localparam BAW = 9;		// Buffer address width, CHUNK <= 2**BAW
+
+   wire dq_empty, dq_pop;
+   wire [DESCW-1:0] dq_head;
+   reg dq_ready = 0;		// Head of queue is valid
+
+   fifo #(.W(DESCW), .AW(QAW))
+     desc_q(clk, 1'b0,
+	    push, {fill, irq, len, dst, src},
+	    dq_pop, dq_head,
+	    level, dq_empty, full);
+
+   // Current descriptor.
+   reg have = 0;
+   reg c_fill, c_irq;
+   reg [LENW-1:0] c_left;
+   reg [23:0] c_dst, c_src;
+   reg [LENW-1:0] blk;		// Length of current chunk
+   // States for one-hot state machine, while have is set.
+   reg st_read = 0, st_write = 0;
+   reg b_start = 0, b_rwn;
+   reg [23:0] b_adr;
+   wire b_busy;
+   wire [LENW-1:0] b_count_unused;
+   reg [BAW-1:0] buf_w_idx, buf_r_idx;
+   wire [15:0] buf_q;
+   reg [7:0] n_done = 0;
+   reg irq_r = 0;
+   wire [23:0] after_adr;	// Start of the chunk's next burst
+
+   sdram_burst #(.LENW(LENW))
+     copy_burst(clk,
+		b_start, b_rwn, b_adr, blk, after_adr,
+		b_busy, b_count_unused,
+		sd_adr, sd_rwn, sd_len, sd_adv, next_adr,
+		sd_ready, sd_ack, sd_data_valid, sd_write_done);
+
+   // The controller takes each word the cycle after sd_data_next, which
+   // is when the registered block RAM output has moved to it.
+   dpram #(.W(16), .AW(BAW))
+     copy_buf(clk, st_read & sd_data_valid, buf_w_idx, sd_data,
+	      buf_r_idx, buf_q);
+
+   // A copy chunk's read is followed by its write, and the write by the
+   // read of the next chunk.
+   assign after_adr = st_read ? c_dst :
+		      (c_fill ? c_dst : c_src) + blk[23:0];
+   assign dq_pop = !have & dq_ready;
+   assign busy = st_read | st_write;
+   assign pending = have | !dq_empty;
+   assign wdata = c_fill ? c_src[15:0] : buf_q;
+   assign inv = b_start & !b_rwn;
+   assign done_cnt = n_done;
+   assign irq_out = irq_r;
+
+   always @(posedge clk) begin
+      dq_ready <= !dq_empty & !dq_pop;
+      b_start <= 0;
+
+      if (dq_pop) begin
+	 {c_fill, c_irq, c_left, c_dst, c_src} <= dq_head;
+	 have <= 1;
+      end
+
+      if (irq_clr)
+	irq_r <= 0;
+
+      // Finish the descriptor, or start its next chunk.
+      if (have & !busy & !b_start & (c_left == 0)) begin
+	 have <= 0;
+	 n_done <= n_done + 1;
+	 if (c_irq)
+	   irq_r <= 1;
+      end else if (have & !busy & !b_start & go) begin
+	 blk <= (c_left > CHUNK) ? CHUNK : c_left;
+	 b_rwn <= !c_fill;
+	 b_adr <= c_fill ? c_dst : c_src;
+	 b_start <= 1;
+	 buf_w_idx <= 0;
+	 buf_r_idx <= 0;
+	 if (c_fill)
+	   st_write <= 1;
+	 else
+	   st_read <= 1;
+      end
+
+      if (st_read & sd_data_valid)
+	buf_w_idx <= buf_w_idx + 1;
+      if (st_write & sd_data_next)
+	buf_r_idx <= buf_r_idx + 1;
+
+      if (st_read & !b_start & !b_busy) begin
+	 st_read <= 0;
+	 st_write <= 1;
+	 b_rwn <= 0;
+	 b_adr <= c_dst;
+	 b_start <= 1;
+      end
+      if (st_write & !b_start & !b_busy) begin
+	 st_write <= 0;
+	 c_left <= c_left - blk;
+	 c_dst <= c_dst + blk[23:0];
+	 if (!c_fill)
+	   c_src <= c_src + blk[23:0];
+      end
+   end
+endmodule
@@ -0,0 +1,45 @@
+/*
+  CRC-32 and sum of a stream of 16-bit words.
+
+  Each word with valid is taken as two bytes, low byte first, into a CRC-32
+  (IEEE 802.3 polynomial, reflected, initial value and final xor all
+  ones, as zlib's crc32()), and added into a 32-bit sum of the words, whose
+  low half is the 16-bit sum. clr starts over. The words go through one
+  register stage first; busy is set while one is in it.
+*/
+module sdram_crc
+   (input clk,
+    input clr, input valid, input wire[15:0] data,
+    output busy, output wire[31:0] crc, output reg[31:0] sum);
+
+   // Next CRC register value after the 16 bits of d, least significant
+   // bit first.
+   function [31:0] crc32_16(input [31:0] c, input [15:0] d);
+      integer k;
+      begin
+	 crc32_16 = c;
+	 for (k = 0; k < 16; k = k + 1)
+	   crc32_16 = (crc32_16[0] ^ d[k]) ?
+		      (crc32_16 >> 1) ^ 32'hedb88320 : (crc32_16 >> 1);
+      end
+   endfunction
+
+   reg d_valid = 0;
+   reg [15:0] d;
+   reg [31:0] c;
+
+   assign busy = d_valid;
+   assign crc = ~c;
+
+   always @(posedge clk) begin
+      d_valid <= valid & !clr;
+      d <= data;
+      if (clr) begin
+	 c <= 32'hffffffff;
+	 sum <= 0;
+      end else if (d_valid) begin
+	 c <= crc32_16(c, d);
+	 sum <= sum + {16'h0000, d};
+      end
+   end
+endmodule
@@ -136,8 +136,14 @@ parameter CMD_STATE_BURSTSTOP_READ_DELAY       = 5'b10001;
 parameter CMD_STATE_PRECHARGE                  = 5'b11001;
 parameter CMD_STATE_PRECHARGE_DELAY            = 5'b11101;
 parameter CMD_STATE_POWER_DOWN_MODE            = 5'b01101;
-
-//-- 01101 01100 01000 01010 11010 11011 10011 10010 10110 10100 00100
+parameter CMD_STATE_PRECHARGE_BANK             = 5'b01100;
+parameter CMD_STATE_PRECHARGE_BANK_DELAY       = 5'b01000;
+parameter CMD_STATE_PRECHARGE_ALL              = 5'b01010;
+parameter CMD_STATE_PRECHARGE_ALL_DELAY        = 5'b11010;
+parameter CMD_STATE_READ_BURST                 = 5'b11011;
+parameter CMD_STATE_WRITE_BURST                = 5'b10011;
+
+//-- 10010 10110 10100 00100
 
 /*******************************************************************************
  * Initialization FSM States defined as Gray encoding 
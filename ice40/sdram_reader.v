@@ -0,0 +1,69 @@
+/*
+  Chunked reader of an SDRAM range, feeding the near-memory engines.
+
+  start reads len words from word address adr; pending is set until all
+  have come. The range is read in chunks of up to CHUNK words, each
+  started when go allows (so other SDRAM traffic gets in between chunks)
+  and owning the controller while busy. The words are presented in address
+  order on valid/data, straight from the controller. stop ends the range
+  early, after the current chunk.
+*/
+module sdram_reader #(parameter CHUNK=512, LENW=25)
+   (input clk,
+    input 		  start, input wire[23:0] adr, input wire[LENW-1:0] len,
+    input 		  go, input stop, output busy, output pending,
+    output 		  valid, output wire[15:0] data,
+    // Towards sdram controller.
+    output wire[23:0] 	  sd_adr, output wire sd_rwn,
+    output wire[9:0] 	  sd_len, output wire sd_adv,
+    output wire[23:0] 	  next_adr,
+    input 		  sd_ready, input sd_ack,
+    input 		  sd_data_valid, input wire[15:0] sd_data,
+    input 		  sd_write_done);
+
+   reg pend = 0;
+   reg st_read = 0;
+   reg b_start = 0;
+   reg [23:0] cur;		// Start of next chunk
+   reg [LENW-1:0] left;		// Words not yet read
+   reg [LENW-1:0] blk;		// Length of current chunk
+   wire b_busy;
+   wire [LENW-1:0] b_count_unused;
+
+   sdram_burst #(.LENW(LENW))
+     reader_burst(clk,
+		  b_start, 1'b1, cur, blk, cur + blk[23:0],
+		  b_busy, b_count_unused,
+		  sd_adr, sd_rwn, sd_len, sd_adv, next_adr,
+		  sd_ready, sd_ack, sd_data_valid, sd_write_done);
+
+   assign pending = pend;
+   assign busy = st_read;
+   assign valid = st_read & sd_data_valid;
+   assign data = sd_data;
+
+   always @(posedge clk) begin
+      b_start <= 0;
+
+      if (start & !pend) begin
+	 cur <= adr;
+	 left <= len;
+	 pend <= 1;
+      end
+
+      // Finish, or start the next chunk.
+      if (pend & !st_read & !b_start & ((left == 0) | stop))
+	pend <= 0;
+      else if (pend & !st_read & !b_start & go) begin
+	 blk <= (left > CHUNK) ? CHUNK : left;
+	 b_start <= 1;
+	 st_read <= 1;
+      end
+
+      if (st_read & !b_start & !b_busy) begin
+	 st_read <= 0;
+	 cur <= cur + blk[23:0];
+	 left <= left - blk;
+      end
+   end
+endmodule
@@ -0,0 +1,108 @@
+/*
+  Search and reduction over a stream of 16-bit words.
+
+  clr starts over with operation op. Of the words with valid, one in every
+  stride is taken (0 counts as 1), starting with the first; the word is
+  and'ed with mask, and with sgn, compared and summed as signed. Results,
+  with index an offset in words from the first one:
+    OP_FIND   result is the first word matching key under mask, index its
+              offset; found is set once it is seen.
+    OP_COUNT  result is the number of matching words, index the offset of
+              the first.
+    OP_MIN,   result is the smallest or largest value, sign extended with
+    OP_MAX    sgn, index the offset of its first occurrence.
+    OP_SUM    result is the sum of the values, index the number of them.
+  index is all ones while nothing has matched (or been taken, for min and
+  max). The words go through one register stage first; busy is set while
+  one is in it.
+*/
+module sdram_scan #(parameter LENW=25)
+   (input clk,
+    input 		  clr, input wire[2:0] op, input sgn,
+    input wire[15:0] 	  key, input wire[15:0] mask, input wire[7:0] stride,
+    input 		  valid, input wire[15:0] data,
+    output 		  busy, output found,
+    output reg[31:0] 	  result, output reg[31:0] index);
+
+   localparam OP_FIND = 3'd0, OP_COUNT = 3'd1, OP_MIN = 3'd2, OP_MAX = 3'd3,
+     OP_SUM = 3'd4;
+
+   reg [2:0] op_r;
+   reg sgn_r;
+   reg [15:0] key_r, mask_r;
+   reg [7:0] step;		// Words skipped after each one taken
+   reg [7:0] skip = 0;		// Words to skip before the next one taken
+   reg [LENW-1:0] pos = 0;	// Offset of the next word
+   reg hit = 0;			// Something matched or was taken
+   reg d_valid = 0;
+   reg [15:0] d;
+   reg [LENW-1:0] d_pos;
+   wire [31:0] d_index;
+   wire [15:0] v, flip;
+   wire [31:0] vx;
+   wire match, less, more;
+
+   assign d_index = {{32-LENW{1'b0}}, d_pos};
+
+   assign busy = d_valid;
+   assign found = hit & (op_r == OP_FIND);
+
+   assign v = d & mask_r;
+   assign vx = {{16{sgn_r & v[15]}}, v};
+   assign match = (v == (key_r & mask_r));
+   // Inverting the sign bits makes the unsigned compare a signed one.
+   assign flip = {sgn_r, 15'd0};
+   assign less = (v ^ flip) < (result[15:0] ^ flip);
+   assign more = (result[15:0] ^ flip) < (v ^ flip);
+
+   always @(posedge clk) begin
+      if (clr) begin
+	 op_r <= op;
+	 sgn_r <= sgn;
+	 key_r <= key;
+	 mask_r <= mask;
+	 step <= (stride == 0) ? 8'd0 : stride - 1;
+	 skip <= 0;
+	 pos <= 0;
+	 hit <= 0;
+	 d_valid <= 0;
+	 result <= 0;
+	 index <= (op == OP_SUM) ? 32'd0 : 32'hffffffff;
+      end else begin
+	 d_valid <= valid & (skip == 0);
+	 d <= data;
+	 d_pos <= pos;
+	 if (valid) begin
+	    pos <= pos + 1;
+	    skip <= (skip == 0) ? step : skip - 1;
+	 end
+
+	 if (d_valid)
+	   case (op_r)
+	     OP_FIND:
+	       if (match & !hit) begin
+		  hit <= 1;
+		  result <= {16'h0000, d};
+		  index <= d_index;
+	       end
+	     OP_COUNT:
+	       if (match) begin
+		  hit <= 1;
+		  result <= result + 1;
+		  if (!hit)
+		    index <= d_index;
+	       end
+	     OP_MIN, OP_MAX:
+	       if (!hit | ((op_r == OP_MIN) ? less : more)) begin
+		  hit <= 1;
+		  result <= vx;
+		  index <= d_index;
+	       end
+	     default: begin
+		result <= result + vx;
+		index <= index + 1;
+	     end
+	   endcase
+      end
+   end
+endmodule
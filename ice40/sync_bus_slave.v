@@ -0,0 +1,175 @@
+/*
+  Synchronous (PSRAM mode) FSMC bus slave, clocked from FSMC_CLK.
+
+  Presents the same client interface as clocked_bus_slave, in the clk
+  domain, so the register logic in top is shared. The FSMC side runs on
+  aCLK without synchronisers: the first clock with NE low latches the
+  address, and data beats follow from clock FIRST_DATA of the access
+  (FSMC DataLatency + 2), one per clock unless held off with nwait.
+  Within a burst the address increments per beat, except for the streaming
+  data port which increments internally.
+
+  Writes are posted: each beat goes as {address, data} into a dual-clock
+  command FIFO, and is handed to the client as do_write (with w_adr/w_data
+  valid the same cycle) when wr_wait allows. nwait holds the FSMC while the
+  command FIFO is full.
+
+  Register reads send a read command across and wait (nwait low) for the
+  response, one beat at a time. The FSMC does not say how many beats it
+  wants, so the command for a further beat is sent when the FSMC waits at
+  a data edge with NE still low; if the access ends there instead, the
+  response is dropped when it arrives. Such a read must not change
+  anything, so the client applies the side effects of a register read
+  (buffer index advance and the like) on r_taken, which comes back
+  through the command FIFO when the FSMC has actually taken the beat,
+  with r_adr set to its address. Responses carry the sequence number of
+  their command; only one command is in flight, and a response is used
+  only if it answers the last command, sent in the current access.
+
+  Reads of the streaming data port do not go through commands. Instead,
+  words are moved from the client's stream FIFO (stream_valid/stream_data,
+  popped with stream_pop) into a dual-clock FIFO ahead of time, so stream
+  read bursts can run at one word per FSMC clock. Each stream restart
+  (write to STREAM_ADR_REG) starts a new epoch on both sides, and words from
+  an older epoch are dropped on the FSMC side.
+*/
+module sync_bus_slave #(parameter ADRW=1, DATW=1, FIRST_DATA=2,
+			DATA_STREAM_REG=0, STREAM_ADR_REG=0)
+  (input 		 aCLK, input aNE, aNOE, aNWE,
+   input wire [ADRW-1:0] aAn, input wire[DATW-1:0] aDn,
+   input 		 clk,
+   output reg[ADRW-1:0]  r_adr, output wire[ADRW-1:0] w_adr,
+   output reg 		 do_read, input wire[DATW-1:0] read_data,
+   output 		 do_write, output wire[DATW-1:0] w_data,
+   output 		 io_output, output wire[DATW-1:0] io_data,
+   input 		 rd_wait, input wr_wait, output nwait,
+   output reg 		 r_taken,
+   input 		 stream_valid, input wire[DATW-1:0] stream_data,
+   output 		 stream_pop, input stream_restart);
+
+   localparam SEQW = 3;
+   localparam CW = 2 + SEQW + ADRW + DATW;
+
+   // FSMC clock domain.
+   reg 			 active = 0;	// Inside an access (NE low)
+   reg[3:0] 		 cnt;		// FSMC clocks since start of access
+   reg[ADRW-1:0] 	 f_adr;		// Address of current beat
+   reg 			 is_stream;	// Access is to the streaming data port
+   reg[SEQW-1:0] 	 f_seq = 0;	// Sequence number of last read command
+   reg 			 f_want = 0;	// Last read command is for this access
+   wire[SEQW-1:0] 	 next_seq;
+   reg 			 f_epoch = 0;	// Toggled per stream restart
+   reg 			 outstanding = 0; // Register read command in flight
+   wire 		 data_edge, f_read, f_write, src_valid;
+   wire 		 rd_cmd, wr_beat, rd_beat, rd_taken;
+   wire 		 c_push, c_full;
+   wire 		 rsp_pop, rsp_empty;
+   wire[SEQW-1:0] 	 rsp_seq;
+   wire 		 sq_pop, sq_empty, sq_epoch;
+   wire[DATW-1:0] 	 rsp_data, sq_data;
+
+   // Client clock domain.
+   wire 		 c_pop, c_empty, c_wr, c_taken, c_read, c_commit;
+   wire[SEQW-1:0] 	 c_seq;
+   wire[ADRW-1:0] 	 c_adr;
+   wire[DATW-1:0] 	 c_data;
+   reg 			 s_reading = 0;	// Read command waiting for client
+   reg[SEQW-1:0] 	 s_seq;
+   reg 			 s_epoch = 0;
+   wire 		 s_done, rsp_full, sq_full;
+
+   // Commands are writes, reads, and notices of beats taken, which carry
+   // the address of the beat.
+   async_fifo #(.W(CW), .AW(4))
+     cmd_fifo(aCLK, c_push, {f_write, rd_taken, next_seq, f_adr, aDn}, c_full,
+	      clk, c_pop, {c_wr, c_taken, c_seq, c_adr, c_data}, c_empty);
+   async_fifo #(.W(SEQW+DATW), .AW(2))
+     rsp_fifo(clk, s_done, {s_seq, read_data}, rsp_full,
+	      aCLK, rsp_pop, {rsp_seq, rsp_data}, rsp_empty);
+   async_fifo #(.W(1+DATW), .AW(8))
+     stream_q(clk, stream_pop, {s_epoch, stream_data}, sq_full,
+	      aCLK, sq_pop, {sq_epoch, sq_data}, sq_empty);
+
+   /* FSMC side. */
+   assign f_read = ~aNOE;
+   assign f_write = ~aNWE;
+   // Clock edges where the FSMC samples (read) or drives (write) a beat.
+   assign data_edge = active & ~aNE & (cnt >= FIRST_DATA);
+   // A register beat also needs room for its notice.
+   assign src_valid = is_stream ? (~sq_empty & (sq_epoch == f_epoch)) :
+		      (~rsp_empty & f_want & (rsp_seq == f_seq) & ~c_full);
+   // The FSMC takes a beat when nwait was high at a data edge.
+   assign rd_beat = data_edge & f_read & src_valid;
+   assign wr_beat = data_edge & f_write & ~c_full;
+   assign rd_taken = rd_beat & ~is_stream;
+   // The first beat of a read is always wanted, so its command goes out as
+   // soon as the address is known; further ones only while the FSMC waits
+   // for a beat. Any other response is left over from an earlier access,
+   // and is dropped when it arrives.
+   assign rd_cmd = active & ~aNE & f_read & ~is_stream & ~outstanding &
+		   ~c_full & (~f_want | data_edge);
+   assign c_push = rd_cmd | wr_beat | rd_taken;
+   assign next_seq = f_seq + 1;
+   assign rsp_pop = ~rsp_empty & (~f_want | (rsp_seq != f_seq) | rd_taken);
+   assign sq_pop = ~sq_empty & ((sq_epoch != f_epoch) | (rd_beat & is_stream));
+
+   always @(posedge aCLK) begin
+      if (aNE)
+	active <= 0;
+      else if (~active) begin
+	 // First clock of the access, address valid.
+	 active <= 1;
+	 cnt <= 1;
+	 f_adr <= aAn;
+	 is_stream <= (aAn == DATA_STREAM_REG);
+	 f_want <= 0;
+      end else begin
+	 if (cnt != 4'hf)
+	   cnt <= cnt + 1;
+	 if ((rd_beat | wr_beat) & (f_adr != DATA_STREAM_REG))
+	   f_adr <= f_adr + 1;
+	 if (wr_beat & (f_adr == STREAM_ADR_REG))
+	   f_epoch <= ~f_epoch;
+      end
+
+      if (rd_cmd) begin
+	 f_seq <= next_seq;
+	 f_want <= 1;
+	 outstanding <= 1;
+      end else if (rsp_pop)
+	outstanding <= 0;
+   end
+
+   assign nwait = aNE | (f_write ? ~c_full : src_valid);
+   assign io_output = ~aNE & ~aNOE;
+   assign io_data = is_stream ? sq_data : rsp_data;
+
+   /* Client side. */
+   assign c_read = ~c_empty & ~c_wr & ~c_taken & ~s_reading;
+   assign c_commit = ~c_empty & c_taken & ~s_reading;
+   assign do_write = ~c_empty & c_wr & ~s_reading & ~wr_wait;
+   assign c_pop = c_read | c_commit | do_write;
+   assign w_adr = c_adr;
+   assign w_data = c_data;
+   // As in clocked_bus_slave, read_data is taken from the do_read cycle on,
+   // once the client stops waiting.
+   assign s_done = s_reading & ~rd_wait;
+
+   always @(posedge clk) begin
+      do_read <= c_read;
+      r_taken <= c_commit;
+      if (c_read | c_commit)
+	r_adr <= c_adr;
+      if (c_read) begin
+	 s_seq <= c_seq;
+	 s_reading <= 1;
+      end else if (s_done)
+	s_reading <= 0;
+
+      if (stream_restart)
+	s_epoch <= ~s_epoch;
+   end
+
+   // Move prefetched stream words across whenever there is room.
+   assign stream_pop = stream_valid & ~sq_full;
+endmodule
@@ -0,0 +1,231 @@
+#include <stdio.h>
+
+#include "fsmc_model.h"
+
+/* Clocks NWAIT may hold a single access before it is reported as stuck. */
+static const unsigned WAIT_TIMEOUT = 100000;
+
+
+void
+FsmcModel::error(const char *what)
+{
+  if (errors++ < 20)
+    fprintf(stderr, "fsmc: %s access to 0x%02x: %s\n",
+            write ? "write" : "read", adr, what);
+}
+
+
+void
+FsmcModel::start(bool wr, uint8_t a, unsigned words, const uint16_t *d,
+                 unsigned lanes)
+{
+  write = wr;
+  adr = a;
+  n = words ? words : 1;
+  nbl = lanes;
+  if (n > 1 && !tm.sync)
+    error("bursts need synchronous mode");
+  buf.assign(n, 0);
+  if (write)
+    for (unsigned k = 0; k < n; ++k)
+      buf[k] = d[k];
+  st = START;
+}
+
+
+void
+FsmcModel::finish_read(uint16_t d, bool d_valid)
+{
+  if (!d_valid)
+    error("data bus not driven when sampled");
+  buf[i] = d;
+}
+
+
+void
+FsmcModel::hclk(uint16_t d, bool d_valid, bool nwait)
+{
+  bool end = false;
+
+  nw_sync[1] = nw_sync[0];
+  nw_sync[0] = nwait;
+
+  switch (st)
+  {
+  case IDLE:
+    break;
+
+  case START:
+    pins.ne = false;
+    pins.a = adr;
+    pins.nbl = nbl;
+    i = 0;
+    cnt = 0;
+    st = ADDR;
+    break;
+
+  case ADDR:
+    if (++cnt >= tm.addset)
+    {
+      cnt = 0;
+      waiting = false;
+      st = DATA;
+      if (write)
+      {
+        pins.nwe = false;
+        pins.d_oe = true;
+        pins.d = buf[0];
+      }
+      else
+        pins.noe = false;
+    }
+    break;
+
+  case DATA:
+  {
+    unsigned datast = write ? tm.wr_datast : tm.datast;
+    unsigned chk = datast > 3 ? datast - 3 : 1;
+
+    ++cnt;
+    if (waiting)
+    {
+      ++wait_clocks;
+      if (nw_sync[1])
+      {
+        waiting = false;
+        cnt = 0;
+        st = RELEASE;
+      }
+      else if (cnt > WAIT_TIMEOUT)
+      {
+        error("NWAIT stuck low");
+        end = true;
+      }
+    }
+    else if (tm.async_wait && cnt == chk && !nw_sync[1])
+    {
+      waiting = true;
+      ++wait_clocks;
+    }
+    else if (cnt >= datast)
+      end = true;
+    break;
+  }
+
+  case RELEASE:
+    if (++cnt >= 2)
+      end = true;
+    break;
+
+  case WHOLD:
+    pins.ne = true;
+    pins.d_oe = false;
+    cnt = 0;
+    st = GAP;
+    break;
+
+  case GAP:
+    if (++cnt >= tm.busturn + 1)
+      st = IDLE;
+    break;
+  }
+
+  if (end)
+  {
+    if (write)
+    {
+      pins.nwe = true;
+      st = WHOLD;
+    }
+    else
+    {
+      finish_read(d, d_valid);
+      pins.noe = true;
+      pins.ne = true;
+      cnt = 0;
+      st = GAP;
+    }
+  }
+}
+
+
+void
+FsmcModel::clk_fall()
+{
+  switch (st)
+  {
+  case START:
+    pins.ne = false;
+    pins.a = adr;
+    pins.nbl = nbl;
+    if (write)
+    {
+      pins.nwe = false;
+      pins.d_oe = true;
+      pins.d = buf[0];
+    }
+    else
+      pins.noe = false;
+    i = 0;
+    cnt = 0;
+    done = false;
+    st = DATA;
+    break;
+
+  case DATA:
+    if (done && (write || cnt++ >= tm.ne_hold))
+    {
+      pins.ne = pins.noe = pins.nwe = true;
+      pins.d_oe = false;
+      cnt = 0;
+      st = GAP;
+    }
+    else if (write)
+      pins.d = buf[i];
+    break;
+
+  default:
+    break;
+  }
+}
+
+
+void
+FsmcModel::clk_rise(uint16_t d, bool d_valid, bool nwait)
+{
+  switch (st)
+  {
+  case DATA:
+    if (done || cnt++ < tm.datlat + 2)
+      break;
+    if (nwait)
+    {
+      if (!write)
+        finish_read(d, d_valid);
+      if (++i == n)
+      {
+        done = true;
+        cnt = 0;
+      }
+    }
+    else
+    {
+      ++wait_clocks;
+      if (cnt > WAIT_TIMEOUT)
+      {
+        error("NWAIT stuck low");
+        done = true;
+        cnt = 0;
+      }
+    }
+    break;
+
+  case GAP:
+    if (++cnt >= tm.busturn + 1)
+      st = IDLE;
+    break;
+
+  default:
+    break;
+  }
+}
@@ -0,0 +1,92 @@
+/*
+  Model of the STM32F4 FSMC driving the FPGA bus (NOR/SRAM bank 1, 16-bit,
+  address/data not multiplexed), as set up by fsmc_manual_init() in
+  stm32/main.c.
+
+  Asynchronous mode (access mode A with AsynchronousWait) is stepped on
+  each rising HCLK edge: ADDSET clocks of address phase, then NOE or NWE
+  low for DATAST clocks. NWAIT goes through two HCLK flip-flops and is
+  looked at DATAST - 3 clocks into the data phase; if it is low there the
+  FSMC waits, and ends the access two clocks after it sees NWAIT high
+  again. Reads sample the data bus at the end of the data phase. Writes
+  drive the data from NWE low, and hold it for one clock after NWE rises,
+  when NE rises. BUSTURN + 1 clocks pass with NE high before the next
+  access.
+
+  Synchronous mode (PSRAM, burst, WaitSignal during the wait state) is
+  stepped on FSMC_CLK, which is assumed to run continuously; the FPGA's
+  sync bus slave needs at least one clock with NE high between accesses,
+  and this model gives it BUSTURN + 1. Outputs change on falling edges.
+  Beats are taken on rising edges from DATLAT + 2 clocks after the first
+  rising edge with NE low, on each edge where NWAIT is high.
+
+  Timing parameters are the FSMC register values; DATAST and CLKDIV count
+  as in the reference manual (FSMC_CLK = HCLK / (CLKDIV + 1)). Writes use
+  WR_DATAST, from the extended mode write timing register.
+*/
+#ifndef FSMC_MODEL_H
+#define FSMC_MODEL_H
+
+#include <stdint.h>
+#include <vector>
+
+struct FsmcTiming {
+  unsigned addset = 2, datast = 8, wr_datast = 5, busturn = 2;
+  bool async_wait = true;
+  bool sync = false;
+  unsigned clkdiv = 2, datlat = 0;
+  unsigned ne_hold = 0;                 // Sync: clocks NE stays low after a last read beat
+};
+
+struct FsmcPins {
+  bool ne = true, noe = true, nwe = true;
+  uint8_t a = 0;
+  unsigned nbl = 0;                     // Byte lanes, active low
+  bool d_oe = false;
+  uint16_t d = 0;
+};
+
+class FsmcModel {
+public:
+  explicit FsmcModel(const FsmcTiming &timing = FsmcTiming()) : tm(timing) {}
+
+  /* Start an access of N words (more than 1 only in synchronous mode). */
+  void start(bool write, uint8_t adr, unsigned n, const uint16_t *data,
+             unsigned nbl = 0);
+  bool busy() const { return st != IDLE; }
+  /* Read data of the last access. */
+  const std::vector<uint16_t> &data() const { return buf; }
+
+  /* Asynchronous mode: rising HCLK edge, with the bus before the edge. */
+  void hclk(uint16_t d, bool d_valid, bool nwait);
+  /* Synchronous mode: FSMC_CLK edges. */
+  void clk_rise(uint16_t d, bool d_valid, bool nwait);
+  void clk_fall();
+
+  const FsmcTiming &timing() const { return tm; }
+  void set_timing(const FsmcTiming &timing) { tm = timing; }
+
+  FsmcPins pins;
+  uint64_t errors = 0;
+  uint64_t wait_clocks = 0;             // Clocks NWAIT held an access
+
+private:
+  enum State { IDLE, START, ADDR, DATA, RELEASE, WHOLD, GAP };
+
+  FsmcTiming tm;
+  State st = IDLE;
+  bool write = false;
+  uint8_t adr = 0;
+  unsigned nbl = 0;
+  unsigned n = 0, i = 0;
+  unsigned cnt = 0;
+  bool waiting = false;
+  bool done = false;                    // Sync: last beat taken
+  bool nw_sync[2] = {true, true};
+  std::vector<uint16_t> buf;
+
+  void error(const char *what);
+  void finish_read(uint16_t d, bool d_valid);
+};
+
+#endif
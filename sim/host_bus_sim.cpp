@@ -0,0 +1,138 @@
+/*
+  The host access layer of stm32/main.c (stm32/host/host_bus.h) over the
+  board model, so that the firmware tests run against the Verilated design:
+  "make host" in ../stm32 links main.c built with HOST_BUILD with this.
+
+  Every FPGA access is an FSMC access of the model, and cycle_count() is
+  the model's HCLK count. The MCU instructions between accesses take no
+  time here, so software-side timings read lower than on the board, but
+  the FPGA side is timed as in tb_top.
+
+  Usage: sdram-stm32-host [-t test] [-r rounds] [-d datast] [-v trace.vcd]
+*/
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "verilated.h"
+
+#include "system.h"
+#include "../stm32/host/host_bus.h"
+
+static System *sys;
+static unsigned rounds = 1, round_no;
+
+
+/* FSMC address lines A[7:0] are HADDR[8:1] for the 16-bit bus. */
+static uint8_t
+reg(uint32_t offset)
+{
+  return offset >> 1;
+}
+
+
+uint32_t
+host_bus_init(int argc, char **argv)
+{
+  SystemConfig cfg;
+  unsigned test = 8;
+  int opt;
+
+  Verilated::commandArgs(argc, argv);
+#ifdef FSMC_SYNC
+  cfg.fsmc.sync = true;
+  cfg.fsmc.busturn = 1;
+#endif
+  while ((opt = getopt(argc, argv, "t:r:d:v:")) != -1)
+  {
+    switch (opt)
+    {
+    case 't': test = strtoul(optarg, nullptr, 0); break;
+    case 'r': rounds = strtoul(optarg, nullptr, 0); break;
+    case 'd': cfg.fsmc.datast = strtoul(optarg, nullptr, 0); break;
+    case 'v': cfg.vcd = optarg; break;
+    default:
+      fprintf(stderr, "usage: %s [-t test] [-r rounds] [-d datast] "
+              "[-v trace.vcd]\n", argv[0]);
+      exit(2);
+    }
+  }
+
+  sys = new System(cfg);
+  if (!sys->wait_init())
+  {
+    fprintf(stderr, "host: SDRAM controller did not finish "
+            "initialisation\n");
+    exit(1);
+  }
+  sys->sdram.reset_stats();
+  return test;
+}
+
+
+/* A byte store enables only the byte lane of OFFSET; NBL is active low. */
+void
+host_bus_write8(uint32_t offset, uint8_t val)
+{
+  if (offset & 1)
+    sys->write16(reg(offset), (uint16_t)val << 8, 0x1);
+  else
+    sys->write16(reg(offset), val, 0x2);
+}
+
+
+void
+host_bus_write16(uint32_t offset, uint16_t val)
+{
+  sys->write16(reg(offset), val);
+}
+
+
+uint16_t
+host_bus_read16(uint32_t offset)
+{
+  return sys->read16(reg(offset));
+}
+
+
+void
+host_bus_write32(uint32_t offset, uint32_t val)
+{
+  sys->write32(reg(offset), val);
+}
+
+
+uint32_t
+host_bus_read32(uint32_t offset)
+{
+  return sys->read32(reg(offset));
+}
+
+
+uint32_t
+host_bus_cycles(void)
+{
+  return (uint32_t)sys->hclk();
+}
+
+
+void
+host_bus_idle(uint32_t hclks)
+{
+  sys->idle_hclk(hclks);
+}
+
+
+void
+host_bus_round_end(void)
+{
+  uint64_t errors;
+
+  if (++round_no < rounds)
+    return;
+  fflush(stdout);
+  sys->report(stdout);
+  errors = sys->errors();
+  printf("%llu errors\n", (unsigned long long)errors);
+  delete sys;
+  exit(errors ? 1 : 0);
+}
@@ -0,0 +1,33 @@
+/*
+  Minimal models of the iCE40 cells used in ice40/, for Verilator.
+
+  SB_PLL40_CORE passes the reference clock through; the testbench drives
+  crystal_clk at the PLL output frequency instead of 12 MHz. SB_IO only
+  models the input path, the testbench resolves the bus (see sim_top.v).
+*/
+module SB_PLL40_CORE #(parameter FEEDBACK_PATH="SIMPLE",
+		       PLLOUT_SELECT="GENCLK",
+		       DIVR=4'd0, DIVF=7'd0, DIVQ=3'd0,
+		       FILTER_RANGE=3'd0)
+   (input REFERENCECLK, RESETB, BYPASS,
+    output PLLOUTGLOBAL, PLLOUTCORE, LOCK);
+
+   assign PLLOUTGLOBAL = REFERENCECLK;
+   assign PLLOUTCORE = REFERENCECLK;
+   assign LOCK = RESETB;
+endmodule
+
+
+module SB_IO #(parameter PIN_TYPE=6'b0, PULLUP=1'b0)
+   (inout PACKAGE_PIN, input OUTPUT_ENABLE, input D_OUT_0,
+    output D_IN_0);
+
+   assign D_IN_0 = PACKAGE_PIN;
+endmodule
+
+
+module SB_GB
+   (input USER_SIGNAL_TO_GLOBAL_BUFFER, output GLOBAL_BUFFER_OUTPUT);
+
+   assign GLOBAL_BUFFER_OUTPUT = USER_SIGNAL_TO_GLOBAL_BUFFER;
+endmodule
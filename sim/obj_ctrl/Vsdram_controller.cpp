@@ -0,0 +1,1430 @@
+// Generated by the vl2cpp stand-in; do not edit.
+#include "Vsdram_controller.h"
+
+typedef unsigned __int128 u128;
+template<class T> static inline T vl_m(int w) {
+  return w >= (int)(8 * sizeof(T)) ? ~(T)0 : (((T)1 << w) - 1);
+}
+template<class T> static inline T vl_sext(T v, int w) {
+  if ((v >> (w - 1)) & 1) v |= ~vl_m<T>(w);
+  return v;
+}
+template<class T> static inline T vl_shl(T a, uint64_t n, int W) {
+  return n >= (uint64_t)W ? (T)0 : (T)((a << n) & vl_m<T>(W));
+}
+template<class T> static inline T vl_shr(T a, uint64_t n, int W) {
+  return n >= (uint64_t)W ? (T)0 : (T)(a >> n);
+}
+template<class T> static inline T vl_sar(T a, uint64_t n, int W) {
+  bool neg = (a >> (W - 1)) & 1;
+  if (n >= (uint64_t)W) return neg ? vl_m<T>(W) : (T)0;
+  T r = a >> n;
+  if (neg) r |= vl_m<T>(W) & ~vl_m<T>(W - (int)n);
+  return r;
+}
+template<class T> static inline T vl_divu(T a, T b) { return b ? a / b : 0; }
+template<class T> static inline T vl_modu(T a, T b) { return b ? a % b : 0; }
+static inline int64_t vl_s(uint64_t v, int w) {
+  return (int64_t)vl_sext<uint64_t>(v, w);
+}
+static inline uint64_t vl_divs(uint64_t a, uint64_t b, int w) {
+  int64_t x = vl_s(a, w), y = vl_s(b, w);
+  return y ? (uint64_t)(x / y) & vl_m<uint64_t>(w) : 0;
+}
+static inline uint64_t vl_mods(uint64_t a, uint64_t b, int w) {
+  int64_t x = vl_s(a, w), y = vl_s(b, w);
+  return y ? (uint64_t)(x % y) & vl_m<uint64_t>(w) : 0;
+}
+template<class T> static inline uint64_t vl_par(T v) {
+  return (__builtin_parityll((uint64_t)v) ^
+          __builtin_parityll((uint64_t)((u128)v >> 64))) & 1;
+}
+template<class T> static inline uint64_t vl_bit(T v, int64_t i, int w) {
+  return (i >= 0 && i < w) ? (uint64_t)((v >> i) & 1) : 0;
+}
+template<class T> static inline T vl_bits(T v, int64_t i, int w, int n) {
+  if (i < 0 || i >= w) return 0;
+  return (v >> i) & vl_m<T>(n);
+}
+template<class T> static inline T vl_pow(T a, uint64_t n, int W) {
+  T r = 1;
+  while (n--) r = (r * a) & vl_m<T>(W);
+  return r;
+}
+
+Vsdram_controller::Vsdram_controller(const char *) {
+}
+// ../ice40/sdram_control_fsm.v:231
+void Vsdram_controller::p0_() {
+  s_U0_o_sdram_dqm = (((((uint64_t)(s_U0_sdram_dqm_i))) ? 0x3ULL : (uint64_t)0) | ((((uint64_t)(s_U0_write_cmd_i)) != 0) ? ((uint64_t)(s_U0_i_dqm)) : ((0x0ULL) ? 0x3ULL : (uint64_t)0)));
+}
+// ../ice40/sdram_control_fsm.v:250
+void Vsdram_controller::p1_() {
+  s_U0_req_bank_i = ((uint64_t)((((uint64_t)(s_U0_i_addr)) >> 9) & 0x3ULL));
+}
+// ../ice40/sdram_control_fsm.v:251
+void Vsdram_controller::p2_() {
+  s_U0_req_row_i = ((uint64_t)((((uint64_t)(s_U0_i_addr)) >> 11) & 0x1fffULL));
+}
+// ../ice40/sdram_control_fsm.v:252
+void Vsdram_controller::p3_() {
+  s_U0_page_hit_i = (uint64_t)((vl_bit(((uint64_t)(s_U0_row_open_i)), (int64_t)(((uint64_t)(s_U0_req_bank_i))) - 0, 4) != 0) && ((uint64_t)((((((uint64_t)(s_U0_req_bank_i))) <= 3) ? (uint64_t)s_U0_open_row_i[(((uint64_t)(s_U0_req_bank_i))) - 0] : 0) == ((uint64_t)(s_U0_req_row_i))) != 0));
+}
+// ../ice40/sdram_control_fsm.v:253
+void Vsdram_controller::p4_() {
+  s_U0_page_miss_i = (uint64_t)((vl_bit(((uint64_t)(s_U0_row_open_i)), (int64_t)(((uint64_t)(s_U0_req_bank_i))) - 0, 4) != 0) && ((uint64_t)((((((uint64_t)(s_U0_req_bank_i))) <= 3) ? (uint64_t)s_U0_open_row_i[(((uint64_t)(s_U0_req_bank_i))) - 0] : 0) != ((uint64_t)(s_U0_req_row_i))) != 0));
+}
+// ../ice40/sdram_control_fsm.v:275
+void Vsdram_controller::p5_() {
+  s_U0_next_bank_i = ((uint64_t)((((uint64_t)(s_U0_i_next_addr)) >> 9) & 0x3ULL));
+}
+// ../ice40/sdram_control_fsm.v:276
+void Vsdram_controller::p6_() {
+  s_U0_next_row_i = ((uint64_t)((((uint64_t)(s_U0_i_next_addr)) >> 11) & 0x1fffULL));
+}
+// ../ice40/sdram_control_fsm.v:277
+void Vsdram_controller::p7_() {
+  s_U0_lookahead_slot_i = (uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(i_disable_precharge)) != 0) && (((uint64_t)(i_next_valid)) != 0)) != 0) && ((uint64_t)(((uint64_t)(s_U0_next_bank_i)) != ((uint64_t)(s_U0_req_bank_i))) != 0)) != 0) && ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x1ULL) != 0)) != 0) && ((uint64_t)(((uint64_t)((0x1ULL != 0) && ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x18ULL) != 0)) != 0) || ((uint64_t)((0x1ULL != 0) && ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x1eULL) != 0)) != 0)) != 0));
+}
+// ../ice40/sdram_control_fsm.v:281
+void Vsdram_controller::p8_() {
+  s_U0_lookahead_act_i = (uint64_t)((((uint64_t)(s_U0_lookahead_slot_i)) != 0) && ((uint64_t)(vl_bit(((uint64_t)(s_U0_row_open_i)), (int64_t)(((uint64_t)(s_U0_next_bank_i))) - 0, 4) == 0) != 0));
+}
+// ../ice40/sdram_control_fsm.v:282
+void Vsdram_controller::p9_() {
+  s_U0_lookahead_pre_i = (uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_U0_lookahead_slot_i)) != 0) && (vl_bit(((uint64_t)(s_U0_row_open_i)), (int64_t)(((uint64_t)(s_U0_next_bank_i))) - 0, 4) != 0)) != 0) && ((uint64_t)((((((uint64_t)(s_U0_next_bank_i))) <= 3) ? (uint64_t)s_U0_open_row_i[(((uint64_t)(s_U0_next_bank_i))) - 0] : 0) != ((uint64_t)(s_U0_next_row_i))) != 0)) != 0) && (vl_bit(((uint64_t)(s_U0_precharge_ok_i)), (int64_t)(((uint64_t)(s_U0_next_bank_i))) - 0, 4) != 0));
+}
+// ../ice40/sdram_control_fsm.v:297
+void Vsdram_controller::p10_() {
+  s_U0_write_issue_i = (uint64_t)(((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x13ULL) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x2ULL) != 0));
+}
+// ../ice40/sdram_control_fsm.v:318
+void Vsdram_controller::p11_() {
+  s_U0_bank_i = 0x0ULL;
+  for (int t6 = 0; (uint64_t)(vl_s(((uint64_t)(s_U0_bank_i)), 32) < vl_s(vl_shl<uint64_t>(0x1ULL, 0x2ULL, 32), 32)) != 0; ++t6) {
+    if (t6 > 1000000) vl_fatal("loop");
+    { int64_t t7 = (int64_t)(vl_s(((uint64_t)(s_U0_bank_i)), 32)) - 0; if (t7 >= 0 && t7 <= 3) s_U0_precharge_ok_i = (uint8_t)((((uint64_t)(s_U0_precharge_ok_i)) & ~(0x1ULL << t7)) | (((uint64_t)((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_U0_ras_count_i)), (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_U0_bank_i))) & 0xffffffffULL), 32)) - 0, 16, 4)))) == 0x0ULL) != 0) && ((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_U0_wr_count_i)), (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_U0_bank_i))) & 0xffffffffULL), 32)) - 0, 16, 4)))) == 0x0ULL) != 0))) & 0x1ULL) << t7)); }
+    s_U0_bank_i = ((uint64_t)(((uint64_t)(s_U0_bank_i)) + 0x1ULL) & 0xffffffffULL);
+  }
+}
+// ../ice40/sdram_control_fsm.v:346
+void Vsdram_controller::p12_() {
+  s_U0_read_pipeline_i = (uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)((0x1ULL != 0) && (((uint64_t)(i_adv)) != 0)) != 0) && (((uint64_t)(i_rwn)) != 0)) != 0) && ((uint64_t)((((uint64_t)(i_disable_active)) != 0) || (((uint64_t)(s_U0_page_hit_i)) != 0)) != 0)) != 0) && ((uint64_t)((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_refresh_req_i)) != 0) || (((uint64_t)(s_selfrefresh_i)) != 0)) != 0) || (((uint64_t)(i_loadmod_req)) != 0)) != 0) || (((uint64_t)(i_precharge_req)) != 0)) != 0) || (((uint64_t)(s_power_down_i)) != 0)) == 0) != 0));
+}
+// ../ice40/sdram_control_fsm.v:350
+void Vsdram_controller::p13_() {
+  s_U0_read_early_i = (uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_U0_read_pipeline_i)) != 0) && ((uint64_t)(((uint64_t)(o_ack)) == 0) != 0)) != 0) && ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x18ULL) != 0)) != 0) && ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_U0_ras_count_i)), (int64_t)((((uint64_t)((uint64_t)(s_U0_req_bank_i)) << 2) | (uint64_t)0x0ULL)) - 0, 16, 4)))) + 0x2ULL) & 0xffffffffULL) <= 0x4ULL) != 0));
+}
+// ../ice40/sdram_control_fsm.v:354
+void Vsdram_controller::p14_() {
+  o_pipe_ready = (uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x18ULL) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x1cULL) != 0)) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0xfULL) != 0));
+}
+// ../ice40/sdram_control_fsm.v:364
+void Vsdram_controller::p15_() {
+  o_power_state = (((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0xdULL) != 0) ? 0x1ULL : (((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x1ULL) != 0) ? 0x2ULL : (((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x5ULL) != 0) ? 0x3ULL : 0x0ULL)));
+}
+// ../ice40/sdram_control_fsm.v:446
+void Vsdram_controller::p16_() {
+  o_write_done = (uint64_t)((((uint64_t)(s_U0_write_done_i)) != 0) && ((uint64_t)(((uint64_t)(s_U0_write_done_reg_i)) == 0) != 0));
+}
+// ../ice40/sdram_control_fsm.v:447
+void Vsdram_controller::p17_() {
+  o_read_done = (uint64_t)((((uint64_t)(s_U0_read_done_i)) != 0) && ((uint64_t)(((uint64_t)(s_U0_read_done_reg_i)) == 0) != 0));
+}
+// ../ice40/sdram_control_fsm.v:462
+void Vsdram_controller::p18_() {
+  s_U0_read_cmd_state_i = (((uint64_t)(((uint64_t)(((uint64_t)(i_burst_len)))) > 0x1ULL) != 0) ? 0x1bULL : 0x6ULL);
+}
+// ../ice40/sdram_control_fsm.v:464
+void Vsdram_controller::p19_() {
+  s_U0_write_cmd_state_i = (((uint64_t)(((uint64_t)(((uint64_t)(i_burst_len)))) > 0x1ULL) != 0) ? 0x13ULL : 0x2ULL);
+}
+// ../ice40/sdram_control_fsm.v:477
+void Vsdram_controller::p20_() {
+  o_data_next = (uint64_t)(((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x13ULL) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x2ULL) != 0));
+}
+// ../ice40/sdram_control_fsm.v:805
+void Vsdram_controller::p21_() {
+  { uint64_t t22 = ((uint64_t)(s_U0_init_fsm_states_i));
+    if (t22 == 0x1ULL) {
+      s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+    } else if (t22 == 0x3ULL || t22 == 0x5ULL) {
+      s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(0x5ULL == 0x0ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+    } else if (t22 == 0x0ULL) {
+      s_U0_reset_clk_counter_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else if (t22 == 0x2ULL) {
+      s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+    } else if (t22 == 0x8ULL) {
+      s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+    } else if (t22 == 0x4ULL || t22 == 0x6ULL) {
+      s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x5ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+    } else if (t22 == 0x9ULL) {
+      { uint64_t t23 = ((uint64_t)(s_U0_cmd_fsm_states_i));
+        if (t23 == 0xeULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0x0ULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+        } else if (t23 == 0x10ULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0x1fULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x5ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0x1ULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+        } else if (t23 == 0x5ULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x4ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0x18ULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) || (((uint64_t)(s_U0_read_early_i)) != 0)) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0x1cULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == ((uint64_t)(0x1ULL - 0x1ULL) & 0xffffffffULL)) != 0) || ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x1ULL) != 0)) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0x1eULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x1ULL) != 0) || (((uint64_t)(i_burststop_req)) != 0)) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0x9ULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0x7ULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+        } else if (t23 == 0x17ULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0x15ULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+        } else if (t23 == 0x11ULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0x19ULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0xcULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0x8ULL || t23 == 0x1aULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t23 == 0x1bULL || t23 == 0x13ULL) {
+          s_U0_reset_clk_counter_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+        } else {
+          s_U0_reset_clk_counter_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+        }
+      }
+    } else {
+      s_U0_reset_clk_counter_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:922
+void Vsdram_controller::p22_() {
+  o_data_valid = ((uint64_t)(s_U0_cpu_den_i));
+}
+// ../ice40/sdram_control_fsm.v:927
+void Vsdram_controller::p23_() {
+  s_U0_o_data = ((uint64_t)(s_U0_sdram_dq_reg_i));
+}
+// ../ice40/sdram_control_fsm.v:928
+void Vsdram_controller::p24_() {
+  s_cpu_den_i = ((uint64_t)(s_U0_cpu_den_i));
+}
+// ../ice40/sdram_control_fsm.v:975
+void Vsdram_controller::p25_() {
+  s_U0_o_sdram_dq = ((uint64_t)(s_U0_i_data));
+}
+// ../ice40/sdram_control_fsm.v:976
+void Vsdram_controller::p26_() {
+  o_sdram_busdir = ((uint64_t)(s_U0_sdram_dq_en_i));
+}
+// ../ice40/sdram_control_fsm.v:1058
+void Vsdram_controller::p27_() {
+  o_data_req = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_read_req_cnt_i)))) < 0x1ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+}
+// ../ice40/sdram_control_fsm.v:1067
+void Vsdram_controller::p28_() {
+  s_U0_col_i = ((uint64_t)(((uint64_t)((((uint64_t)(s_U0_i_addr)) >> 0) & 0x1ffULL)) + ((uint64_t)((((uint64_t)(s_U0_burst_col_i)) >> 0) & 0x1ffULL))) & 0x1ffULL);
+}
+// ../ice40/sdram_control_fsm.v:1069
+void Vsdram_controller::p29_() {
+  { int64_t t25 = (int64_t)(vl_s(0xaULL, 32)) - 0; if (t25 >= 0 && t25 <= 12) s_U0_col_addr_i = (uint16_t)((((uint64_t)(s_U0_col_addr_i)) & ~(0x1ULL << t25)) | (((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(i_disable_precharge)) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x1bULL) != 0)) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x13ULL) != 0)) != 0) || ((uint64_t)(0x0ULL == 0x7ULL) != 0)) != 0) ? 0x0ULL : 0x1ULL)) & 0x1ULL) << t25)); }
+}
+// ../ice40/sdram_control_fsm.v:1078
+void Vsdram_controller::p30_() {
+  s_U0_col_addr_i = (uint16_t)((((uint64_t)(s_U0_col_addr_i)) & ~(0x3ffULL << 0)) | (((uint64_t)((((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_U0_col_i)) >> 0) & 0x1ffULL)))) & 0x3ffULL) << 0));
+}
+// ../ice40/sdram_control_fsm.v:1289
+void Vsdram_controller::p31_() {
+  { uint64_t t49 = ((uint64_t)((uint64_t)(s_U0_cmd_fsm_states_i)));
+    if (t49 == 0x0ULL) {
+    } else if (t49 == 0x10ULL) {
+    } else if (t49 == 0x18ULL) {
+    } else if (t49 == 0x1cULL) {
+    } else if (t49 == 0x1eULL) {
+    } else if (t49 == 0x1fULL) {
+    } else if (t49 == 0xfULL) {
+    } else if (t49 == 0xeULL) {
+    } else if (t49 == 0x6ULL) {
+    } else if (t49 == 0x2ULL) {
+    } else if (t49 == 0x3ULL) {
+    } else if (t49 == 0xbULL) {
+    } else if (t49 == 0x9ULL) {
+    } else if (t49 == 0x1ULL) {
+    } else if (t49 == 0x5ULL) {
+    } else if (t49 == 0x7ULL) {
+    } else if (t49 == 0x17ULL) {
+    } else if (t49 == 0x15ULL) {
+    } else if (t49 == 0x11ULL) {
+    } else if (t49 == 0x19ULL) {
+    } else if (t49 == 0x1dULL) {
+    } else if (t49 == 0xdULL) {
+    } else if (t49 == 0xcULL) {
+    } else if (t49 == 0x8ULL) {
+    } else if (t49 == 0xaULL) {
+    } else if (t49 == 0x1aULL) {
+    } else if (t49 == 0x1bULL) {
+    } else if (t49 == 0x13ULL) {
+    } else {
+    }
+  }
+}
+// ../ice40/sdram_controller.v:325
+void Vsdram_controller::p32_() {
+  o_sdram_blkaddr = (uint8_t)((((uint64_t)(o_sdram_blkaddr)) & ~(0x3ULL << 0)) | (((uint64_t)(((uint64_t)(s_U0_o_sdram_blkaddr))) & 0x3ULL) << 0));
+}
+// ../ice40/sdram_controller.v:325
+void Vsdram_controller::p33_() {
+  o_sdram_addr = (uint16_t)((((uint64_t)(o_sdram_addr)) & ~(0x1fffULL << 0)) | (((uint64_t)(((uint64_t)(s_U0_o_sdram_addr))) & 0x1fffULL) << 0));
+}
+// ../ice40/sdram_controller.v:325
+void Vsdram_controller::p34_() {
+  o_sdram_dqm = (uint8_t)((((uint64_t)(o_sdram_dqm)) & ~(0x3ULL << 0)) | (((uint64_t)(((uint64_t)(s_U0_o_sdram_dqm))) & 0x3ULL) << 0));
+}
+// ../ice40/sdram_controller.v:325
+void Vsdram_controller::p35_() {
+  s_U0_i_data = ((uint64_t)((((uint64_t)(i_data)) >> 0) & 0xffffULL));
+}
+// ../ice40/sdram_controller.v:325
+void Vsdram_controller::p36_() {
+  s_cpu_dataout_i = (uint16_t)((((uint64_t)(s_cpu_dataout_i)) & ~(0xffffULL << 0)) | (((uint64_t)(((uint64_t)(s_U0_o_data))) & 0xffffULL) << 0));
+}
+// ../ice40/sdram_controller.v:325
+void Vsdram_controller::p37_() {
+  o_sdram_dq = (uint16_t)((((uint64_t)(o_sdram_dq)) & ~(0xffffULL << 0)) | (((uint64_t)(((uint64_t)(s_U0_o_sdram_dq))) & 0xffffULL) << 0));
+}
+// ../ice40/sdram_controller.v:325
+void Vsdram_controller::p38_() {
+  s_U0_i_sdram_dq = ((uint64_t)((((uint64_t)(i_sdram_dq)) >> 0) & 0xffffULL));
+}
+// ../ice40/sdram_controller.v:325
+void Vsdram_controller::p39_() {
+  s_U0_i_next_addr = ((uint64_t)((((uint64_t)(i_next_addr)) >> 0) & 0xffffffULL));
+}
+// ../ice40/sdram_controller.v:325
+void Vsdram_controller::p40_() {
+  s_U0_i_dqm = ((uint64_t)((((uint64_t)(i_dqm)) >> 0) & 0x3ULL));
+}
+// ../ice40/sdram_controller.v:325
+void Vsdram_controller::p41_() {
+  s_U0_i_addr = ((uint64_t)((((uint64_t)(i_addr)) >> 0) & 0xffffffULL));
+}
+// ../ice40/lfsr_count64.v:56
+void Vsdram_controller::p42_() {
+  s_U1_U1_lfsr_d0_i = (~((uint64_t)((((uint64_t)(s_U1_U1_lfsr_reg_i)) >> 5) & 1) ^ (uint64_t)((((uint64_t)(s_U1_U1_lfsr_reg_i)) >> 4) & 1)) & 0x1ULL);
+}
+// ../ice40/lfsr_count64.v:57
+void Vsdram_controller::p43_() {
+  s_U1_U1_lfsr_equal = (uint64_t)(((uint64_t)(s_U1_U1_lfsr_reg_i)) == 0x20ULL);
+}
+// ../ice40/lfsr_count255.v:57
+void Vsdram_controller::p44_() {
+  s_U1_U5_lfsr_d0_i = (~((((uint64_t)((((uint64_t)(s_U1_U5_lfsr_reg_i)) >> 7) & 1) ^ (uint64_t)((((uint64_t)(s_U1_U5_lfsr_reg_i)) >> 5) & 1)) ^ (uint64_t)((((uint64_t)(s_U1_U5_lfsr_reg_i)) >> 4) & 1)) ^ (uint64_t)((((uint64_t)(s_U1_U5_lfsr_reg_i)) >> 3) & 1)) & 0x1ULL);
+}
+// ../ice40/lfsr_count255.v:58
+void Vsdram_controller::p45_() {
+  s_U1_U5_lfsr_256_equal_i = (uint64_t)(((uint64_t)(s_U1_U5_lfsr_reg_i)) == 0x80ULL);
+}
+// ../ice40/autorefresh_counter.v:62
+void Vsdram_controller::p46_() {
+  s_U2_count_match_i = (uint64_t)(((uint64_t)(((uint64_t)(s_U2_count_i)))) == ((uint64_t)(0x26cULL - 0x1ULL) & 0xffffffffULL));
+}
+// ../ice40/sdram_controller.v:290
+void Vsdram_controller::p47_() {
+  o_data = ((uint64_t)(s_cpu_dataout_i));
+}
+// ../ice40/sdram_controller.v:291
+void Vsdram_controller::p48_() {
+  s_cpu_datain_i = ((uint64_t)(i_data));
+}
+// ../ice40/sdram_controller.v:317
+void Vsdram_controller::p49_() {
+  o_sdram_clk = ((((uint64_t)(i_clk)) != 0) ? (~((uint64_t)(s_power_down_reg3_i)) & 0x1ULL) : 0x0ULL);
+}
+// ../ice40/sdram_controller.v:318
+void Vsdram_controller::p50_() {
+  o_init_done = ((uint64_t)(s_init_done_i));
+}
+// ../ice40/sdram_controller.v:319
+void Vsdram_controller::p51_() {
+  s_sys_clk_i = ((uint64_t)(i_clk));
+}
+// ../ice40/sdram_controller.v:320
+void Vsdram_controller::p52_() {
+  s_sys_rst_i = ((uint64_t)(i_rst));
+}
+// ../ice40/sdram_controller.v:321
+void Vsdram_controller::p53_() {
+  o_busy = ((uint64_t)(s_sdrctl_busyn_i));
+}
+// ../ice40/sdram_controller.v:417
+void Vsdram_controller::p54_() {
+  s_refresh_due_i = (uint64_t)(((uint64_t)(((uint64_t)(vl_s((vl_sext<uint64_t>(((uint64_t)(((uint64_t)(s_refresh_owed_i)))), 5) & 0xffffffffULL), 32) >= vl_s(0x8ULL, 32)) != 0) || ((uint64_t)(((uint64_t)(vl_s((vl_sext<uint64_t>(((uint64_t)(((uint64_t)(s_refresh_owed_i)))), 5) & 0xffffffffULL), 32) > vl_s(0x0ULL, 32)) != 0) && ((~((uint64_t)(i_adv)) & 0x1ULL) != 0)) != 0)) != 0) || ((uint64_t)(((uint64_t)(vl_s((vl_sext<uint64_t>(((uint64_t)(((uint64_t)(s_refresh_owed_i)))), 5) & 0xffffffffULL), 32) > vl_s(((uint64_t)(-0x8ULL) & 0xffffffffULL), 32)) != 0) && ((uint64_t)(((uint64_t)(((uint64_t)(s_idle_count_i)))) == 0x10ULL) != 0)) != 0));
+}
+// ../ice40/sdram_controller.v:449
+void Vsdram_controller::p55_() {
+  s_selfrefresh_want_i = (uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(i_selfrefresh_idle)))) != 0x0ULL) != 0) && ((uint64_t)(((uint64_t)(s_power_idle_i)) >= (((uint64_t)((uint64_t)(i_selfrefresh_idle)) << 8) | (uint64_t)0x0ULL)) != 0));
+}
+// ../ice40/sdram_controller.v:451
+void Vsdram_controller::p56_() {
+  s_powerdown_want_i = (uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(i_powerdown_idle)))) != 0x0ULL) != 0) && ((uint64_t)(((uint64_t)(s_power_idle_i)) >= (((uint64_t)0x0ULL << 16) | (uint64_t)((uint64_t)(i_powerdown_idle)))) != 0)) != 0) && ((~((uint64_t)(s_selfrefresh_want_i)) & 0x1ULL) != 0));
+}
+// ../ice40/sdram_controller.v:454
+void Vsdram_controller::p57_() {
+  s_selfrefresh_i = (uint64_t)(((uint64_t)((((uint64_t)(i_selfrefresh_req)) != 0) || ((uint64_t)((((uint64_t)(s_selfrefresh_want_i)) != 0) && ((~((uint64_t)(i_adv)) & 0x1ULL) != 0)) != 0)) != 0) || ((uint64_t)(((uint64_t)(((uint64_t)(o_power_state)) == 0x2ULL) != 0) && ((uint64_t)(((uint64_t)(((uint64_t)(s_selfrefresh_time_i)))) != 0x4ULL) != 0)) != 0));
+}
+// ../ice40/sdram_controller.v:458
+void Vsdram_controller::p58_() {
+  s_power_down_i = (uint64_t)((((uint64_t)(i_power_down)) != 0) || ((uint64_t)(((uint64_t)((((uint64_t)(s_powerdown_want_i)) != 0) && ((~((uint64_t)(i_adv)) & 0x1ULL) != 0)) != 0) && ((~((uint64_t)(s_refresh_due_i)) & 0x1ULL) != 0)) != 0));
+}
+// ../ice40/sdram_controller.v:460
+void Vsdram_controller::p59_() {
+  o_wake = (uint64_t)((((uint64_t)(i_adv)) != 0) && ((uint64_t)(((uint64_t)(o_power_state)) != 0x0ULL) != 0));
+}
+// ../ice40/sdram_control_fsm.v:224
+void Vsdram_controller::q0_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_write_cmd_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    n_s_U0_write_cmd_i = (uint64_t)(((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x13ULL) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x2ULL) != 0));
+  }
+}
+// ../ice40/sdram_control_fsm.v:300
+void Vsdram_controller::q1_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_ras_count_i = ((uint64_t)((0x0ULL) & 0xffffULL));
+    n_s_U0_wr_count_i = ((uint64_t)((0x0ULL) & 0xffffULL));
+  } else {
+    s_U0_bank_i = 0x0ULL;
+    for (int t1 = 0; (uint64_t)(vl_s(((uint64_t)(s_U0_bank_i)), 32) < vl_s(vl_shl<uint64_t>(0x1ULL, 0x2ULL, 32), 32)) != 0; ++t1) {
+      if (t1 > 1000000) vl_fatal("loop");
+      if ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0xeULL) != 0) && ((uint64_t)(((uint64_t)(s_U0_req_bank_i)) == ((uint64_t)((((uint64_t)(s_U0_bank_i)) >> 0) & 0x3ULL))) != 0)) != 0) || ((uint64_t)((((uint64_t)(s_U0_lookahead_act_i)) != 0) && ((uint64_t)(((uint64_t)(s_U0_next_bank_i)) == ((uint64_t)((((uint64_t)(s_U0_bank_i)) >> 0) & 0x3ULL))) != 0)) != 0)) != 0) {
+        { int64_t t2 = (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_U0_bank_i))) & 0xffffffffULL), 32)) - 0; if (t2 >= 0 && t2 <= 12) n_s_U0_ras_count_i = (uint16_t)((((uint64_t)(n_s_U0_ras_count_i)) & ~(0xfULL << t2)) | (((uint64_t)(((uint64_t)((((uint64_t)(0x4ULL - 0x1ULL) & 0xffffffffULL)) & 0xfULL))) & 0xfULL) << t2)); }
+      } else {
+        if ((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_U0_ras_count_i)), (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_U0_bank_i))) & 0xffffffffULL), 32)) - 0, 16, 4)))) != 0x0ULL) != 0) {
+          { int64_t t3 = (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_U0_bank_i))) & 0xffffffffULL), 32)) - 0; if (t3 >= 0 && t3 <= 12) n_s_U0_ras_count_i = (uint16_t)((((uint64_t)(n_s_U0_ras_count_i)) & ~(0xfULL << t3)) | (((uint64_t)(((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_U0_ras_count_i)), (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_U0_bank_i))) & 0xffffffffULL), 32)) - 0, 16, 4)))) - 0x1ULL) & 0xffffffffULL)) & 0xfULL))) & 0xfULL) << t3)); }
+        }
+      }
+      if ((uint64_t)((((uint64_t)(s_U0_write_issue_i)) != 0) && ((uint64_t)(((uint64_t)(s_U0_req_bank_i)) == ((uint64_t)((((uint64_t)(s_U0_bank_i)) >> 0) & 0x3ULL))) != 0)) != 0) {
+        { int64_t t4 = (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_U0_bank_i))) & 0xffffffffULL), 32)) - 0; if (t4 >= 0 && t4 <= 12) n_s_U0_wr_count_i = (uint16_t)((((uint64_t)(n_s_U0_wr_count_i)) & ~(0xfULL << t4)) | (((uint64_t)(((uint64_t)((((uint64_t)(0x2ULL - 0x1ULL) & 0xffffffffULL)) & 0xfULL))) & 0xfULL) << t4)); }
+      } else {
+        if ((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_U0_wr_count_i)), (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_U0_bank_i))) & 0xffffffffULL), 32)) - 0, 16, 4)))) != 0x0ULL) != 0) {
+          { int64_t t5 = (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_U0_bank_i))) & 0xffffffffULL), 32)) - 0; if (t5 >= 0 && t5 <= 12) n_s_U0_wr_count_i = (uint16_t)((((uint64_t)(n_s_U0_wr_count_i)) & ~(0xfULL << t5)) | (((uint64_t)(((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_U0_wr_count_i)), (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_U0_bank_i))) & 0xffffffffULL), 32)) - 0, 16, 4)))) - 0x1ULL) & 0xffffffffULL)) & 0xfULL))) & 0xfULL) << t5)); }
+        }
+      }
+      s_U0_bank_i = ((uint64_t)(((uint64_t)(s_U0_bank_i)) + 0x1ULL) & 0xffffffffULL);
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:369
+void Vsdram_controller::q2_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_row_open_i = ((uint64_t)((0x0ULL) & 0xfULL));
+  } else {
+    { uint64_t t8 = ((uint64_t)(s_U0_cmd_fsm_states_i));
+      if (t8 == 0xeULL) {
+        { int64_t t9 = (int64_t)(((uint64_t)(s_U0_req_bank_i))) - 0; if (t9 >= 0 && t9 <= 3) n_s_U0_row_open_i = (uint8_t)((((uint64_t)(n_s_U0_row_open_i)) & ~(0x1ULL << t9)) | (((uint64_t)(((uint64_t)(i_disable_precharge))) & 0x1ULL) << t9)); }
+      } else if (t8 == 0x18ULL || t8 == 0x1eULL) {
+        if (((uint64_t)(s_U0_lookahead_act_i)) != 0) {
+          { int64_t t10 = (int64_t)(((uint64_t)(s_U0_next_bank_i))) - 0; if (t10 >= 0 && t10 <= 3) n_s_U0_row_open_i = (uint8_t)((((uint64_t)(n_s_U0_row_open_i)) & ~(0x1ULL << t10)) | (((uint64_t)(0x1ULL) & 0x1ULL) << t10)); }
+        } else {
+          if (((uint64_t)(s_U0_lookahead_pre_i)) != 0) {
+            { int64_t t11 = (int64_t)(((uint64_t)(s_U0_next_bank_i))) - 0; if (t11 >= 0 && t11 <= 3) n_s_U0_row_open_i = (uint8_t)((((uint64_t)(n_s_U0_row_open_i)) & ~(0x1ULL << t11)) | (((uint64_t)(0x0ULL) & 0x1ULL) << t11)); }
+          }
+        }
+      } else if (t8 == 0xcULL) {
+        { int64_t t12 = (int64_t)(((uint64_t)(s_U0_req_bank_i))) - 0; if (t12 >= 0 && t12 <= 3) n_s_U0_row_open_i = (uint8_t)((((uint64_t)(n_s_U0_row_open_i)) & ~(0x1ULL << t12)) | (((uint64_t)(0x0ULL) & 0x1ULL) << t12)); }
+      } else if (t8 == 0x6ULL || t8 == 0x2ULL) {
+        if ((uint64_t)(((uint64_t)(i_disable_precharge)) == 0) != 0) {
+          { int64_t t13 = (int64_t)(((uint64_t)(s_U0_req_bank_i))) - 0; if (t13 >= 0 && t13 <= 3) n_s_U0_row_open_i = (uint8_t)((((uint64_t)(n_s_U0_row_open_i)) & ~(0x1ULL << t13)) | (((uint64_t)(0x0ULL) & 0x1ULL) << t13)); }
+        }
+      } else if (t8 == 0x19ULL || t8 == 0xaULL) {
+        n_s_U0_row_open_i = ((uint64_t)((0x0ULL) & 0xfULL));
+      } else {
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:395
+void Vsdram_controller::q3_() {
+  if ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0xeULL) != 0) {
+    { uint64_t t14 = ((uint64_t)(s_U0_req_bank_i)); if (t14 >= 0 && t14 <= 3) nq_s_U0_open_row_i.push_back(std::make_pair(t14 - 0, (uint64_t)(((uint64_t)(s_U0_req_row_i))))); }
+  } else {
+    if (((uint64_t)(s_U0_lookahead_act_i)) != 0) {
+      { uint64_t t15 = ((uint64_t)(s_U0_next_bank_i)); if (t15 >= 0 && t15 <= 3) nq_s_U0_open_row_i.push_back(std::make_pair(t15 - 0, (uint64_t)(((uint64_t)(s_U0_next_row_i))))); }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:420
+void Vsdram_controller::q4_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_write_done_i = 0x0ULL;
+    n_s_U0_read_done_i = 0x0ULL;
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x1ULL) != 0) && ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x1eULL) != 0)) != 0) || ((uint64_t)((((uint64_t)(i_burststop_req)) != 0) && ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x1eULL) != 0)) != 0)) != 0) {
+      n_s_U0_write_done_i = 0x1ULL;
+      n_s_U0_read_done_i = 0x0ULL;
+    } else {
+      if ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == ((uint64_t)(0x1ULL - 0x1ULL) & 0xffffffffULL)) != 0) && ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x1cULL) != 0)) != 0) || ((uint64_t)((((uint64_t)(i_burststop_req)) != 0) && ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x1cULL) != 0)) != 0)) != 0) {
+        n_s_U0_write_done_i = 0x0ULL;
+        n_s_U0_read_done_i = 0x1ULL;
+      } else {
+        if ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x0ULL) != 0) {
+          n_s_U0_write_done_i = 0x0ULL;
+          n_s_U0_read_done_i = 0x0ULL;
+        }
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:437
+void Vsdram_controller::q5_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_write_done_reg_i = 0x0ULL;
+    n_s_U0_read_done_reg_i = 0x0ULL;
+  } else {
+    n_s_U0_write_done_reg_i = ((uint64_t)(s_U0_write_done_i));
+    n_s_U0_read_done_reg_i = ((uint64_t)(s_U0_read_done_i));
+  }
+}
+// ../ice40/sdram_control_fsm.v:467
+void Vsdram_controller::q6_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_burst_col_i = ((uint64_t)((0x0ULL) & 0x3ffULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x1bULL) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x13ULL) != 0)) != 0) {
+      n_s_U0_burst_col_i = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_burst_col_i)))) + 0x1ULL) & 0xffffffffULL)) & 0x3ffULL));
+    } else {
+      n_s_U0_burst_col_i = ((uint64_t)((0x0ULL) & 0x3ffULL));
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:483
+void Vsdram_controller::q7_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_init_fsm_states_i = 0x0ULL;
+  } else {
+    { uint64_t t16 = ((uint64_t)(s_U0_init_fsm_states_i));
+      if (t16 == 0x0ULL) {
+        if (((uint64_t)(s_delay_done150us_i)) != 0) {
+          n_s_U0_init_fsm_states_i = 0x1ULL;
+        }
+      } else if (t16 == 0x1ULL) {
+        n_s_U0_init_fsm_states_i = (((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0x3ULL : 0x2ULL);
+      } else if (t16 == 0x2ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_U0_init_fsm_states_i = 0x3ULL;
+        }
+      } else if (t16 == 0x3ULL) {
+        n_s_U0_init_fsm_states_i = (((uint64_t)(0x5ULL == 0x0ULL) != 0) ? 0x5ULL : 0x4ULL);
+      } else if (t16 == 0x4ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x5ULL) != 0) {
+          n_s_U0_init_fsm_states_i = 0x5ULL;
+        }
+      } else if (t16 == 0x5ULL) {
+        n_s_U0_init_fsm_states_i = (((uint64_t)(0x5ULL == 0x0ULL) != 0) ? 0x7ULL : 0x6ULL);
+      } else if (t16 == 0x6ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x5ULL) != 0) {
+          n_s_U0_init_fsm_states_i = 0x7ULL;
+        }
+      } else if (t16 == 0x7ULL) {
+        n_s_U0_init_fsm_states_i = (((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0x9ULL : 0x8ULL);
+      } else if (t16 == 0x8ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_U0_init_fsm_states_i = 0x9ULL;
+        }
+      } else if (t16 == 0x9ULL) {
+        n_s_U0_init_fsm_states_i = 0x9ULL;
+      } else {
+        n_s_U0_init_fsm_states_i = 0x0ULL;
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:535
+void Vsdram_controller::q8_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_init_done_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    { uint64_t t17 = ((uint64_t)(s_U0_init_fsm_states_i));
+      if (t17 == 0x9ULL) {
+        n_s_init_done_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_init_done_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:547
+void Vsdram_controller::q9_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_cmd_fsm_states_i = 0x0ULL;
+  } else {
+    { uint64_t t18 = ((uint64_t)(s_U0_cmd_fsm_states_i));
+      if (t18 == 0x0ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_selfrefresh_i)) != 0) || (((uint64_t)(s_refresh_req_i)) != 0)) != 0) && (((uint64_t)(s_init_done_i)) != 0)) != 0) && ((uint64_t)(((uint64_t)(s_U0_row_open_i)) != 0) != 0)) != 0) {
+          if ((uint64_t)(((uint64_t)(s_U0_precharge_ok_i)) == 0xfULL) != 0) {
+            n_s_U0_cmd_fsm_states_i = 0xaULL;
+          }
+        } else {
+          if ((uint64_t)((((uint64_t)(s_selfrefresh_i)) != 0) && (((uint64_t)(s_init_done_i)) != 0)) != 0) {
+            n_s_U0_cmd_fsm_states_i = 0x1ULL;
+          } else {
+            if ((uint64_t)((((uint64_t)(s_refresh_req_i)) != 0) && (((uint64_t)(s_init_done_i)) != 0)) != 0) {
+              n_s_U0_cmd_fsm_states_i = 0x3ULL;
+            } else {
+              if ((uint64_t)(((uint64_t)((((uint64_t)(i_loadmod_req)) != 0) && (((uint64_t)(s_init_done_i)) != 0)) != 0) && (((uint64_t)(i_adv)) != 0)) != 0) {
+                n_s_U0_cmd_fsm_states_i = 0xbULL;
+              } else {
+                if ((uint64_t)(((uint64_t)((((uint64_t)(i_precharge_req)) != 0) && (((uint64_t)(s_init_done_i)) != 0)) != 0) && (((uint64_t)(i_adv)) != 0)) != 0) {
+                  n_s_U0_cmd_fsm_states_i = 0x19ULL;
+                } else {
+                  if ((uint64_t)((((uint64_t)(s_power_down_i)) != 0) && (((uint64_t)(s_init_done_i)) != 0)) != 0) {
+                    n_s_U0_cmd_fsm_states_i = 0xdULL;
+                  } else {
+                    if ((uint64_t)((((uint64_t)(i_adv)) != 0) && (((uint64_t)(s_init_done_i)) != 0)) != 0) {
+                      if ((uint64_t)((((uint64_t)(i_disable_active)) != 0) || (((uint64_t)(s_U0_page_hit_i)) != 0)) != 0) {
+                        n_s_U0_cmd_fsm_states_i = ((((uint64_t)(i_rwn)) != 0) ? ((uint64_t)(s_U0_read_cmd_state_i)) : ((uint64_t)(s_U0_write_cmd_state_i)));
+                      } else {
+                        if (((uint64_t)(s_U0_page_miss_i)) != 0) {
+                          if (vl_bit(((uint64_t)(s_U0_precharge_ok_i)), (int64_t)(((uint64_t)(s_U0_req_bank_i))) - 0, 4) != 0) {
+                            n_s_U0_cmd_fsm_states_i = 0xcULL;
+                          }
+                        } else {
+                          n_s_U0_cmd_fsm_states_i = 0xeULL;
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      } else if (t18 == 0xeULL) {
+        if ((uint64_t)(0x2ULL == 0x0ULL) != 0) {
+          n_s_U0_cmd_fsm_states_i = ((((uint64_t)(i_rwn)) != 0) ? ((uint64_t)(s_U0_read_cmd_state_i)) : ((uint64_t)(s_U0_write_cmd_state_i)));
+        } else {
+          n_s_U0_cmd_fsm_states_i = 0x10ULL;
+        }
+      } else if (t18 == 0x10ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_U0_cmd_fsm_states_i = ((((uint64_t)(i_rwn)) != 0) ? ((uint64_t)(s_U0_read_cmd_state_i)) : ((uint64_t)(s_U0_write_cmd_state_i)));
+        }
+      } else if (t18 == 0x1bULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_burst_col_i)))) == ((uint64_t)(((uint64_t)(((uint64_t)(i_burst_len)))) - 0x2ULL) & 0xffffffffULL)) != 0) {
+          n_s_U0_cmd_fsm_states_i = 0x6ULL;
+        }
+      } else if (t18 == 0x6ULL) {
+        n_s_U0_cmd_fsm_states_i = 0x18ULL;
+      } else if (t18 == 0x18ULL) {
+        if (((uint64_t)(s_U0_read_early_i)) != 0) {
+          n_s_U0_cmd_fsm_states_i = ((uint64_t)(s_U0_read_cmd_state_i));
+        } else {
+          if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) {
+            n_s_U0_cmd_fsm_states_i = 0x1cULL;
+          }
+        }
+      } else if (t18 == 0x1cULL) {
+        if (((uint64_t)(i_burststop_req)) != 0) {
+          n_s_U0_cmd_fsm_states_i = 0x15ULL;
+        } else {
+          if ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == ((uint64_t)(0x1ULL - 0x1ULL) & 0xffffffffULL)) != 0) && (((uint64_t)(s_U0_read_pipeline_i)) != 0)) != 0) {
+            n_s_U0_cmd_fsm_states_i = ((uint64_t)(s_U0_read_cmd_state_i));
+          } else {
+            if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == ((uint64_t)(0x1ULL - 0x1ULL) & 0xffffffffULL)) != 0) {
+              n_s_U0_cmd_fsm_states_i = 0x0ULL;
+            }
+          }
+        }
+      } else if (t18 == 0x13ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_burst_col_i)))) == ((uint64_t)(((uint64_t)(((uint64_t)(i_burst_len)))) - 0x2ULL) & 0xffffffffULL)) != 0) {
+          n_s_U0_cmd_fsm_states_i = 0x2ULL;
+        }
+      } else if (t18 == 0x2ULL) {
+        n_s_U0_cmd_fsm_states_i = 0x1eULL;
+      } else if (t18 == 0x1eULL) {
+        if (((uint64_t)(i_burststop_req)) != 0) {
+          n_s_U0_cmd_fsm_states_i = 0x7ULL;
+        } else {
+          if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x1ULL) != 0) {
+            n_s_U0_cmd_fsm_states_i = 0xfULL;
+          }
+        }
+      } else if (t18 == 0xfULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x0ULL) != 0) {
+          n_s_U0_cmd_fsm_states_i = 0x0ULL;
+        }
+      } else if (t18 == 0x3ULL) {
+        n_s_U0_cmd_fsm_states_i = (((uint64_t)(0x5ULL == 0x0ULL) != 0) ? 0x0ULL : 0x1fULL);
+      } else if (t18 == 0x1fULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x5ULL) != 0) {
+          n_s_U0_cmd_fsm_states_i = 0x0ULL;
+        }
+      } else if (t18 == 0x1ULL) {
+        if ((~((uint64_t)(s_selfrefresh_i)) & 0x1ULL) != 0) {
+          n_s_U0_cmd_fsm_states_i = 0x5ULL;
+        }
+      } else if (t18 == 0x5ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x4ULL) != 0) {
+          n_s_U0_cmd_fsm_states_i = 0x0ULL;
+        }
+      } else if (t18 == 0xbULL) {
+        n_s_U0_cmd_fsm_states_i = (((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0x0ULL : 0x9ULL);
+      } else if (t18 == 0x9ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_U0_cmd_fsm_states_i = 0x0ULL;
+        }
+      } else if (t18 == 0x7ULL) {
+        n_s_U0_cmd_fsm_states_i = 0x17ULL;
+      } else if (t18 == 0x17ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          if ((uint64_t)(((uint64_t)(i_disable_precharge)) == 0) != 0) {
+            n_s_U0_cmd_fsm_states_i = 0x19ULL;
+          } else {
+            n_s_U0_cmd_fsm_states_i = 0x0ULL;
+          }
+        }
+      } else if (t18 == 0x15ULL) {
+        n_s_U0_cmd_fsm_states_i = 0x11ULL;
+      } else if (t18 == 0x11ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          if ((uint64_t)(((uint64_t)(i_disable_precharge)) == 0) != 0) {
+            n_s_U0_cmd_fsm_states_i = 0x19ULL;
+          } else {
+            n_s_U0_cmd_fsm_states_i = 0x0ULL;
+          }
+        }
+      } else if (t18 == 0x19ULL) {
+        n_s_U0_cmd_fsm_states_i = 0x1dULL;
+      } else if (t18 == 0x1dULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_U0_cmd_fsm_states_i = 0x0ULL;
+        }
+      } else if (t18 == 0xcULL) {
+        n_s_U0_cmd_fsm_states_i = (((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0xeULL : 0x8ULL);
+      } else if (t18 == 0x8ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_U0_cmd_fsm_states_i = 0xeULL;
+        }
+      } else if (t18 == 0xaULL) {
+        n_s_U0_cmd_fsm_states_i = 0x1aULL;
+      } else if (t18 == 0x1aULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_U0_cmd_fsm_states_i = ((((uint64_t)(s_selfrefresh_i)) != 0) ? 0x1ULL : 0x3ULL);
+        }
+      } else if (t18 == 0xdULL) {
+        if ((uint64_t)(((uint64_t)(s_power_down_i)) == 0) != 0) {
+          n_s_U0_cmd_fsm_states_i = 0x0ULL;
+        }
+      } else {
+        n_s_U0_cmd_fsm_states_i = 0x0ULL;
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:708
+void Vsdram_controller::q10_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_autoref_ack_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    { uint64_t t19 = ((uint64_t)(s_U0_cmd_fsm_states_i));
+      if (t19 == 0x3ULL) {
+        n_s_autoref_ack_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_autoref_ack_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:723
+void Vsdram_controller::q11_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_o_ack = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    { uint64_t t20 = ((uint64_t)(s_U0_cmd_fsm_states_i));
+      if (t20 == 0x0ULL) {
+        if (((uint64_t)(i_precharge_req)) != 0) {
+          n_o_ack = ((uint64_t)((0x1ULL) & 0x1ULL));
+        }
+      } else if (t20 == 0x7ULL || t20 == 0x15ULL || t20 == 0x6ULL || t20 == 0x2ULL || t20 == 0xbULL) {
+        n_o_ack = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_o_ack = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:747
+void Vsdram_controller::q12_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_sdrctl_busyn_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    { uint64_t t21 = ((uint64_t)(s_U0_cmd_fsm_states_i));
+      if (t21 == 0x0ULL) {
+        if (((uint64_t)(s_init_done_i)) != 0) {
+          if ((uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_refresh_req_i)) != 0) || (((uint64_t)(i_loadmod_req)) != 0)) != 0) || (((uint64_t)(i_precharge_req)) != 0)) != 0) || (((uint64_t)(i_adv)) != 0)) != 0) {
+            n_s_sdrctl_busyn_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+          } else {
+            n_s_sdrctl_busyn_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+          }
+        }
+      } else if (t21 == 0xeULL || t21 == 0x10ULL || t21 == 0x1bULL || t21 == 0x6ULL || t21 == 0x18ULL || t21 == 0x13ULL || t21 == 0x2ULL || t21 == 0x1eULL || t21 == 0x3ULL || t21 == 0x7ULL || t21 == 0x19ULL || t21 == 0xbULL || t21 == 0x11ULL || t21 == 0x17ULL || t21 == 0x15ULL || t21 == 0x1cULL || t21 == 0xfULL || t21 == 0x9ULL || t21 == 0x1fULL || t21 == 0x1dULL || t21 == 0xcULL || t21 == 0x8ULL || t21 == 0xaULL || t21 == 0x1aULL || t21 == 0x5ULL) {
+        n_s_sdrctl_busyn_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_sdrctl_busyn_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:796
+void Vsdram_controller::q13_() {
+  if (((uint64_t)(s_U0_reset_clk_counter_i)) != 0) {
+    n_s_U0_clk_count_i = ((uint64_t)((0x0ULL) & 0xfULL));
+  } else {
+    n_s_U0_clk_count_i = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_clk_count_i)))) + 0x1ULL) & 0xffffffffULL)) & 0xfULL));
+  }
+}
+// ../ice40/sdram_control_fsm.v:933
+void Vsdram_controller::q14_() {
+  n_s_U0_sdram_dq_reg_i = ((uint64_t)(s_U0_i_sdram_dq));
+}
+// ../ice40/sdram_control_fsm.v:949
+void Vsdram_controller::q15_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_read_pipe_i = ((uint64_t)((0x0ULL) & 0x7ULL));
+  } else {
+    n_s_U0_read_pipe_i = (((uint64_t)((uint64_t)((((uint64_t)(s_U0_read_pipe_i)) >> 0) & 0x3ULL)) << 1) | (uint64_t)(uint64_t)(((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x1bULL) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x6ULL) != 0)));
+  }
+}
+// ../ice40/sdram_control_fsm.v:957
+void Vsdram_controller::q16_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_cpu_den_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_U0_read_pipe_i)) >> 2) & 1) != 0) || ((uint64_t)(((uint64_t)(vl_s(0x1ULL, 32) > vl_s(0x1ULL, 32)) != 0) && ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x1cULL) != 0)) != 0)) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x15ULL) != 0)) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x11ULL) != 0)) != 0) {
+      n_s_U0_cpu_den_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_U0_cpu_den_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:981
+void Vsdram_controller::q17_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_cpu2sdram_reg_i = ((0x0ULL) ? 0xffffULL : (uint64_t)0);
+  } else {
+    n_s_U0_cpu2sdram_reg_i = ((uint64_t)(s_U0_cpu_data_reg_i));
+  }
+}
+// ../ice40/sdram_control_fsm.v:990
+void Vsdram_controller::q18_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_sdram_dq_en_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x2ULL) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x13ULL) != 0)) != 0) {
+      n_s_U0_sdram_dq_en_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      if ((uint64_t)(((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x6ULL) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x1bULL) != 0)) != 0) {
+        n_s_U0_sdram_dq_en_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:1003
+void Vsdram_controller::q19_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_cpu_data_reg_i = ((0x0ULL) ? 0xffffULL : (uint64_t)0);
+  } else {
+    n_s_U0_cpu_data_reg_i = ((uint64_t)(s_U0_i_data));
+  }
+}
+// ../ice40/sdram_control_fsm.v:1022
+void Vsdram_controller::q20_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_read_req_cnt_rst_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0xfULL) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x7ULL) != 0)) != 0) || ((uint64_t)(((uint64_t)(s_U0_cmd_fsm_states_i)) == 0x0ULL) != 0)) != 0) {
+      n_s_U0_read_req_cnt_rst_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_U0_read_req_cnt_rst_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:1032
+void Vsdram_controller::q21_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_read_data_req_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    { uint64_t t24 = ((uint64_t)(s_U0_cmd_fsm_states_i));
+      if (t24 == 0xeULL || t24 == 0x10ULL) {
+        if ((uint64_t)(((uint64_t)(i_rwn)) == 0) != 0) {
+          n_s_U0_read_data_req_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+        }
+      } else if (t24 == 0x1eULL || t24 == 0x13ULL || t24 == 0x2ULL) {
+        n_s_U0_read_data_req_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_U0_read_data_req_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:1050
+void Vsdram_controller::q22_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_U0_read_req_cnt_i = ((0x1ULL) ? 0x3ffULL : (uint64_t)0);
+  } else {
+    if ((uint64_t)((((uint64_t)(s_U0_read_req_cnt_rst_i)) != 0) || (((uint64_t)(i_burststop_req)) != 0)) != 0) {
+      n_s_U0_read_req_cnt_i = ((0x1ULL) ? 0x3ffULL : (uint64_t)0);
+    } else {
+      if (((uint64_t)(s_U0_read_data_req_i)) != 0) {
+        n_s_U0_read_req_cnt_i = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_U0_read_req_cnt_i)))) + 0x1ULL) & 0xffffffffULL)) & 0x3ffULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:1099
+void Vsdram_controller::q23_() {
+  if (((uint64_t)(i_rst)) != 0) {
+  } else {
+    { uint64_t t26 = ((uint64_t)(s_U0_init_fsm_states_i));
+      if (t26 == 0x2ULL || t26 == 0x4ULL || t26 == 0x6ULL || t26 == 0x8ULL || t26 == 0x0ULL) {
+        { uint64_t t27 = 0xeULL;
+          n_s_U0_sdram_dqm_i = ((uint64_t)((t27 >> 0) & 0x1ULL));
+          n_o_sdram_wen = ((uint64_t)((t27 >> 1) & 0x1ULL));
+          n_o_sdram_casn = ((uint64_t)((t27 >> 2) & 0x1ULL));
+          n_o_sdram_rasn = ((uint64_t)((t27 >> 3) & 0x1ULL));
+          n_o_sdram_csn = ((uint64_t)((t27 >> 4) & 0x1ULL));
+        }
+        n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_U0_o_sdram_blkaddr = 0x3ULL;
+        n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+      } else if (t26 == 0x1ULL) {
+        { uint64_t t28 = 0x5ULL;
+          n_s_U0_sdram_dqm_i = ((uint64_t)((t28 >> 0) & 0x1ULL));
+          n_o_sdram_wen = ((uint64_t)((t28 >> 1) & 0x1ULL));
+          n_o_sdram_casn = ((uint64_t)((t28 >> 2) & 0x1ULL));
+          n_o_sdram_rasn = ((uint64_t)((t28 >> 3) & 0x1ULL));
+          n_o_sdram_csn = ((uint64_t)((t28 >> 4) & 0x1ULL));
+        }
+        n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_U0_o_sdram_blkaddr = 0x3ULL;
+        n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+      } else if (t26 == 0x3ULL || t26 == 0x5ULL) {
+        { uint64_t t29 = 0x3ULL;
+          n_s_U0_sdram_dqm_i = ((uint64_t)((t29 >> 0) & 0x1ULL));
+          n_o_sdram_wen = ((uint64_t)((t29 >> 1) & 0x1ULL));
+          n_o_sdram_casn = ((uint64_t)((t29 >> 2) & 0x1ULL));
+          n_o_sdram_rasn = ((uint64_t)((t29 >> 3) & 0x1ULL));
+          n_o_sdram_csn = ((uint64_t)((t29 >> 4) & 0x1ULL));
+        }
+        n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_U0_o_sdram_blkaddr = 0x3ULL;
+        n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+      } else if (t26 == 0x7ULL) {
+        { uint64_t t30 = 0x1ULL;
+          n_s_U0_sdram_dqm_i = ((uint64_t)((t30 >> 0) & 0x1ULL));
+          n_o_sdram_wen = ((uint64_t)((t30 >> 1) & 0x1ULL));
+          n_o_sdram_casn = ((uint64_t)((t30 >> 2) & 0x1ULL));
+          n_o_sdram_rasn = ((uint64_t)((t30 >> 3) & 0x1ULL));
+          n_o_sdram_csn = ((uint64_t)((t30 >> 4) & 0x1ULL));
+        }
+        n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_U0_o_sdram_blkaddr = 0x0ULL;
+        n_s_U0_o_sdram_addr = (((uint64_t)0x0ULL << 10) | ((uint64_t)0x0ULL << 9) | ((uint64_t)0x0ULL << 7) | ((uint64_t)0x2ULL << 4) | ((uint64_t)0x0ULL << 3) | (uint64_t)0x0ULL);
+      } else if (t26 == 0x9ULL) {
+        { uint64_t t31 = ((uint64_t)(s_U0_cmd_fsm_states_i));
+          if (t31 == 0x0ULL || t31 == 0x10ULL || t31 == 0x1fULL || t31 == 0x5ULL || t31 == 0x1cULL || t31 == 0x17ULL || t31 == 0x11ULL) {
+            { uint64_t t32 = 0xeULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t32 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t32 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t32 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t32 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t32 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t31 == 0x18ULL || t31 == 0x1eULL) {
+            if (((uint64_t)(s_U0_lookahead_act_i)) != 0) {
+              { uint64_t t33 = (((uint64_t)((uint64_t)((0x7ULL >> 1) & 0xfULL)) << 1) | (uint64_t)0x0ULL);
+                n_s_U0_sdram_dqm_i = ((uint64_t)((t33 >> 0) & 0x1ULL));
+                n_o_sdram_wen = ((uint64_t)((t33 >> 1) & 0x1ULL));
+                n_o_sdram_casn = ((uint64_t)((t33 >> 2) & 0x1ULL));
+                n_o_sdram_rasn = ((uint64_t)((t33 >> 3) & 0x1ULL));
+                n_o_sdram_csn = ((uint64_t)((t33 >> 4) & 0x1ULL));
+              }
+              n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+              n_s_U0_o_sdram_blkaddr = ((uint64_t)(s_U0_next_bank_i));
+              n_s_U0_o_sdram_addr = ((uint64_t)(s_U0_next_row_i));
+            } else {
+              if (((uint64_t)(s_U0_lookahead_pre_i)) != 0) {
+                { uint64_t t34 = (((uint64_t)((uint64_t)((0x5ULL >> 1) & 0xfULL)) << 1) | (uint64_t)0x0ULL);
+                  n_s_U0_sdram_dqm_i = ((uint64_t)((t34 >> 0) & 0x1ULL));
+                  n_o_sdram_wen = ((uint64_t)((t34 >> 1) & 0x1ULL));
+                  n_o_sdram_casn = ((uint64_t)((t34 >> 2) & 0x1ULL));
+                  n_o_sdram_rasn = ((uint64_t)((t34 >> 3) & 0x1ULL));
+                  n_o_sdram_csn = ((uint64_t)((t34 >> 4) & 0x1ULL));
+                }
+                n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+                n_s_U0_o_sdram_blkaddr = ((uint64_t)(s_U0_next_bank_i));
+                n_s_U0_o_sdram_addr = ((0x0ULL) ? 0x1fffULL : (uint64_t)0);
+              } else {
+                { uint64_t t35 = 0xeULL;
+                  n_s_U0_sdram_dqm_i = ((uint64_t)((t35 >> 0) & 0x1ULL));
+                  n_o_sdram_wen = ((uint64_t)((t35 >> 1) & 0x1ULL));
+                  n_o_sdram_casn = ((uint64_t)((t35 >> 2) & 0x1ULL));
+                  n_o_sdram_rasn = ((uint64_t)((t35 >> 3) & 0x1ULL));
+                  n_o_sdram_csn = ((uint64_t)((t35 >> 4) & 0x1ULL));
+                }
+                n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+                n_s_U0_o_sdram_blkaddr = 0x3ULL;
+                n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+              }
+            }
+          } else if (t31 == 0xeULL) {
+            { uint64_t t36 = 0x7ULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t36 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t36 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t36 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t36 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t36 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = ((uint64_t)((((uint64_t)(s_U0_i_addr)) >> 9) & 0x3ULL));
+            n_s_U0_o_sdram_addr = ((uint64_t)((((uint64_t)(s_U0_i_addr)) >> 11) & 0x1fffULL));
+          } else if (t31 == 0x1bULL || t31 == 0x6ULL) {
+            { uint64_t t37 = 0xaULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t37 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t37 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t37 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t37 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t37 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = ((uint64_t)((((uint64_t)(s_U0_i_addr)) >> 9) & 0x3ULL));
+            n_s_U0_o_sdram_addr = (uint16_t)((((uint64_t)(n_s_U0_o_sdram_addr)) & ~(0x1fffULL << 0)) | (((uint64_t)(((uint64_t)(s_U0_col_addr_i))) & 0x1fffULL) << 0));
+          } else if (t31 == 0x13ULL || t31 == 0x2ULL) {
+            { uint64_t t38 = 0x8ULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t38 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t38 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t38 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t38 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t38 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = ((uint64_t)((((uint64_t)(s_U0_i_addr)) >> 9) & 0x3ULL));
+            n_s_U0_o_sdram_addr = (uint16_t)((((uint64_t)(n_s_U0_o_sdram_addr)) & ~(0x1fffULL << 0)) | (((uint64_t)(((uint64_t)(s_U0_col_addr_i))) & 0x1fffULL) << 0));
+          } else if (t31 == 0x3ULL) {
+            { uint64_t t39 = 0x3ULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t39 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t39 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t39 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t39 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t39 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t31 == 0x1ULL) {
+            { uint64_t t40 = 0x3ULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t40 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t40 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t40 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t40 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t40 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x0ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t31 == 0xbULL) {
+            { uint64_t t41 = 0x1ULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t41 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t41 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t41 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t41 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t41 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = 0x0ULL;
+            n_s_U0_o_sdram_addr = ((uint64_t)((((uint64_t)(s_U0_i_addr)) >> 0) & 0x1fffULL));
+          } else if (t31 == 0x19ULL || t31 == 0xaULL) {
+            { uint64_t t42 = 0x5ULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t42 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t42 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t42 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t42 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t42 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t31 == 0xcULL) {
+            { uint64_t t43 = 0x5ULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t43 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t43 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t43 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t43 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t43 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = ((uint64_t)((((uint64_t)(s_U0_i_addr)) >> 9) & 0x3ULL));
+            n_s_U0_o_sdram_addr = ((0x0ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t31 == 0x15ULL || t31 == 0x7ULL) {
+            { uint64_t t44 = 0xcULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t44 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t44 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t44 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t44 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t44 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t31 == 0x11ULL || t31 == 0x17ULL) {
+            { uint64_t t45 = 0xeULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t45 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t45 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t45 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t45 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t45 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t31 == 0xdULL) {
+            { uint64_t t46 = 0xeULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t46 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t46 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t46 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t46 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t46 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x0ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else {
+            { uint64_t t47 = 0xeULL;
+              n_s_U0_sdram_dqm_i = ((uint64_t)((t47 >> 0) & 0x1ULL));
+              n_o_sdram_wen = ((uint64_t)((t47 >> 1) & 0x1ULL));
+              n_o_sdram_casn = ((uint64_t)((t47 >> 2) & 0x1ULL));
+              n_o_sdram_rasn = ((uint64_t)((t47 >> 3) & 0x1ULL));
+              n_o_sdram_csn = ((uint64_t)((t47 >> 4) & 0x1ULL));
+            }
+            n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          }
+        }
+      } else {
+        { uint64_t t48 = 0xeULL;
+          n_s_U0_sdram_dqm_i = ((uint64_t)((t48 >> 0) & 0x1ULL));
+          n_o_sdram_wen = ((uint64_t)((t48 >> 1) & 0x1ULL));
+          n_o_sdram_casn = ((uint64_t)((t48 >> 2) & 0x1ULL));
+          n_o_sdram_rasn = ((uint64_t)((t48 >> 3) & 0x1ULL));
+          n_o_sdram_csn = ((uint64_t)((t48 >> 4) & 0x1ULL));
+        }
+        n_o_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_U0_o_sdram_blkaddr = 0x3ULL;
+        n_s_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+      }
+    }
+  }
+}
+// ../ice40/lfsr_count64.v:59
+void Vsdram_controller::q24_() {
+  if (((uint64_t)(s_sys_rst_i)) != 0) {
+    n_s_U1_U1_lfsr_reg_i = ((uint64_t)((0x0ULL) & 0x3fULL));
+    n_s_U1_lfsr_64_done_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    n_s_U1_U1_lfsr_reg_i = ((((uint64_t)(s_U1_U1_lfsr_equal)) != 0) ? 0x0ULL : (((uint64_t)((uint64_t)((((uint64_t)(s_U1_U1_lfsr_reg_i)) >> 0) & 0x1fULL)) << 1) | (uint64_t)((uint64_t)(s_U1_U1_lfsr_d0_i))));
+    n_s_U1_lfsr_64_done_i = ((uint64_t)(s_U1_U1_lfsr_equal));
+  }
+}
+// ../ice40/lfsr_count255.v:61
+void Vsdram_controller::q25_() {
+  if (((uint64_t)(s_sys_rst_i)) != 0) {
+    n_s_U1_U5_lfsr_reg_i = ((uint64_t)((0x0ULL) & 0xffULL));
+    n_s_delay_done150us_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    n_s_U1_U5_lfsr_reg_i = ((((uint64_t)(s_U1_U5_lfsr_256_equal_i)) != 0) ? 0x0ULL : (((uint64_t)((uint64_t)((((uint64_t)(s_U1_U5_lfsr_reg_i)) >> 0) & 0x7fULL)) << 1) | (uint64_t)((uint64_t)(s_U1_U5_lfsr_d0_i))));
+    n_s_delay_done150us_i = ((uint64_t)(s_U1_U5_lfsr_256_equal_i));
+  }
+}
+// ../ice40/autorefresh_counter.v:64
+void Vsdram_controller::q26_() {
+  if (((uint64_t)(s_sys_rst_i)) != 0) {
+    n_s_U2_count_i = ((uint64_t)((0x0ULL) & 0xffffULL));
+    n_s_refresh_count_done_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if (((uint64_t)(s_autorefresh_enable_i)) != 0) {
+      n_s_U2_count_i = ((uint64_t)((((((uint64_t)(s_U2_count_match_i)) != 0) ? 0x0ULL : ((uint64_t)(((uint64_t)(((uint64_t)(s_U2_count_i)))) + 0x1ULL) & 0xffffffffULL))) & 0xffffULL));
+    }
+    n_s_refresh_count_done_i = (uint64_t)((((uint64_t)(s_autorefresh_enable_i)) != 0) && (((uint64_t)(s_U2_count_match_i)) != 0));
+  }
+}
+// ../ice40/sdram_controller.v:305
+void Vsdram_controller::q27_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_power_down_reg1_i = 0x0ULL;
+    n_s_power_down_reg2_i = 0x0ULL;
+    n_s_power_down_reg3_i = 0x0ULL;
+  } else {
+    n_s_power_down_reg1_i = (uint64_t)((((uint64_t)(s_power_down_i)) != 0) && ((uint64_t)(((uint64_t)(o_power_state)) == 0x1ULL) != 0));
+    n_s_power_down_reg2_i = (uint64_t)((((uint64_t)(s_power_down_i)) != 0) && (((uint64_t)(s_power_down_reg1_i)) != 0));
+    n_s_power_down_reg3_i = (uint64_t)((((uint64_t)(s_power_down_i)) != 0) && (((uint64_t)(s_power_down_reg2_i)) != 0));
+  }
+}
+// ../ice40/sdram_controller.v:401
+void Vsdram_controller::q28_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_refresh_owed_i = ((uint64_t)((0x0ULL) & 0x1fULL));
+  } else {
+    if ((uint64_t)((((uint64_t)(s_refresh_count_done_i)) != 0) && ((~((uint64_t)(s_autoref_ack_i)) & 0x1ULL) != 0)) != 0) {
+      n_s_refresh_owed_i = ((uint64_t)((((uint64_t)((vl_sext<uint64_t>(((uint64_t)(((uint64_t)(s_refresh_owed_i)))), 5) & 0xffffffffULL) + 0x1ULL) & 0xffffffffULL)) & 0x1fULL));
+    } else {
+      if ((uint64_t)((((uint64_t)(s_autoref_ack_i)) != 0) && ((~((uint64_t)(s_refresh_count_done_i)) & 0x1ULL) != 0)) != 0) {
+        n_s_refresh_owed_i = ((uint64_t)((((uint64_t)((vl_sext<uint64_t>(((uint64_t)(((uint64_t)(s_refresh_owed_i)))), 5) & 0xffffffffULL) - 0x1ULL) & 0xffffffffULL)) & 0x1fULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_controller.v:409
+void Vsdram_controller::q29_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_idle_count_i = ((uint64_t)((0x0ULL) & 0x1fULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(((~((uint64_t)(s_init_done_i)) & 0x1ULL) != 0) || (((uint64_t)(s_sdrctl_busyn_i)) != 0)) != 0) || (((uint64_t)(i_adv)) != 0)) != 0) {
+      n_s_idle_count_i = ((uint64_t)((0x0ULL) & 0x1fULL));
+    } else {
+      if ((uint64_t)(((uint64_t)(((uint64_t)(s_idle_count_i)))) != 0x10ULL) != 0) {
+        n_s_idle_count_i = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_idle_count_i)))) + 0x1ULL) & 0xffffffffULL)) & 0x1fULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_controller.v:435
+void Vsdram_controller::q30_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_power_idle_i = ((uint64_t)((0x0ULL) & 0xffffffULL));
+  } else {
+    if ((uint64_t)(((~((uint64_t)(s_init_done_i)) & 0x1ULL) != 0) || (((uint64_t)(i_adv)) != 0)) != 0) {
+      n_s_power_idle_i = ((uint64_t)((0x0ULL) & 0xffffffULL));
+    } else {
+      if ((uint64_t)(((uint64_t)(s_power_idle_i)) != 0xffffffULL) != 0) {
+        n_s_power_idle_i = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_power_idle_i)))) + 0x1ULL) & 0xffffffffULL)) & 0xffffffULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_controller.v:443
+void Vsdram_controller::q31_() {
+  if ((uint64_t)(((uint64_t)(o_power_state)) != 0x2ULL) != 0) {
+    n_s_selfrefresh_time_i = ((uint64_t)((0x0ULL) & 0xfULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_selfrefresh_time_i)))) != 0x4ULL) != 0) {
+      n_s_selfrefresh_time_i = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_selfrefresh_time_i)))) + 0x1ULL) & 0xffffffffULL)) & 0xfULL));
+    }
+  }
+}
+// ../ice40/sdram_controller.v:465
+void Vsdram_controller::q32_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_refresh_req_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if (((uint64_t)(i_disable_autorefresh)) != 0) {
+      n_s_refresh_req_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+    } else {
+      if (((uint64_t)(s_init_done_i)) != 0) {
+        n_s_refresh_req_i = ((uint64_t)(s_refresh_due_i));
+      } else {
+        n_s_refresh_req_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_controller.v:476
+void Vsdram_controller::q33_() {
+  if (((uint64_t)(i_rst)) != 0) {
+    n_s_autorefresh_enable_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if ((uint64_t)((((uint64_t)(s_init_done_i)) != 0) && ((~((uint64_t)(s_selfrefresh_i)) & 0x1ULL) != 0)) != 0) {
+      n_s_autorefresh_enable_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_autorefresh_enable_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+}
+void Vsdram_controller::settle_() {
+  p55_();
+  p56_();
+  p54_();
+  p58_();
+  p53_();
+  p52_();
+  p51_();
+  p50_();
+  p49_();
+  p48_();
+  p46_();
+  p45_();
+  p44_();
+  p43_();
+  p42_();
+  p41_();
+  p40_();
+  p39_();
+  p38_();
+  p35_();
+  p33_();
+  p32_();
+  p31_();
+  p29_();
+  p28_();
+  p30_();
+  p27_();
+  p26_();
+  p25_();
+  p37_();
+  p24_();
+  p23_();
+  p36_();
+  p47_();
+  p22_();
+  p20_();
+  p19_();
+  p18_();
+  p17_();
+  p16_();
+  p15_();
+  p59_();
+  p57_();
+  p14_();
+  p11_();
+  p10_();
+  p6_();
+  p5_();
+  p2_();
+  p1_();
+  p7_();
+  p9_();
+  p8_();
+  p4_();
+  p3_();
+  p12_();
+  p13_();
+  p21_();
+  p0_();
+  p34_();
+}
+void Vsdram_controller::commit_() {
+  s_U0_burst_col_i = n_s_U0_burst_col_i;
+  s_U0_clk_count_i = n_s_U0_clk_count_i;
+  s_U0_cmd_fsm_states_i = n_s_U0_cmd_fsm_states_i;
+  s_U0_cpu2sdram_reg_i = n_s_U0_cpu2sdram_reg_i;
+  s_U0_cpu_data_reg_i = n_s_U0_cpu_data_reg_i;
+  s_U0_cpu_den_i = n_s_U0_cpu_den_i;
+  s_U0_init_fsm_states_i = n_s_U0_init_fsm_states_i;
+  s_U0_o_sdram_addr = n_s_U0_o_sdram_addr;
+  s_U0_o_sdram_blkaddr = n_s_U0_o_sdram_blkaddr;
+  s_U0_ras_count_i = n_s_U0_ras_count_i;
+  s_U0_read_data_req_i = n_s_U0_read_data_req_i;
+  s_U0_read_done_i = n_s_U0_read_done_i;
+  s_U0_read_done_reg_i = n_s_U0_read_done_reg_i;
+  s_U0_read_pipe_i = n_s_U0_read_pipe_i;
+  s_U0_read_req_cnt_i = n_s_U0_read_req_cnt_i;
+  s_U0_read_req_cnt_rst_i = n_s_U0_read_req_cnt_rst_i;
+  s_U0_row_open_i = n_s_U0_row_open_i;
+  s_U0_sdram_dq_en_i = n_s_U0_sdram_dq_en_i;
+  s_U0_sdram_dq_reg_i = n_s_U0_sdram_dq_reg_i;
+  s_U0_sdram_dqm_i = n_s_U0_sdram_dqm_i;
+  s_U0_wr_count_i = n_s_U0_wr_count_i;
+  s_U0_write_cmd_i = n_s_U0_write_cmd_i;
+  s_U0_write_done_i = n_s_U0_write_done_i;
+  s_U0_write_done_reg_i = n_s_U0_write_done_reg_i;
+  s_U1_U1_lfsr_reg_i = n_s_U1_U1_lfsr_reg_i;
+  s_U1_U5_lfsr_reg_i = n_s_U1_U5_lfsr_reg_i;
+  s_U1_lfsr_64_done_i = n_s_U1_lfsr_64_done_i;
+  s_U2_count_i = n_s_U2_count_i;
+  s_autoref_ack_i = n_s_autoref_ack_i;
+  s_autorefresh_enable_i = n_s_autorefresh_enable_i;
+  s_delay_done150us_i = n_s_delay_done150us_i;
+  s_idle_count_i = n_s_idle_count_i;
+  s_init_done_i = n_s_init_done_i;
+  o_ack = n_o_ack;
+  o_sdram_casn = n_o_sdram_casn;
+  o_sdram_cke = n_o_sdram_cke;
+  o_sdram_csn = n_o_sdram_csn;
+  o_sdram_rasn = n_o_sdram_rasn;
+  o_sdram_wen = n_o_sdram_wen;
+  s_power_down_reg1_i = n_s_power_down_reg1_i;
+  s_power_down_reg2_i = n_s_power_down_reg2_i;
+  s_power_down_reg3_i = n_s_power_down_reg3_i;
+  s_power_idle_i = n_s_power_idle_i;
+  s_refresh_count_done_i = n_s_refresh_count_done_i;
+  s_refresh_owed_i = n_s_refresh_owed_i;
+  s_refresh_req_i = n_s_refresh_req_i;
+  s_sdrctl_busyn_i = n_s_sdrctl_busyn_i;
+  s_selfrefresh_time_i = n_s_selfrefresh_time_i;
+  for (size_t i = 0; i < nq_s_U0_open_row_i.size(); ++i) s_U0_open_row_i[nq_s_U0_open_row_i[i].first] = nq_s_U0_open_row_i[i].second;
+  nq_s_U0_open_row_i.clear();
+}
+void Vsdram_controller::eval() {
+  i_addr &= 0x7ffffffULL;
+  i_adv &= 0x1ULL;
+  i_clk &= 0x1ULL;
+  i_rst &= 0x1ULL;
+  i_rwn &= 0x1ULL;
+  i_selfrefresh_req &= 0x1ULL;
+  i_loadmod_req &= 0x1ULL;
+  i_burststop_req &= 0x1ULL;
+  i_disable_active &= 0x1ULL;
+  i_disable_precharge &= 0x1ULL;
+  i_precharge_req &= 0x1ULL;
+  i_power_down &= 0x1ULL;
+  i_disable_autorefresh &= 0x1ULL;
+  i_next_addr &= 0x7ffffffULL;
+  i_next_valid &= 0x1ULL;
+  i_burst_len &= 0x3ffULL;
+  i_dqm &= 0xfULL;
+  settle_();
+  if (!inited_) {
+    tp_0 = ((uint64_t)(i_clk));
+    tp_1 = ((uint64_t)(i_rst));
+    tp_2 = ((uint64_t)(s_sys_clk_i));
+    tp_3 = ((uint64_t)(s_sys_rst_i));
+    tp_4 = ((uint64_t)(s_U1_lfsr_64_done_i));
+    inited_ = true;
+  }
+  for (int it = 0; ; ++it) {
+    uint8_t c_0 = ((uint64_t)(i_clk));
+    uint8_t c_1 = ((uint64_t)(i_rst));
+    uint8_t c_2 = ((uint64_t)(s_sys_clk_i));
+    uint8_t c_3 = ((uint64_t)(s_sys_rst_i));
+    uint8_t c_4 = ((uint64_t)(s_U1_lfsr_64_done_i));
+    bool g_0 = (!tp_0 && c_0);
+    bool g_1 = (!tp_0 && c_0) || (!tp_1 && c_1);
+    bool g_2 = (!tp_2 && c_2) || (!tp_3 && c_3);
+    bool g_3 = (!tp_3 && c_3) || (!tp_4 && c_4);
+    tp_0 = c_0;
+    tp_1 = c_1;
+    tp_2 = c_2;
+    tp_3 = c_3;
+    tp_4 = c_4;
+    if (!(g_0 || g_1 || g_2 || g_3)) break;
+    if (g_0) { q3_(); q13_(); q14_(); q23_(); q31_(); }
+    if (g_1) { q0_(); q1_(); q2_(); q4_(); q5_(); q6_(); q7_(); q8_(); q9_(); q10_(); q11_(); q12_(); q15_(); q16_(); q17_(); q18_(); q19_(); q20_(); q21_(); q22_(); q27_(); q28_(); q29_(); q30_(); q32_(); q33_(); }
+    if (g_2) { q24_(); q26_(); }
+    if (g_3) { q25_(); }
+    commit_();
+    settle_();
+    if (it > 1000) vl_fatal("clock loop");
+  }
+}
@@ -0,0 +1,297 @@
+// Generated by the vl2cpp stand-in; do not edit.
+#ifndef _VSDRAM_CONTROLLER_H_
+#define _VSDRAM_CONTROLLER_H_
+#include "verilated.h"
+class Vsdram_controller {
+public:
+  uint32_t s_U0_bank_i = 0;
+  uint16_t s_U0_burst_col_i = 0;
+  uint16_t n_s_U0_burst_col_i = 0;
+  uint8_t s_U0_clk_count_i = 0;
+  uint8_t n_s_U0_clk_count_i = 0;
+  uint8_t s_U0_cmd_fsm_states_i = 0;
+  uint8_t n_s_U0_cmd_fsm_states_i = 0;
+  uint16_t s_U0_col_addr_i = 0;
+  uint16_t s_U0_col_i = 0;
+  uint16_t s_U0_cpu2sdram_reg_i = 0;
+  uint16_t n_s_U0_cpu2sdram_reg_i = 0;
+  uint16_t s_U0_cpu_data_reg_i = 0;
+  uint16_t n_s_U0_cpu_data_reg_i = 0;
+  uint8_t s_U0_cpu_den_i = 0;
+  uint8_t n_s_U0_cpu_den_i = 0;
+  uint32_t s_U0_i_addr = 0;
+  uint16_t s_U0_i_data = 0;
+  uint8_t s_U0_i_dqm = 0;
+  uint32_t s_U0_i_next_addr = 0;
+  uint16_t s_U0_i_sdram_dq = 0;
+  uint8_t s_U0_init_fsm_states_i = 0;
+  uint8_t n_s_U0_init_fsm_states_i = 0;
+  uint8_t s_U0_lookahead_act_i = 0;
+  uint8_t s_U0_lookahead_pre_i = 0;
+  uint8_t s_U0_lookahead_slot_i = 0;
+  uint8_t s_U0_next_bank_i = 0;
+  uint16_t s_U0_next_row_i = 0;
+  uint16_t s_U0_o_data = 0;
+  uint16_t s_U0_o_sdram_addr = 0;
+  uint16_t n_s_U0_o_sdram_addr = 0;
+  uint8_t s_U0_o_sdram_blkaddr = 0;
+  uint8_t n_s_U0_o_sdram_blkaddr = 0;
+  uint16_t s_U0_o_sdram_dq = 0;
+  uint8_t s_U0_o_sdram_dqm = 0;
+  uint16_t s_U0_open_row_i[4] = {};
+  std::vector<std::pair<uint64_t, uint64_t> > nq_s_U0_open_row_i;
+  uint8_t s_U0_page_hit_i = 0;
+  uint8_t s_U0_page_miss_i = 0;
+  uint8_t s_U0_precharge_ok_i = 0;
+  uint16_t s_U0_ras_count_i = 0;
+  uint16_t n_s_U0_ras_count_i = 0;
+  uint8_t s_U0_read_cmd_state_i = 0;
+  uint8_t s_U0_read_data_req_i = 0;
+  uint8_t n_s_U0_read_data_req_i = 0;
+  uint8_t s_U0_read_done_i = 0;
+  uint8_t n_s_U0_read_done_i = 0;
+  uint8_t s_U0_read_done_reg_i = 0;
+  uint8_t n_s_U0_read_done_reg_i = 0;
+  uint8_t s_U0_read_early_i = 0;
+  uint8_t s_U0_read_pipe_i = 0;
+  uint8_t n_s_U0_read_pipe_i = 0;
+  uint8_t s_U0_read_pipeline_i = 0;
+  uint16_t s_U0_read_req_cnt_i = 0;
+  uint16_t n_s_U0_read_req_cnt_i = 0;
+  uint8_t s_U0_read_req_cnt_rst_i = 0;
+  uint8_t n_s_U0_read_req_cnt_rst_i = 0;
+  uint8_t s_U0_req_bank_i = 0;
+  uint16_t s_U0_req_row_i = 0;
+  uint8_t s_U0_reset_clk_counter_i = 0;
+  uint8_t s_U0_row_open_i = 0;
+  uint8_t n_s_U0_row_open_i = 0;
+  uint8_t s_U0_sdram_dq_en_i = 0;
+  uint8_t n_s_U0_sdram_dq_en_i = 0;
+  uint16_t s_U0_sdram_dq_reg0_i = 0;
+  uint16_t s_U0_sdram_dq_reg1_i = 0;
+  uint16_t s_U0_sdram_dq_reg2_i = 0;
+  uint16_t s_U0_sdram_dq_reg3_i = 0;
+  uint16_t s_U0_sdram_dq_reg_i = 0;
+  uint16_t n_s_U0_sdram_dq_reg_i = 0;
+  uint8_t s_U0_sdram_dqm_i = 0;
+  uint8_t n_s_U0_sdram_dqm_i = 0;
+  VlWide<276> s_U0_state_ASCII;
+  uint16_t s_U0_wr_count_i = 0;
+  uint16_t n_s_U0_wr_count_i = 0;
+  uint8_t s_U0_write_cmd_i = 0;
+  uint8_t n_s_U0_write_cmd_i = 0;
+  uint8_t s_U0_write_cmd_state_i = 0;
+  uint8_t s_U0_write_done_i = 0;
+  uint8_t n_s_U0_write_done_i = 0;
+  uint8_t s_U0_write_done_reg_i = 0;
+  uint8_t n_s_U0_write_done_reg_i = 0;
+  uint8_t s_U0_write_issue_i = 0;
+  uint8_t s_U1_U1_lfsr_d0_i = 0;
+  uint8_t s_U1_U1_lfsr_equal = 0;
+  uint8_t s_U1_U1_lfsr_reg_i = 0;
+  uint8_t n_s_U1_U1_lfsr_reg_i = 0;
+  uint8_t s_U1_U5_lfsr_256_equal_i = 0;
+  uint8_t s_U1_U5_lfsr_d0_i = 0;
+  uint8_t s_U1_U5_lfsr_reg_i = 0;
+  uint8_t n_s_U1_U5_lfsr_reg_i = 0;
+  uint8_t s_U1_lfsr_64_done_i = 0;
+  uint8_t n_s_U1_lfsr_64_done_i = 0;
+  uint16_t s_U2_count_i = 0;
+  uint16_t n_s_U2_count_i = 0;
+  uint8_t s_U2_count_match_i = 0;
+  uint8_t s_autoref_ack_i = 0;
+  uint8_t n_s_autoref_ack_i = 0;
+  uint8_t s_autorefresh_enable_i = 0;
+  uint8_t n_s_autorefresh_enable_i = 0;
+  uint16_t s_cpu_datain_i = 0;
+  uint16_t s_cpu_dataout_i = 0;
+  uint8_t s_cpu_den_i = 0;
+  uint8_t s_delay_done150us_i = 0;
+  uint8_t n_s_delay_done150us_i = 0;
+  uint32_t i_addr = 0;
+  uint8_t i_adv = 0;
+  uint16_t i_burst_len = 0;
+  uint8_t i_burststop_req = 0;
+  uint8_t i_clk = 0;
+  uint16_t i_data = 0;
+  uint8_t i_disable_active = 0;
+  uint8_t i_disable_autorefresh = 0;
+  uint8_t i_disable_precharge = 0;
+  uint8_t i_dqm = 0;
+  uint8_t i_loadmod_req = 0;
+  uint32_t i_next_addr = 0;
+  uint8_t i_next_valid = 0;
+  uint8_t i_power_down = 0;
+  uint16_t i_powerdown_idle = 0;
+  uint8_t i_precharge_req = 0;
+  uint8_t i_rst = 0;
+  uint8_t i_rwn = 0;
+  uint16_t i_sdram_dq = 0;
+  uint16_t i_selfrefresh_idle = 0;
+  uint8_t i_selfrefresh_req = 0;
+  uint8_t s_idle_count_i = 0;
+  uint8_t n_s_idle_count_i = 0;
+  uint8_t s_init_done_i = 0;
+  uint8_t n_s_init_done_i = 0;
+  uint8_t o_ack = 0;
+  uint8_t n_o_ack = 0;
+  uint8_t o_busy = 0;
+  uint16_t o_data = 0;
+  uint8_t o_data_next = 0;
+  uint8_t o_data_req = 0;
+  uint8_t o_data_valid = 0;
+  uint8_t o_init_done = 0;
+  uint8_t o_pipe_ready = 0;
+  uint8_t o_power_state = 0;
+  uint8_t o_read_done = 0;
+  uint16_t o_sdram_addr = 0;
+  uint8_t o_sdram_blkaddr = 0;
+  uint8_t o_sdram_busdir = 0;
+  uint8_t o_sdram_casn = 0;
+  uint8_t n_o_sdram_casn = 0;
+  uint8_t o_sdram_cke = 0;
+  uint8_t n_o_sdram_cke = 0;
+  uint8_t o_sdram_clk = 0;
+  uint8_t o_sdram_csn = 0;
+  uint8_t n_o_sdram_csn = 0;
+  uint16_t o_sdram_dq = 0;
+  uint8_t o_sdram_dqm = 0;
+  uint8_t o_sdram_rasn = 0;
+  uint8_t n_o_sdram_rasn = 0;
+  uint8_t o_sdram_wen = 0;
+  uint8_t n_o_sdram_wen = 0;
+  uint8_t o_wake = 0;
+  uint8_t o_write_done = 0;
+  uint8_t s_power_down_i = 0;
+  uint8_t s_power_down_reg1_i = 0;
+  uint8_t n_s_power_down_reg1_i = 0;
+  uint8_t s_power_down_reg2_i = 0;
+  uint8_t n_s_power_down_reg2_i = 0;
+  uint8_t s_power_down_reg3_i = 0;
+  uint8_t n_s_power_down_reg3_i = 0;
+  uint32_t s_power_idle_i = 0;
+  uint32_t n_s_power_idle_i = 0;
+  uint8_t s_powerdown_want_i = 0;
+  uint8_t s_refresh_count_done_i = 0;
+  uint8_t n_s_refresh_count_done_i = 0;
+  uint8_t s_refresh_due_i = 0;
+  uint8_t s_refresh_owed_i = 0;
+  uint8_t n_s_refresh_owed_i = 0;
+  uint8_t s_refresh_req_i = 0;
+  uint8_t n_s_refresh_req_i = 0;
+  uint8_t s_sdrctl_busyn_i = 0;
+  uint8_t n_s_sdrctl_busyn_i = 0;
+  uint8_t s_selfrefresh_i = 0;
+  uint8_t s_selfrefresh_time_i = 0;
+  uint8_t n_s_selfrefresh_time_i = 0;
+  uint8_t s_selfrefresh_want_i = 0;
+  uint8_t s_sys_clk_i = 0;
+  uint8_t s_sys_rst_i = 0;
+  uint8_t tp_0 = 0;
+  uint8_t tp_1 = 0;
+  uint8_t tp_2 = 0;
+  uint8_t tp_3 = 0;
+  uint8_t tp_4 = 0;
+  bool inited_ = false;
+  Vsdram_controller(const char *name = "TOP");
+  ~Vsdram_controller() {}
+  void eval();
+  void final() {}
+  void settle_();
+  void commit_();
+  void p0_();
+  void p1_();
+  void p2_();
+  void p3_();
+  void p4_();
+  void p5_();
+  void p6_();
+  void p7_();
+  void p8_();
+  void p9_();
+  void p10_();
+  void p11_();
+  void p12_();
+  void p13_();
+  void p14_();
+  void p15_();
+  void p16_();
+  void p17_();
+  void p18_();
+  void p19_();
+  void p20_();
+  void p21_();
+  void p22_();
+  void p23_();
+  void p24_();
+  void p25_();
+  void p26_();
+  void p27_();
+  void p28_();
+  void p29_();
+  void p30_();
+  void p31_();
+  void p32_();
+  void p33_();
+  void p34_();
+  void p35_();
+  void p36_();
+  void p37_();
+  void p38_();
+  void p39_();
+  void p40_();
+  void p41_();
+  void p42_();
+  void p43_();
+  void p44_();
+  void p45_();
+  void p46_();
+  void p47_();
+  void p48_();
+  void p49_();
+  void p50_();
+  void p51_();
+  void p52_();
+  void p53_();
+  void p54_();
+  void p55_();
+  void p56_();
+  void p57_();
+  void p58_();
+  void p59_();
+  void q0_();
+  void q1_();
+  void q2_();
+  void q3_();
+  void q4_();
+  void q5_();
+  void q6_();
+  void q7_();
+  void q8_();
+  void q9_();
+  void q10_();
+  void q11_();
+  void q12_();
+  void q13_();
+  void q14_();
+  void q15_();
+  void q16_();
+  void q17_();
+  void q18_();
+  void q19_();
+  void q20_();
+  void q21_();
+  void q22_();
+  void q23_();
+  void q24_();
+  void q25_();
+  void q26_();
+  void q27_();
+  void q28_();
+  void q29_();
+  void q30_();
+  void q31_();
+  void q32_();
+  void q33_();
+};
+#endif
@@ -0,0 +1,1782 @@
+// Generated by the vl2cpp stand-in; do not edit.
+#ifndef _VSIM_TOP_H_
+#define _VSIM_TOP_H_
+#include "verilated.h"
+class Vsim_top {
+public:
+  uint8_t aA = 0;
+  uint16_t s_aD = 0;
+  uint16_t aD_in = 0;
+  uint8_t aD_oe = 0;
+  uint16_t aD_out = 0;
+  uint8_t aNE = 0;
+  uint8_t aNOE = 0;
+  uint8_t aNWE = 0;
+  uint8_t cp_irq = 0;
+  uint8_t crystal_clk = 0;
+  uint16_t s_dut_aDn_input = 0;
+  uint16_t s_dut_aDn_output = 0;
+  uint16_t s_dut_adr32_lo = 0;
+  uint16_t n_s_dut_adr32_lo = 0;
+  uint32_t s_dut_at_arg = 0;
+  uint32_t n_s_dut_at_arg = 0;
+  uint8_t s_dut_at_busy = 0;
+  uint32_t s_dut_at_cmp = 0;
+  uint32_t n_s_dut_at_cmp = 0;
+  uint8_t s_dut_at_go = 0;
+  uint8_t s_dut_at_inv = 0;
+  uint32_t s_dut_at_inv_adr = 0;
+  uint32_t s_dut_at_next_adr = 0;
+  uint8_t s_dut_at_pending = 0;
+  uint32_t s_dut_at_result = 0;
+  uint32_t n_s_dut_at_result = 0;
+  uint32_t s_dut_at_sd_adr = 0;
+  uint32_t n_s_dut_at_sd_adr = 0;
+  uint8_t s_dut_at_sd_adv = 0;
+  uint8_t n_s_dut_at_sd_adv = 0;
+  uint16_t s_dut_at_sd_len = 0;
+  uint16_t n_s_dut_at_sd_len = 0;
+  uint8_t s_dut_at_sd_rwn = 0;
+  uint8_t n_s_dut_at_sd_rwn = 0;
+  uint16_t s_dut_at_wdata = 0;
+  uint16_t n_s_dut_at_wdata = 0;
+  uint8_t s_dut_bbuf_idx = 0;
+  uint8_t n_s_dut_bbuf_idx = 0;
+  uint16_t s_dut_bbuf_q = 0;
+  uint16_t n_s_dut_bbuf_q = 0;
+  uint8_t s_dut_bbuf_r_adr = 0;
+  uint8_t s_dut_bbuf_sd_idx = 0;
+  uint8_t n_s_dut_bbuf_sd_idx = 0;
+  uint8_t s_dut_bbuf_w_adr = 0;
+  uint16_t s_dut_bbuf_w_data = 0;
+  uint8_t s_dut_bbuf_we = 0;
+  uint8_t s_dut_bg_go = 0;
+  uint8_t s_dut_bg_turn = 0;
+  uint8_t n_s_dut_bg_turn = 0;
+  uint8_t s_dut_bist_busy = 0;
+  uint32_t s_dut_bist_errors = 0;
+  uint32_t n_s_dut_bist_errors = 0;
+  uint32_t s_dut_bist_fail_adr = 0;
+  uint16_t s_dut_bist_fail_mask = 0;
+  uint16_t n_s_dut_bist_fail_mask = 0;
+  uint8_t s_dut_bist_fail_sel = 0;
+  uint8_t n_s_dut_bist_fail_sel = 0;
+  uint32_t s_dut_bist_len = 0;
+  uint32_t n_s_dut_bist_len = 0;
+  uint32_t s_dut_bist_next_adr = 0;
+  uint8_t s_dut_bist_nfail = 0;
+  uint8_t n_s_dut_bist_nfail = 0;
+  uint32_t s_dut_bist_sd_adr = 0;
+  uint32_t n_s_dut_bist_sd_adr = 0;
+  uint8_t s_dut_bist_sd_adv = 0;
+  uint8_t n_s_dut_bist_sd_adv = 0;
+  uint16_t s_dut_bist_sd_len = 0;
+  uint16_t n_s_dut_bist_sd_len = 0;
+  uint8_t s_dut_bist_sd_rwn = 0;
+  uint8_t n_s_dut_bist_sd_rwn = 0;
+  uint8_t s_dut_bist_start = 0;
+  uint16_t s_dut_bist_wdata = 0;
+  uint16_t n_s_dut_bist_wdata = 0;
+  uint16_t s_dut_burst_buf_mem[256] = {};
+  std::vector<std::pair<uint64_t, uint64_t> > nq_s_dut_burst_buf_mem;
+  uint8_t s_dut_burst_busy = 0;
+  uint32_t s_dut_burst_count = 0;
+  uint32_t n_s_dut_burst_count = 0;
+  uint16_t s_dut_burst_len = 0;
+  uint16_t n_s_dut_burst_len = 0;
+  uint32_t s_dut_burst_next_adr = 0;
+  uint32_t s_dut_burst_sd_adr = 0;
+  uint32_t n_s_dut_burst_sd_adr = 0;
+  uint8_t s_dut_burst_sd_adv = 0;
+  uint8_t n_s_dut_burst_sd_adv = 0;
+  uint16_t s_dut_burst_sd_len = 0;
+  uint16_t n_s_dut_burst_sd_len = 0;
+  uint8_t s_dut_burst_sd_rwn = 0;
+  uint8_t n_s_dut_burst_sd_rwn = 0;
+  uint8_t s_dut_burst_start = 0;
+  uint8_t s_dut_cache_hit = 0;
+  uint16_t s_dut_cache_hits = 0;
+  uint16_t n_s_dut_cache_hits = 0;
+  uint16_t s_dut_cache_misses = 0;
+  uint16_t n_s_dut_cache_misses = 0;
+  uint16_t s_dut_cache_q = 0;
+  uint16_t n_s_dut_cache_q = 0;
+  uint8_t s_dut_clk = 0;
+  uint8_t s_dut_cmd_active = 0;
+  uint8_t s_dut_cmd_precharge = 0;
+  uint8_t s_dut_cmd_read = 0;
+  uint8_t s_dut_cmd_refresh = 0;
+  uint8_t s_dut_cmd_write = 0;
+  uint8_t s_dut_cp_busy = 0;
+  uint8_t s_dut_cp_done = 0;
+  uint32_t s_dut_cp_dst = 0;
+  uint32_t n_s_dut_cp_dst = 0;
+  uint16_t s_dut_cp_fill_val = 0;
+  uint16_t n_s_dut_cp_fill_val = 0;
+  uint8_t s_dut_cp_full = 0;
+  uint8_t s_dut_cp_go = 0;
+  uint8_t s_dut_cp_inv = 0;
+  uint8_t s_dut_cp_irq = 0;
+  uint32_t s_dut_cp_len = 0;
+  uint32_t n_s_dut_cp_len = 0;
+  uint8_t s_dut_cp_level = 0;
+  uint32_t s_dut_cp_next_adr = 0;
+  uint8_t s_dut_cp_pending = 0;
+  uint8_t s_dut_cp_push = 0;
+  uint32_t s_dut_cp_sd_adr = 0;
+  uint32_t n_s_dut_cp_sd_adr = 0;
+  uint8_t s_dut_cp_sd_adv = 0;
+  uint8_t n_s_dut_cp_sd_adv = 0;
+  uint16_t s_dut_cp_sd_len = 0;
+  uint16_t n_s_dut_cp_sd_len = 0;
+  uint8_t s_dut_cp_sd_rwn = 0;
+  uint8_t n_s_dut_cp_sd_rwn = 0;
+  uint32_t s_dut_cp_src = 0;
+  uint32_t n_s_dut_cp_src = 0;
+  uint16_t s_dut_cp_wdata = 0;
+  uint8_t s_dut_crc_busy = 0;
+  uint32_t s_dut_crc_q = 0;
+  uint8_t s_dut_crc_start = 0;
+  uint32_t s_dut_crc_sum = 0;
+  uint32_t n_s_dut_crc_sum = 0;
+  uint32_t s_dut_cur_adr = 0;
+  uint32_t n_s_dut_cur_adr = 0;
+  uint8_t s_dut_cur_nbl = 0;
+  uint8_t n_s_dut_cur_nbl = 0;
+  uint8_t s_dut_cur_status_busy = 0;
+  uint16_t s_dut_cur_value = 0;
+  uint16_t n_s_dut_cur_value = 0;
+  uint8_t s_dut_decode_adr32_hi = 0;
+  uint8_t s_dut_decode_adr32_lo = 0;
+  uint8_t s_dut_decode_adr_high = 0;
+  uint8_t s_dut_decode_adr_low = 0;
+  uint8_t s_dut_decode_at_arg_hi = 0;
+  uint8_t s_dut_decode_at_arg_lo = 0;
+  uint8_t s_dut_decode_at_cmp_hi = 0;
+  uint8_t s_dut_decode_at_cmp_lo = 0;
+  uint8_t s_dut_decode_at_op = 0;
+  uint8_t s_dut_decode_bist_ctrl = 0;
+  uint8_t s_dut_decode_bist_fail_sel = 0;
+  uint8_t s_dut_decode_bist_len_hi = 0;
+  uint8_t s_dut_decode_bist_len_lo = 0;
+  uint8_t s_dut_decode_burst_data = 0;
+  uint8_t s_dut_decode_burst_len = 0;
+  uint8_t s_dut_decode_burst_status = 0;
+  uint8_t s_dut_decode_cache_hits = 0;
+  uint8_t s_dut_decode_cache_misses = 0;
+  uint8_t s_dut_decode_cp_ctrl = 0;
+  uint8_t s_dut_decode_cp_dst_hi = 0;
+  uint8_t s_dut_decode_cp_dst_lo = 0;
+  uint8_t s_dut_decode_cp_fill = 0;
+  uint8_t s_dut_decode_cp_len_hi = 0;
+  uint8_t s_dut_decode_cp_len_lo = 0;
+  uint8_t s_dut_decode_cp_src_hi = 0;
+  uint8_t s_dut_decode_cp_src_lo = 0;
+  uint8_t s_dut_decode_cp_status = 0;
+  uint8_t s_dut_decode_crc_ctrl = 0;
+  uint8_t s_dut_decode_data = 0;
+  uint8_t s_dut_decode_data32 = 0;
+  uint8_t s_dut_decode_data_stream = 0;
+  uint8_t s_dut_decode_perf_sel = 0;
+  uint8_t s_dut_decode_pwr_pd_idle = 0;
+  uint8_t s_dut_decode_pwr_sr_idle = 0;
+  uint8_t s_dut_decode_range_len_hi = 0;
+  uint8_t s_dut_decode_range_len_lo = 0;
+  uint8_t s_dut_decode_scan_ctrl = 0;
+  uint8_t s_dut_decode_scan_key = 0;
+  uint8_t s_dut_decode_scan_mask = 0;
+  uint8_t s_dut_decode_stream_adr = 0;
+  uint8_t s_dut_decode_win_base = 0;
+  uint8_t s_dut_decode_window_w = 0;
+  uint8_t s_dut_fill_cnt = 0;
+  uint8_t n_s_dut_fill_cnt = 0;
+  uint8_t s_dut_fill_go = 0;
+  uint8_t s_dut_fsmc_do_read = 0;
+  uint8_t n_s_dut_fsmc_do_read = 0;
+  uint8_t s_dut_fsmc_do_write = 0;
+  uint8_t n_s_dut_fsmc_do_write = 0;
+  uint8_t s_dut_fsmc_io_d_output = 0;
+  uint8_t s_dut_fsmc_io_nbl_unused = 0;
+  uint8_t s_dut_fsmc_nbl = 0;
+  uint8_t s_dut_fsmc_nwait = 0;
+  uint8_t s_dut_fsmc_r_adr = 0;
+  uint16_t s_dut_fsmc_r_data = 0;
+  uint8_t s_dut_fsmc_r_taken = 0;
+  uint8_t s_dut_fsmc_rd_wait = 0;
+  uint8_t s_dut_fsmc_stream_pop = 0;
+  uint8_t s_dut_fsmc_w_adr = 0;
+  uint16_t s_dut_fsmc_w_data = 0;
+  uint8_t s_dut_fsmc_w_nbl = 0;
+  uint8_t s_dut_fsmc_wr_wait = 0;
+  uint8_t s_dut_in_refresh = 0;
+  uint8_t n_s_dut_in_refresh = 0;
+  uint8_t s_dut_io_Dn_0__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_0__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_0__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_0__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_10__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_10__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_10__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_10__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_11__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_11__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_11__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_11__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_12__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_12__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_12__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_12__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_13__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_13__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_13__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_13__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_14__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_14__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_14__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_14__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_15__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_15__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_15__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_15__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_1__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_1__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_1__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_1__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_2__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_2__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_2__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_2__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_3__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_3__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_3__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_3__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_4__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_4__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_4__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_4__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_5__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_5__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_5__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_5__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_6__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_6__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_6__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_6__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_7__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_7__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_7__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_7__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_8__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_8__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_8__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_8__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_Dn_9__D_IN_0 = 0;
+  uint8_t s_dut_io_Dn_9__D_OUT_0 = 0;
+  uint8_t s_dut_io_Dn_9__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_Dn_9__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_0__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_0__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_0__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_0__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_10__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_10__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_10__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_10__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_11__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_11__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_11__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_11__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_12__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_12__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_12__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_12__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_13__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_13__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_13__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_13__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_14__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_14__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_14__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_14__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_15__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_15__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_15__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_15__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_1__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_1__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_1__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_1__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_2__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_2__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_2__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_2__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_3__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_3__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_3__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_3__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_4__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_4__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_4__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_4__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_5__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_5__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_5__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_5__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_6__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_6__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_6__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_6__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_7__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_7__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_7__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_7__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_8__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_8__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_8__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_8__PACKAGE_PIN = 0;
+  uint8_t s_dut_io_mem_d_9__D_IN_0 = 0;
+  uint8_t s_dut_io_mem_d_9__D_OUT_0 = 0;
+  uint8_t s_dut_io_mem_d_9__OUTPUT_ENABLE = 0;
+  uint8_t s_dut_io_mem_d_9__PACKAGE_PIN = 0;
+  uint8_t s_dut_lock = 0;
+  uint32_t s_dut_my_atomic_adr = 0;
+  uint32_t s_dut_my_atomic_adr_r = 0;
+  uint32_t n_s_dut_my_atomic_adr_r = 0;
+  uint32_t s_dut_my_atomic_alu = 0;
+  uint32_t s_dut_my_atomic_arg_r = 0;
+  uint32_t n_s_dut_my_atomic_arg_r = 0;
+  uint16_t s_dut_my_atomic_atomic_burst_chunk = 0;
+  uint16_t s_dut_my_atomic_atomic_burst_chunk_x = 0;
+  uint32_t s_dut_my_atomic_atomic_burst_cur_adr = 0;
+  uint32_t n_s_dut_my_atomic_atomic_burst_cur_adr = 0;
+  uint8_t s_dut_my_atomic_atomic_burst_left = 0;
+  uint8_t n_s_dut_my_atomic_atomic_burst_left = 0;
+  uint16_t s_dut_my_atomic_atomic_burst_left_x = 0;
+  uint8_t s_dut_my_atomic_atomic_burst_len = 0;
+  uint8_t s_dut_my_atomic_atomic_burst_rd_left = 0;
+  uint8_t n_s_dut_my_atomic_atomic_burst_rd_left = 0;
+  uint8_t s_dut_my_atomic_atomic_burst_req_len = 0;
+  uint8_t n_s_dut_my_atomic_atomic_burst_req_len = 0;
+  uint16_t s_dut_my_atomic_atomic_burst_room = 0;
+  uint16_t s_dut_my_atomic_atomic_burst_room_x = 0;
+  uint8_t s_dut_my_atomic_atomic_burst_st_doing = 0;
+  uint8_t n_s_dut_my_atomic_atomic_burst_st_doing = 0;
+  uint8_t s_dut_my_atomic_atomic_burst_st_idle = 0;
+  uint8_t n_s_dut_my_atomic_atomic_burst_st_idle = 0;
+  uint8_t s_dut_my_atomic_atomic_burst_st_next = 0;
+  uint8_t n_s_dut_my_atomic_atomic_burst_st_next = 0;
+  uint8_t s_dut_my_atomic_atomic_burst_st_pending = 0;
+  uint8_t n_s_dut_my_atomic_atomic_burst_st_pending = 0;
+  uint8_t s_dut_my_atomic_b_busy = 0;
+  uint8_t s_dut_my_atomic_b_count_unused = 0;
+  uint8_t n_s_dut_my_atomic_b_count_unused = 0;
+  uint8_t s_dut_my_atomic_b_rwn = 0;
+  uint8_t n_s_dut_my_atomic_b_rwn = 0;
+  uint8_t s_dut_my_atomic_b_start = 0;
+  uint8_t n_s_dut_my_atomic_b_start = 0;
+  uint32_t s_dut_my_atomic_cmp_r = 0;
+  uint32_t n_s_dut_my_atomic_cmp_r = 0;
+  uint8_t s_dut_my_atomic_match = 0;
+  uint32_t s_dut_my_atomic_nv = 0;
+  uint32_t n_s_dut_my_atomic_nv = 0;
+  uint32_t s_dut_my_atomic_old = 0;
+  uint8_t s_dut_my_atomic_op = 0;
+  uint8_t s_dut_my_atomic_op_r = 0;
+  uint8_t n_s_dut_my_atomic_op_r = 0;
+  uint8_t s_dut_my_atomic_pend = 0;
+  uint8_t n_s_dut_my_atomic_pend = 0;
+  uint8_t s_dut_my_atomic_r_idx = 0;
+  uint8_t n_s_dut_my_atomic_r_idx = 0;
+  uint8_t s_dut_my_atomic_size32 = 0;
+  uint8_t s_dut_my_atomic_size32_r = 0;
+  uint8_t n_s_dut_my_atomic_size32_r = 0;
+  uint8_t s_dut_my_atomic_st_read = 0;
+  uint8_t n_s_dut_my_atomic_st_read = 0;
+  uint8_t s_dut_my_atomic_st_write = 0;
+  uint8_t n_s_dut_my_atomic_st_write = 0;
+  uint8_t s_dut_my_atomic_start = 0;
+  uint32_t s_dut_my_atomic_sum = 0;
+  uint8_t s_dut_my_atomic_w_idx = 0;
+  uint8_t n_s_dut_my_atomic_w_idx = 0;
+  uint32_t s_dut_my_bist_adr = 0;
+  uint32_t s_dut_my_bist_after_adr = 0;
+  uint8_t s_dut_my_bist_b_busy = 0;
+  uint32_t s_dut_my_bist_b_count_unused = 0;
+  uint32_t n_s_dut_my_bist_b_count_unused = 0;
+  uint8_t s_dut_my_bist_b_rwn = 0;
+  uint8_t n_s_dut_my_bist_b_rwn = 0;
+  uint8_t s_dut_my_bist_b_start = 0;
+  uint8_t n_s_dut_my_bist_b_start = 0;
+  uint32_t s_dut_my_bist_base = 0;
+  uint32_t n_s_dut_my_bist_base = 0;
+  uint16_t s_dut_my_bist_bist_burst_chunk = 0;
+  uint64_t s_dut_my_bist_bist_burst_chunk_x = 0;
+  uint32_t s_dut_my_bist_bist_burst_cur_adr = 0;
+  uint32_t n_s_dut_my_bist_bist_burst_cur_adr = 0;
+  uint32_t s_dut_my_bist_bist_burst_left = 0;
+  uint32_t n_s_dut_my_bist_bist_burst_left = 0;
+  uint64_t s_dut_my_bist_bist_burst_left_x = 0;
+  uint32_t s_dut_my_bist_bist_burst_rd_left = 0;
+  uint32_t n_s_dut_my_bist_bist_burst_rd_left = 0;
+  uint32_t s_dut_my_bist_bist_burst_req_len = 0;
+  uint32_t n_s_dut_my_bist_bist_burst_req_len = 0;
+  uint16_t s_dut_my_bist_bist_burst_room = 0;
+  uint64_t s_dut_my_bist_bist_burst_room_x = 0;
+  uint8_t s_dut_my_bist_bist_burst_st_doing = 0;
+  uint8_t n_s_dut_my_bist_bist_burst_st_doing = 0;
+  uint8_t s_dut_my_bist_bist_burst_st_idle = 0;
+  uint8_t n_s_dut_my_bist_bist_burst_st_idle = 0;
+  uint8_t s_dut_my_bist_bist_burst_st_next = 0;
+  uint8_t n_s_dut_my_bist_bist_burst_st_next = 0;
+  uint8_t s_dut_my_bist_bist_burst_st_pending = 0;
+  uint8_t n_s_dut_my_bist_bist_burst_st_pending = 0;
+  uint32_t s_dut_my_bist_blk = 0;
+  uint32_t s_dut_my_bist_blk_adr = 0;
+  uint32_t s_dut_my_bist_c1_adr = 0;
+  uint32_t n_s_dut_my_bist_c1_adr = 0;
+  uint16_t s_dut_my_bist_c1_exp = 0;
+  uint16_t n_s_dut_my_bist_c1_exp = 0;
+  uint16_t s_dut_my_bist_c1_got = 0;
+  uint16_t n_s_dut_my_bist_c1_got = 0;
+  uint8_t s_dut_my_bist_c1_valid = 0;
+  uint8_t n_s_dut_my_bist_c1_valid = 0;
+  uint32_t s_dut_my_bist_c_adr = 0;
+  uint32_t n_s_dut_my_bist_c_adr = 0;
+  uint32_t s_dut_my_bist_c_len = 0;
+  uint32_t n_s_dut_my_bist_c_len = 0;
+  uint8_t s_dut_my_bist_el = 0;
+  uint8_t s_dut_my_bist_el_down = 0;
+  uint8_t s_dut_my_bist_el_last = 0;
+  uint8_t s_dut_my_bist_el_rd = 0;
+  uint8_t s_dut_my_bist_el_rd_inv = 0;
+  uint8_t s_dut_my_bist_el_wr = 0;
+  uint8_t s_dut_my_bist_el_wr_inv = 0;
+  uint8_t s_dut_my_bist_elem = 0;
+  uint8_t n_s_dut_my_bist_elem = 0;
+  uint32_t s_dut_my_bist_fails[8] = {};
+  std::vector<std::pair<uint64_t, uint64_t> > nq_s_dut_my_bist_fails;
+  uint32_t s_dut_my_bist_left = 0;
+  uint32_t n_s_dut_my_bist_left = 0;
+  uint32_t s_dut_my_bist_len_r = 0;
+  uint32_t n_s_dut_my_bist_len_r = 0;
+  uint8_t s_dut_my_bist_nxt_down = 0;
+  uint8_t s_dut_my_bist_pat = 0;
+  uint8_t s_dut_my_bist_pat_r = 0;
+  uint8_t n_s_dut_my_bist_pat_r = 0;
+  uint32_t s_dut_my_bist_rd_adr = 0;
+  uint32_t n_s_dut_my_bist_rd_adr = 0;
+  uint32_t s_dut_my_bist_rd_lfsr = 0;
+  uint32_t n_s_dut_my_bist_rd_lfsr = 0;
+  uint8_t s_dut_my_bist_seed = 0;
+  uint8_t s_dut_my_bist_seed_r = 0;
+  uint8_t n_s_dut_my_bist_seed_r = 0;
+  uint8_t s_dut_my_bist_st_chunk = 0;
+  uint8_t n_s_dut_my_bist_st_chunk = 0;
+  uint8_t s_dut_my_bist_st_elem = 0;
+  uint8_t n_s_dut_my_bist_st_elem = 0;
+  uint8_t s_dut_my_bist_st_idle = 0;
+  uint8_t n_s_dut_my_bist_st_idle = 0;
+  uint8_t s_dut_my_bist_st_read = 0;
+  uint8_t n_s_dut_my_bist_st_read = 0;
+  uint8_t s_dut_my_bist_st_write = 0;
+  uint8_t n_s_dut_my_bist_st_write = 0;
+  uint32_t s_dut_my_bist_top_adr = 0;
+  uint32_t s_dut_my_bist_wr_adr = 0;
+  uint32_t n_s_dut_my_bist_wr_adr = 0;
+  uint32_t s_dut_my_bist_wr_lfsr = 0;
+  uint32_t n_s_dut_my_bist_wr_lfsr = 0;
+  uint32_t s_dut_my_burst_adr = 0;
+  uint32_t s_dut_my_burst_after_adr = 0;
+  uint16_t s_dut_my_burst_chunk = 0;
+  uint64_t s_dut_my_burst_chunk_x = 0;
+  uint32_t s_dut_my_burst_cur_adr = 0;
+  uint32_t n_s_dut_my_burst_cur_adr = 0;
+  uint32_t s_dut_my_burst_left = 0;
+  uint32_t n_s_dut_my_burst_left = 0;
+  uint64_t s_dut_my_burst_left_x = 0;
+  uint32_t s_dut_my_burst_len = 0;
+  uint32_t s_dut_my_burst_rd_left = 0;
+  uint32_t n_s_dut_my_burst_rd_left = 0;
+  uint32_t s_dut_my_burst_req_len = 0;
+  uint32_t n_s_dut_my_burst_req_len = 0;
+  uint16_t s_dut_my_burst_room = 0;
+  uint64_t s_dut_my_burst_room_x = 0;
+  uint8_t s_dut_my_burst_rwn = 0;
+  uint8_t s_dut_my_burst_st_doing = 0;
+  uint8_t n_s_dut_my_burst_st_doing = 0;
+  uint8_t s_dut_my_burst_st_idle = 0;
+  uint8_t n_s_dut_my_burst_st_idle = 0;
+  uint8_t s_dut_my_burst_st_next = 0;
+  uint8_t n_s_dut_my_burst_st_next = 0;
+  uint8_t s_dut_my_burst_st_pending = 0;
+  uint8_t n_s_dut_my_burst_st_pending = 0;
+  uint32_t s_dut_my_bus_slave_aDn = 0;
+  uint8_t s_dut_my_bus_slave_acc_done = 0;
+  uint8_t n_s_dut_my_bus_slave_acc_done = 0;
+  uint32_t s_dut_my_bus_slave_io_data = 0;
+  uint8_t s_dut_my_bus_slave_next_do_read = 0;
+  uint8_t s_dut_my_bus_slave_next_do_write = 0;
+  uint32_t s_dut_my_bus_slave_next_rDn = 0;
+  uint8_t s_dut_my_bus_slave_next_sAn_r = 0;
+  uint8_t s_dut_my_bus_slave_next_sAn_w = 0;
+  uint8_t s_dut_my_bus_slave_next_st_idle = 0;
+  uint8_t s_dut_my_bus_slave_next_st_read1 = 0;
+  uint8_t s_dut_my_bus_slave_next_st_read2 = 0;
+  uint8_t s_dut_my_bus_slave_next_st_write = 0;
+  uint8_t s_dut_my_bus_slave_next_st_wwait = 0;
+  uint32_t s_dut_my_bus_slave_next_wDn = 0;
+  uint32_t s_dut_my_bus_slave_rDn = 0;
+  uint32_t n_s_dut_my_bus_slave_rDn = 0;
+  uint32_t s_dut_my_bus_slave_read_data = 0;
+  uint8_t s_dut_my_bus_slave_sAn_r = 0;
+  uint8_t n_s_dut_my_bus_slave_sAn_r = 0;
+  uint8_t s_dut_my_bus_slave_sAn_w = 0;
+  uint8_t n_s_dut_my_bus_slave_sAn_w = 0;
+  uint8_t s_dut_my_bus_slave_sNE = 0;
+  uint8_t n_s_dut_my_bus_slave_sNE = 0;
+  uint8_t s_dut_my_bus_slave_sNOE = 0;
+  uint8_t n_s_dut_my_bus_slave_sNOE = 0;
+  uint8_t s_dut_my_bus_slave_sNWE = 0;
+  uint8_t n_s_dut_my_bus_slave_sNWE = 0;
+  uint8_t s_dut_my_bus_slave_st_idle = 0;
+  uint8_t n_s_dut_my_bus_slave_st_idle = 0;
+  uint8_t s_dut_my_bus_slave_st_read1 = 0;
+  uint8_t n_s_dut_my_bus_slave_st_read1 = 0;
+  uint8_t s_dut_my_bus_slave_st_read2 = 0;
+  uint8_t n_s_dut_my_bus_slave_st_read2 = 0;
+  uint8_t s_dut_my_bus_slave_st_write = 0;
+  uint8_t n_s_dut_my_bus_slave_st_write = 0;
+  uint8_t s_dut_my_bus_slave_st_wwait = 0;
+  uint8_t n_s_dut_my_bus_slave_st_wwait = 0;
+  uint8_t s_dut_my_bus_slave_sync_NE_M = 0;
+  uint8_t n_s_dut_my_bus_slave_sync_NE_M = 0;
+  uint8_t s_dut_my_bus_slave_sync_NOE_M = 0;
+  uint8_t n_s_dut_my_bus_slave_sync_NOE_M = 0;
+  uint8_t s_dut_my_bus_slave_sync_NWE_M = 0;
+  uint8_t n_s_dut_my_bus_slave_sync_NWE_M = 0;
+  uint32_t s_dut_my_bus_slave_wDn = 0;
+  uint32_t n_s_dut_my_bus_slave_wDn = 0;
+  uint32_t s_dut_my_bus_slave_w_data = 0;
+  uint32_t s_dut_my_cache_adr = 0;
+  uint8_t s_dut_my_cache_fill_done = 0;
+  uint8_t s_dut_my_cache_fill_we = 0;
+  uint8_t s_dut_my_cache_idx = 0;
+  uint8_t s_dut_my_cache_inv = 0;
+  uint32_t s_dut_my_cache_inv_adr = 0;
+  uint8_t s_dut_my_cache_inv_all = 0;
+  uint16_t s_dut_my_cache_lines_mem[1024] = {};
+  std::vector<std::pair<uint64_t, uint64_t> > nq_s_dut_my_cache_lines_mem;
+  uint16_t s_dut_my_cache_lines_r_adr = 0;
+  uint16_t s_dut_my_cache_lines_w_adr = 0;
+  uint16_t s_dut_my_cache_tag_q = 0;
+  uint16_t n_s_dut_my_cache_tag_q = 0;
+  uint16_t s_dut_my_cache_tags_mem[64] = {};
+  std::vector<std::pair<uint64_t, uint64_t> > nq_s_dut_my_cache_tags_mem;
+  uint16_t s_dut_my_cache_tags_w_data = 0;
+  uint64_t s_dut_my_cache_valid = 0;
+  uint64_t n_s_dut_my_cache_valid = 0;
+  uint32_t s_dut_my_copy_after_adr = 0;
+  uint32_t s_dut_my_copy_b_adr = 0;
+  uint32_t n_s_dut_my_copy_b_adr = 0;
+  uint8_t s_dut_my_copy_b_busy = 0;
+  uint32_t s_dut_my_copy_b_count_unused = 0;
+  uint32_t n_s_dut_my_copy_b_count_unused = 0;
+  uint8_t s_dut_my_copy_b_rwn = 0;
+  uint8_t n_s_dut_my_copy_b_rwn = 0;
+  uint8_t s_dut_my_copy_b_start = 0;
+  uint8_t n_s_dut_my_copy_b_start = 0;
+  uint32_t s_dut_my_copy_blk = 0;
+  uint32_t n_s_dut_my_copy_blk = 0;
+  uint16_t s_dut_my_copy_buf_q = 0;
+  uint16_t n_s_dut_my_copy_buf_q = 0;
+  uint16_t s_dut_my_copy_buf_r_idx = 0;
+  uint16_t n_s_dut_my_copy_buf_r_idx = 0;
+  uint16_t s_dut_my_copy_buf_w_idx = 0;
+  uint16_t n_s_dut_my_copy_buf_w_idx = 0;
+  uint32_t s_dut_my_copy_c_dst = 0;
+  uint32_t n_s_dut_my_copy_c_dst = 0;
+  uint8_t s_dut_my_copy_c_fill = 0;
+  uint8_t n_s_dut_my_copy_c_fill = 0;
+  uint8_t s_dut_my_copy_c_irq = 0;
+  uint8_t n_s_dut_my_copy_c_irq = 0;
+  uint32_t s_dut_my_copy_c_left = 0;
+  uint32_t n_s_dut_my_copy_c_left = 0;
+  uint32_t s_dut_my_copy_c_src = 0;
+  uint32_t n_s_dut_my_copy_c_src = 0;
+  uint16_t s_dut_my_copy_copy_buf_mem[512] = {};
+  std::vector<std::pair<uint64_t, uint64_t> > nq_s_dut_my_copy_copy_buf_mem;
+  uint8_t s_dut_my_copy_copy_buf_we = 0;
+  uint16_t s_dut_my_copy_copy_burst_chunk = 0;
+  uint64_t s_dut_my_copy_copy_burst_chunk_x = 0;
+  uint32_t s_dut_my_copy_copy_burst_cur_adr = 0;
+  uint32_t n_s_dut_my_copy_copy_burst_cur_adr = 0;
+  uint32_t s_dut_my_copy_copy_burst_left = 0;
+  uint32_t n_s_dut_my_copy_copy_burst_left = 0;
+  uint64_t s_dut_my_copy_copy_burst_left_x = 0;
+  uint32_t s_dut_my_copy_copy_burst_rd_left = 0;
+  uint32_t n_s_dut_my_copy_copy_burst_rd_left = 0;
+  uint32_t s_dut_my_copy_copy_burst_req_len = 0;
+  uint32_t n_s_dut_my_copy_copy_burst_req_len = 0;
+  uint16_t s_dut_my_copy_copy_burst_room = 0;
+  uint64_t s_dut_my_copy_copy_burst_room_x = 0;
+  uint8_t s_dut_my_copy_copy_burst_st_doing = 0;
+  uint8_t n_s_dut_my_copy_copy_burst_st_doing = 0;
+  uint8_t s_dut_my_copy_copy_burst_st_idle = 0;
+  uint8_t n_s_dut_my_copy_copy_burst_st_idle = 0;
+  uint8_t s_dut_my_copy_copy_burst_st_next = 0;
+  uint8_t n_s_dut_my_copy_copy_burst_st_next = 0;
+  uint8_t s_dut_my_copy_copy_burst_st_pending = 0;
+  uint8_t n_s_dut_my_copy_copy_burst_st_pending = 0;
+  uint8_t s_dut_my_copy_desc_q_clr = 0;
+  u128 s_dut_my_copy_desc_q_mem_mem[16] = {};
+  std::vector<std::pair<uint64_t, u128> > nq_s_dut_my_copy_desc_q_mem_mem;
+  uint8_t s_dut_my_copy_desc_q_mem_r_adr = 0;
+  uint8_t s_dut_my_copy_desc_q_mem_w_adr = 0;
+  uint8_t s_dut_my_copy_desc_q_mem_we = 0;
+  uint8_t s_dut_my_copy_desc_q_r_ptr = 0;
+  uint8_t n_s_dut_my_copy_desc_q_r_ptr = 0;
+  u128 s_dut_my_copy_desc_q_w_data = 0;
+  uint8_t s_dut_my_copy_desc_q_w_ptr = 0;
+  uint8_t n_s_dut_my_copy_desc_q_w_ptr = 0;
+  uint8_t s_dut_my_copy_dq_empty = 0;
+  u128 s_dut_my_copy_dq_head = 0;
+  u128 n_s_dut_my_copy_dq_head = 0;
+  uint8_t s_dut_my_copy_dq_pop = 0;
+  uint8_t s_dut_my_copy_dq_ready = 0;
+  uint8_t n_s_dut_my_copy_dq_ready = 0;
+  uint8_t s_dut_my_copy_fill = 0;
+  uint8_t s_dut_my_copy_have = 0;
+  uint8_t n_s_dut_my_copy_have = 0;
+  uint8_t s_dut_my_copy_irq = 0;
+  uint8_t s_dut_my_copy_irq_clr = 0;
+  uint8_t s_dut_my_copy_irq_r = 0;
+  uint8_t n_s_dut_my_copy_irq_r = 0;
+  uint8_t s_dut_my_copy_n_done = 0;
+  uint8_t n_s_dut_my_copy_n_done = 0;
+  uint32_t s_dut_my_copy_src = 0;
+  uint8_t s_dut_my_copy_st_read = 0;
+  uint8_t n_s_dut_my_copy_st_read = 0;
+  uint8_t s_dut_my_copy_st_write = 0;
+  uint8_t n_s_dut_my_copy_st_write = 0;
+  uint32_t s_dut_my_crc_c = 0;
+  uint32_t n_s_dut_my_crc_c = 0;
+  uint16_t s_dut_my_crc_d = 0;
+  uint16_t n_s_dut_my_crc_d = 0;
+  uint8_t s_dut_my_crc_d_valid = 0;
+  uint8_t n_s_dut_my_crc_d_valid = 0;
+  uint8_t s_dut_my_crc_valid = 0;
+  VlWide<416> s_dut_my_perf_cnt;
+  VlWide<416> n_s_dut_my_perf_cnt;
+  uint32_t s_dut_my_perf_i = 0;
+  uint8_t s_dut_my_pll_bypass = 0;
+  uint8_t s_dut_my_pll_dummy_out = 0;
+  uint8_t s_dut_my_pll_lock1 = 0;
+  uint32_t s_dut_my_reader_adr = 0;
+  uint8_t s_dut_my_reader_b_busy = 0;
+  uint32_t s_dut_my_reader_b_count_unused = 0;
+  uint32_t n_s_dut_my_reader_b_count_unused = 0;
+  uint8_t s_dut_my_reader_b_start = 0;
+  uint8_t n_s_dut_my_reader_b_start = 0;
+  uint32_t s_dut_my_reader_blk = 0;
+  uint32_t n_s_dut_my_reader_blk = 0;
+  uint32_t s_dut_my_reader_cur = 0;
+  uint32_t n_s_dut_my_reader_cur = 0;
+  uint32_t s_dut_my_reader_left = 0;
+  uint32_t n_s_dut_my_reader_left = 0;
+  uint8_t s_dut_my_reader_pend = 0;
+  uint8_t n_s_dut_my_reader_pend = 0;
+  uint32_t s_dut_my_reader_reader_burst_after_adr = 0;
+  uint16_t s_dut_my_reader_reader_burst_chunk = 0;
+  uint64_t s_dut_my_reader_reader_burst_chunk_x = 0;
+  uint32_t s_dut_my_reader_reader_burst_cur_adr = 0;
+  uint32_t n_s_dut_my_reader_reader_burst_cur_adr = 0;
+  uint32_t s_dut_my_reader_reader_burst_left = 0;
+  uint32_t n_s_dut_my_reader_reader_burst_left = 0;
+  uint64_t s_dut_my_reader_reader_burst_left_x = 0;
+  uint32_t s_dut_my_reader_reader_burst_rd_left = 0;
+  uint32_t n_s_dut_my_reader_reader_burst_rd_left = 0;
+  uint32_t s_dut_my_reader_reader_burst_req_len = 0;
+  uint32_t n_s_dut_my_reader_reader_burst_req_len = 0;
+  uint16_t s_dut_my_reader_reader_burst_room = 0;
+  uint64_t s_dut_my_reader_reader_burst_room_x = 0;
+  uint8_t s_dut_my_reader_reader_burst_rwn = 0;
+  uint8_t s_dut_my_reader_reader_burst_st_doing = 0;
+  uint8_t n_s_dut_my_reader_reader_burst_st_doing = 0;
+  uint8_t s_dut_my_reader_reader_burst_st_idle = 0;
+  uint8_t n_s_dut_my_reader_reader_burst_st_idle = 0;
+  uint8_t s_dut_my_reader_reader_burst_st_next = 0;
+  uint8_t n_s_dut_my_reader_reader_burst_st_next = 0;
+  uint8_t s_dut_my_reader_reader_burst_st_pending = 0;
+  uint8_t n_s_dut_my_reader_reader_burst_st_pending = 0;
+  uint8_t s_dut_my_reader_st_read = 0;
+  uint8_t n_s_dut_my_reader_st_read = 0;
+  uint8_t s_dut_my_reader_stop = 0;
+  uint16_t s_dut_my_scan_d = 0;
+  uint16_t n_s_dut_my_scan_d = 0;
+  uint32_t s_dut_my_scan_d_index = 0;
+  uint32_t s_dut_my_scan_d_pos = 0;
+  uint32_t n_s_dut_my_scan_d_pos = 0;
+  uint8_t s_dut_my_scan_d_valid = 0;
+  uint8_t n_s_dut_my_scan_d_valid = 0;
+  uint16_t s_dut_my_scan_flip = 0;
+  uint8_t s_dut_my_scan_hit = 0;
+  uint8_t n_s_dut_my_scan_hit = 0;
+  uint16_t s_dut_my_scan_key_r = 0;
+  uint16_t n_s_dut_my_scan_key_r = 0;
+  uint8_t s_dut_my_scan_less = 0;
+  uint16_t s_dut_my_scan_mask_r = 0;
+  uint16_t n_s_dut_my_scan_mask_r = 0;
+  uint8_t s_dut_my_scan_match = 0;
+  uint8_t s_dut_my_scan_more = 0;
+  uint8_t s_dut_my_scan_op = 0;
+  uint8_t s_dut_my_scan_op_r = 0;
+  uint8_t n_s_dut_my_scan_op_r = 0;
+  uint32_t s_dut_my_scan_pos = 0;
+  uint32_t n_s_dut_my_scan_pos = 0;
+  uint8_t s_dut_my_scan_sgn = 0;
+  uint8_t s_dut_my_scan_sgn_r = 0;
+  uint8_t n_s_dut_my_scan_sgn_r = 0;
+  uint8_t s_dut_my_scan_skip = 0;
+  uint8_t n_s_dut_my_scan_skip = 0;
+  uint8_t s_dut_my_scan_step = 0;
+  uint8_t n_s_dut_my_scan_step = 0;
+  uint8_t s_dut_my_scan_stride = 0;
+  uint16_t s_dut_my_scan_v = 0;
+  uint8_t s_dut_my_scan_valid = 0;
+  uint32_t s_dut_my_scan_vx = 0;
+  uint8_t s_dut_nm_busy = 0;
+  uint8_t s_dut_perf_clr = 0;
+  uint16_t s_dut_perf_ev = 0;
+  uint16_t s_dut_perf_hi = 0;
+  uint16_t n_s_dut_perf_hi = 0;
+  uint32_t s_dut_perf_q = 0;
+  uint32_t s_dut_perf_rd = 0;
+  uint32_t n_s_dut_perf_rd = 0;
+  uint8_t s_dut_perf_sel = 0;
+  uint8_t n_s_dut_perf_sel = 0;
+  uint32_t s_dut_pf_adr = 0;
+  uint32_t n_s_dut_pf_adr = 0;
+  uint8_t s_dut_pf_busy = 0;
+  uint32_t s_dut_pf_count = 0;
+  uint32_t n_s_dut_pf_count = 0;
+  uint8_t s_dut_pf_drop = 0;
+  uint8_t n_s_dut_pf_drop = 0;
+  uint32_t s_dut_pf_next_adr = 0;
+  uint32_t s_dut_pf_sd_adr = 0;
+  uint32_t n_s_dut_pf_sd_adr = 0;
+  uint8_t s_dut_pf_sd_adv = 0;
+  uint8_t n_s_dut_pf_sd_adv = 0;
+  uint16_t s_dut_pf_sd_len = 0;
+  uint16_t n_s_dut_pf_sd_len = 0;
+  uint8_t s_dut_pf_sd_rwn = 0;
+  uint8_t n_s_dut_pf_sd_rwn = 0;
+  uint8_t s_dut_pf_start = 0;
+  uint8_t s_dut_pll_nrst = 0;
+  uint16_t s_dut_prefetch_chunk = 0;
+  uint64_t s_dut_prefetch_chunk_x = 0;
+  uint32_t s_dut_prefetch_cur_adr = 0;
+  uint32_t n_s_dut_prefetch_cur_adr = 0;
+  uint32_t s_dut_prefetch_left = 0;
+  uint32_t n_s_dut_prefetch_left = 0;
+  uint64_t s_dut_prefetch_left_x = 0;
+  uint32_t s_dut_prefetch_len = 0;
+  uint32_t s_dut_prefetch_rd_left = 0;
+  uint32_t n_s_dut_prefetch_rd_left = 0;
+  uint32_t s_dut_prefetch_req_len = 0;
+  uint32_t n_s_dut_prefetch_req_len = 0;
+  uint16_t s_dut_prefetch_room = 0;
+  uint64_t s_dut_prefetch_room_x = 0;
+  uint8_t s_dut_prefetch_rwn = 0;
+  uint8_t s_dut_prefetch_st_doing = 0;
+  uint8_t n_s_dut_prefetch_st_doing = 0;
+  uint8_t s_dut_prefetch_st_idle = 0;
+  uint8_t n_s_dut_prefetch_st_idle = 0;
+  uint8_t s_dut_prefetch_st_next = 0;
+  uint8_t n_s_dut_prefetch_st_next = 0;
+  uint8_t s_dut_prefetch_st_pending = 0;
+  uint8_t n_s_dut_prefetch_st_pending = 0;
+  uint16_t s_dut_pwr_pd_idle = 0;
+  uint16_t n_s_dut_pwr_pd_idle = 0;
+  uint16_t s_dut_pwr_sr_idle = 0;
+  uint16_t n_s_dut_pwr_sr_idle = 0;
+  uint16_t s_dut_pwr_wake_cnt = 0;
+  uint16_t n_s_dut_pwr_wake_cnt = 0;
+  uint16_t s_dut_pwr_wake_last = 0;
+  uint16_t n_s_dut_pwr_wake_last = 0;
+  uint32_t s_dut_range_len = 0;
+  uint32_t n_s_dut_range_len = 0;
+  uint16_t s_dut_rd_data = 0;
+  uint8_t s_dut_rd_done = 0;
+  uint8_t s_dut_rd_go = 0;
+  uint8_t s_dut_rd_result_pending = 0;
+  uint8_t n_s_dut_rd_result_pending = 0;
+  uint8_t s_dut_rdr_busy = 0;
+  uint16_t s_dut_rdr_data = 0;
+  uint8_t s_dut_rdr_go = 0;
+  uint32_t s_dut_rdr_next_adr = 0;
+  uint8_t s_dut_rdr_pending = 0;
+  uint32_t s_dut_rdr_sd_adr = 0;
+  uint32_t n_s_dut_rdr_sd_adr = 0;
+  uint8_t s_dut_rdr_sd_adv = 0;
+  uint8_t n_s_dut_rdr_sd_adv = 0;
+  uint16_t s_dut_rdr_sd_len = 0;
+  uint16_t n_s_dut_rdr_sd_len = 0;
+  uint8_t s_dut_rdr_sd_rwn = 0;
+  uint8_t n_s_dut_rdr_sd_rwn = 0;
+  uint8_t s_dut_rdr_start = 0;
+  uint8_t s_dut_rdr_to_scan = 0;
+  uint8_t n_s_dut_rdr_to_scan = 0;
+  uint8_t s_dut_rdr_valid = 0;
+  uint8_t s_dut_read_busy = 0;
+  uint8_t s_dut_read_data32 = 0;
+  uint8_t s_dut_read_to_win = 0;
+  uint8_t n_s_dut_read_to_win = 0;
+  uint64_t s_dut_req_queue_mem[2] = {};
+  std::vector<std::pair<uint64_t, uint64_t> > nq_s_dut_req_queue_mem;
+  uint64_t s_dut_req_queue_r_data = 0;
+  uint8_t s_dut_req_queue_r_ptr = 0;
+  uint8_t n_s_dut_req_queue_r_ptr = 0;
+  uint64_t s_dut_req_queue_w_data = 0;
+  uint8_t s_dut_req_queue_w_ptr = 0;
+  uint8_t n_s_dut_req_queue_w_ptr = 0;
+  uint32_t s_dut_rq_adr = 0;
+  uint16_t s_dut_rq_data = 0;
+  uint8_t s_dut_rq_empty = 0;
+  uint8_t s_dut_rq_full = 0;
+  uint8_t s_dut_rq_level = 0;
+  uint8_t s_dut_rq_more = 0;
+  uint8_t s_dut_rq_nbl = 0;
+  uint8_t s_dut_rq_pop = 0;
+  uint8_t s_dut_rq_push = 0;
+  uint8_t s_dut_rq_rwn = 0;
+  uint8_t s_dut_scan_busy = 0;
+  uint8_t s_dut_scan_found = 0;
+  uint32_t s_dut_scan_index = 0;
+  uint32_t n_s_dut_scan_index = 0;
+  uint16_t s_dut_scan_key = 0;
+  uint16_t n_s_dut_scan_key = 0;
+  uint16_t s_dut_scan_mask = 0;
+  uint16_t n_s_dut_scan_mask = 0;
+  uint32_t s_dut_scan_result = 0;
+  uint32_t n_s_dut_scan_result = 0;
+  uint8_t s_dut_scan_start = 0;
+  uint32_t s_dut_sdram_U0_bank_i = 0;
+  uint16_t s_dut_sdram_U0_burst_col_i = 0;
+  uint16_t n_s_dut_sdram_U0_burst_col_i = 0;
+  uint8_t s_dut_sdram_U0_clk_count_i = 0;
+  uint8_t n_s_dut_sdram_U0_clk_count_i = 0;
+  uint8_t s_dut_sdram_U0_cmd_fsm_states_i = 0;
+  uint8_t n_s_dut_sdram_U0_cmd_fsm_states_i = 0;
+  uint16_t s_dut_sdram_U0_col_addr_i = 0;
+  uint16_t s_dut_sdram_U0_col_i = 0;
+  uint16_t s_dut_sdram_U0_cpu2sdram_reg_i = 0;
+  uint16_t n_s_dut_sdram_U0_cpu2sdram_reg_i = 0;
+  uint16_t s_dut_sdram_U0_cpu_data_reg_i = 0;
+  uint16_t n_s_dut_sdram_U0_cpu_data_reg_i = 0;
+  uint8_t s_dut_sdram_U0_cpu_den_i = 0;
+  uint8_t n_s_dut_sdram_U0_cpu_den_i = 0;
+  uint32_t s_dut_sdram_U0_i_addr = 0;
+  uint16_t s_dut_sdram_U0_i_data = 0;
+  uint8_t s_dut_sdram_U0_i_dqm = 0;
+  uint32_t s_dut_sdram_U0_i_next_addr = 0;
+  uint16_t s_dut_sdram_U0_i_sdram_dq = 0;
+  uint8_t s_dut_sdram_U0_init_fsm_states_i = 0;
+  uint8_t n_s_dut_sdram_U0_init_fsm_states_i = 0;
+  uint8_t s_dut_sdram_U0_lookahead_act_i = 0;
+  uint8_t s_dut_sdram_U0_lookahead_pre_i = 0;
+  uint8_t s_dut_sdram_U0_lookahead_slot_i = 0;
+  uint8_t s_dut_sdram_U0_next_bank_i = 0;
+  uint16_t s_dut_sdram_U0_next_row_i = 0;
+  uint16_t s_dut_sdram_U0_o_data = 0;
+  uint16_t s_dut_sdram_U0_o_sdram_addr = 0;
+  uint16_t n_s_dut_sdram_U0_o_sdram_addr = 0;
+  uint8_t s_dut_sdram_U0_o_sdram_blkaddr = 0;
+  uint8_t n_s_dut_sdram_U0_o_sdram_blkaddr = 0;
+  uint16_t s_dut_sdram_U0_o_sdram_dq = 0;
+  uint8_t s_dut_sdram_U0_o_sdram_dqm = 0;
+  uint16_t s_dut_sdram_U0_open_row_i[4] = {};
+  std::vector<std::pair<uint64_t, uint64_t> > nq_s_dut_sdram_U0_open_row_i;
+  uint8_t s_dut_sdram_U0_page_hit_i = 0;
+  uint8_t s_dut_sdram_U0_page_miss_i = 0;
+  uint8_t s_dut_sdram_U0_precharge_ok_i = 0;
+  uint16_t s_dut_sdram_U0_ras_count_i = 0;
+  uint16_t n_s_dut_sdram_U0_ras_count_i = 0;
+  uint8_t s_dut_sdram_U0_read_cmd_state_i = 0;
+  uint8_t s_dut_sdram_U0_read_data_req_i = 0;
+  uint8_t n_s_dut_sdram_U0_read_data_req_i = 0;
+  uint8_t s_dut_sdram_U0_read_done_i = 0;
+  uint8_t n_s_dut_sdram_U0_read_done_i = 0;
+  uint8_t s_dut_sdram_U0_read_done_reg_i = 0;
+  uint8_t n_s_dut_sdram_U0_read_done_reg_i = 0;
+  uint8_t s_dut_sdram_U0_read_early_i = 0;
+  uint8_t s_dut_sdram_U0_read_pipe_i = 0;
+  uint8_t n_s_dut_sdram_U0_read_pipe_i = 0;
+  uint8_t s_dut_sdram_U0_read_pipeline_i = 0;
+  uint16_t s_dut_sdram_U0_read_req_cnt_i = 0;
+  uint16_t n_s_dut_sdram_U0_read_req_cnt_i = 0;
+  uint8_t s_dut_sdram_U0_read_req_cnt_rst_i = 0;
+  uint8_t n_s_dut_sdram_U0_read_req_cnt_rst_i = 0;
+  uint8_t s_dut_sdram_U0_req_bank_i = 0;
+  uint16_t s_dut_sdram_U0_req_row_i = 0;
+  uint8_t s_dut_sdram_U0_reset_clk_counter_i = 0;
+  uint8_t s_dut_sdram_U0_row_open_i = 0;
+  uint8_t n_s_dut_sdram_U0_row_open_i = 0;
+  uint8_t s_dut_sdram_U0_sdram_dq_en_i = 0;
+  uint8_t n_s_dut_sdram_U0_sdram_dq_en_i = 0;
+  uint16_t s_dut_sdram_U0_sdram_dq_reg0_i = 0;
+  uint16_t s_dut_sdram_U0_sdram_dq_reg1_i = 0;
+  uint16_t s_dut_sdram_U0_sdram_dq_reg2_i = 0;
+  uint16_t s_dut_sdram_U0_sdram_dq_reg3_i = 0;
+  uint16_t s_dut_sdram_U0_sdram_dq_reg_i = 0;
+  uint16_t n_s_dut_sdram_U0_sdram_dq_reg_i = 0;
+  uint8_t s_dut_sdram_U0_sdram_dqm_i = 0;
+  uint8_t n_s_dut_sdram_U0_sdram_dqm_i = 0;
+  VlWide<276> s_dut_sdram_U0_state_ASCII;
+  uint16_t s_dut_sdram_U0_wr_count_i = 0;
+  uint16_t n_s_dut_sdram_U0_wr_count_i = 0;
+  uint8_t s_dut_sdram_U0_write_cmd_i = 0;
+  uint8_t n_s_dut_sdram_U0_write_cmd_i = 0;
+  uint8_t s_dut_sdram_U0_write_cmd_state_i = 0;
+  uint8_t s_dut_sdram_U0_write_done_i = 0;
+  uint8_t n_s_dut_sdram_U0_write_done_i = 0;
+  uint8_t s_dut_sdram_U0_write_done_reg_i = 0;
+  uint8_t n_s_dut_sdram_U0_write_done_reg_i = 0;
+  uint8_t s_dut_sdram_U0_write_issue_i = 0;
+  uint8_t s_dut_sdram_U1_U1_lfsr_d0_i = 0;
+  uint8_t s_dut_sdram_U1_U1_lfsr_equal = 0;
+  uint8_t s_dut_sdram_U1_U1_lfsr_reg_i = 0;
+  uint8_t n_s_dut_sdram_U1_U1_lfsr_reg_i = 0;
+  uint8_t s_dut_sdram_U1_U5_lfsr_256_equal_i = 0;
+  uint8_t s_dut_sdram_U1_U5_lfsr_d0_i = 0;
+  uint8_t s_dut_sdram_U1_U5_lfsr_reg_i = 0;
+  uint8_t n_s_dut_sdram_U1_U5_lfsr_reg_i = 0;
+  uint8_t s_dut_sdram_U1_lfsr_64_done_i = 0;
+  uint8_t n_s_dut_sdram_U1_lfsr_64_done_i = 0;
+  uint16_t s_dut_sdram_U2_count_i = 0;
+  uint16_t n_s_dut_sdram_U2_count_i = 0;
+  uint8_t s_dut_sdram_U2_count_match_i = 0;
+  uint8_t s_dut_sdram_autoref_ack_i = 0;
+  uint8_t n_s_dut_sdram_autoref_ack_i = 0;
+  uint8_t s_dut_sdram_autorefresh_enable_i = 0;
+  uint8_t n_s_dut_sdram_autorefresh_enable_i = 0;
+  uint16_t s_dut_sdram_cpu_datain_i = 0;
+  uint16_t s_dut_sdram_cpu_dataout_i = 0;
+  uint8_t s_dut_sdram_cpu_den_i = 0;
+  uint8_t s_dut_sdram_delay_done150us_i = 0;
+  uint8_t n_s_dut_sdram_delay_done150us_i = 0;
+  uint8_t s_dut_sdram_i_dqm = 0;
+  uint8_t s_dut_sdram_idle_count_i = 0;
+  uint8_t n_s_dut_sdram_idle_count_i = 0;
+  uint8_t s_dut_sdram_init_done_i = 0;
+  uint8_t n_s_dut_sdram_init_done_i = 0;
+  uint8_t s_dut_sdram_power_down_i = 0;
+  uint8_t s_dut_sdram_power_down_reg1_i = 0;
+  uint8_t n_s_dut_sdram_power_down_reg1_i = 0;
+  uint8_t s_dut_sdram_power_down_reg2_i = 0;
+  uint8_t n_s_dut_sdram_power_down_reg2_i = 0;
+  uint8_t s_dut_sdram_power_down_reg3_i = 0;
+  uint8_t n_s_dut_sdram_power_down_reg3_i = 0;
+  uint32_t s_dut_sdram_power_idle_i = 0;
+  uint32_t n_s_dut_sdram_power_idle_i = 0;
+  uint8_t s_dut_sdram_powerdown_want_i = 0;
+  uint8_t s_dut_sdram_refresh_count_done_i = 0;
+  uint8_t n_s_dut_sdram_refresh_count_done_i = 0;
+  uint8_t s_dut_sdram_refresh_due_i = 0;
+  uint8_t s_dut_sdram_refresh_owed_i = 0;
+  uint8_t n_s_dut_sdram_refresh_owed_i = 0;
+  uint8_t s_dut_sdram_refresh_req_i = 0;
+  uint8_t n_s_dut_sdram_refresh_req_i = 0;
+  uint8_t s_dut_sdram_sdrctl_busyn_i = 0;
+  uint8_t n_s_dut_sdram_sdrctl_busyn_i = 0;
+  uint8_t s_dut_sdram_selfrefresh_i = 0;
+  uint8_t s_dut_sdram_selfrefresh_time_i = 0;
+  uint8_t n_s_dut_sdram_selfrefresh_time_i = 0;
+  uint8_t s_dut_sdram_selfrefresh_want_i = 0;
+  uint8_t s_dut_sdram_sys_clk_i = 0;
+  uint8_t s_dut_sdram_sys_rst_i = 0;
+  uint8_t s_dut_sdram_ack = 0;
+  uint8_t n_s_dut_sdram_ack = 0;
+  uint8_t s_dut_sdram_adv = 0;
+  uint8_t n_s_dut_sdram_adv = 0;
+  uint8_t s_dut_sdram_burststop_req = 0;
+  uint8_t s_dut_sdram_busdir = 0;
+  uint8_t s_dut_sdram_busy = 0;
+  uint8_t s_dut_sdram_casn = 0;
+  uint8_t n_s_dut_sdram_casn = 0;
+  uint8_t s_dut_sdram_cke = 0;
+  uint8_t n_s_dut_sdram_cke = 0;
+  uint8_t s_dut_sdram_csn = 0;
+  uint8_t n_s_dut_sdram_csn = 0;
+  uint8_t s_dut_sdram_data_next = 0;
+  uint16_t s_dut_sdram_data_out = 0;
+  uint8_t s_dut_sdram_data_req = 0;
+  uint8_t s_dut_sdram_data_valid = 0;
+  uint8_t s_dut_sdram_disable_active = 0;
+  uint8_t s_dut_sdram_disable_autorefresh = 0;
+  uint8_t s_dut_sdram_disable_precharge = 0;
+  uint8_t s_dut_sdram_dqm = 0;
+  uint8_t s_dut_sdram_gpio4 = 0;
+  uint8_t s_dut_sdram_gpio5 = 0;
+  uint32_t s_dut_sdram_i_addr = 0;
+  uint32_t n_s_dut_sdram_i_addr = 0;
+  uint8_t s_dut_sdram_i_clk = 0;
+  uint16_t s_dut_sdram_i_dq = 0;
+  uint8_t s_dut_sdram_idle = 0;
+  uint8_t s_dut_sdram_init_done = 0;
+  uint8_t s_dut_sdram_loadmod_req = 0;
+  uint32_t s_dut_sdram_next_addr = 0;
+  uint8_t s_dut_sdram_next_valid = 0;
+  uint16_t s_dut_sdram_o_addr = 0;
+  uint8_t s_dut_sdram_o_blkaddr = 0;
+  uint8_t s_dut_sdram_o_clk = 0;
+  uint16_t s_dut_sdram_o_dq = 0;
+  uint8_t s_dut_sdram_pipe_ready = 0;
+  uint8_t s_dut_sdram_power_state = 0;
+  uint8_t s_dut_sdram_powerdown = 0;
+  uint8_t s_dut_sdram_precharge_req = 0;
+  uint8_t s_dut_sdram_rasn = 0;
+  uint8_t n_s_dut_sdram_rasn = 0;
+  uint8_t s_dut_sdram_read_done = 0;
+  uint8_t s_dut_sdram_ready = 0;
+  uint32_t s_dut_sdram_req_addr = 0;
+  uint8_t s_dut_sdram_req_adv = 0;
+  uint16_t s_dut_sdram_req_data = 0;
+  uint8_t s_dut_sdram_req_dqm = 0;
+  uint16_t s_dut_sdram_req_len = 0;
+  uint8_t s_dut_sdram_req_rwn = 0;
+  uint8_t s_dut_sdram_rst = 0;
+  uint8_t s_dut_sdram_selfrefresh_req = 0;
+  uint8_t s_dut_sdram_wake = 0;
+  uint8_t s_dut_sdram_wanted = 0;
+  uint8_t s_dut_sdram_wen = 0;
+  uint8_t n_s_dut_sdram_wen = 0;
+  uint8_t s_dut_sdram_write_done = 0;
+  uint8_t s_dut_sf_empty = 0;
+  uint8_t s_dut_sf_full = 0;
+  uint16_t s_dut_sf_level = 0;
+  uint8_t s_dut_sf_push = 0;
+  uint16_t s_dut_sf_q = 0;
+  uint16_t n_s_dut_sf_q = 0;
+  uint8_t s_dut_sf_ready = 0;
+  uint8_t n_s_dut_sf_ready = 0;
+  uint8_t s_dut_st_after_startup = 0;
+  uint8_t n_s_dut_st_after_startup = 0;
+  uint8_t s_dut_st_doing_read = 0;
+  uint8_t n_s_dut_st_doing_read = 0;
+  uint8_t s_dut_st_finishing_write = 0;
+  uint8_t n_s_dut_st_finishing_write = 0;
+  uint8_t s_dut_st_lookup = 0;
+  uint8_t n_s_dut_st_lookup = 0;
+  uint8_t s_dut_st_pending_fill = 0;
+  uint8_t n_s_dut_st_pending_fill = 0;
+  uint8_t s_dut_st_pending_read = 0;
+  uint8_t n_s_dut_st_pending_read = 0;
+  uint8_t s_dut_startup_counter = 0;
+  uint8_t n_s_dut_startup_counter = 0;
+  uint32_t s_dut_stream_adr = 0;
+  uint32_t n_s_dut_stream_adr = 0;
+  uint16_t s_dut_stream_fifo_mem_mem[256] = {};
+  std::vector<std::pair<uint64_t, uint64_t> > nq_s_dut_stream_fifo_mem_mem;
+  uint8_t s_dut_stream_fifo_mem_r_adr = 0;
+  uint8_t s_dut_stream_fifo_mem_w_adr = 0;
+  uint8_t s_dut_stream_fifo_mem_we = 0;
+  uint16_t s_dut_stream_fifo_r_ptr = 0;
+  uint16_t n_s_dut_stream_fifo_r_ptr = 0;
+  uint16_t s_dut_stream_fifo_w_ptr = 0;
+  uint16_t n_s_dut_stream_fifo_w_ptr = 0;
+  uint8_t s_dut_stream_pop = 0;
+  uint8_t s_dut_stream_restart = 0;
+  uint8_t s_dut_stream_rwn = 0;
+  uint8_t n_s_dut_stream_rwn = 0;
+  uint32_t s_dut_win_base = 0;
+  uint32_t n_s_dut_win_base = 0;
+  uint8_t s_dut_win_pending = 0;
+  uint8_t n_s_dut_win_pending = 0;
+  uint32_t s_dut_win_rd_adr = 0;
+  uint32_t n_s_dut_win_rd_adr = 0;
+  uint16_t s_dut_win_rdata = 0;
+  uint16_t n_s_dut_win_rdata = 0;
+  uint8_t s_dut_win_read = 0;
+  uint8_t s_dut_win_ready = 0;
+  uint8_t n_s_dut_win_ready = 0;
+  uint32_t s_dut_wq_adr = 0;
+  uint16_t s_dut_wq_data = 0;
+  uint8_t s_dut_wq_empty = 0;
+  uint8_t s_dut_wq_fresh = 0;
+  uint8_t n_s_dut_wq_fresh = 0;
+  uint8_t s_dut_wq_full = 0;
+  uint16_t s_dut_wq_level = 0;
+  uint8_t s_dut_wq_nbl = 0;
+  uint8_t s_dut_wq_pop = 0;
+  uint8_t s_dut_wq_push = 0;
+  uint64_t s_dut_wq_w_entry = 0;
+  uint8_t s_dut_write_queue_clr = 0;
+  uint64_t s_dut_write_queue_mem_mem[256] = {};
+  std::vector<std::pair<uint64_t, uint64_t> > nq_s_dut_write_queue_mem_mem;
+  uint8_t s_dut_write_queue_mem_r_adr = 0;
+  uint8_t s_dut_write_queue_mem_w_adr = 0;
+  uint8_t s_dut_write_queue_mem_we = 0;
+  uint64_t s_dut_write_queue_r_data = 0;
+  uint64_t n_s_dut_write_queue_r_data = 0;
+  uint16_t s_dut_write_queue_r_ptr = 0;
+  uint16_t n_s_dut_write_queue_r_ptr = 0;
+  uint16_t s_dut_write_queue_w_ptr = 0;
+  uint16_t n_s_dut_write_queue_w_ptr = 0;
+  uint8_t fsmc_clk = 0;
+  uint8_t fsmc_nbl = 0;
+  uint8_t init_done = 0;
+  uint16_t mem_a = 0;
+  uint8_t mem_ba = 0;
+  uint8_t mem_cas = 0;
+  uint8_t mem_cke = 0;
+  uint8_t mem_clk = 0;
+  uint8_t mem_cs = 0;
+  uint8_t s_mem_cs2_unused = 0;
+  uint16_t s_mem_d = 0;
+  uint16_t mem_d_in = 0;
+  uint8_t mem_d_oe = 0;
+  uint16_t mem_d_out = 0;
+  uint8_t mem_dqm = 0;
+  uint8_t mem_ras = 0;
+  uint8_t mem_we = 0;
+  uint8_t nwait = 0;
+  uint8_t tp_0 = 0;
+  uint8_t tp_1 = 0;
+  uint8_t tp_2 = 0;
+  uint8_t tp_3 = 0;
+  uint8_t tp_4 = 0;
+  uint8_t tp_5 = 0;
+  uint8_t tp_6 = 0;
+  bool inited_ = false;
+  Vsim_top(const char *name = "TOP");
+  ~Vsim_top() {}
+  void eval();
+  void final() {}
+  void settle_();
+  void commit_();
+  void p0_();
+  void p1_();
+  void p2_();
+  void p3_();
+  void p4_();
+  void p5_();
+  void p6_();
+  void p7_();
+  void p8_();
+  void p9_();
+  void p10_();
+  void p11_();
+  void p12_();
+  void p13_();
+  void p14_();
+  void p15_();
+  void p16_();
+  void p17_();
+  void p18_();
+  void p19_();
+  void p20_();
+  void p21_();
+  void p22_();
+  void p23_();
+  void p24_();
+  void p25_();
+  void p26_();
+  void p27_();
+  void p28_();
+  void p29_();
+  void p30_();
+  void p31_();
+  void p32_();
+  void p33_();
+  void p34_();
+  void p35_();
+  void p36_();
+  void p37_();
+  void p38_();
+  void p39_();
+  void p40_();
+  void p41_();
+  void p42_();
+  void p43_();
+  void p44_();
+  void p45_();
+  void p46_();
+  void p47_();
+  void p48_();
+  void p49_();
+  void p50_();
+  void p51_();
+  void p52_();
+  void p53_();
+  void p54_();
+  void p55_();
+  void p56_();
+  void p57_();
+  void p58_();
+  void p59_();
+  void p60_();
+  void p61_();
+  void p62_();
+  void p63_();
+  void p64_();
+  void p65_();
+  void p66_();
+  void p67_();
+  void p68_();
+  void p69_();
+  void p70_();
+  void p71_();
+  void p72_();
+  void p73_();
+  void p74_();
+  void p75_();
+  void p76_();
+  void p77_();
+  void p78_();
+  void p79_();
+  void p80_();
+  void p81_();
+  void p82_();
+  void p83_();
+  void p84_();
+  void p85_();
+  void p86_();
+  void p87_();
+  void p88_();
+  void p89_();
+  void p90_();
+  void p91_();
+  void p92_();
+  void p93_();
+  void p94_();
+  void p95_();
+  void p96_();
+  void p97_();
+  void p98_();
+  void p99_();
+  void p100_();
+  void p101_();
+  void p102_();
+  void p103_();
+  void p104_();
+  void p105_();
+  void p106_();
+  void p107_();
+  void p108_();
+  void p109_();
+  void p110_();
+  void p111_();
+  void p112_();
+  void p113_();
+  void p114_();
+  void p115_();
+  void p116_();
+  void p117_();
+  void p118_();
+  void p119_();
+  void p120_();
+  void p121_();
+  void p122_();
+  void p123_();
+  void p124_();
+  void p125_();
+  void p126_();
+  void p127_();
+  void p128_();
+  void p129_();
+  void p130_();
+  void p131_();
+  void p132_();
+  void p133_();
+  void p134_();
+  void p135_();
+  void p136_();
+  void p137_();
+  void p138_();
+  void p139_();
+  void p140_();
+  void p141_();
+  void p142_();
+  void p143_();
+  void p144_();
+  void p145_();
+  void p146_();
+  void p147_();
+  void p148_();
+  void p149_();
+  void p150_();
+  void p151_();
+  void p152_();
+  void p153_();
+  void p154_();
+  void p155_();
+  void p156_();
+  void p157_();
+  void p158_();
+  void p159_();
+  void p160_();
+  void p161_();
+  void p162_();
+  void p163_();
+  void p164_();
+  void p165_();
+  void p166_();
+  void p167_();
+  void p168_();
+  void p169_();
+  void p170_();
+  void p171_();
+  void p172_();
+  void p173_();
+  void p174_();
+  void p175_();
+  void p176_();
+  void p177_();
+  void p178_();
+  void p179_();
+  void p180_();
+  void p181_();
+  void p182_();
+  void p183_();
+  void p184_();
+  void p185_();
+  void p186_();
+  void p187_();
+  void p188_();
+  void p189_();
+  void p190_();
+  void p191_();
+  void p192_();
+  void p193_();
+  void p194_();
+  void p195_();
+  void p196_();
+  void p197_();
+  void p198_();
+  void p199_();
+  void p200_();
+  void p201_();
+  void p202_();
+  void p203_();
+  void p204_();
+  void p205_();
+  void p206_();
+  void p207_();
+  void p208_();
+  void p209_();
+  void p210_();
+  void p211_();
+  void p212_();
+  void p213_();
+  void p214_();
+  void p215_();
+  void p216_();
+  void p217_();
+  void p218_();
+  void p219_();
+  void p220_();
+  void p221_();
+  void p222_();
+  void p223_();
+  void p224_();
+  void p225_();
+  void p226_();
+  void p227_();
+  void p228_();
+  void p229_();
+  void p230_();
+  void p231_();
+  void p232_();
+  void p233_();
+  void p234_();
+  void p235_();
+  void p236_();
+  void p237_();
+  void p238_();
+  void p239_();
+  void p240_();
+  void p241_();
+  void p242_();
+  void p243_();
+  void p244_();
+  void p245_();
+  void p246_();
+  void p247_();
+  void p248_();
+  void p249_();
+  void p250_();
+  void p251_();
+  void p252_();
+  void p253_();
+  void p254_();
+  void p255_();
+  void p256_();
+  void p257_();
+  void p258_();
+  void p259_();
+  void p260_();
+  void p261_();
+  void p262_();
+  void p263_();
+  void p264_();
+  void p265_();
+  void p266_();
+  void p267_();
+  void p268_();
+  void p269_();
+  void p270_();
+  void p271_();
+  void p272_();
+  void p273_();
+  void p274_();
+  void p275_();
+  void p276_();
+  void p277_();
+  void p278_();
+  void p279_();
+  void p280_();
+  void p281_();
+  void p282_();
+  void p283_();
+  void p284_();
+  void p285_();
+  void p286_();
+  void p287_();
+  void p288_();
+  void p289_();
+  void p290_();
+  void p291_();
+  void p292_();
+  void p293_();
+  void p294_();
+  void p295_();
+  void p296_();
+  void p297_();
+  void p298_();
+  void p299_();
+  void p300_();
+  void p301_();
+  void p302_();
+  void p303_();
+  void p304_();
+  void p305_();
+  void p306_();
+  void p307_();
+  void p308_();
+  void p309_();
+  void p310_();
+  void p311_();
+  void p312_();
+  void p313_();
+  void p314_();
+  void p315_();
+  void p316_();
+  void p317_();
+  void p318_();
+  void p319_();
+  void p320_();
+  void p321_();
+  void p322_();
+  void p323_();
+  void p324_();
+  void p325_();
+  void p326_();
+  void p327_();
+  void p328_();
+  void p329_();
+  void p330_();
+  void p331_();
+  void p332_();
+  void p333_();
+  void p334_();
+  void p335_();
+  void p336_();
+  void p337_();
+  void p338_();
+  void p339_();
+  void p340_();
+  void p341_();
+  void p342_();
+  void p343_();
+  void p344_();
+  void p345_();
+  void p346_();
+  void p347_();
+  void p348_();
+  void p349_();
+  void p350_();
+  void p351_();
+  void p352_();
+  void p353_();
+  void p354_();
+  void p355_();
+  void p356_();
+  void p357_();
+  void p358_();
+  void p359_();
+  void p360_();
+  void p361_();
+  void p362_();
+  void p363_();
+  void p364_();
+  void p365_();
+  void p366_();
+  void p367_();
+  void p368_();
+  void p369_();
+  void p370_();
+  void p371_();
+  void p372_();
+  void p373_();
+  void p374_();
+  void p375_();
+  void p376_();
+  void p377_();
+  void p378_();
+  void p379_();
+  void p380_();
+  void p381_();
+  void p382_();
+  void p383_();
+  void p384_();
+  void p385_();
+  void p386_();
+  void p387_();
+  void p388_();
+  void p389_();
+  void p390_();
+  void p391_();
+  void p392_();
+  void p393_();
+  void p394_();
+  void p395_();
+  void p396_();
+  void p397_();
+  void p398_();
+  void p399_();
+  void p400_();
+  void p401_();
+  void p402_();
+  void p403_();
+  void p404_();
+  void p405_();
+  void p406_();
+  void p407_();
+  void p408_();
+  void p409_();
+  void p410_();
+  void p411_();
+  void p412_();
+  void p413_();
+  void p414_();
+  void p415_();
+  void p416_();
+  void p417_();
+  void p418_();
+  void p419_();
+  void p420_();
+  void p421_();
+  void p422_();
+  void p423_();
+  void p424_();
+  void p425_();
+  void p426_();
+  void p427_();
+  void p428_();
+  void p429_();
+  void p430_();
+  void p431_();
+  void p432_();
+  void p433_();
+  void p434_();
+  void p435_();
+  void p436_();
+  void p437_();
+  void p438_();
+  void p439_();
+  void p440_();
+  void p441_();
+  void p442_();
+  void p443_();
+  void p444_();
+  void p445_();
+  void p446_();
+  void p447_();
+  void p448_();
+  void p449_();
+  void p450_();
+  void p451_();
+  void p452_();
+  void p453_();
+  void p454_();
+  void p455_();
+  void p456_();
+  void p457_();
+  void p458_();
+  void p459_();
+  void p460_();
+  void p461_();
+  void p462_();
+  void p463_();
+  void p464_();
+  void p465_();
+  void p466_();
+  void p467_();
+  void p468_();
+  void p469_();
+  void p470_();
+  void p471_();
+  void p472_();
+  void p473_();
+  void p474_();
+  void p475_();
+  void p476_();
+  void p477_();
+  void p478_();
+  void p479_();
+  void p480_();
+  void p481_();
+  void p482_();
+  void p483_();
+  void p484_();
+  void p485_();
+  void p486_();
+  void p487_();
+  void p488_();
+  void p489_();
+  void p490_();
+  void p491_();
+  void p492_();
+  void p493_();
+  void p494_();
+  void p495_();
+  void p496_();
+  void p497_();
+  void p498_();
+  void p499_();
+  void p500_();
+  void p501_();
+  void p502_();
+  void p503_();
+  void p504_();
+  void p505_();
+  void p506_();
+  void p507_();
+  void p508_();
+  void p509_();
+  void p510_();
+  void p511_();
+  void p512_();
+  void p513_();
+  void p514_();
+  void p515_();
+  void p516_();
+  void p517_();
+  void p518_();
+  void p519_();
+  void p520_();
+  void p521_();
+  void p522_();
+  void p523_();
+  void p524_();
+  void p525_();
+  void p526_();
+  void p527_();
+  void p528_();
+  void p529_();
+  void p530_();
+  void p531_();
+  void p532_();
+  void p533_();
+  void p534_();
+  void p535_();
+  void p536_();
+  void p537_();
+  void p538_();
+  void q0_();
+  void q1_();
+  void q2_();
+  void q3_();
+  void q4_();
+  void q5_();
+  void q6_();
+  void q7_();
+  void q8_();
+  void q9_();
+  void q10_();
+  void q11_();
+  void q12_();
+  void q13_();
+  void q14_();
+  void q15_();
+  void q16_();
+  void q17_();
+  void q18_();
+  void q19_();
+  void q20_();
+  void q21_();
+  void q22_();
+  void q23_();
+  void q24_();
+  void q25_();
+  void q26_();
+  void q27_();
+  void q28_();
+  void q29_();
+  void q30_();
+  void q31_();
+  void q32_();
+  void q33_();
+  void q34_();
+  void q35_();
+  void q36_();
+  void q37_();
+  void q38_();
+  void q39_();
+  void q40_();
+  void q41_();
+  void q42_();
+  void q43_();
+  void q44_();
+  void q45_();
+  void q46_();
+  void q47_();
+  void q48_();
+  void q49_();
+  void q50_();
+  void q51_();
+  void q52_();
+  void q53_();
+  void q54_();
+  void q55_();
+  void q56_();
+  void q57_();
+  void q58_();
+  void q59_();
+  void q60_();
+  void q61_();
+  void q62_();
+  void q63_();
+  void q64_();
+  void q65_();
+  void q66_();
+  void q67_();
+  void q68_();
+  void q69_();
+  void q70_();
+  void q71_();
+  void q72_();
+  void q73_();
+  void q74_();
+  void q75_();
+  void q76_();
+  void q77_();
+  void q78_();
+  void q79_();
+  void q80_();
+  uint64_t f_dut_pll_divq(uint64_t);
+  uint64_t f_dut_my_bist_lfsr_next(uint64_t);
+  uint64_t f_dut_my_bist_pattern(uint64_t, uint64_t, uint64_t, uint64_t, uint64_t);
+  uint64_t f_dut_my_crc_crc32_16(uint64_t, uint64_t);
+};
+#endif
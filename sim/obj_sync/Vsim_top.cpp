@@ -0,0 +1,5876 @@
+// Generated by the vl2cpp stand-in; do not edit.
+#include "Vsim_top.h"
+
+typedef unsigned __int128 u128;
+template<class T> static inline T vl_m(int w) {
+  return w >= (int)(8 * sizeof(T)) ? ~(T)0 : (((T)1 << w) - 1);
+}
+template<class T> static inline T vl_sext(T v, int w) {
+  if ((v >> (w - 1)) & 1) v |= ~vl_m<T>(w);
+  return v;
+}
+template<class T> static inline T vl_shl(T a, uint64_t n, int W) {
+  return n >= (uint64_t)W ? (T)0 : (T)((a << n) & vl_m<T>(W));
+}
+template<class T> static inline T vl_shr(T a, uint64_t n, int W) {
+  return n >= (uint64_t)W ? (T)0 : (T)(a >> n);
+}
+template<class T> static inline T vl_sar(T a, uint64_t n, int W) {
+  bool neg = (a >> (W - 1)) & 1;
+  if (n >= (uint64_t)W) return neg ? vl_m<T>(W) : (T)0;
+  T r = a >> n;
+  if (neg) r |= vl_m<T>(W) & ~vl_m<T>(W - (int)n);
+  return r;
+}
+template<class T> static inline T vl_divu(T a, T b) { return b ? a / b : 0; }
+template<class T> static inline T vl_modu(T a, T b) { return b ? a % b : 0; }
+static inline int64_t vl_s(uint64_t v, int w) {
+  return (int64_t)vl_sext<uint64_t>(v, w);
+}
+static inline uint64_t vl_divs(uint64_t a, uint64_t b, int w) {
+  int64_t x = vl_s(a, w), y = vl_s(b, w);
+  return y ? (uint64_t)(x / y) & vl_m<uint64_t>(w) : 0;
+}
+static inline uint64_t vl_mods(uint64_t a, uint64_t b, int w) {
+  int64_t x = vl_s(a, w), y = vl_s(b, w);
+  return y ? (uint64_t)(x % y) & vl_m<uint64_t>(w) : 0;
+}
+template<class T> static inline uint64_t vl_par(T v) {
+  return (__builtin_parityll((uint64_t)v) ^
+          __builtin_parityll((uint64_t)((u128)v >> 64))) & 1;
+}
+template<class T> static inline uint64_t vl_bit(T v, int64_t i, int w) {
+  return (i >= 0 && i < w) ? (uint64_t)((v >> i) & 1) : 0;
+}
+template<class T> static inline T vl_bits(T v, int64_t i, int w, int n) {
+  if (i < 0 || i >= w) return 0;
+  return (v >> i) & vl_m<T>(n);
+}
+template<class T> static inline T vl_pow(T a, uint64_t n, int W) {
+  T r = 1;
+  while (n--) r = (r * a) & vl_m<T>(W);
+  return r;
+}
+
+Vsim_top::Vsim_top(const char *) {
+  s_dut_bg_turn = 0x0ULL;
+  n_s_dut_bg_turn = 0x0ULL;
+  s_dut_bist_fail_sel = 0x0ULL;
+  n_s_dut_bist_fail_sel = 0x0ULL;
+  s_dut_bist_len = 0x0ULL;
+  n_s_dut_bist_len = 0x0ULL;
+  s_dut_cache_hits = 0x0ULL;
+  n_s_dut_cache_hits = 0x0ULL;
+  s_dut_cache_misses = 0x0ULL;
+  n_s_dut_cache_misses = 0x0ULL;
+  s_dut_cur_nbl = 0x0ULL;
+  n_s_dut_cur_nbl = 0x0ULL;
+  s_dut_in_refresh = 0x0ULL;
+  n_s_dut_in_refresh = 0x0ULL;
+  s_dut_my_atomic_atomic_burst_rd_left = 0x0ULL;
+  n_s_dut_my_atomic_atomic_burst_rd_left = 0x0ULL;
+  s_dut_my_atomic_atomic_burst_st_doing = 0x0ULL;
+  n_s_dut_my_atomic_atomic_burst_st_doing = 0x0ULL;
+  s_dut_my_atomic_atomic_burst_st_idle = 0x1ULL;
+  n_s_dut_my_atomic_atomic_burst_st_idle = 0x1ULL;
+  s_dut_my_atomic_atomic_burst_st_next = 0x0ULL;
+  n_s_dut_my_atomic_atomic_burst_st_next = 0x0ULL;
+  s_dut_my_atomic_atomic_burst_st_pending = 0x0ULL;
+  n_s_dut_my_atomic_atomic_burst_st_pending = 0x0ULL;
+  s_dut_my_atomic_b_start = 0x0ULL;
+  n_s_dut_my_atomic_b_start = 0x0ULL;
+  s_dut_my_atomic_pend = 0x0ULL;
+  n_s_dut_my_atomic_pend = 0x0ULL;
+  s_dut_my_atomic_st_read = 0x0ULL;
+  n_s_dut_my_atomic_st_read = 0x0ULL;
+  s_dut_my_atomic_st_write = 0x0ULL;
+  n_s_dut_my_atomic_st_write = 0x0ULL;
+  s_dut_my_bist_b_start = 0x0ULL;
+  n_s_dut_my_bist_b_start = 0x0ULL;
+  s_dut_my_bist_bist_burst_rd_left = 0x0ULL;
+  n_s_dut_my_bist_bist_burst_rd_left = 0x0ULL;
+  s_dut_my_bist_bist_burst_st_doing = 0x0ULL;
+  n_s_dut_my_bist_bist_burst_st_doing = 0x0ULL;
+  s_dut_my_bist_bist_burst_st_idle = 0x1ULL;
+  n_s_dut_my_bist_bist_burst_st_idle = 0x1ULL;
+  s_dut_my_bist_bist_burst_st_next = 0x0ULL;
+  n_s_dut_my_bist_bist_burst_st_next = 0x0ULL;
+  s_dut_my_bist_bist_burst_st_pending = 0x0ULL;
+  n_s_dut_my_bist_bist_burst_st_pending = 0x0ULL;
+  s_dut_my_bist_c1_valid = 0x0ULL;
+  n_s_dut_my_bist_c1_valid = 0x0ULL;
+  s_dut_my_bist_st_chunk = 0x0ULL;
+  n_s_dut_my_bist_st_chunk = 0x0ULL;
+  s_dut_my_bist_st_elem = 0x0ULL;
+  n_s_dut_my_bist_st_elem = 0x0ULL;
+  s_dut_my_bist_st_idle = 0x1ULL;
+  n_s_dut_my_bist_st_idle = 0x1ULL;
+  s_dut_my_bist_st_read = 0x0ULL;
+  n_s_dut_my_bist_st_read = 0x0ULL;
+  s_dut_my_bist_st_write = 0x0ULL;
+  n_s_dut_my_bist_st_write = 0x0ULL;
+  s_dut_my_burst_rd_left = 0x0ULL;
+  n_s_dut_my_burst_rd_left = 0x0ULL;
+  s_dut_my_burst_st_doing = 0x0ULL;
+  n_s_dut_my_burst_st_doing = 0x0ULL;
+  s_dut_my_burst_st_idle = 0x1ULL;
+  n_s_dut_my_burst_st_idle = 0x1ULL;
+  s_dut_my_burst_st_next = 0x0ULL;
+  n_s_dut_my_burst_st_next = 0x0ULL;
+  s_dut_my_burst_st_pending = 0x0ULL;
+  n_s_dut_my_burst_st_pending = 0x0ULL;
+  s_dut_my_bus_slave_active = 0x0ULL;
+  n_s_dut_my_bus_slave_active = 0x0ULL;
+  s_dut_my_bus_slave_cmd_fifo_r_bin = 0x0ULL;
+  n_s_dut_my_bus_slave_cmd_fifo_r_bin = 0x0ULL;
+  s_dut_my_bus_slave_cmd_fifo_r_gray = 0x0ULL;
+  n_s_dut_my_bus_slave_cmd_fifo_r_gray = 0x0ULL;
+  s_dut_my_bus_slave_cmd_fifo_w_bin = 0x0ULL;
+  n_s_dut_my_bus_slave_cmd_fifo_w_bin = 0x0ULL;
+  s_dut_my_bus_slave_cmd_fifo_w_gray = 0x0ULL;
+  n_s_dut_my_bus_slave_cmd_fifo_w_gray = 0x0ULL;
+  s_dut_my_bus_slave_f_epoch = 0x0ULL;
+  n_s_dut_my_bus_slave_f_epoch = 0x0ULL;
+  s_dut_my_bus_slave_f_seq = 0x0ULL;
+  n_s_dut_my_bus_slave_f_seq = 0x0ULL;
+  s_dut_my_bus_slave_f_want = 0x0ULL;
+  n_s_dut_my_bus_slave_f_want = 0x0ULL;
+  s_dut_my_bus_slave_outstanding = 0x0ULL;
+  n_s_dut_my_bus_slave_outstanding = 0x0ULL;
+  s_dut_my_bus_slave_rsp_fifo_r_bin = 0x0ULL;
+  n_s_dut_my_bus_slave_rsp_fifo_r_bin = 0x0ULL;
+  s_dut_my_bus_slave_rsp_fifo_r_gray = 0x0ULL;
+  n_s_dut_my_bus_slave_rsp_fifo_r_gray = 0x0ULL;
+  s_dut_my_bus_slave_rsp_fifo_w_bin = 0x0ULL;
+  n_s_dut_my_bus_slave_rsp_fifo_w_bin = 0x0ULL;
+  s_dut_my_bus_slave_rsp_fifo_w_gray = 0x0ULL;
+  n_s_dut_my_bus_slave_rsp_fifo_w_gray = 0x0ULL;
+  s_dut_my_bus_slave_s_epoch = 0x0ULL;
+  n_s_dut_my_bus_slave_s_epoch = 0x0ULL;
+  s_dut_my_bus_slave_s_reading = 0x0ULL;
+  n_s_dut_my_bus_slave_s_reading = 0x0ULL;
+  s_dut_my_bus_slave_stream_q_r_bin = 0x0ULL;
+  n_s_dut_my_bus_slave_stream_q_r_bin = 0x0ULL;
+  s_dut_my_bus_slave_stream_q_r_gray = 0x0ULL;
+  n_s_dut_my_bus_slave_stream_q_r_gray = 0x0ULL;
+  s_dut_my_bus_slave_stream_q_w_bin = 0x0ULL;
+  n_s_dut_my_bus_slave_stream_q_w_bin = 0x0ULL;
+  s_dut_my_bus_slave_stream_q_w_gray = 0x0ULL;
+  n_s_dut_my_bus_slave_stream_q_w_gray = 0x0ULL;
+  s_dut_my_cache_valid = 0x0ULL;
+  n_s_dut_my_cache_valid = 0x0ULL;
+  s_dut_my_copy_b_start = 0x0ULL;
+  n_s_dut_my_copy_b_start = 0x0ULL;
+  s_dut_my_copy_copy_burst_rd_left = 0x0ULL;
+  n_s_dut_my_copy_copy_burst_rd_left = 0x0ULL;
+  s_dut_my_copy_copy_burst_st_doing = 0x0ULL;
+  n_s_dut_my_copy_copy_burst_st_doing = 0x0ULL;
+  s_dut_my_copy_copy_burst_st_idle = 0x1ULL;
+  n_s_dut_my_copy_copy_burst_st_idle = 0x1ULL;
+  s_dut_my_copy_copy_burst_st_next = 0x0ULL;
+  n_s_dut_my_copy_copy_burst_st_next = 0x0ULL;
+  s_dut_my_copy_copy_burst_st_pending = 0x0ULL;
+  n_s_dut_my_copy_copy_burst_st_pending = 0x0ULL;
+  s_dut_my_copy_desc_q_r_ptr = 0x0ULL;
+  n_s_dut_my_copy_desc_q_r_ptr = 0x0ULL;
+  s_dut_my_copy_desc_q_w_ptr = 0x0ULL;
+  n_s_dut_my_copy_desc_q_w_ptr = 0x0ULL;
+  s_dut_my_copy_dq_ready = 0x0ULL;
+  n_s_dut_my_copy_dq_ready = 0x0ULL;
+  s_dut_my_copy_have = 0x0ULL;
+  n_s_dut_my_copy_have = 0x0ULL;
+  s_dut_my_copy_irq_r = 0x0ULL;
+  n_s_dut_my_copy_irq_r = 0x0ULL;
+  s_dut_my_copy_n_done = 0x0ULL;
+  n_s_dut_my_copy_n_done = 0x0ULL;
+  s_dut_my_copy_st_read = 0x0ULL;
+  n_s_dut_my_copy_st_read = 0x0ULL;
+  s_dut_my_copy_st_write = 0x0ULL;
+  n_s_dut_my_copy_st_write = 0x0ULL;
+  s_dut_my_crc_d_valid = 0x0ULL;
+  n_s_dut_my_crc_d_valid = 0x0ULL;
+  s_dut_my_reader_b_start = 0x0ULL;
+  n_s_dut_my_reader_b_start = 0x0ULL;
+  s_dut_my_reader_pend = 0x0ULL;
+  n_s_dut_my_reader_pend = 0x0ULL;
+  s_dut_my_reader_reader_burst_rd_left = 0x0ULL;
+  n_s_dut_my_reader_reader_burst_rd_left = 0x0ULL;
+  s_dut_my_reader_reader_burst_st_doing = 0x0ULL;
+  n_s_dut_my_reader_reader_burst_st_doing = 0x0ULL;
+  s_dut_my_reader_reader_burst_st_idle = 0x1ULL;
+  n_s_dut_my_reader_reader_burst_st_idle = 0x1ULL;
+  s_dut_my_reader_reader_burst_st_next = 0x0ULL;
+  n_s_dut_my_reader_reader_burst_st_next = 0x0ULL;
+  s_dut_my_reader_reader_burst_st_pending = 0x0ULL;
+  n_s_dut_my_reader_reader_burst_st_pending = 0x0ULL;
+  s_dut_my_reader_st_read = 0x0ULL;
+  n_s_dut_my_reader_st_read = 0x0ULL;
+  s_dut_my_scan_d_valid = 0x0ULL;
+  n_s_dut_my_scan_d_valid = 0x0ULL;
+  s_dut_my_scan_hit = 0x0ULL;
+  n_s_dut_my_scan_hit = 0x0ULL;
+  s_dut_my_scan_pos = 0x0ULL;
+  n_s_dut_my_scan_pos = 0x0ULL;
+  s_dut_my_scan_skip = 0x0ULL;
+  n_s_dut_my_scan_skip = 0x0ULL;
+  s_dut_perf_sel = 0x0ULL;
+  n_s_dut_perf_sel = 0x0ULL;
+  s_dut_pf_drop = 0x0ULL;
+  n_s_dut_pf_drop = 0x0ULL;
+  s_dut_prefetch_rd_left = 0x0ULL;
+  n_s_dut_prefetch_rd_left = 0x0ULL;
+  s_dut_prefetch_st_doing = 0x0ULL;
+  n_s_dut_prefetch_st_doing = 0x0ULL;
+  s_dut_prefetch_st_idle = 0x1ULL;
+  n_s_dut_prefetch_st_idle = 0x1ULL;
+  s_dut_prefetch_st_next = 0x0ULL;
+  n_s_dut_prefetch_st_next = 0x0ULL;
+  s_dut_prefetch_st_pending = 0x0ULL;
+  n_s_dut_prefetch_st_pending = 0x0ULL;
+  s_dut_pwr_pd_idle = 0x0ULL;
+  n_s_dut_pwr_pd_idle = 0x0ULL;
+  s_dut_pwr_sr_idle = 0x0ULL;
+  n_s_dut_pwr_sr_idle = 0x0ULL;
+  s_dut_pwr_wake_cnt = 0x0ULL;
+  n_s_dut_pwr_wake_cnt = 0x0ULL;
+  s_dut_pwr_wake_last = 0x0ULL;
+  n_s_dut_pwr_wake_last = 0x0ULL;
+  s_dut_rd_result_pending = 0x0ULL;
+  n_s_dut_rd_result_pending = 0x0ULL;
+  s_dut_rdr_to_scan = 0x0ULL;
+  n_s_dut_rdr_to_scan = 0x0ULL;
+  s_dut_read_to_win = 0x0ULL;
+  n_s_dut_read_to_win = 0x0ULL;
+  s_dut_req_queue_r_ptr = 0x0ULL;
+  n_s_dut_req_queue_r_ptr = 0x0ULL;
+  s_dut_req_queue_w_ptr = 0x0ULL;
+  n_s_dut_req_queue_w_ptr = 0x0ULL;
+  s_dut_scan_mask = 0xffffULL;
+  n_s_dut_scan_mask = 0xffffULL;
+  s_dut_sdram_adv = 0x0ULL;
+  n_s_dut_sdram_adv = 0x0ULL;
+  s_dut_sf_ready = 0x0ULL;
+  n_s_dut_sf_ready = 0x0ULL;
+  s_dut_st_after_startup = 0x0ULL;
+  n_s_dut_st_after_startup = 0x0ULL;
+  s_dut_st_finishing_write = 0x0ULL;
+  n_s_dut_st_finishing_write = 0x0ULL;
+  s_dut_st_lookup = 0x0ULL;
+  n_s_dut_st_lookup = 0x0ULL;
+  s_dut_st_pending_fill = 0x0ULL;
+  n_s_dut_st_pending_fill = 0x0ULL;
+  s_dut_startup_counter = 0x0ULL;
+  n_s_dut_startup_counter = 0x0ULL;
+  s_dut_stream_fifo_r_ptr = 0x0ULL;
+  n_s_dut_stream_fifo_r_ptr = 0x0ULL;
+  s_dut_stream_fifo_w_ptr = 0x0ULL;
+  n_s_dut_stream_fifo_w_ptr = 0x0ULL;
+  s_dut_stream_rwn = 0x0ULL;
+  n_s_dut_stream_rwn = 0x0ULL;
+  s_dut_win_pending = 0x0ULL;
+  n_s_dut_win_pending = 0x0ULL;
+  s_dut_win_ready = 0x0ULL;
+  n_s_dut_win_ready = 0x0ULL;
+  s_dut_wq_fresh = 0x0ULL;
+  n_s_dut_wq_fresh = 0x0ULL;
+  s_dut_write_queue_r_ptr = 0x0ULL;
+  n_s_dut_write_queue_r_ptr = 0x0ULL;
+  s_dut_write_queue_w_ptr = 0x0ULL;
+  n_s_dut_write_queue_w_ptr = 0x0ULL;
+}
+uint64_t Vsim_top::f_dut_pll_divq(uint64_t l_khz) {
+  uint64_t l_pll_divq = 0;
+  uint64_t l_q = 0;
+  l_pll_divq = 0x6ULL;
+  l_q = 0x6ULL;
+  for (int t90 = 0; (uint64_t)(vl_s(l_q, 32) >= vl_s(0x1ULL, 32)) != 0; ++t90) {
+    if (t90 > 1000000) vl_fatal("loop");
+    if ((uint64_t)(vl_s(vl_shl<uint64_t>(l_khz, l_q, 32), 32) >= vl_s(0x82208ULL, 32)) != 0) {
+      l_pll_divq = l_q;
+    }
+    l_q = ((uint64_t)(l_q - 0x1ULL) & 0xffffffffULL);
+  }
+  return l_pll_divq;
+}
+uint64_t Vsim_top::f_dut_my_bist_lfsr_next(uint64_t l_s) {
+  uint64_t l_lfsr_next = 0;
+  uint64_t l_k = 0;
+  l_lfsr_next = l_s;
+  l_k = 0x0ULL;
+  for (int t91 = 0; (uint64_t)(vl_s(l_k, 32) < vl_s(0x10ULL, 32)) != 0; ++t91) {
+    if (t91 > 1000000) vl_fatal("loop");
+    l_lfsr_next = (((uint64_t)((l_lfsr_next >> 0) & 1) != 0) ? (vl_shr<uint64_t>(l_lfsr_next, 0x1ULL, 32) ^ 0x80200003ULL) : vl_shr<uint64_t>(l_lfsr_next, 0x1ULL, 32));
+    l_k = ((uint64_t)(l_k + 0x1ULL) & 0xffffffffULL);
+  }
+  return l_lfsr_next;
+}
+uint64_t Vsim_top::f_dut_my_bist_pattern(uint64_t l_p, uint64_t l_sd, uint64_t l_a, uint64_t l_l, uint64_t l_inv) {
+  uint64_t l_pattern = 0;
+  uint64_t l_sh = 0;
+  l_sh = ((uint64_t)(((uint64_t)((l_a >> 0) & 0xfULL)) + ((uint64_t)((l_sd >> 0) & 0xfULL))) & 0xfULL);
+  { uint64_t t92 = l_p;
+    if (t92 == 0x0ULL) {
+      l_pattern = ((((uint64_t)((l_a >> 0) & 0xffffULL)) ^ (((uint64_t)((uint64_t)((l_a >> 16) & 0xffULL)) << 8) | (uint64_t)0x0ULL)) ^ (((uint64_t)l_sd << 8) | (uint64_t)l_sd));
+    } else if (t92 == 0x1ULL) {
+      l_pattern = ((uint64_t)((l_l >> 0) & 0xffffULL));
+    } else if (t92 == 0x2ULL) {
+      l_pattern = (vl_shl<uint64_t>(0x1ULL, l_sh, 16) ^ (((uint64_t)((l_sd >> 4) & 1)) ? 0xffffULL : (uint64_t)0));
+    } else {
+      l_pattern = ((((uint64_t)l_sd << 8) | (uint64_t)l_sd) ^ ((l_inv) ? 0xffffULL : (uint64_t)0));
+    }
+  }
+  return l_pattern;
+}
+uint64_t Vsim_top::f_dut_my_crc_crc32_16(uint64_t l_c, uint64_t l_d) {
+  uint64_t l_crc32_16 = 0;
+  uint64_t l_k = 0;
+  l_crc32_16 = l_c;
+  l_k = 0x0ULL;
+  for (int t93 = 0; (uint64_t)(vl_s(l_k, 32) < vl_s(0x10ULL, 32)) != 0; ++t93) {
+    if (t93 > 1000000) vl_fatal("loop");
+    l_crc32_16 = ((((uint64_t)((l_crc32_16 >> 0) & 1) ^ vl_bit(l_d, (int64_t)(l_k) - 0, 16)) != 0) ? (vl_shr<uint64_t>(l_crc32_16, 0x1ULL, 32) ^ 0xedb88320ULL) : vl_shr<uint64_t>(l_crc32_16, 0x1ULL, 32));
+    l_k = ((uint64_t)(l_k + 0x1ULL) & 0xffffffffULL);
+  }
+  return l_crc32_16;
+}
+// ice40_cells.v:15
+void Vsim_top::p0_() {
+  s_dut_clk = ((uint64_t)(crystal_clk));
+}
+// ice40_cells.v:16
+void Vsim_top::p1_() {
+  s_dut_my_pll_dummy_out = ((uint64_t)(crystal_clk));
+}
+// ice40_cells.v:17
+void Vsim_top::p2_() {
+  s_dut_my_pll_lock1 = ((uint64_t)(s_dut_pll_nrst));
+}
+// ../ice40/sdram-stm32.v:81
+void Vsim_top::p3_() {
+  s_dut_my_pll_bypass = 0x0ULL;
+}
+// ice40_cells.v:25
+void Vsim_top::p4_() {
+  s_dut_io_Dn_0__D_IN_0 = ((uint64_t)(s_dut_io_Dn_0__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p5_() {
+  s_dut_io_Dn_0__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 0) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p6_() {
+  s_dut_io_Dn_0__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 0) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p7_() {
+  s_dut_io_Dn_0__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 0) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p8_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_0__D_IN_0))) & 0x1ULL) << 0));
+}
+// ice40_cells.v:25
+void Vsim_top::p9_() {
+  s_dut_io_Dn_1__D_IN_0 = ((uint64_t)(s_dut_io_Dn_1__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p10_() {
+  s_dut_io_Dn_1__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 1) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p11_() {
+  s_dut_io_Dn_1__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 1) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p12_() {
+  s_dut_io_Dn_1__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 1) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p13_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 1)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_1__D_IN_0))) & 0x1ULL) << 1));
+}
+// ice40_cells.v:25
+void Vsim_top::p14_() {
+  s_dut_io_Dn_2__D_IN_0 = ((uint64_t)(s_dut_io_Dn_2__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p15_() {
+  s_dut_io_Dn_2__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 2) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p16_() {
+  s_dut_io_Dn_2__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 2) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p17_() {
+  s_dut_io_Dn_2__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 2) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p18_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 2)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_2__D_IN_0))) & 0x1ULL) << 2));
+}
+// ice40_cells.v:25
+void Vsim_top::p19_() {
+  s_dut_io_Dn_3__D_IN_0 = ((uint64_t)(s_dut_io_Dn_3__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p20_() {
+  s_dut_io_Dn_3__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 3) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p21_() {
+  s_dut_io_Dn_3__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 3) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p22_() {
+  s_dut_io_Dn_3__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 3) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p23_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 3)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_3__D_IN_0))) & 0x1ULL) << 3));
+}
+// ice40_cells.v:25
+void Vsim_top::p24_() {
+  s_dut_io_Dn_4__D_IN_0 = ((uint64_t)(s_dut_io_Dn_4__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p25_() {
+  s_dut_io_Dn_4__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 4) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p26_() {
+  s_dut_io_Dn_4__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 4) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p27_() {
+  s_dut_io_Dn_4__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 4) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p28_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 4)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_4__D_IN_0))) & 0x1ULL) << 4));
+}
+// ice40_cells.v:25
+void Vsim_top::p29_() {
+  s_dut_io_Dn_5__D_IN_0 = ((uint64_t)(s_dut_io_Dn_5__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p30_() {
+  s_dut_io_Dn_5__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 5) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p31_() {
+  s_dut_io_Dn_5__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 5) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p32_() {
+  s_dut_io_Dn_5__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 5) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p33_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 5)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_5__D_IN_0))) & 0x1ULL) << 5));
+}
+// ice40_cells.v:25
+void Vsim_top::p34_() {
+  s_dut_io_Dn_6__D_IN_0 = ((uint64_t)(s_dut_io_Dn_6__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p35_() {
+  s_dut_io_Dn_6__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 6) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p36_() {
+  s_dut_io_Dn_6__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 6) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p37_() {
+  s_dut_io_Dn_6__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 6) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p38_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 6)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_6__D_IN_0))) & 0x1ULL) << 6));
+}
+// ice40_cells.v:25
+void Vsim_top::p39_() {
+  s_dut_io_Dn_7__D_IN_0 = ((uint64_t)(s_dut_io_Dn_7__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p40_() {
+  s_dut_io_Dn_7__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 7) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p41_() {
+  s_dut_io_Dn_7__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 7) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p42_() {
+  s_dut_io_Dn_7__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 7) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p43_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 7)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_7__D_IN_0))) & 0x1ULL) << 7));
+}
+// ice40_cells.v:25
+void Vsim_top::p44_() {
+  s_dut_io_Dn_8__D_IN_0 = ((uint64_t)(s_dut_io_Dn_8__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p45_() {
+  s_dut_io_Dn_8__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 8) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p46_() {
+  s_dut_io_Dn_8__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 8) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p47_() {
+  s_dut_io_Dn_8__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 8) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p48_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 8)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_8__D_IN_0))) & 0x1ULL) << 8));
+}
+// ice40_cells.v:25
+void Vsim_top::p49_() {
+  s_dut_io_Dn_9__D_IN_0 = ((uint64_t)(s_dut_io_Dn_9__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p50_() {
+  s_dut_io_Dn_9__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 9) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p51_() {
+  s_dut_io_Dn_9__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 9) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p52_() {
+  s_dut_io_Dn_9__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 9) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p53_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 9)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_9__D_IN_0))) & 0x1ULL) << 9));
+}
+// ice40_cells.v:25
+void Vsim_top::p54_() {
+  s_dut_io_Dn_10__D_IN_0 = ((uint64_t)(s_dut_io_Dn_10__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p55_() {
+  s_dut_io_Dn_10__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 10) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p56_() {
+  s_dut_io_Dn_10__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 10) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p57_() {
+  s_dut_io_Dn_10__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 10) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p58_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 10)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_10__D_IN_0))) & 0x1ULL) << 10));
+}
+// ice40_cells.v:25
+void Vsim_top::p59_() {
+  s_dut_io_Dn_11__D_IN_0 = ((uint64_t)(s_dut_io_Dn_11__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p60_() {
+  s_dut_io_Dn_11__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 11) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p61_() {
+  s_dut_io_Dn_11__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 11) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p62_() {
+  s_dut_io_Dn_11__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 11) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p63_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 11)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_11__D_IN_0))) & 0x1ULL) << 11));
+}
+// ice40_cells.v:25
+void Vsim_top::p64_() {
+  s_dut_io_Dn_12__D_IN_0 = ((uint64_t)(s_dut_io_Dn_12__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p65_() {
+  s_dut_io_Dn_12__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 12) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p66_() {
+  s_dut_io_Dn_12__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 12) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p67_() {
+  s_dut_io_Dn_12__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 12) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p68_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 12)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_12__D_IN_0))) & 0x1ULL) << 12));
+}
+// ice40_cells.v:25
+void Vsim_top::p69_() {
+  s_dut_io_Dn_13__D_IN_0 = ((uint64_t)(s_dut_io_Dn_13__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p70_() {
+  s_dut_io_Dn_13__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 13) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p71_() {
+  s_dut_io_Dn_13__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 13) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p72_() {
+  s_dut_io_Dn_13__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 13) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p73_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 13)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_13__D_IN_0))) & 0x1ULL) << 13));
+}
+// ice40_cells.v:25
+void Vsim_top::p74_() {
+  s_dut_io_Dn_14__D_IN_0 = ((uint64_t)(s_dut_io_Dn_14__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p75_() {
+  s_dut_io_Dn_14__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 14) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p76_() {
+  s_dut_io_Dn_14__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 14) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p77_() {
+  s_dut_io_Dn_14__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 14) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p78_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 14)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_14__D_IN_0))) & 0x1ULL) << 14));
+}
+// ice40_cells.v:25
+void Vsim_top::p79_() {
+  s_dut_io_Dn_15__D_IN_0 = ((uint64_t)(s_dut_io_Dn_15__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p80_() {
+  s_dut_io_Dn_15__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_aD)) >> 15) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p81_() {
+  s_dut_io_Dn_15__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_fsmc_io_d_output))) ? 0xffffULL : (uint64_t)0) >> 15) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p82_() {
+  s_dut_io_Dn_15__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_aDn_output)) >> 15) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:158
+void Vsim_top::p83_() {
+  s_dut_aDn_input = (uint16_t)((((uint64_t)(s_dut_aDn_input)) & ~(0x1ULL << 15)) | (((uint64_t)(((uint64_t)(s_dut_io_Dn_15__D_IN_0))) & 0x1ULL) << 15));
+}
+// ice40_cells.v:25
+void Vsim_top::p84_() {
+  s_dut_io_mem_d_0__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_0__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p85_() {
+  s_dut_io_mem_d_0__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 0) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p86_() {
+  s_dut_io_mem_d_0__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 0) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p87_() {
+  s_dut_io_mem_d_0__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 0) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p88_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_0__D_IN_0))) & 0x1ULL) << 0));
+}
+// ice40_cells.v:25
+void Vsim_top::p89_() {
+  s_dut_io_mem_d_1__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_1__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p90_() {
+  s_dut_io_mem_d_1__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 1) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p91_() {
+  s_dut_io_mem_d_1__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 1) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p92_() {
+  s_dut_io_mem_d_1__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 1) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p93_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 1)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_1__D_IN_0))) & 0x1ULL) << 1));
+}
+// ice40_cells.v:25
+void Vsim_top::p94_() {
+  s_dut_io_mem_d_2__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_2__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p95_() {
+  s_dut_io_mem_d_2__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 2) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p96_() {
+  s_dut_io_mem_d_2__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 2) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p97_() {
+  s_dut_io_mem_d_2__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 2) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p98_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 2)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_2__D_IN_0))) & 0x1ULL) << 2));
+}
+// ice40_cells.v:25
+void Vsim_top::p99_() {
+  s_dut_io_mem_d_3__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_3__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p100_() {
+  s_dut_io_mem_d_3__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 3) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p101_() {
+  s_dut_io_mem_d_3__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 3) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p102_() {
+  s_dut_io_mem_d_3__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 3) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p103_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 3)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_3__D_IN_0))) & 0x1ULL) << 3));
+}
+// ice40_cells.v:25
+void Vsim_top::p104_() {
+  s_dut_io_mem_d_4__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_4__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p105_() {
+  s_dut_io_mem_d_4__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 4) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p106_() {
+  s_dut_io_mem_d_4__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 4) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p107_() {
+  s_dut_io_mem_d_4__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 4) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p108_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 4)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_4__D_IN_0))) & 0x1ULL) << 4));
+}
+// ice40_cells.v:25
+void Vsim_top::p109_() {
+  s_dut_io_mem_d_5__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_5__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p110_() {
+  s_dut_io_mem_d_5__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 5) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p111_() {
+  s_dut_io_mem_d_5__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 5) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p112_() {
+  s_dut_io_mem_d_5__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 5) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p113_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 5)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_5__D_IN_0))) & 0x1ULL) << 5));
+}
+// ice40_cells.v:25
+void Vsim_top::p114_() {
+  s_dut_io_mem_d_6__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_6__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p115_() {
+  s_dut_io_mem_d_6__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 6) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p116_() {
+  s_dut_io_mem_d_6__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 6) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p117_() {
+  s_dut_io_mem_d_6__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 6) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p118_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 6)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_6__D_IN_0))) & 0x1ULL) << 6));
+}
+// ice40_cells.v:25
+void Vsim_top::p119_() {
+  s_dut_io_mem_d_7__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_7__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p120_() {
+  s_dut_io_mem_d_7__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 7) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p121_() {
+  s_dut_io_mem_d_7__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 7) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p122_() {
+  s_dut_io_mem_d_7__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 7) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p123_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 7)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_7__D_IN_0))) & 0x1ULL) << 7));
+}
+// ice40_cells.v:25
+void Vsim_top::p124_() {
+  s_dut_io_mem_d_8__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_8__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p125_() {
+  s_dut_io_mem_d_8__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 8) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p126_() {
+  s_dut_io_mem_d_8__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 8) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p127_() {
+  s_dut_io_mem_d_8__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 8) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p128_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 8)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_8__D_IN_0))) & 0x1ULL) << 8));
+}
+// ice40_cells.v:25
+void Vsim_top::p129_() {
+  s_dut_io_mem_d_9__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_9__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p130_() {
+  s_dut_io_mem_d_9__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 9) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p131_() {
+  s_dut_io_mem_d_9__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 9) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p132_() {
+  s_dut_io_mem_d_9__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 9) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p133_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 9)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_9__D_IN_0))) & 0x1ULL) << 9));
+}
+// ice40_cells.v:25
+void Vsim_top::p134_() {
+  s_dut_io_mem_d_10__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_10__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p135_() {
+  s_dut_io_mem_d_10__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 10) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p136_() {
+  s_dut_io_mem_d_10__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 10) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p137_() {
+  s_dut_io_mem_d_10__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 10) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p138_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 10)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_10__D_IN_0))) & 0x1ULL) << 10));
+}
+// ice40_cells.v:25
+void Vsim_top::p139_() {
+  s_dut_io_mem_d_11__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_11__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p140_() {
+  s_dut_io_mem_d_11__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 11) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p141_() {
+  s_dut_io_mem_d_11__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 11) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p142_() {
+  s_dut_io_mem_d_11__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 11) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p143_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 11)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_11__D_IN_0))) & 0x1ULL) << 11));
+}
+// ice40_cells.v:25
+void Vsim_top::p144_() {
+  s_dut_io_mem_d_12__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_12__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p145_() {
+  s_dut_io_mem_d_12__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 12) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p146_() {
+  s_dut_io_mem_d_12__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 12) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p147_() {
+  s_dut_io_mem_d_12__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 12) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p148_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 12)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_12__D_IN_0))) & 0x1ULL) << 12));
+}
+// ice40_cells.v:25
+void Vsim_top::p149_() {
+  s_dut_io_mem_d_13__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_13__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p150_() {
+  s_dut_io_mem_d_13__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 13) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p151_() {
+  s_dut_io_mem_d_13__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 13) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p152_() {
+  s_dut_io_mem_d_13__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 13) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p153_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 13)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_13__D_IN_0))) & 0x1ULL) << 13));
+}
+// ice40_cells.v:25
+void Vsim_top::p154_() {
+  s_dut_io_mem_d_14__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_14__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p155_() {
+  s_dut_io_mem_d_14__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 14) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p156_() {
+  s_dut_io_mem_d_14__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 14) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p157_() {
+  s_dut_io_mem_d_14__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 14) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p158_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 14)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_14__D_IN_0))) & 0x1ULL) << 14));
+}
+// ice40_cells.v:25
+void Vsim_top::p159_() {
+  s_dut_io_mem_d_15__D_IN_0 = ((uint64_t)(s_dut_io_mem_d_15__PACKAGE_PIN));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p160_() {
+  s_dut_io_mem_d_15__PACKAGE_PIN = ((uint64_t)((((uint64_t)(s_mem_d)) >> 15) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p161_() {
+  s_dut_io_mem_d_15__OUTPUT_ENABLE = ((uint64_t)((((((uint64_t)(s_dut_sdram_busdir))) ? 0xffffULL : (uint64_t)0) >> 15) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p162_() {
+  s_dut_io_mem_d_15__D_OUT_0 = ((uint64_t)((((uint64_t)(s_dut_sdram_o_dq)) >> 15) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:168
+void Vsim_top::p163_() {
+  s_dut_sdram_i_dq = (uint16_t)((((uint64_t)(s_dut_sdram_i_dq)) & ~(0x1ULL << 15)) | (((uint64_t)(((uint64_t)(s_dut_io_mem_d_15__D_IN_0))) & 0x1ULL) << 15));
+}
+// ice40_cells.v:32
+void Vsim_top::p164_() {
+  s_dut_fsmc_clk = ((uint64_t)(fsmc_clk));
+}
+// ../ice40/async_fifo.v:27
+void Vsim_top::p165_() {
+  s_dut_my_bus_slave_cmd_fifo_w_bin_next = ((uint64_t)(((uint64_t)(s_dut_my_bus_slave_cmd_fifo_w_bin)) + (((uint64_t)((0x0ULL) ? 0xfULL : (uint64_t)0) << 1) | (uint64_t)(((uint64_t)(s_dut_my_bus_slave_c_push)) & (~((uint64_t)(s_dut_my_bus_slave_c_full)) & 0x1ULL)))) & 0x1fULL);
+}
+// ../ice40/async_fifo.v:28
+void Vsim_top::p166_() {
+  s_dut_my_bus_slave_cmd_fifo_w_gray_next = (vl_shr<uint64_t>(((uint64_t)(s_dut_my_bus_slave_cmd_fifo_w_bin_next)), 0x1ULL, 5) ^ ((uint64_t)(s_dut_my_bus_slave_cmd_fifo_w_bin_next)));
+}
+// ../ice40/async_fifo.v:29
+void Vsim_top::p167_() {
+  s_dut_my_bus_slave_cmd_fifo_r_bin_next = ((uint64_t)(((uint64_t)(s_dut_my_bus_slave_cmd_fifo_r_bin)) + (((uint64_t)((0x0ULL) ? 0xfULL : (uint64_t)0) << 1) | (uint64_t)(((uint64_t)(s_dut_my_bus_slave_c_pop)) & (~((uint64_t)(s_dut_my_bus_slave_c_empty)) & 0x1ULL)))) & 0x1fULL);
+}
+// ../ice40/async_fifo.v:30
+void Vsim_top::p168_() {
+  s_dut_my_bus_slave_cmd_fifo_r_gray_next = (vl_shr<uint64_t>(((uint64_t)(s_dut_my_bus_slave_cmd_fifo_r_bin_next)), 0x1ULL, 5) ^ ((uint64_t)(s_dut_my_bus_slave_cmd_fifo_r_bin_next)));
+}
+// ../ice40/async_fifo.v:34
+void Vsim_top::p169_() {
+  s_dut_my_bus_slave_c_full = (uint64_t)(((uint64_t)(s_dut_my_bus_slave_cmd_fifo_w_gray)) == (((uint64_t)(~((uint64_t)((((uint64_t)(s_dut_my_bus_slave_cmd_fifo_s_r_gray)) >> 3) & 0x3ULL)) & 0x3ULL) << 3) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_my_bus_slave_cmd_fifo_s_r_gray)) >> 0) & 0x7ULL))));
+}
+// ../ice40/async_fifo.v:35
+void Vsim_top::p170_() {
+  s_dut_my_bus_slave_c_empty = (uint64_t)(((uint64_t)(s_dut_my_bus_slave_cmd_fifo_r_gray)) == ((uint64_t)(s_dut_my_bus_slave_cmd_fifo_s_w_gray)));
+}
+// ../ice40/sync_bus_slave.v:83
+void Vsim_top::p171_() {
+  s_dut_my_bus_slave_cmd_fifo_w_data = (((uint64_t)((uint64_t)(s_dut_my_bus_slave_f_write)) << 30) | ((uint64_t)((uint64_t)(s_dut_my_bus_slave_rd_taken)) << 29) | ((uint64_t)((uint64_t)(s_dut_my_bus_slave_next_seq)) << 26) | ((uint64_t)((uint64_t)(s_dut_my_bus_slave_f_adr)) << 18) | (uint64_t)((uint64_t)(s_dut_my_bus_slave_aDn)));
+}
+// ../ice40/sync_bus_slave.v:83
+void Vsim_top::p172_() {
+  { uint64_t t2 = ((uint64_t)(s_dut_my_bus_slave_cmd_fifo_r_data));
+    s_dut_my_bus_slave_c_data = ((uint64_t)((t2 >> 0) & 0x3ffffULL));
+    s_dut_my_bus_slave_c_adr = ((uint64_t)((t2 >> 18) & 0xffULL));
+    s_dut_my_bus_slave_c_seq = ((uint64_t)((t2 >> 26) & 0x7ULL));
+    s_dut_my_bus_slave_c_taken = ((uint64_t)((t2 >> 29) & 0x1ULL));
+    s_dut_my_bus_slave_c_wr = ((uint64_t)((t2 >> 30) & 0x1ULL));
+  }
+}
+// ../ice40/async_fifo.v:27
+void Vsim_top::p173_() {
+  s_dut_my_bus_slave_rsp_fifo_w_bin_next = ((uint64_t)(((uint64_t)(s_dut_my_bus_slave_rsp_fifo_w_bin)) + (((uint64_t)((0x0ULL) ? 0x3ULL : (uint64_t)0) << 1) | (uint64_t)(((uint64_t)(s_dut_my_bus_slave_s_done)) & (~((uint64_t)(s_dut_my_bus_slave_rsp_full)) & 0x1ULL)))) & 0x7ULL);
+}
+// ../ice40/async_fifo.v:28
+void Vsim_top::p174_() {
+  s_dut_my_bus_slave_rsp_fifo_w_gray_next = (vl_shr<uint64_t>(((uint64_t)(s_dut_my_bus_slave_rsp_fifo_w_bin_next)), 0x1ULL, 3) ^ ((uint64_t)(s_dut_my_bus_slave_rsp_fifo_w_bin_next)));
+}
+// ../ice40/async_fifo.v:29
+void Vsim_top::p175_() {
+  s_dut_my_bus_slave_rsp_fifo_r_bin_next = ((uint64_t)(((uint64_t)(s_dut_my_bus_slave_rsp_fifo_r_bin)) + (((uint64_t)((0x0ULL) ? 0x3ULL : (uint64_t)0) << 1) | (uint64_t)(((uint64_t)(s_dut_my_bus_slave_rsp_pop)) & (~((uint64_t)(s_dut_my_bus_slave_rsp_empty)) & 0x1ULL)))) & 0x7ULL);
+}
+// ../ice40/async_fifo.v:30
+void Vsim_top::p176_() {
+  s_dut_my_bus_slave_rsp_fifo_r_gray_next = (vl_shr<uint64_t>(((uint64_t)(s_dut_my_bus_slave_rsp_fifo_r_bin_next)), 0x1ULL, 3) ^ ((uint64_t)(s_dut_my_bus_slave_rsp_fifo_r_bin_next)));
+}
+// ../ice40/async_fifo.v:34
+void Vsim_top::p177_() {
+  s_dut_my_bus_slave_rsp_full = (uint64_t)(((uint64_t)(s_dut_my_bus_slave_rsp_fifo_w_gray)) == (((uint64_t)(~((uint64_t)((((uint64_t)(s_dut_my_bus_slave_rsp_fifo_s_r_gray)) >> 1) & 0x3ULL)) & 0x3ULL) << 1) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_my_bus_slave_rsp_fifo_s_r_gray)) >> 0) & 0x1ULL))));
+}
+// ../ice40/async_fifo.v:35
+void Vsim_top::p178_() {
+  s_dut_my_bus_slave_rsp_empty = (uint64_t)(((uint64_t)(s_dut_my_bus_slave_rsp_fifo_r_gray)) == ((uint64_t)(s_dut_my_bus_slave_rsp_fifo_s_w_gray)));
+}
+// ../ice40/sync_bus_slave.v:86
+void Vsim_top::p179_() {
+  s_dut_my_bus_slave_rsp_fifo_w_data = (((uint64_t)((uint64_t)(s_dut_my_bus_slave_s_seq)) << 18) | (uint64_t)((uint64_t)(s_dut_my_bus_slave_read_data)));
+}
+// ../ice40/sync_bus_slave.v:86
+void Vsim_top::p180_() {
+  { uint64_t t4 = ((uint64_t)(s_dut_my_bus_slave_rsp_fifo_r_data));
+    s_dut_my_bus_slave_rsp_data = ((uint64_t)((t4 >> 0) & 0x3ffffULL));
+    s_dut_my_bus_slave_rsp_seq = ((uint64_t)((t4 >> 18) & 0x7ULL));
+  }
+}
+// ../ice40/async_fifo.v:27
+void Vsim_top::p181_() {
+  s_dut_my_bus_slave_stream_q_w_bin_next = ((uint64_t)(((uint64_t)(s_dut_my_bus_slave_stream_q_w_bin)) + (((uint64_t)((0x0ULL) ? 0xffULL : (uint64_t)0) << 1) | (uint64_t)(((uint64_t)(s_dut_fsmc_stream_pop)) & (~((uint64_t)(s_dut_my_bus_slave_sq_full)) & 0x1ULL)))) & 0x1ffULL);
+}
+// ../ice40/async_fifo.v:28
+void Vsim_top::p182_() {
+  s_dut_my_bus_slave_stream_q_w_gray_next = (vl_shr<uint64_t>(((uint64_t)(s_dut_my_bus_slave_stream_q_w_bin_next)), 0x1ULL, 9) ^ ((uint64_t)(s_dut_my_bus_slave_stream_q_w_bin_next)));
+}
+// ../ice40/async_fifo.v:29
+void Vsim_top::p183_() {
+  s_dut_my_bus_slave_stream_q_r_bin_next = ((uint64_t)(((uint64_t)(s_dut_my_bus_slave_stream_q_r_bin)) + (((uint64_t)((0x0ULL) ? 0xffULL : (uint64_t)0) << 1) | (uint64_t)(((uint64_t)(s_dut_my_bus_slave_sq_pop)) & (~((uint64_t)(s_dut_my_bus_slave_sq_empty)) & 0x1ULL)))) & 0x1ffULL);
+}
+// ../ice40/async_fifo.v:30
+void Vsim_top::p184_() {
+  s_dut_my_bus_slave_stream_q_r_gray_next = (vl_shr<uint64_t>(((uint64_t)(s_dut_my_bus_slave_stream_q_r_bin_next)), 0x1ULL, 9) ^ ((uint64_t)(s_dut_my_bus_slave_stream_q_r_bin_next)));
+}
+// ../ice40/async_fifo.v:34
+void Vsim_top::p185_() {
+  s_dut_my_bus_slave_sq_full = (uint64_t)(((uint64_t)(s_dut_my_bus_slave_stream_q_w_gray)) == (((uint64_t)(~((uint64_t)((((uint64_t)(s_dut_my_bus_slave_stream_q_s_r_gray)) >> 7) & 0x3ULL)) & 0x3ULL) << 7) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_my_bus_slave_stream_q_s_r_gray)) >> 0) & 0x7fULL))));
+}
+// ../ice40/async_fifo.v:35
+void Vsim_top::p186_() {
+  s_dut_my_bus_slave_sq_empty = (uint64_t)(((uint64_t)(s_dut_my_bus_slave_stream_q_r_gray)) == ((uint64_t)(s_dut_my_bus_slave_stream_q_s_w_gray)));
+}
+// ../ice40/sync_bus_slave.v:89
+void Vsim_top::p187_() {
+  s_dut_my_bus_slave_stream_q_w_data = (((uint64_t)((uint64_t)(s_dut_my_bus_slave_s_epoch)) << 18) | (uint64_t)((uint64_t)(s_dut_my_bus_slave_stream_data)));
+}
+// ../ice40/sync_bus_slave.v:89
+void Vsim_top::p188_() {
+  { uint64_t t6 = ((uint64_t)(s_dut_my_bus_slave_stream_q_r_data));
+    s_dut_my_bus_slave_sq_data = ((uint64_t)((t6 >> 0) & 0x3ffffULL));
+    s_dut_my_bus_slave_sq_epoch = ((uint64_t)((t6 >> 18) & 0x1ULL));
+  }
+}
+// ../ice40/sync_bus_slave.v:94
+void Vsim_top::p189_() {
+  s_dut_my_bus_slave_f_read = (~((uint64_t)(aNOE)) & 0x1ULL);
+}
+// ../ice40/sync_bus_slave.v:95
+void Vsim_top::p190_() {
+  s_dut_my_bus_slave_f_write = (~((uint64_t)(aNWE)) & 0x1ULL);
+}
+// ../ice40/sync_bus_slave.v:97
+void Vsim_top::p191_() {
+  s_dut_my_bus_slave_data_edge = ((((uint64_t)(s_dut_my_bus_slave_active)) & (~((uint64_t)(aNE)) & 0x1ULL)) & (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bus_slave_cnt)))) >= 0x2ULL));
+}
+// ../ice40/sync_bus_slave.v:99
+void Vsim_top::p192_() {
+  s_dut_my_bus_slave_src_valid = ((((uint64_t)(s_dut_my_bus_slave_is_stream)) != 0) ? ((~((uint64_t)(s_dut_my_bus_slave_sq_empty)) & 0x1ULL) & (uint64_t)(((uint64_t)(s_dut_my_bus_slave_sq_epoch)) == ((uint64_t)(s_dut_my_bus_slave_f_epoch)))) : ((((~((uint64_t)(s_dut_my_bus_slave_rsp_empty)) & 0x1ULL) & ((uint64_t)(s_dut_my_bus_slave_f_want))) & (uint64_t)(((uint64_t)(s_dut_my_bus_slave_rsp_seq)) == ((uint64_t)(s_dut_my_bus_slave_f_seq)))) & (~((uint64_t)(s_dut_my_bus_slave_c_full)) & 0x1ULL)));
+}
+// ../ice40/sync_bus_slave.v:102
+void Vsim_top::p193_() {
+  s_dut_my_bus_slave_rd_beat = ((((uint64_t)(s_dut_my_bus_slave_data_edge)) & ((uint64_t)(s_dut_my_bus_slave_f_read))) & ((uint64_t)(s_dut_my_bus_slave_src_valid)));
+}
+// ../ice40/sync_bus_slave.v:103
+void Vsim_top::p194_() {
+  s_dut_my_bus_slave_wr_beat = ((((uint64_t)(s_dut_my_bus_slave_data_edge)) & ((uint64_t)(s_dut_my_bus_slave_f_write))) & (~((uint64_t)(s_dut_my_bus_slave_c_full)) & 0x1ULL));
+}
+// ../ice40/sync_bus_slave.v:104
+void Vsim_top::p195_() {
+  s_dut_my_bus_slave_rd_taken = (((uint64_t)(s_dut_my_bus_slave_rd_beat)) & (~((uint64_t)(s_dut_my_bus_slave_is_stream)) & 0x1ULL));
+}
+// ../ice40/sync_bus_slave.v:109
+void Vsim_top::p196_() {
+  s_dut_my_bus_slave_rd_cmd = ((((((((uint64_t)(s_dut_my_bus_slave_active)) & (~((uint64_t)(aNE)) & 0x1ULL)) & ((uint64_t)(s_dut_my_bus_slave_f_read))) & (~((uint64_t)(s_dut_my_bus_slave_is_stream)) & 0x1ULL)) & (~((uint64_t)(s_dut_my_bus_slave_outstanding)) & 0x1ULL)) & (~((uint64_t)(s_dut_my_bus_slave_c_full)) & 0x1ULL)) & ((~((uint64_t)(s_dut_my_bus_slave_f_want)) & 0x1ULL) | ((uint64_t)(s_dut_my_bus_slave_data_edge))));
+}
+// ../ice40/sync_bus_slave.v:111
+void Vsim_top::p197_() {
+  s_dut_my_bus_slave_c_push = ((((uint64_t)(s_dut_my_bus_slave_rd_cmd)) | ((uint64_t)(s_dut_my_bus_slave_wr_beat))) | ((uint64_t)(s_dut_my_bus_slave_rd_taken)));
+}
+// ../ice40/sync_bus_slave.v:112
+void Vsim_top::p198_() {
+  s_dut_my_bus_slave_next_seq = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bus_slave_f_seq)))) + 0x1ULL) & 0xffffffffULL)) & 0x7ULL));
+}
+// ../ice40/sync_bus_slave.v:113
+void Vsim_top::p199_() {
+  s_dut_my_bus_slave_rsp_pop = ((~((uint64_t)(s_dut_my_bus_slave_rsp_empty)) & 0x1ULL) & (((~((uint64_t)(s_dut_my_bus_slave_f_want)) & 0x1ULL) | (uint64_t)(((uint64_t)(s_dut_my_bus_slave_rsp_seq)) != ((uint64_t)(s_dut_my_bus_slave_f_seq)))) | ((uint64_t)(s_dut_my_bus_slave_rd_taken))));
+}
+// ../ice40/sync_bus_slave.v:114
+void Vsim_top::p200_() {
+  s_dut_my_bus_slave_sq_pop = ((~((uint64_t)(s_dut_my_bus_slave_sq_empty)) & 0x1ULL) & ((uint64_t)(((uint64_t)(s_dut_my_bus_slave_sq_epoch)) != ((uint64_t)(s_dut_my_bus_slave_f_epoch))) | (((uint64_t)(s_dut_my_bus_slave_rd_beat)) & ((uint64_t)(s_dut_my_bus_slave_is_stream)))));
+}
+// ../ice40/sync_bus_slave.v:143
+void Vsim_top::p201_() {
+  s_dut_fsmc_nwait = (((uint64_t)(aNE)) | ((((uint64_t)(s_dut_my_bus_slave_f_write)) != 0) ? (~((uint64_t)(s_dut_my_bus_slave_c_full)) & 0x1ULL) : ((uint64_t)(s_dut_my_bus_slave_src_valid))));
+}
+// ../ice40/sync_bus_slave.v:144
+void Vsim_top::p202_() {
+  s_dut_fsmc_io_d_output = ((~((uint64_t)(aNE)) & 0x1ULL) & (~((uint64_t)(aNOE)) & 0x1ULL));
+}
+// ../ice40/sync_bus_slave.v:145
+void Vsim_top::p203_() {
+  s_dut_my_bus_slave_io_data = ((((uint64_t)(s_dut_my_bus_slave_is_stream)) != 0) ? ((uint64_t)(s_dut_my_bus_slave_sq_data)) : ((uint64_t)(s_dut_my_bus_slave_rsp_data)));
+}
+// ../ice40/sync_bus_slave.v:148
+void Vsim_top::p204_() {
+  s_dut_my_bus_slave_c_read = ((((~((uint64_t)(s_dut_my_bus_slave_c_empty)) & 0x1ULL) & (~((uint64_t)(s_dut_my_bus_slave_c_wr)) & 0x1ULL)) & (~((uint64_t)(s_dut_my_bus_slave_c_taken)) & 0x1ULL)) & (~((uint64_t)(s_dut_my_bus_slave_s_reading)) & 0x1ULL));
+}
+// ../ice40/sync_bus_slave.v:149
+void Vsim_top::p205_() {
+  s_dut_my_bus_slave_c_commit = (((~((uint64_t)(s_dut_my_bus_slave_c_empty)) & 0x1ULL) & ((uint64_t)(s_dut_my_bus_slave_c_taken))) & (~((uint64_t)(s_dut_my_bus_slave_s_reading)) & 0x1ULL));
+}
+// ../ice40/sync_bus_slave.v:150
+void Vsim_top::p206_() {
+  s_dut_fsmc_do_write = ((((~((uint64_t)(s_dut_my_bus_slave_c_empty)) & 0x1ULL) & ((uint64_t)(s_dut_my_bus_slave_c_wr))) & (~((uint64_t)(s_dut_my_bus_slave_s_reading)) & 0x1ULL)) & (~((uint64_t)(s_dut_fsmc_wr_wait)) & 0x1ULL));
+}
+// ../ice40/sync_bus_slave.v:151
+void Vsim_top::p207_() {
+  s_dut_my_bus_slave_c_pop = ((((uint64_t)(s_dut_my_bus_slave_c_read)) | ((uint64_t)(s_dut_my_bus_slave_c_commit))) | ((uint64_t)(s_dut_fsmc_do_write)));
+}
+// ../ice40/sync_bus_slave.v:152
+void Vsim_top::p208_() {
+  s_dut_fsmc_w_adr = ((uint64_t)(s_dut_my_bus_slave_c_adr));
+}
+// ../ice40/sync_bus_slave.v:153
+void Vsim_top::p209_() {
+  s_dut_my_bus_slave_w_data = ((uint64_t)(s_dut_my_bus_slave_c_data));
+}
+// ../ice40/sync_bus_slave.v:156
+void Vsim_top::p210_() {
+  s_dut_my_bus_slave_s_done = (((uint64_t)(s_dut_my_bus_slave_s_reading)) & (~((uint64_t)(s_dut_fsmc_rd_wait)) & 0x1ULL));
+}
+// ../ice40/sync_bus_slave.v:174
+void Vsim_top::p211_() {
+  s_dut_fsmc_stream_pop = (((uint64_t)(s_dut_sf_ready)) & (~((uint64_t)(s_dut_my_bus_slave_sq_full)) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:213
+void Vsim_top::p212_() {
+  s_dut_my_bus_slave_aDn = (((uint64_t)((uint64_t)(s_dut_fsmc_nbl)) << 16) | (uint64_t)((uint64_t)(s_dut_aDn_input)));
+}
+// ../ice40/sdram-stm32.v:213
+void Vsim_top::p213_() {
+  s_dut_my_bus_slave_read_data = (((uint64_t)0x0ULL << 16) | (uint64_t)((uint64_t)(s_dut_fsmc_r_data)));
+}
+// ../ice40/sdram-stm32.v:213
+void Vsim_top::p214_() {
+  { uint64_t t7 = ((uint64_t)(s_dut_my_bus_slave_w_data));
+    s_dut_fsmc_w_data = ((uint64_t)((t7 >> 0) & 0xffffULL));
+    s_dut_fsmc_w_nbl = ((uint64_t)((t7 >> 16) & 0x3ULL));
+  }
+}
+// ../ice40/sdram-stm32.v:213
+void Vsim_top::p215_() {
+  { uint64_t t8 = ((uint64_t)(s_dut_my_bus_slave_io_data));
+    s_dut_aDn_output = ((uint64_t)((t8 >> 0) & 0xffffULL));
+    s_dut_fsmc_io_nbl_unused = ((uint64_t)((t8 >> 16) & 0x3ULL));
+  }
+}
+// ../ice40/sdram-stm32.v:213
+void Vsim_top::p216_() {
+  s_dut_my_bus_slave_stream_data = (((uint64_t)0x0ULL << 16) | (uint64_t)((uint64_t)(s_dut_sf_q)));
+}
+// ../ice40/sdram_control_fsm.v:231
+void Vsim_top::p217_() {
+  s_dut_sdram_U0_o_sdram_dqm = (((((uint64_t)(s_dut_sdram_U0_sdram_dqm_i))) ? 0x3ULL : (uint64_t)0) | ((((uint64_t)(s_dut_sdram_U0_write_cmd_i)) != 0) ? ((uint64_t)(s_dut_sdram_U0_i_dqm)) : ((0x0ULL) ? 0x3ULL : (uint64_t)0)));
+}
+// ../ice40/sdram_control_fsm.v:250
+void Vsim_top::p218_() {
+  s_dut_sdram_U0_req_bank_i = ((uint64_t)((((uint64_t)(s_dut_sdram_U0_i_addr)) >> 9) & 0x3ULL));
+}
+// ../ice40/sdram_control_fsm.v:251
+void Vsim_top::p219_() {
+  s_dut_sdram_U0_req_row_i = ((uint64_t)((((uint64_t)(s_dut_sdram_U0_i_addr)) >> 11) & 0x1fffULL));
+}
+// ../ice40/sdram_control_fsm.v:252
+void Vsim_top::p220_() {
+  s_dut_sdram_U0_page_hit_i = (uint64_t)((vl_bit(((uint64_t)(s_dut_sdram_U0_row_open_i)), (int64_t)(((uint64_t)(s_dut_sdram_U0_req_bank_i))) - 0, 4) != 0) && ((uint64_t)((((((uint64_t)(s_dut_sdram_U0_req_bank_i))) <= 3) ? (uint64_t)s_dut_sdram_U0_open_row_i[(((uint64_t)(s_dut_sdram_U0_req_bank_i))) - 0] : 0) == ((uint64_t)(s_dut_sdram_U0_req_row_i))) != 0));
+}
+// ../ice40/sdram_control_fsm.v:253
+void Vsim_top::p221_() {
+  s_dut_sdram_U0_page_miss_i = (uint64_t)((vl_bit(((uint64_t)(s_dut_sdram_U0_row_open_i)), (int64_t)(((uint64_t)(s_dut_sdram_U0_req_bank_i))) - 0, 4) != 0) && ((uint64_t)((((((uint64_t)(s_dut_sdram_U0_req_bank_i))) <= 3) ? (uint64_t)s_dut_sdram_U0_open_row_i[(((uint64_t)(s_dut_sdram_U0_req_bank_i))) - 0] : 0) != ((uint64_t)(s_dut_sdram_U0_req_row_i))) != 0));
+}
+// ../ice40/sdram_control_fsm.v:275
+void Vsim_top::p222_() {
+  s_dut_sdram_U0_next_bank_i = ((uint64_t)((((uint64_t)(s_dut_sdram_U0_i_next_addr)) >> 9) & 0x3ULL));
+}
+// ../ice40/sdram_control_fsm.v:276
+void Vsim_top::p223_() {
+  s_dut_sdram_U0_next_row_i = ((uint64_t)((((uint64_t)(s_dut_sdram_U0_i_next_addr)) >> 11) & 0x1fffULL));
+}
+// ../ice40/sdram_control_fsm.v:277
+void Vsim_top::p224_() {
+  s_dut_sdram_U0_lookahead_slot_i = (uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_disable_precharge)) != 0) && (((uint64_t)(s_dut_sdram_next_valid)) != 0)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_next_bank_i)) != ((uint64_t)(s_dut_sdram_U0_req_bank_i))) != 0)) != 0) && ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x1ULL) != 0)) != 0) && ((uint64_t)(((uint64_t)((0x1ULL != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x18ULL) != 0)) != 0) || ((uint64_t)((0x1ULL != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x1eULL) != 0)) != 0)) != 0));
+}
+// ../ice40/sdram_control_fsm.v:281
+void Vsim_top::p225_() {
+  s_dut_sdram_U0_lookahead_act_i = (uint64_t)((((uint64_t)(s_dut_sdram_U0_lookahead_slot_i)) != 0) && ((uint64_t)(vl_bit(((uint64_t)(s_dut_sdram_U0_row_open_i)), (int64_t)(((uint64_t)(s_dut_sdram_U0_next_bank_i))) - 0, 4) == 0) != 0));
+}
+// ../ice40/sdram_control_fsm.v:282
+void Vsim_top::p226_() {
+  s_dut_sdram_U0_lookahead_pre_i = (uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_U0_lookahead_slot_i)) != 0) && (vl_bit(((uint64_t)(s_dut_sdram_U0_row_open_i)), (int64_t)(((uint64_t)(s_dut_sdram_U0_next_bank_i))) - 0, 4) != 0)) != 0) && ((uint64_t)((((((uint64_t)(s_dut_sdram_U0_next_bank_i))) <= 3) ? (uint64_t)s_dut_sdram_U0_open_row_i[(((uint64_t)(s_dut_sdram_U0_next_bank_i))) - 0] : 0) != ((uint64_t)(s_dut_sdram_U0_next_row_i))) != 0)) != 0) && (vl_bit(((uint64_t)(s_dut_sdram_U0_precharge_ok_i)), (int64_t)(((uint64_t)(s_dut_sdram_U0_next_bank_i))) - 0, 4) != 0));
+}
+// ../ice40/sdram_control_fsm.v:297
+void Vsim_top::p227_() {
+  s_dut_sdram_U0_write_issue_i = (uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x13ULL) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x2ULL) != 0));
+}
+// ../ice40/sdram_control_fsm.v:318
+void Vsim_top::p228_() {
+  s_dut_sdram_U0_bank_i = 0x0ULL;
+  for (int t14 = 0; (uint64_t)(vl_s(((uint64_t)(s_dut_sdram_U0_bank_i)), 32) < vl_s(vl_shl<uint64_t>(0x1ULL, 0x2ULL, 32), 32)) != 0; ++t14) {
+    if (t14 > 1000000) vl_fatal("loop");
+    { int64_t t15 = (int64_t)(vl_s(((uint64_t)(s_dut_sdram_U0_bank_i)), 32)) - 0; if (t15 >= 0 && t15 <= 3) s_dut_sdram_U0_precharge_ok_i = (uint8_t)((((uint64_t)(s_dut_sdram_U0_precharge_ok_i)) & ~(0x1ULL << t15)) | (((uint64_t)((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_dut_sdram_U0_ras_count_i)), (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_dut_sdram_U0_bank_i))) & 0xffffffffULL), 32)) - 0, 16, 4)))) == 0x0ULL) != 0) && ((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_dut_sdram_U0_wr_count_i)), (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_dut_sdram_U0_bank_i))) & 0xffffffffULL), 32)) - 0, 16, 4)))) == 0x0ULL) != 0))) & 0x1ULL) << t15)); }
+    s_dut_sdram_U0_bank_i = ((uint64_t)(((uint64_t)(s_dut_sdram_U0_bank_i)) + 0x1ULL) & 0xffffffffULL);
+  }
+}
+// ../ice40/sdram_control_fsm.v:346
+void Vsim_top::p229_() {
+  s_dut_sdram_U0_read_pipeline_i = (uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)((0x1ULL != 0) && (((uint64_t)(s_dut_sdram_req_adv)) != 0)) != 0) && (((uint64_t)(s_dut_sdram_req_rwn)) != 0)) != 0) && ((uint64_t)((((uint64_t)(s_dut_sdram_disable_active)) != 0) || (((uint64_t)(s_dut_sdram_U0_page_hit_i)) != 0)) != 0)) != 0) && ((uint64_t)((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_refresh_req_i)) != 0) || (((uint64_t)(s_dut_sdram_selfrefresh_i)) != 0)) != 0) || (((uint64_t)(s_dut_sdram_loadmod_req)) != 0)) != 0) || (((uint64_t)(s_dut_sdram_precharge_req)) != 0)) != 0) || (((uint64_t)(s_dut_sdram_power_down_i)) != 0)) == 0) != 0));
+}
+// ../ice40/sdram_control_fsm.v:350
+void Vsim_top::p230_() {
+  s_dut_sdram_U0_read_early_i = (uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_U0_read_pipeline_i)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_ack)) == 0) != 0)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x18ULL) != 0)) != 0) && ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_dut_sdram_U0_ras_count_i)), (int64_t)((((uint64_t)((uint64_t)(s_dut_sdram_U0_req_bank_i)) << 2) | (uint64_t)0x0ULL)) - 0, 16, 4)))) + 0x2ULL) & 0xffffffffULL) <= 0x4ULL) != 0));
+}
+// ../ice40/sdram_control_fsm.v:354
+void Vsim_top::p231_() {
+  s_dut_sdram_pipe_ready = (uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x18ULL) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x1cULL) != 0)) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0xfULL) != 0));
+}
+// ../ice40/sdram_control_fsm.v:364
+void Vsim_top::p232_() {
+  s_dut_sdram_power_state = (((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0xdULL) != 0) ? 0x1ULL : (((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x1ULL) != 0) ? 0x2ULL : (((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x5ULL) != 0) ? 0x3ULL : 0x0ULL)));
+}
+// ../ice40/sdram_control_fsm.v:446
+void Vsim_top::p233_() {
+  s_dut_sdram_write_done = (uint64_t)((((uint64_t)(s_dut_sdram_U0_write_done_i)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_write_done_reg_i)) == 0) != 0));
+}
+// ../ice40/sdram_control_fsm.v:447
+void Vsim_top::p234_() {
+  s_dut_sdram_read_done = (uint64_t)((((uint64_t)(s_dut_sdram_U0_read_done_i)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_read_done_reg_i)) == 0) != 0));
+}
+// ../ice40/sdram_control_fsm.v:462
+void Vsim_top::p235_() {
+  s_dut_sdram_U0_read_cmd_state_i = (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_req_len)))) > 0x1ULL) != 0) ? 0x1bULL : 0x6ULL);
+}
+// ../ice40/sdram_control_fsm.v:464
+void Vsim_top::p236_() {
+  s_dut_sdram_U0_write_cmd_state_i = (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_req_len)))) > 0x1ULL) != 0) ? 0x13ULL : 0x2ULL);
+}
+// ../ice40/sdram_control_fsm.v:477
+void Vsim_top::p237_() {
+  s_dut_sdram_data_next = (uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x13ULL) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x2ULL) != 0));
+}
+// ../ice40/sdram_control_fsm.v:805
+void Vsim_top::p238_() {
+  { uint64_t t30 = ((uint64_t)(s_dut_sdram_U0_init_fsm_states_i));
+    if (t30 == 0x1ULL) {
+      s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+    } else if (t30 == 0x3ULL || t30 == 0x5ULL) {
+      s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(0x5ULL == 0x0ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+    } else if (t30 == 0x0ULL) {
+      s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else if (t30 == 0x2ULL) {
+      s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+    } else if (t30 == 0x8ULL) {
+      s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+    } else if (t30 == 0x4ULL || t30 == 0x6ULL) {
+      s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x5ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+    } else if (t30 == 0x9ULL) {
+      { uint64_t t31 = ((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i));
+        if (t31 == 0xeULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0x0ULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+        } else if (t31 == 0x10ULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0x1fULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x5ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0x1ULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+        } else if (t31 == 0x5ULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x4ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0x18ULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) || (((uint64_t)(s_dut_sdram_U0_read_early_i)) != 0)) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0x1cULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == ((uint64_t)(0x1ULL - 0x1ULL) & 0xffffffffULL)) != 0) || ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x1ULL) != 0)) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0x1eULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x1ULL) != 0) || (((uint64_t)(s_dut_sdram_burststop_req)) != 0)) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0x9ULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0x7ULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+        } else if (t31 == 0x17ULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0x15ULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+        } else if (t31 == 0x11ULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0x19ULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0xcULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0x8ULL || t31 == 0x1aULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+        } else if (t31 == 0x1bULL || t31 == 0x13ULL) {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+        } else {
+          s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+        }
+      }
+    } else {
+      s_dut_sdram_U0_reset_clk_counter_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:922
+void Vsim_top::p239_() {
+  s_dut_sdram_data_valid = ((uint64_t)(s_dut_sdram_U0_cpu_den_i));
+}
+// ../ice40/sdram_control_fsm.v:927
+void Vsim_top::p240_() {
+  s_dut_sdram_U0_o_data = ((uint64_t)(s_dut_sdram_U0_sdram_dq_reg_i));
+}
+// ../ice40/sdram_control_fsm.v:928
+void Vsim_top::p241_() {
+  s_dut_sdram_cpu_den_i = ((uint64_t)(s_dut_sdram_U0_cpu_den_i));
+}
+// ../ice40/sdram_control_fsm.v:975
+void Vsim_top::p242_() {
+  s_dut_sdram_U0_o_sdram_dq = ((uint64_t)(s_dut_sdram_U0_i_data));
+}
+// ../ice40/sdram_control_fsm.v:976
+void Vsim_top::p243_() {
+  s_dut_sdram_busdir = ((uint64_t)(s_dut_sdram_U0_sdram_dq_en_i));
+}
+// ../ice40/sdram_control_fsm.v:1058
+void Vsim_top::p244_() {
+  s_dut_sdram_data_req = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_read_req_cnt_i)))) < 0x1ULL) != 0) ? 0x1ULL : 0x0ULL)) & 0x1ULL));
+}
+// ../ice40/sdram_control_fsm.v:1067
+void Vsim_top::p245_() {
+  s_dut_sdram_U0_col_i = ((uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_U0_i_addr)) >> 0) & 0x1ffULL)) + ((uint64_t)((((uint64_t)(s_dut_sdram_U0_burst_col_i)) >> 0) & 0x1ffULL))) & 0x1ffULL);
+}
+// ../ice40/sdram_control_fsm.v:1069
+void Vsim_top::p246_() {
+  { int64_t t33 = (int64_t)(vl_s(0xaULL, 32)) - 0; if (t33 >= 0 && t33 <= 12) s_dut_sdram_U0_col_addr_i = (uint16_t)((((uint64_t)(s_dut_sdram_U0_col_addr_i)) & ~(0x1ULL << t33)) | (((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_disable_precharge)) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x1bULL) != 0)) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x13ULL) != 0)) != 0) || ((uint64_t)(0x0ULL == 0x7ULL) != 0)) != 0) ? 0x0ULL : 0x1ULL)) & 0x1ULL) << t33)); }
+}
+// ../ice40/sdram_control_fsm.v:1078
+void Vsim_top::p247_() {
+  s_dut_sdram_U0_col_addr_i = (uint16_t)((((uint64_t)(s_dut_sdram_U0_col_addr_i)) & ~(0x3ffULL << 0)) | (((uint64_t)((((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_sdram_U0_col_i)) >> 0) & 0x1ffULL)))) & 0x3ffULL) << 0));
+}
+// ../ice40/sdram_control_fsm.v:1289
+void Vsim_top::p248_() {
+  { uint64_t t57 = ((uint64_t)((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)));
+    if (t57 == 0x0ULL) {
+    } else if (t57 == 0x10ULL) {
+    } else if (t57 == 0x18ULL) {
+    } else if (t57 == 0x1cULL) {
+    } else if (t57 == 0x1eULL) {
+    } else if (t57 == 0x1fULL) {
+    } else if (t57 == 0xfULL) {
+    } else if (t57 == 0xeULL) {
+    } else if (t57 == 0x6ULL) {
+    } else if (t57 == 0x2ULL) {
+    } else if (t57 == 0x3ULL) {
+    } else if (t57 == 0xbULL) {
+    } else if (t57 == 0x9ULL) {
+    } else if (t57 == 0x1ULL) {
+    } else if (t57 == 0x5ULL) {
+    } else if (t57 == 0x7ULL) {
+    } else if (t57 == 0x17ULL) {
+    } else if (t57 == 0x15ULL) {
+    } else if (t57 == 0x11ULL) {
+    } else if (t57 == 0x19ULL) {
+    } else if (t57 == 0x1dULL) {
+    } else if (t57 == 0xdULL) {
+    } else if (t57 == 0xcULL) {
+    } else if (t57 == 0x8ULL) {
+    } else if (t57 == 0xaULL) {
+    } else if (t57 == 0x1aULL) {
+    } else if (t57 == 0x1bULL) {
+    } else if (t57 == 0x13ULL) {
+    } else {
+    }
+  }
+}
+// ../ice40/sdram_controller.v:325
+void Vsim_top::p249_() {
+  s_dut_sdram_o_blkaddr = (uint8_t)((((uint64_t)(s_dut_sdram_o_blkaddr)) & ~(0x3ULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_sdram_U0_o_sdram_blkaddr))) & 0x3ULL) << 0));
+}
+// ../ice40/sdram_controller.v:325
+void Vsim_top::p250_() {
+  s_dut_sdram_o_addr = (uint16_t)((((uint64_t)(s_dut_sdram_o_addr)) & ~(0x1fffULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_sdram_U0_o_sdram_addr))) & 0x1fffULL) << 0));
+}
+// ../ice40/sdram_controller.v:325
+void Vsim_top::p251_() {
+  s_dut_sdram_dqm = (uint8_t)((((uint64_t)(s_dut_sdram_dqm)) & ~(0x3ULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_sdram_U0_o_sdram_dqm))) & 0x3ULL) << 0));
+}
+// ../ice40/sdram_controller.v:325
+void Vsim_top::p252_() {
+  s_dut_sdram_U0_i_data = ((uint64_t)((((uint64_t)(s_dut_sdram_req_data)) >> 0) & 0xffffULL));
+}
+// ../ice40/sdram_controller.v:325
+void Vsim_top::p253_() {
+  s_dut_sdram_cpu_dataout_i = (uint16_t)((((uint64_t)(s_dut_sdram_cpu_dataout_i)) & ~(0xffffULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_sdram_U0_o_data))) & 0xffffULL) << 0));
+}
+// ../ice40/sdram_controller.v:325
+void Vsim_top::p254_() {
+  s_dut_sdram_o_dq = (uint16_t)((((uint64_t)(s_dut_sdram_o_dq)) & ~(0xffffULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_sdram_U0_o_sdram_dq))) & 0xffffULL) << 0));
+}
+// ../ice40/sdram_controller.v:325
+void Vsim_top::p255_() {
+  s_dut_sdram_U0_i_sdram_dq = ((uint64_t)((((uint64_t)(s_dut_sdram_i_dq)) >> 0) & 0xffffULL));
+}
+// ../ice40/sdram_controller.v:325
+void Vsim_top::p256_() {
+  s_dut_sdram_U0_i_next_addr = ((uint64_t)((((uint64_t)(s_dut_sdram_next_addr)) >> 0) & 0xffffffULL));
+}
+// ../ice40/sdram_controller.v:325
+void Vsim_top::p257_() {
+  s_dut_sdram_U0_i_dqm = ((uint64_t)((((uint64_t)(s_dut_sdram_i_dqm)) >> 0) & 0x3ULL));
+}
+// ../ice40/sdram_controller.v:325
+void Vsim_top::p258_() {
+  s_dut_sdram_U0_i_addr = ((uint64_t)((((uint64_t)(s_dut_sdram_req_addr)) >> 0) & 0xffffffULL));
+}
+// ../ice40/lfsr_count64.v:56
+void Vsim_top::p259_() {
+  s_dut_sdram_U1_U1_lfsr_d0_i = (~((uint64_t)((((uint64_t)(s_dut_sdram_U1_U1_lfsr_reg_i)) >> 5) & 1) ^ (uint64_t)((((uint64_t)(s_dut_sdram_U1_U1_lfsr_reg_i)) >> 4) & 1)) & 0x1ULL);
+}
+// ../ice40/lfsr_count64.v:57
+void Vsim_top::p260_() {
+  s_dut_sdram_U1_U1_lfsr_equal = (uint64_t)(((uint64_t)(s_dut_sdram_U1_U1_lfsr_reg_i)) == 0x20ULL);
+}
+// ../ice40/lfsr_count255.v:57
+void Vsim_top::p261_() {
+  s_dut_sdram_U1_U5_lfsr_d0_i = (~((((uint64_t)((((uint64_t)(s_dut_sdram_U1_U5_lfsr_reg_i)) >> 7) & 1) ^ (uint64_t)((((uint64_t)(s_dut_sdram_U1_U5_lfsr_reg_i)) >> 5) & 1)) ^ (uint64_t)((((uint64_t)(s_dut_sdram_U1_U5_lfsr_reg_i)) >> 4) & 1)) ^ (uint64_t)((((uint64_t)(s_dut_sdram_U1_U5_lfsr_reg_i)) >> 3) & 1)) & 0x1ULL);
+}
+// ../ice40/lfsr_count255.v:58
+void Vsim_top::p262_() {
+  s_dut_sdram_U1_U5_lfsr_256_equal_i = (uint64_t)(((uint64_t)(s_dut_sdram_U1_U5_lfsr_reg_i)) == 0x80ULL);
+}
+// ../ice40/autorefresh_counter.v:62
+void Vsim_top::p263_() {
+  s_dut_sdram_U2_count_match_i = (uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U2_count_i)))) == ((uint64_t)(0x26cULL - 0x1ULL) & 0xffffffffULL));
+}
+// ../ice40/sdram_controller.v:290
+void Vsim_top::p264_() {
+  s_dut_sdram_data_out = ((uint64_t)(s_dut_sdram_cpu_dataout_i));
+}
+// ../ice40/sdram_controller.v:291
+void Vsim_top::p265_() {
+  s_dut_sdram_cpu_datain_i = ((uint64_t)(s_dut_sdram_req_data));
+}
+// ../ice40/sdram_controller.v:317
+void Vsim_top::p266_() {
+  s_dut_sdram_o_clk = ((((uint64_t)(s_dut_sdram_i_clk)) != 0) ? (~((uint64_t)(s_dut_sdram_power_down_reg3_i)) & 0x1ULL) : 0x0ULL);
+}
+// ../ice40/sdram_controller.v:318
+void Vsim_top::p267_() {
+  s_dut_sdram_init_done = ((uint64_t)(s_dut_sdram_init_done_i));
+}
+// ../ice40/sdram_controller.v:319
+void Vsim_top::p268_() {
+  s_dut_sdram_sys_clk_i = ((uint64_t)(s_dut_sdram_i_clk));
+}
+// ../ice40/sdram_controller.v:320
+void Vsim_top::p269_() {
+  s_dut_sdram_sys_rst_i = ((uint64_t)(s_dut_sdram_rst));
+}
+// ../ice40/sdram_controller.v:321
+void Vsim_top::p270_() {
+  s_dut_sdram_busy = ((uint64_t)(s_dut_sdram_sdrctl_busyn_i));
+}
+// ../ice40/sdram_controller.v:417
+void Vsim_top::p271_() {
+  s_dut_sdram_refresh_due_i = (uint64_t)(((uint64_t)(((uint64_t)(vl_s((vl_sext<uint64_t>(((uint64_t)(((uint64_t)(s_dut_sdram_refresh_owed_i)))), 5) & 0xffffffffULL), 32) >= vl_s(0x8ULL, 32)) != 0) || ((uint64_t)(((uint64_t)(vl_s((vl_sext<uint64_t>(((uint64_t)(((uint64_t)(s_dut_sdram_refresh_owed_i)))), 5) & 0xffffffffULL), 32) > vl_s(0x0ULL, 32)) != 0) && ((~((uint64_t)(s_dut_sdram_req_adv)) & 0x1ULL) != 0)) != 0)) != 0) || ((uint64_t)(((uint64_t)(vl_s((vl_sext<uint64_t>(((uint64_t)(((uint64_t)(s_dut_sdram_refresh_owed_i)))), 5) & 0xffffffffULL), 32) > vl_s(((uint64_t)(-0x8ULL) & 0xffffffffULL), 32)) != 0) && ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_idle_count_i)))) == 0x10ULL) != 0)) != 0));
+}
+// ../ice40/sdram_controller.v:449
+void Vsim_top::p272_() {
+  s_dut_sdram_selfrefresh_want_i = (uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_dut_pwr_sr_idle)))) != 0x0ULL) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_power_idle_i)) >= (((uint64_t)((uint64_t)(s_dut_pwr_sr_idle)) << 8) | (uint64_t)0x0ULL)) != 0));
+}
+// ../ice40/sdram_controller.v:451
+void Vsim_top::p273_() {
+  s_dut_sdram_powerdown_want_i = (uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_dut_pwr_pd_idle)))) != 0x0ULL) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_power_idle_i)) >= (((uint64_t)0x0ULL << 16) | (uint64_t)((uint64_t)(s_dut_pwr_pd_idle)))) != 0)) != 0) && ((~((uint64_t)(s_dut_sdram_selfrefresh_want_i)) & 0x1ULL) != 0));
+}
+// ../ice40/sdram_controller.v:454
+void Vsim_top::p274_() {
+  s_dut_sdram_selfrefresh_i = (uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_selfrefresh_req)) != 0) || ((uint64_t)((((uint64_t)(s_dut_sdram_selfrefresh_want_i)) != 0) && ((~((uint64_t)(s_dut_sdram_req_adv)) & 0x1ULL) != 0)) != 0)) != 0) || ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_power_state)) == 0x2ULL) != 0) && ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_selfrefresh_time_i)))) != 0x4ULL) != 0)) != 0));
+}
+// ../ice40/sdram_controller.v:458
+void Vsim_top::p275_() {
+  s_dut_sdram_power_down_i = (uint64_t)((((uint64_t)(s_dut_sdram_powerdown)) != 0) || ((uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_powerdown_want_i)) != 0) && ((~((uint64_t)(s_dut_sdram_req_adv)) & 0x1ULL) != 0)) != 0) && ((~((uint64_t)(s_dut_sdram_refresh_due_i)) & 0x1ULL) != 0)) != 0));
+}
+// ../ice40/sdram_controller.v:460
+void Vsim_top::p276_() {
+  s_dut_sdram_wake = (uint64_t)((((uint64_t)(s_dut_sdram_req_adv)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_power_state)) != 0x0ULL) != 0));
+}
+// ../ice40/sdram-stm32.v:297
+void Vsim_top::p277_() {
+  s_dut_sdram_i_dqm = (((uint64_t)0x0ULL << 2) | (uint64_t)((uint64_t)(s_dut_sdram_req_dqm)));
+}
+// ../ice40/reg_fifo.v:17
+void Vsim_top::p278_() {
+  s_dut_req_queue_r_data = (((((uint64_t)((((uint64_t)(s_dut_req_queue_r_ptr)) >> 0) & 0x1ULL))) <= 1) ? (uint64_t)s_dut_req_queue_mem[(((uint64_t)((((uint64_t)(s_dut_req_queue_r_ptr)) >> 0) & 0x1ULL))) - 0] : 0);
+}
+// ../ice40/reg_fifo.v:18
+void Vsim_top::p279_() {
+  s_dut_rq_level = ((uint64_t)(((uint64_t)(s_dut_req_queue_w_ptr)) - ((uint64_t)(s_dut_req_queue_r_ptr))) & 0x3ULL);
+}
+// ../ice40/reg_fifo.v:19
+void Vsim_top::p280_() {
+  s_dut_rq_empty = (uint64_t)(((uint64_t)(s_dut_req_queue_w_ptr)) == ((uint64_t)(s_dut_req_queue_r_ptr)));
+}
+// ../ice40/reg_fifo.v:20
+void Vsim_top::p281_() {
+  s_dut_rq_full = (uint64_t)((uint64_t)((((uint64_t)(s_dut_rq_level)) >> 1) & 1) == 0x1ULL);
+}
+// ../ice40/sdram-stm32.v:414
+void Vsim_top::p282_() {
+  s_dut_req_queue_w_data = ((((uint64_t)(s_dut_wq_pop)) != 0) ? (((uint64_t)0x0ULL << 45) | ((uint64_t)0x0ULL << 42) | ((uint64_t)((uint64_t)(s_dut_wq_adr)) << 18) | ((uint64_t)((uint64_t)(s_dut_wq_nbl)) << 16) | (uint64_t)((uint64_t)(s_dut_wq_data))) : (((uint64_t)0x1ULL << 45) | ((uint64_t)((uint64_t)((((uint64_t)(s_dut_sdram_i_addr)) >> 4) & 0x7fffffULL)) << 22) | ((uint64_t)0x0ULL << 18) | ((uint64_t)0x0ULL << 16) | (uint64_t)((0x0ULL) ? 0xffffULL : (uint64_t)0)));
+}
+// ../ice40/sdram-stm32.v:414
+void Vsim_top::p283_() {
+  { uint64_t t59 = ((uint64_t)(s_dut_req_queue_r_data));
+    s_dut_rq_data = ((uint64_t)((t59 >> 0) & 0xffffULL));
+    s_dut_rq_nbl = ((uint64_t)((t59 >> 16) & 0x3ULL));
+    s_dut_rq_adr = ((uint64_t)((t59 >> 18) & 0x7ffffffULL));
+    s_dut_rq_rwn = ((uint64_t)((t59 >> 45) & 0x1ULL));
+  }
+}
+// ../ice40/fifo.v:17
+void Vsim_top::p284_() {
+  s_dut_write_queue_mem_we = (((uint64_t)(s_dut_wq_push)) & (~((uint64_t)(s_dut_wq_full)) & 0x1ULL));
+}
+// ../ice40/fifo.v:17
+void Vsim_top::p285_() {
+  s_dut_write_queue_mem_w_adr = ((uint64_t)((((uint64_t)(s_dut_write_queue_w_ptr)) >> 0) & 0xffULL));
+}
+// ../ice40/fifo.v:17
+void Vsim_top::p286_() {
+  s_dut_write_queue_mem_r_adr = ((uint64_t)((((uint64_t)(s_dut_write_queue_r_ptr)) >> 0) & 0xffULL));
+}
+// ../ice40/fifo.v:20
+void Vsim_top::p287_() {
+  s_dut_wq_level = ((uint64_t)(((uint64_t)(s_dut_write_queue_w_ptr)) - ((uint64_t)(s_dut_write_queue_r_ptr))) & 0x1ffULL);
+}
+// ../ice40/fifo.v:21
+void Vsim_top::p288_() {
+  s_dut_wq_empty = (uint64_t)(((uint64_t)(s_dut_write_queue_w_ptr)) == ((uint64_t)(s_dut_write_queue_r_ptr)));
+}
+// ../ice40/fifo.v:22
+void Vsim_top::p289_() {
+  s_dut_wq_full = (uint64_t)((uint64_t)((((uint64_t)(s_dut_wq_level)) >> 8) & 1) == 0x1ULL);
+}
+// ../ice40/sdram-stm32.v:421
+void Vsim_top::p290_() {
+  s_dut_write_queue_clr = 0x0ULL;
+}
+// ../ice40/sdram-stm32.v:421
+void Vsim_top::p291_() {
+  { uint64_t t61 = ((uint64_t)(s_dut_write_queue_r_data));
+    s_dut_wq_data = ((uint64_t)((t61 >> 0) & 0xffffULL));
+    s_dut_wq_nbl = ((uint64_t)((t61 >> 16) & 0x3ULL));
+    s_dut_wq_adr = ((uint64_t)((t61 >> 18) & 0xffffffULL));
+  }
+}
+// ../ice40/fifo.v:17
+void Vsim_top::p292_() {
+  s_dut_stream_fifo_mem_we = (((uint64_t)(s_dut_sf_push)) & (~((uint64_t)(s_dut_sf_full)) & 0x1ULL));
+}
+// ../ice40/fifo.v:17
+void Vsim_top::p293_() {
+  s_dut_stream_fifo_mem_w_adr = ((uint64_t)((((uint64_t)(s_dut_stream_fifo_w_ptr)) >> 0) & 0xffULL));
+}
+// ../ice40/fifo.v:17
+void Vsim_top::p294_() {
+  s_dut_stream_fifo_mem_r_adr = ((uint64_t)((((uint64_t)(s_dut_stream_fifo_r_ptr)) >> 0) & 0xffULL));
+}
+// ../ice40/fifo.v:20
+void Vsim_top::p295_() {
+  s_dut_sf_level = ((uint64_t)(((uint64_t)(s_dut_stream_fifo_w_ptr)) - ((uint64_t)(s_dut_stream_fifo_r_ptr))) & 0x1ffULL);
+}
+// ../ice40/fifo.v:21
+void Vsim_top::p296_() {
+  s_dut_sf_empty = (uint64_t)(((uint64_t)(s_dut_stream_fifo_w_ptr)) == ((uint64_t)(s_dut_stream_fifo_r_ptr)));
+}
+// ../ice40/fifo.v:22
+void Vsim_top::p297_() {
+  s_dut_sf_full = (uint64_t)((uint64_t)((((uint64_t)(s_dut_sf_level)) >> 8) & 1) == 0x1ULL);
+}
+// ../ice40/sdram_burst.v:44
+void Vsim_top::p298_() {
+  s_dut_prefetch_room = ((uint64_t)((((uint64_t)(vl_shl<uint64_t>(0x1ULL, 0x9ULL, 32) - ((uint64_t)((((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_prefetch_cur_adr)) >> 0) & 0x1ffULL)))))) & 0xffffffffULL)) & 0x3ffULL));
+}
+// ../ice40/sdram_burst.v:45
+void Vsim_top::p299_() {
+  s_dut_prefetch_left_x = (((uint64_t)((0x0ULL) ? 0x3ffULL : (uint64_t)0) << 24) | (uint64_t)((uint64_t)(s_dut_prefetch_left)));
+}
+// ../ice40/sdram_burst.v:46
+void Vsim_top::p300_() {
+  s_dut_prefetch_room_x = (((uint64_t)((0x0ULL) ? 0xffffffULL : (uint64_t)0) << 10) | (uint64_t)((uint64_t)(s_dut_prefetch_room)));
+}
+// ../ice40/sdram_burst.v:47
+void Vsim_top::p301_() {
+  s_dut_prefetch_chunk_x = (((uint64_t)(((uint64_t)(s_dut_prefetch_left_x)) < ((uint64_t)(s_dut_prefetch_room_x))) != 0) ? ((uint64_t)(s_dut_prefetch_left_x)) : ((uint64_t)(s_dut_prefetch_room_x)));
+}
+// ../ice40/sdram_burst.v:48
+void Vsim_top::p302_() {
+  s_dut_prefetch_chunk = ((uint64_t)((((uint64_t)(s_dut_prefetch_chunk_x)) >> 0) & 0x3ffULL));
+}
+// ../ice40/sdram_burst.v:49
+void Vsim_top::p303_() {
+  s_dut_pf_busy = ((~((uint64_t)(s_dut_prefetch_st_idle)) & 0x1ULL) | (uint64_t)(((uint64_t)(((uint64_t)(s_dut_prefetch_rd_left)))) != 0x0ULL));
+}
+// ../ice40/sdram_burst.v:50
+void Vsim_top::p304_() {
+  s_dut_pf_next_adr = (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_prefetch_left)))) != 0x0ULL) != 0) ? ((uint64_t)(s_dut_prefetch_cur_adr)) : ((uint64_t)(s_dut_pf_adr)));
+}
+// ../ice40/sdram-stm32.v:455
+void Vsim_top::p305_() {
+  s_dut_prefetch_rwn = 0x1ULL;
+}
+// ../ice40/sdram-stm32.v:455
+void Vsim_top::p306_() {
+  s_dut_prefetch_len = 0x40ULL;
+}
+// ../ice40/sdram_burst.v:44
+void Vsim_top::p307_() {
+  s_dut_my_burst_room = ((uint64_t)((((uint64_t)(vl_shl<uint64_t>(0x1ULL, 0x9ULL, 32) - ((uint64_t)((((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_my_burst_cur_adr)) >> 0) & 0x1ffULL)))))) & 0xffffffffULL)) & 0x3ffULL));
+}
+// ../ice40/sdram_burst.v:45
+void Vsim_top::p308_() {
+  s_dut_my_burst_left_x = (((uint64_t)((0x0ULL) ? 0x3ffULL : (uint64_t)0) << 24) | (uint64_t)((uint64_t)(s_dut_my_burst_left)));
+}
+// ../ice40/sdram_burst.v:46
+void Vsim_top::p309_() {
+  s_dut_my_burst_room_x = (((uint64_t)((0x0ULL) ? 0xffffffULL : (uint64_t)0) << 10) | (uint64_t)((uint64_t)(s_dut_my_burst_room)));
+}
+// ../ice40/sdram_burst.v:47
+void Vsim_top::p310_() {
+  s_dut_my_burst_chunk_x = (((uint64_t)(((uint64_t)(s_dut_my_burst_left_x)) < ((uint64_t)(s_dut_my_burst_room_x))) != 0) ? ((uint64_t)(s_dut_my_burst_left_x)) : ((uint64_t)(s_dut_my_burst_room_x)));
+}
+// ../ice40/sdram_burst.v:48
+void Vsim_top::p311_() {
+  s_dut_my_burst_chunk = ((uint64_t)((((uint64_t)(s_dut_my_burst_chunk_x)) >> 0) & 0x3ffULL));
+}
+// ../ice40/sdram_burst.v:49
+void Vsim_top::p312_() {
+  s_dut_burst_busy = ((~((uint64_t)(s_dut_my_burst_st_idle)) & 0x1ULL) | (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_burst_rd_left)))) != 0x0ULL));
+}
+// ../ice40/sdram_burst.v:50
+void Vsim_top::p313_() {
+  s_dut_burst_next_adr = (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_burst_left)))) != 0x0ULL) != 0) ? ((uint64_t)(s_dut_my_burst_cur_adr)) : ((uint64_t)(s_dut_my_burst_after_adr)));
+}
+// ../ice40/sdram-stm32.v:570
+void Vsim_top::p314_() {
+  s_dut_my_burst_rwn = (uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 1) == 0);
+}
+// ../ice40/sdram-stm32.v:570
+void Vsim_top::p315_() {
+  s_dut_my_burst_adr = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 15) & 0x1ffULL)) << 15) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 1) & 0x7fffULL)));
+}
+// ../ice40/sdram-stm32.v:570
+void Vsim_top::p316_() {
+  s_dut_my_burst_len = (((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)(s_dut_burst_len)));
+}
+// ../ice40/sdram-stm32.v:570
+void Vsim_top::p317_() {
+  s_dut_my_burst_after_adr = ((uint64_t)(((uint64_t)(s_dut_burst_sd_adr)) + (((uint64_t)0x0ULL << 10) | (uint64_t)((uint64_t)(s_dut_burst_sd_len)))) & 0xffffffULL);
+}
+// ../ice40/read_cache.v:26
+void Vsim_top::p318_() {
+  s_dut_my_cache_tags_w_data = ((uint64_t)((((uint64_t)(s_dut_my_cache_adr)) >> 10) & 0x3fffULL));
+}
+// ../ice40/read_cache.v:28
+void Vsim_top::p319_() {
+  s_dut_my_cache_lines_w_adr = (((uint64_t)((uint64_t)(s_dut_my_cache_idx)) << 4) | (uint64_t)((uint64_t)(s_dut_fill_cnt)));
+}
+// ../ice40/read_cache.v:28
+void Vsim_top::p320_() {
+  s_dut_my_cache_lines_r_adr = ((uint64_t)((((uint64_t)(s_dut_my_cache_adr)) >> 0) & 0x3ffULL));
+}
+// ../ice40/read_cache.v:24
+void Vsim_top::p321_() {
+  s_dut_my_cache_idx = ((uint64_t)((((uint64_t)(s_dut_my_cache_adr)) >> 4) & 0x3fULL));
+}
+// ../ice40/read_cache.v:31
+void Vsim_top::p322_() {
+  s_dut_cache_hit = (vl_bit(((uint64_t)(s_dut_my_cache_valid)), (int64_t)(((uint64_t)(s_dut_my_cache_idx))) - 0, 64) & (uint64_t)(((uint64_t)(s_dut_my_cache_tag_q)) == ((uint64_t)((((uint64_t)(s_dut_my_cache_adr)) >> 10) & 0x3fffULL))));
+}
+// ../ice40/sdram-stm32.v:601
+void Vsim_top::p323_() {
+  s_dut_my_cache_adr = ((uint64_t)((((uint64_t)(s_dut_sdram_i_addr)) >> 0) & 0xffffffULL));
+}
+// ../ice40/sdram-stm32.v:601
+void Vsim_top::p324_() {
+  s_dut_my_cache_fill_we = (((uint64_t)(s_dut_st_doing_read)) & ((uint64_t)(s_dut_sdram_data_valid)));
+}
+// ../ice40/sdram-stm32.v:601
+void Vsim_top::p325_() {
+  s_dut_my_cache_fill_done = ((((uint64_t)(s_dut_st_doing_read)) & ((uint64_t)(s_dut_sdram_data_valid))) & (uint64_t)(((uint64_t)(s_dut_fill_cnt)) == 0xfULL));
+}
+// ../ice40/sdram-stm32.v:601
+void Vsim_top::p326_() {
+  s_dut_my_cache_inv = (((uint64_t)(s_dut_wq_pop)) | ((uint64_t)(s_dut_at_inv)));
+}
+// ../ice40/sdram-stm32.v:601
+void Vsim_top::p327_() {
+  s_dut_my_cache_inv_adr = ((((uint64_t)(s_dut_at_inv)) != 0) ? ((uint64_t)(s_dut_at_inv_adr)) : ((uint64_t)(s_dut_wq_adr)));
+}
+// ../ice40/sdram-stm32.v:601
+void Vsim_top::p328_() {
+  s_dut_my_cache_inv_all = (((((uint64_t)(s_dut_burst_start)) & (uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 1)) | ((uint64_t)(s_dut_bist_start))) | ((uint64_t)(s_dut_cp_inv)));
+}
+// ../ice40/perf_counters.v:25
+void Vsim_top::p329_() {
+  s_dut_perf_q = (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_perf_sel)))) < 0xdULL) != 0) ? s_dut_my_perf_cnt.get((int64_t)((((uint64_t)((uint64_t)(s_dut_perf_sel)) << 5) | (uint64_t)0x0ULL)) - 0, 32) : 0x0ULL);
+}
+// ../ice40/sdram_burst.v:44
+void Vsim_top::p330_() {
+  s_dut_my_bist_bist_burst_room = ((uint64_t)((((uint64_t)(vl_shl<uint64_t>(0x1ULL, 0x9ULL, 32) - ((uint64_t)((((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_my_bist_bist_burst_cur_adr)) >> 0) & 0x1ffULL)))))) & 0xffffffffULL)) & 0x3ffULL));
+}
+// ../ice40/sdram_burst.v:45
+void Vsim_top::p331_() {
+  s_dut_my_bist_bist_burst_left_x = (((uint64_t)((0x0ULL) ? 0x3ffULL : (uint64_t)0) << 25) | (uint64_t)((uint64_t)(s_dut_my_bist_bist_burst_left)));
+}
+// ../ice40/sdram_burst.v:46
+void Vsim_top::p332_() {
+  s_dut_my_bist_bist_burst_room_x = (((uint64_t)((0x0ULL) ? 0x1ffffffULL : (uint64_t)0) << 10) | (uint64_t)((uint64_t)(s_dut_my_bist_bist_burst_room)));
+}
+// ../ice40/sdram_burst.v:47
+void Vsim_top::p333_() {
+  s_dut_my_bist_bist_burst_chunk_x = (((uint64_t)(((uint64_t)(s_dut_my_bist_bist_burst_left_x)) < ((uint64_t)(s_dut_my_bist_bist_burst_room_x))) != 0) ? ((uint64_t)(s_dut_my_bist_bist_burst_left_x)) : ((uint64_t)(s_dut_my_bist_bist_burst_room_x)));
+}
+// ../ice40/sdram_burst.v:48
+void Vsim_top::p334_() {
+  s_dut_my_bist_bist_burst_chunk = ((uint64_t)((((uint64_t)(s_dut_my_bist_bist_burst_chunk_x)) >> 0) & 0x3ffULL));
+}
+// ../ice40/sdram_burst.v:49
+void Vsim_top::p335_() {
+  s_dut_my_bist_b_busy = ((~((uint64_t)(s_dut_my_bist_bist_burst_st_idle)) & 0x1ULL) | (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_bist_burst_rd_left)))) != 0x0ULL));
+}
+// ../ice40/sdram_burst.v:50
+void Vsim_top::p336_() {
+  s_dut_bist_next_adr = (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_bist_burst_left)))) != 0x0ULL) != 0) ? ((uint64_t)(s_dut_my_bist_bist_burst_cur_adr)) : ((uint64_t)(s_dut_my_bist_after_adr)));
+}
+// ../ice40/sdram_bist.v:115
+void Vsim_top::p337_() {
+  if ((uint64_t)(((uint64_t)(s_dut_my_bist_pat_r)) != 0x3ULL) != 0) {
+    s_dut_my_bist_el = (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_elem)))) == 0x0ULL) != 0) ? 0x4ULL : 0x30ULL);
+  } else {
+    { uint64_t t69 = ((uint64_t)(((uint64_t)(s_dut_my_bist_elem))));
+      if (t69 == 0x0ULL) {
+        s_dut_my_bist_el = 0x4ULL;
+      } else if (t69 == 0x1ULL) {
+        s_dut_my_bist_el = 0x16ULL;
+      } else if (t69 == 0x2ULL) {
+        s_dut_my_bist_el = 0x1cULL;
+      } else if (t69 == 0x3ULL) {
+        s_dut_my_bist_el = 0x17ULL;
+      } else if (t69 == 0x4ULL) {
+        s_dut_my_bist_el = 0x1dULL;
+      } else {
+        s_dut_my_bist_el = 0x30ULL;
+      }
+    }
+  }
+}
+// ../ice40/sdram_bist.v:129
+void Vsim_top::p338_() {
+  { uint64_t t70 = ((uint64_t)(s_dut_my_bist_el));
+    s_dut_my_bist_el_down = ((uint64_t)((t70 >> 0) & 0x1ULL));
+    s_dut_my_bist_el_wr_inv = ((uint64_t)((t70 >> 1) & 0x1ULL));
+    s_dut_my_bist_el_wr = ((uint64_t)((t70 >> 2) & 0x1ULL));
+    s_dut_my_bist_el_rd_inv = ((uint64_t)((t70 >> 3) & 0x1ULL));
+    s_dut_my_bist_el_rd = ((uint64_t)((t70 >> 4) & 0x1ULL));
+    s_dut_my_bist_el_last = ((uint64_t)((t70 >> 5) & 0x1ULL));
+  }
+}
+// ../ice40/sdram_bist.v:138
+void Vsim_top::p339_() {
+  s_dut_bist_busy = ((~((uint64_t)(s_dut_my_bist_st_idle)) & 0x1ULL) | ((uint64_t)(s_dut_my_bist_c1_valid)));
+}
+// ../ice40/sdram_bist.v:139
+void Vsim_top::p340_() {
+  s_dut_my_bist_blk = (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_pat_r)) == 0x3ULL) != 0) && ((uint64_t)(((uint64_t)(s_dut_my_bist_left)) > 0x100ULL) != 0)) != 0) ? 0x100ULL : ((uint64_t)(s_dut_my_bist_left)));
+}
+// ../ice40/sdram_bist.v:140
+void Vsim_top::p341_() {
+  s_dut_my_bist_blk_adr = ((((uint64_t)(s_dut_my_bist_el_down)) != 0) ? ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_base)) + ((uint64_t)((((uint64_t)(s_dut_my_bist_left)) >> 0) & 0xffffffULL))) & 0xffffffULL) - ((uint64_t)((((uint64_t)(s_dut_my_bist_blk)) >> 0) & 0xffffffULL))) & 0xffffffULL) : ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_base)) + ((uint64_t)((((uint64_t)(s_dut_my_bist_len_r)) >> 0) & 0xffffffULL))) & 0xffffffULL) - ((uint64_t)((((uint64_t)(s_dut_my_bist_left)) >> 0) & 0xffffffULL))) & 0xffffffULL));
+}
+// ../ice40/sdram_bist.v:142
+void Vsim_top::p342_() {
+  s_dut_bist_fail_adr = (((((uint64_t)(s_dut_bist_fail_sel))) <= 7) ? (uint64_t)s_dut_my_bist_fails[(((uint64_t)(s_dut_bist_fail_sel))) - 0] : 0);
+}
+// ../ice40/sdram_bist.v:146
+void Vsim_top::p343_() {
+  s_dut_my_bist_nxt_down = ((uint64_t)(((uint64_t)(s_dut_my_bist_pat_r)) == 0x3ULL) & ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_elem)))) == 0x2ULL) | (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_elem)))) == 0x3ULL)));
+}
+// ../ice40/sdram_bist.v:147
+void Vsim_top::p344_() {
+  s_dut_my_bist_top_adr = ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_base)) + ((uint64_t)((((uint64_t)(s_dut_my_bist_len_r)) >> 0) & 0xffffffULL))) & 0xffffffULL) - (((uint64_t)(((uint64_t)(s_dut_my_bist_len_r)) > 0x100ULL) != 0) ? ((uint64_t)((0x100ULL >> 0) & 0xffffffULL)) : ((uint64_t)((((uint64_t)(s_dut_my_bist_len_r)) >> 0) & 0xffffffULL)))) & 0xffffffULL);
+}
+// ../ice40/sdram_bist.v:149
+void Vsim_top::p345_() {
+  s_dut_my_bist_after_adr = (((((uint64_t)(s_dut_my_bist_st_read)) & ((uint64_t)(s_dut_my_bist_el_wr))) != 0) ? ((uint64_t)(s_dut_my_bist_c_adr)) : (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_left)))) != 0x0ULL) != 0) ? ((uint64_t)(s_dut_my_bist_blk_adr)) : ((((uint64_t)(s_dut_my_bist_nxt_down)) != 0) ? ((uint64_t)(s_dut_my_bist_top_adr)) : ((uint64_t)(s_dut_my_bist_base)))));
+}
+// ../ice40/sdram-stm32.v:750
+void Vsim_top::p346_() {
+  s_dut_my_bist_pat = ((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0x3ULL));
+}
+// ../ice40/sdram-stm32.v:750
+void Vsim_top::p347_() {
+  s_dut_my_bist_seed = ((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 8) & 0xffULL));
+}
+// ../ice40/sdram-stm32.v:750
+void Vsim_top::p348_() {
+  s_dut_my_bist_adr = ((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 0) & 0xffffffULL));
+}
+// ../ice40/fifo.v:17
+void Vsim_top::p349_() {
+  s_dut_my_copy_desc_q_mem_we = (((uint64_t)(s_dut_cp_push)) & (~((uint64_t)(s_dut_cp_full)) & 0x1ULL));
+}
+// ../ice40/fifo.v:17
+void Vsim_top::p350_() {
+  s_dut_my_copy_desc_q_mem_w_adr = ((uint64_t)((((uint64_t)(s_dut_my_copy_desc_q_w_ptr)) >> 0) & 0xfULL));
+}
+// ../ice40/fifo.v:17
+void Vsim_top::p351_() {
+  s_dut_my_copy_desc_q_mem_r_adr = ((uint64_t)((((uint64_t)(s_dut_my_copy_desc_q_r_ptr)) >> 0) & 0xfULL));
+}
+// ../ice40/fifo.v:20
+void Vsim_top::p352_() {
+  s_dut_cp_level = ((uint64_t)(((uint64_t)(s_dut_my_copy_desc_q_w_ptr)) - ((uint64_t)(s_dut_my_copy_desc_q_r_ptr))) & 0x1fULL);
+}
+// ../ice40/fifo.v:21
+void Vsim_top::p353_() {
+  s_dut_my_copy_dq_empty = (uint64_t)(((uint64_t)(s_dut_my_copy_desc_q_w_ptr)) == ((uint64_t)(s_dut_my_copy_desc_q_r_ptr)));
+}
+// ../ice40/fifo.v:22
+void Vsim_top::p354_() {
+  s_dut_cp_full = (uint64_t)((uint64_t)((((uint64_t)(s_dut_cp_level)) >> 4) & 1) == 0x1ULL);
+}
+// ../ice40/sdram_copy.v:46
+void Vsim_top::p355_() {
+  s_dut_my_copy_desc_q_clr = 0x0ULL;
+}
+// ../ice40/sdram_copy.v:46
+void Vsim_top::p356_() {
+  s_dut_my_copy_desc_q_w_data = (((u128)((uint64_t)(s_dut_my_copy_fill)) << 74) | ((u128)((uint64_t)(s_dut_my_copy_irq)) << 73) | ((u128)((uint64_t)(s_dut_cp_len)) << 48) | ((u128)((uint64_t)(s_dut_cp_dst)) << 24) | (u128)((uint64_t)(s_dut_my_copy_src)));
+}
+// ../ice40/sdram_burst.v:44
+void Vsim_top::p357_() {
+  s_dut_my_copy_copy_burst_room = ((uint64_t)((((uint64_t)(vl_shl<uint64_t>(0x1ULL, 0x9ULL, 32) - ((uint64_t)((((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_my_copy_copy_burst_cur_adr)) >> 0) & 0x1ffULL)))))) & 0xffffffffULL)) & 0x3ffULL));
+}
+// ../ice40/sdram_burst.v:45
+void Vsim_top::p358_() {
+  s_dut_my_copy_copy_burst_left_x = (((uint64_t)((0x0ULL) ? 0x3ffULL : (uint64_t)0) << 25) | (uint64_t)((uint64_t)(s_dut_my_copy_copy_burst_left)));
+}
+// ../ice40/sdram_burst.v:46
+void Vsim_top::p359_() {
+  s_dut_my_copy_copy_burst_room_x = (((uint64_t)((0x0ULL) ? 0x1ffffffULL : (uint64_t)0) << 10) | (uint64_t)((uint64_t)(s_dut_my_copy_copy_burst_room)));
+}
+// ../ice40/sdram_burst.v:47
+void Vsim_top::p360_() {
+  s_dut_my_copy_copy_burst_chunk_x = (((uint64_t)(((uint64_t)(s_dut_my_copy_copy_burst_left_x)) < ((uint64_t)(s_dut_my_copy_copy_burst_room_x))) != 0) ? ((uint64_t)(s_dut_my_copy_copy_burst_left_x)) : ((uint64_t)(s_dut_my_copy_copy_burst_room_x)));
+}
+// ../ice40/sdram_burst.v:48
+void Vsim_top::p361_() {
+  s_dut_my_copy_copy_burst_chunk = ((uint64_t)((((uint64_t)(s_dut_my_copy_copy_burst_chunk_x)) >> 0) & 0x3ffULL));
+}
+// ../ice40/sdram_burst.v:49
+void Vsim_top::p362_() {
+  s_dut_my_copy_b_busy = ((~((uint64_t)(s_dut_my_copy_copy_burst_st_idle)) & 0x1ULL) | (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_copy_burst_rd_left)))) != 0x0ULL));
+}
+// ../ice40/sdram_burst.v:50
+void Vsim_top::p363_() {
+  s_dut_cp_next_adr = (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_copy_burst_left)))) != 0x0ULL) != 0) ? ((uint64_t)(s_dut_my_copy_copy_burst_cur_adr)) : ((uint64_t)(s_dut_my_copy_after_adr)));
+}
+// ../ice40/sdram_copy.v:79
+void Vsim_top::p364_() {
+  s_dut_my_copy_copy_buf_we = (((uint64_t)(s_dut_my_copy_st_read)) & ((uint64_t)(s_dut_sdram_data_valid)));
+}
+// ../ice40/sdram_copy.v:85
+void Vsim_top::p365_() {
+  s_dut_my_copy_after_adr = ((((uint64_t)(s_dut_my_copy_st_read)) != 0) ? ((uint64_t)(s_dut_my_copy_c_dst)) : ((uint64_t)(((((uint64_t)(s_dut_my_copy_c_fill)) != 0) ? ((uint64_t)(s_dut_my_copy_c_dst)) : ((uint64_t)(s_dut_my_copy_c_src))) + ((uint64_t)((((uint64_t)(s_dut_my_copy_blk)) >> 0) & 0xffffffULL))) & 0xffffffULL));
+}
+// ../ice40/sdram_copy.v:87
+void Vsim_top::p366_() {
+  s_dut_my_copy_dq_pop = ((uint64_t)(((uint64_t)(s_dut_my_copy_have)) == 0) & ((uint64_t)(s_dut_my_copy_dq_ready)));
+}
+// ../ice40/sdram_copy.v:88
+void Vsim_top::p367_() {
+  s_dut_cp_busy = (((uint64_t)(s_dut_my_copy_st_read)) | ((uint64_t)(s_dut_my_copy_st_write)));
+}
+// ../ice40/sdram_copy.v:89
+void Vsim_top::p368_() {
+  s_dut_cp_pending = (((uint64_t)(s_dut_my_copy_have)) | (uint64_t)(((uint64_t)(s_dut_my_copy_dq_empty)) == 0));
+}
+// ../ice40/sdram_copy.v:90
+void Vsim_top::p369_() {
+  s_dut_cp_wdata = ((((uint64_t)(s_dut_my_copy_c_fill)) != 0) ? ((uint64_t)((((uint64_t)(s_dut_my_copy_c_src)) >> 0) & 0xffffULL)) : ((uint64_t)(s_dut_my_copy_buf_q)));
+}
+// ../ice40/sdram_copy.v:91
+void Vsim_top::p370_() {
+  s_dut_cp_inv = (((uint64_t)(s_dut_my_copy_b_start)) & (uint64_t)(((uint64_t)(s_dut_my_copy_b_rwn)) == 0));
+}
+// ../ice40/sdram_copy.v:92
+void Vsim_top::p371_() {
+  s_dut_cp_done = ((uint64_t)(s_dut_my_copy_n_done));
+}
+// ../ice40/sdram_copy.v:93
+void Vsim_top::p372_() {
+  s_dut_cp_irq = ((uint64_t)(s_dut_my_copy_irq_r));
+}
+// ../ice40/sdram-stm32.v:799
+void Vsim_top::p373_() {
+  s_dut_my_copy_fill = (uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 1);
+}
+// ../ice40/sdram-stm32.v:799
+void Vsim_top::p374_() {
+  s_dut_my_copy_irq = (uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 1) & 1);
+}
+// ../ice40/sdram-stm32.v:799
+void Vsim_top::p375_() {
+  s_dut_my_copy_src = (((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 1) != 0) ? (((uint64_t)0x0ULL << 16) | (uint64_t)((uint64_t)(s_dut_cp_fill_val))) : ((uint64_t)(s_dut_cp_src)));
+}
+// ../ice40/sdram-stm32.v:799
+void Vsim_top::p376_() {
+  s_dut_my_copy_irq_clr = ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_cp_status))) & (uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 14) & 1));
+}
+// ../ice40/sdram_burst.v:44
+void Vsim_top::p377_() {
+  s_dut_my_atomic_atomic_burst_room = ((uint64_t)((((uint64_t)(vl_shl<uint64_t>(0x1ULL, 0x9ULL, 32) - ((uint64_t)((((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_my_atomic_atomic_burst_cur_adr)) >> 0) & 0x1ffULL)))))) & 0xffffffffULL)) & 0x3ffULL));
+}
+// ../ice40/sdram_burst.v:45
+void Vsim_top::p378_() {
+  s_dut_my_atomic_atomic_burst_left_x = (((uint64_t)((0x0ULL) ? 0x3ffULL : (uint64_t)0) << 2) | (uint64_t)((uint64_t)(s_dut_my_atomic_atomic_burst_left)));
+}
+// ../ice40/sdram_burst.v:46
+void Vsim_top::p379_() {
+  s_dut_my_atomic_atomic_burst_room_x = (((uint64_t)((0x0ULL) ? 0x3ULL : (uint64_t)0) << 10) | (uint64_t)((uint64_t)(s_dut_my_atomic_atomic_burst_room)));
+}
+// ../ice40/sdram_burst.v:47
+void Vsim_top::p380_() {
+  s_dut_my_atomic_atomic_burst_chunk_x = (((uint64_t)(((uint64_t)(s_dut_my_atomic_atomic_burst_left_x)) < ((uint64_t)(s_dut_my_atomic_atomic_burst_room_x))) != 0) ? ((uint64_t)(s_dut_my_atomic_atomic_burst_left_x)) : ((uint64_t)(s_dut_my_atomic_atomic_burst_room_x)));
+}
+// ../ice40/sdram_burst.v:48
+void Vsim_top::p381_() {
+  s_dut_my_atomic_atomic_burst_chunk = ((uint64_t)((((uint64_t)(s_dut_my_atomic_atomic_burst_chunk_x)) >> 0) & 0x3ffULL));
+}
+// ../ice40/sdram_burst.v:49
+void Vsim_top::p382_() {
+  s_dut_my_atomic_b_busy = ((~((uint64_t)(s_dut_my_atomic_atomic_burst_st_idle)) & 0x1ULL) | (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_atomic_atomic_burst_rd_left)))) != 0x0ULL));
+}
+// ../ice40/sdram_burst.v:50
+void Vsim_top::p383_() {
+  s_dut_at_next_adr = (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_atomic_atomic_burst_left)))) != 0x0ULL) != 0) ? ((uint64_t)(s_dut_my_atomic_atomic_burst_cur_adr)) : ((uint64_t)(s_dut_my_atomic_adr_r)));
+}
+// ../ice40/sdram_atomic.v:49
+void Vsim_top::p384_() {
+  s_dut_my_atomic_atomic_burst_len = (((uint64_t)((uint64_t)(s_dut_my_atomic_size32_r)) << 1) | (uint64_t)(uint64_t)(((uint64_t)(s_dut_my_atomic_size32_r)) == 0));
+}
+// ../ice40/sdram_atomic.v:56
+void Vsim_top::p385_() {
+  s_dut_at_pending = ((uint64_t)(s_dut_my_atomic_pend));
+}
+// ../ice40/sdram_atomic.v:57
+void Vsim_top::p386_() {
+  s_dut_at_busy = (((uint64_t)(s_dut_my_atomic_st_read)) | ((uint64_t)(s_dut_my_atomic_st_write)));
+}
+// ../ice40/sdram_atomic.v:58
+void Vsim_top::p387_() {
+  s_dut_at_inv = (((uint64_t)(s_dut_my_atomic_b_start)) & (uint64_t)(((uint64_t)(s_dut_my_atomic_b_rwn)) == 0));
+}
+// ../ice40/sdram_atomic.v:59
+void Vsim_top::p388_() {
+  s_dut_at_inv_adr = ((uint64_t)(s_dut_my_atomic_adr_r));
+}
+// ../ice40/sdram_atomic.v:62
+void Vsim_top::p389_() {
+  s_dut_my_atomic_old = ((((uint64_t)(s_dut_my_atomic_size32_r)) != 0) ? ((uint64_t)(s_dut_at_result)) : (((uint64_t)0x0ULL << 16) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_at_result)) >> 0) & 0xffffULL))));
+}
+// ../ice40/sdram_atomic.v:63
+void Vsim_top::p390_() {
+  s_dut_my_atomic_sum = ((uint64_t)(((uint64_t)(s_dut_my_atomic_old)) + ((uint64_t)(s_dut_my_atomic_arg_r))) & 0xffffffffULL);
+}
+// ../ice40/sdram_atomic.v:64
+void Vsim_top::p391_() {
+  s_dut_my_atomic_match = ((((uint64_t)(s_dut_my_atomic_size32_r)) != 0) ? (uint64_t)(((uint64_t)(s_dut_my_atomic_old)) == ((uint64_t)(s_dut_my_atomic_cmp_r))) : (uint64_t)(((uint64_t)((((uint64_t)(s_dut_my_atomic_old)) >> 0) & 0xffffULL)) == ((uint64_t)((((uint64_t)(s_dut_my_atomic_cmp_r)) >> 0) & 0xffffULL))));
+}
+// ../ice40/sdram_atomic.v:65
+void Vsim_top::p392_() {
+  s_dut_my_atomic_alu = (((uint64_t)(((uint64_t)(s_dut_my_atomic_op_r)) == 0x0ULL) != 0) ? ((uint64_t)(s_dut_my_atomic_sum)) : (((uint64_t)(((uint64_t)(s_dut_my_atomic_op_r)) == 0x1ULL) != 0) ? ((uint64_t)(s_dut_my_atomic_arg_r)) : (((uint64_t)(((uint64_t)(s_dut_my_atomic_op_r)) == 0x2ULL) != 0) ? ((uint64_t)(s_dut_my_atomic_arg_r)) : (((uint64_t)(((uint64_t)(s_dut_my_atomic_op_r)) == 0x3ULL) != 0) ? (((uint64_t)(s_dut_my_atomic_old)) & ((uint64_t)(s_dut_my_atomic_arg_r))) : (((uint64_t)(((uint64_t)(s_dut_my_atomic_op_r)) == 0x4ULL) != 0) ? (((uint64_t)(s_dut_my_atomic_old)) | ((uint64_t)(s_dut_my_atomic_arg_r))) : (((uint64_t)(s_dut_my_atomic_old)) ^ ((uint64_t)(s_dut_my_atomic_arg_r))))))));
+}
+// ../ice40/sdram-stm32.v:858
+void Vsim_top::p393_() {
+  s_dut_my_atomic_start = (((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_at_op)));
+}
+// ../ice40/sdram-stm32.v:858
+void Vsim_top::p394_() {
+  s_dut_my_atomic_op = ((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0x7ULL));
+}
+// ../ice40/sdram-stm32.v:858
+void Vsim_top::p395_() {
+  s_dut_my_atomic_size32 = (uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 4) & 1);
+}
+// ../ice40/sdram-stm32.v:858
+void Vsim_top::p396_() {
+  s_dut_my_atomic_adr = ((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 0) & 0xffffffULL));
+}
+// ../ice40/sdram_burst.v:44
+void Vsim_top::p397_() {
+  s_dut_my_reader_reader_burst_room = ((uint64_t)((((uint64_t)(vl_shl<uint64_t>(0x1ULL, 0x9ULL, 32) - ((uint64_t)((((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_my_reader_reader_burst_cur_adr)) >> 0) & 0x1ffULL)))))) & 0xffffffffULL)) & 0x3ffULL));
+}
+// ../ice40/sdram_burst.v:45
+void Vsim_top::p398_() {
+  s_dut_my_reader_reader_burst_left_x = (((uint64_t)((0x0ULL) ? 0x3ffULL : (uint64_t)0) << 25) | (uint64_t)((uint64_t)(s_dut_my_reader_reader_burst_left)));
+}
+// ../ice40/sdram_burst.v:46
+void Vsim_top::p399_() {
+  s_dut_my_reader_reader_burst_room_x = (((uint64_t)((0x0ULL) ? 0x1ffffffULL : (uint64_t)0) << 10) | (uint64_t)((uint64_t)(s_dut_my_reader_reader_burst_room)));
+}
+// ../ice40/sdram_burst.v:47
+void Vsim_top::p400_() {
+  s_dut_my_reader_reader_burst_chunk_x = (((uint64_t)(((uint64_t)(s_dut_my_reader_reader_burst_left_x)) < ((uint64_t)(s_dut_my_reader_reader_burst_room_x))) != 0) ? ((uint64_t)(s_dut_my_reader_reader_burst_left_x)) : ((uint64_t)(s_dut_my_reader_reader_burst_room_x)));
+}
+// ../ice40/sdram_burst.v:48
+void Vsim_top::p401_() {
+  s_dut_my_reader_reader_burst_chunk = ((uint64_t)((((uint64_t)(s_dut_my_reader_reader_burst_chunk_x)) >> 0) & 0x3ffULL));
+}
+// ../ice40/sdram_burst.v:49
+void Vsim_top::p402_() {
+  s_dut_my_reader_b_busy = ((~((uint64_t)(s_dut_my_reader_reader_burst_st_idle)) & 0x1ULL) | (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_reader_reader_burst_rd_left)))) != 0x0ULL));
+}
+// ../ice40/sdram_burst.v:50
+void Vsim_top::p403_() {
+  s_dut_rdr_next_adr = (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_reader_reader_burst_left)))) != 0x0ULL) != 0) ? ((uint64_t)(s_dut_my_reader_reader_burst_cur_adr)) : ((uint64_t)(s_dut_my_reader_reader_burst_after_adr)));
+}
+// ../ice40/sdram_reader.v:33
+void Vsim_top::p404_() {
+  s_dut_my_reader_reader_burst_rwn = 0x1ULL;
+}
+// ../ice40/sdram_reader.v:33
+void Vsim_top::p405_() {
+  s_dut_my_reader_reader_burst_after_adr = ((uint64_t)(((uint64_t)(s_dut_my_reader_cur)) + ((uint64_t)((((uint64_t)(s_dut_my_reader_blk)) >> 0) & 0xffffffULL))) & 0xffffffULL);
+}
+// ../ice40/sdram_reader.v:40
+void Vsim_top::p406_() {
+  s_dut_rdr_pending = ((uint64_t)(s_dut_my_reader_pend));
+}
+// ../ice40/sdram_reader.v:41
+void Vsim_top::p407_() {
+  s_dut_rdr_busy = ((uint64_t)(s_dut_my_reader_st_read));
+}
+// ../ice40/sdram_reader.v:42
+void Vsim_top::p408_() {
+  s_dut_rdr_valid = (((uint64_t)(s_dut_my_reader_st_read)) & ((uint64_t)(s_dut_sdram_data_valid)));
+}
+// ../ice40/sdram_reader.v:43
+void Vsim_top::p409_() {
+  s_dut_rdr_data = ((uint64_t)(s_dut_sdram_data_out));
+}
+// ../ice40/sdram-stm32.v:916
+void Vsim_top::p410_() {
+  s_dut_my_reader_adr = ((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 0) & 0xffffffULL));
+}
+// ../ice40/sdram-stm32.v:916
+void Vsim_top::p411_() {
+  s_dut_my_reader_stop = (((uint64_t)(s_dut_rdr_to_scan)) & ((uint64_t)(s_dut_scan_found)));
+}
+// ../ice40/sdram_crc.v:31
+void Vsim_top::p412_() {
+  s_dut_crc_busy = ((uint64_t)(s_dut_my_crc_d_valid));
+}
+// ../ice40/sdram_crc.v:32
+void Vsim_top::p413_() {
+  s_dut_crc_q = (~((uint64_t)(s_dut_my_crc_c)) & 0xffffffffULL);
+}
+// ../ice40/sdram-stm32.v:925
+void Vsim_top::p414_() {
+  s_dut_my_crc_valid = (((uint64_t)(s_dut_rdr_valid)) & (uint64_t)(((uint64_t)(s_dut_rdr_to_scan)) == 0));
+}
+// ../ice40/sdram_scan.v:45
+void Vsim_top::p415_() {
+  s_dut_my_scan_d_index = (((uint64_t)((0x0ULL) ? 0x7fULL : (uint64_t)0) << 25) | (uint64_t)((uint64_t)(s_dut_my_scan_d_pos)));
+}
+// ../ice40/sdram_scan.v:47
+void Vsim_top::p416_() {
+  s_dut_scan_busy = ((uint64_t)(s_dut_my_scan_d_valid));
+}
+// ../ice40/sdram_scan.v:48
+void Vsim_top::p417_() {
+  s_dut_scan_found = (((uint64_t)(s_dut_my_scan_hit)) & (uint64_t)(((uint64_t)(s_dut_my_scan_op_r)) == 0x0ULL));
+}
+// ../ice40/sdram_scan.v:50
+void Vsim_top::p418_() {
+  s_dut_my_scan_v = (((uint64_t)(s_dut_my_scan_d)) & ((uint64_t)(s_dut_my_scan_mask_r)));
+}
+// ../ice40/sdram_scan.v:51
+void Vsim_top::p419_() {
+  s_dut_my_scan_vx = (((uint64_t)(((((uint64_t)(s_dut_my_scan_sgn_r)) & (uint64_t)((((uint64_t)(s_dut_my_scan_v)) >> 15) & 1))) ? 0xffffULL : (uint64_t)0) << 16) | (uint64_t)((uint64_t)(s_dut_my_scan_v)));
+}
+// ../ice40/sdram_scan.v:52
+void Vsim_top::p420_() {
+  s_dut_my_scan_match = (uint64_t)(((uint64_t)(s_dut_my_scan_v)) == (((uint64_t)(s_dut_my_scan_key_r)) & ((uint64_t)(s_dut_my_scan_mask_r))));
+}
+// ../ice40/sdram_scan.v:54
+void Vsim_top::p421_() {
+  s_dut_my_scan_flip = (((uint64_t)((uint64_t)(s_dut_my_scan_sgn_r)) << 15) | (uint64_t)0x0ULL);
+}
+// ../ice40/sdram_scan.v:55
+void Vsim_top::p422_() {
+  s_dut_my_scan_less = (uint64_t)((((uint64_t)(s_dut_my_scan_v)) ^ ((uint64_t)(s_dut_my_scan_flip))) < (((uint64_t)((((uint64_t)(s_dut_scan_result)) >> 0) & 0xffffULL)) ^ ((uint64_t)(s_dut_my_scan_flip))));
+}
+// ../ice40/sdram_scan.v:56
+void Vsim_top::p423_() {
+  s_dut_my_scan_more = (uint64_t)((((uint64_t)((((uint64_t)(s_dut_scan_result)) >> 0) & 0xffffULL)) ^ ((uint64_t)(s_dut_my_scan_flip))) < (((uint64_t)(s_dut_my_scan_v)) ^ ((uint64_t)(s_dut_my_scan_flip))));
+}
+// ../ice40/sdram-stm32.v:929
+void Vsim_top::p424_() {
+  s_dut_my_scan_op = ((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0x7ULL));
+}
+// ../ice40/sdram-stm32.v:929
+void Vsim_top::p425_() {
+  s_dut_my_scan_sgn = (uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 3) & 1);
+}
+// ../ice40/sdram-stm32.v:929
+void Vsim_top::p426_() {
+  s_dut_my_scan_stride = ((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 8) & 0xffULL));
+}
+// ../ice40/sdram-stm32.v:929
+void Vsim_top::p427_() {
+  s_dut_my_scan_valid = (((uint64_t)(s_dut_rdr_valid)) & ((uint64_t)(s_dut_rdr_to_scan)));
+}
+// ../ice40/sdram-stm32.v:139
+void Vsim_top::p428_() {
+  s_dut_pll_nrst = 0x1ULL;
+}
+// ../ice40/sdram-stm32.v:199
+void Vsim_top::p429_() {
+  s_dut_fsmc_nbl = (((uint64_t)((uint64_t)(s_dut_sdram_gpio5)) << 1) | (uint64_t)((uint64_t)(s_dut_sdram_gpio4)));
+}
+// ../ice40/sdram-stm32.v:273
+void Vsim_top::p430_() {
+  mem_a = ((uint64_t)(s_dut_sdram_o_addr));
+}
+// ../ice40/sdram-stm32.v:274
+void Vsim_top::p431_() {
+  mem_ba = ((uint64_t)(s_dut_sdram_o_blkaddr));
+}
+// ../ice40/sdram-stm32.v:275
+void Vsim_top::p432_() {
+  mem_cas = ((uint64_t)(s_dut_sdram_casn));
+}
+// ../ice40/sdram-stm32.v:276
+void Vsim_top::p433_() {
+  mem_cke = ((uint64_t)(s_dut_sdram_cke));
+}
+// ../ice40/sdram-stm32.v:277
+void Vsim_top::p434_() {
+  mem_cs = ((uint64_t)(s_dut_sdram_csn));
+}
+// ../ice40/sdram-stm32.v:278
+void Vsim_top::p435_() {
+  s_mem_cs2_unused = ((uint64_t)((0x1ULL) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:279
+void Vsim_top::p436_() {
+  mem_dqm = ((uint64_t)((((uint64_t)(s_dut_sdram_dqm)) >> 0) & 0x3ULL));
+}
+// ../ice40/sdram-stm32.v:280
+void Vsim_top::p437_() {
+  mem_ras = ((uint64_t)(s_dut_sdram_rasn));
+}
+// ../ice40/sdram-stm32.v:281
+void Vsim_top::p438_() {
+  mem_we = ((uint64_t)(s_dut_sdram_wen));
+}
+// ../ice40/sdram-stm32.v:282
+void Vsim_top::p439_() {
+  mem_clk = ((uint64_t)(s_dut_sdram_o_clk));
+}
+// ../ice40/sdram-stm32.v:283
+void Vsim_top::p440_() {
+  s_dut_sdram_i_clk = ((uint64_t)(s_dut_clk));
+}
+// ../ice40/sdram-stm32.v:284
+void Vsim_top::p441_() {
+  s_dut_sdram_rst = (uint64_t)(((uint64_t)(s_dut_st_after_startup)) == 0);
+}
+// ../ice40/sdram-stm32.v:285
+void Vsim_top::p442_() {
+  s_dut_sdram_selfrefresh_req = ((uint64_t)((0x0ULL) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:286
+void Vsim_top::p443_() {
+  s_dut_sdram_loadmod_req = ((uint64_t)((0x0ULL) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:287
+void Vsim_top::p444_() {
+  s_dut_sdram_burststop_req = ((uint64_t)((0x0ULL) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:288
+void Vsim_top::p445_() {
+  s_dut_sdram_disable_active = ((uint64_t)((0x0ULL) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:292
+void Vsim_top::p446_() {
+  s_dut_sdram_disable_precharge = ((uint64_t)((0x1ULL) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:293
+void Vsim_top::p447_() {
+  s_dut_sdram_precharge_req = ((uint64_t)((0x0ULL) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:294
+void Vsim_top::p448_() {
+  s_dut_sdram_powerdown = ((uint64_t)((0x0ULL) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:295
+void Vsim_top::p449_() {
+  s_dut_sdram_disable_autorefresh = ((uint64_t)((0x0ULL) & 0x1ULL));
+}
+// ../ice40/sdram-stm32.v:461
+void Vsim_top::p450_() {
+  s_dut_stream_restart = (((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_stream_adr)));
+}
+// ../ice40/sdram-stm32.v:464
+void Vsim_top::p451_() {
+  s_dut_stream_pop = ((((uint64_t)(s_dut_fsmc_r_taken)) & (uint64_t)(((uint64_t)(s_dut_fsmc_r_adr)) == 0x8ULL)) | ((uint64_t)(s_dut_fsmc_stream_pop)));
+}
+// ../ice40/sdram-stm32.v:467
+void Vsim_top::p452_() {
+  s_dut_sf_push = ((((uint64_t)(s_dut_pf_busy)) & ((uint64_t)(s_dut_sdram_data_valid))) & (uint64_t)(((uint64_t)(s_dut_pf_drop)) == 0));
+}
+// ../ice40/sdram-stm32.v:471
+void Vsim_top::p453_() {
+  s_dut_pf_start = ((((((((((((uint64_t)(s_dut_stream_rwn)) & (uint64_t)(((uint64_t)(s_dut_pf_busy)) == 0)) & (uint64_t)((((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)(s_dut_sf_level))) <= ((uint64_t)(0x100ULL - 0x40ULL) & 0xffffffULL))) & (uint64_t)(((uint64_t)(s_dut_fsmc_do_write)) == 0)) & ((uint64_t)(s_dut_wq_empty))) & ((uint64_t)(s_dut_rq_empty))) & (uint64_t)(((uint64_t)(s_dut_st_finishing_write)) == 0)) & (uint64_t)(((uint64_t)(s_dut_read_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_cp_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_rdr_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_at_pending)) == 0));
+}
+// ../ice40/sdram-stm32.v:521
+void Vsim_top::p454_() {
+  s_dut_fsmc_rd_wait = (((((((uint64_t)(s_dut_win_read)) & (((uint64_t)(s_dut_fsmc_do_read)) | (uint64_t)(((uint64_t)(s_dut_win_ready)) == 0))) | ((uint64_t)(((uint64_t)(s_dut_fsmc_r_adr)) == 0x2ULL) & ((uint64_t)(s_dut_rd_result_pending)))) | (((uint64_t)(((uint64_t)(s_dut_fsmc_r_adr)) == 0x8ULL) & ((uint64_t)(s_dut_stream_rwn))) & (uint64_t)(((uint64_t)(s_dut_sf_ready)) == 0))) | (((uint64_t)(((uint64_t)(s_dut_fsmc_r_adr)) == 0x30ULL) | (uint64_t)(((uint64_t)(s_dut_fsmc_r_adr)) == 0x31ULL)) & ((uint64_t)(s_dut_at_pending)))) | ((uint64_t)(((uint64_t)(s_dut_fsmc_r_adr)) == 0xeULL) & ((uint64_t)(s_dut_fsmc_do_read))));
+}
+// ../ice40/sdram-stm32.v:528
+void Vsim_top::p455_() {
+  s_dut_fsmc_wr_wait = ((((((vl_bit(((uint64_t)(s_dut_fsmc_w_adr)), (int64_t)(((uint64_t)(0x8ULL - 0x1ULL) & 0xffffffffULL)) - 0, 8) | ((uint64_t)(s_dut_decode_data_stream))) | ((uint64_t)(s_dut_decode_data32))) & (((uint64_t)(s_dut_wq_full)) | ((uint64_t)(s_dut_read_busy)))) | (((uint64_t)(s_dut_decode_adr_low)) & (((uint64_t)(s_dut_read_busy)) | ((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 1) & ((uint64_t)(s_dut_wq_full)))))) | (((uint64_t)(s_dut_decode_cp_ctrl)) & ((uint64_t)(s_dut_cp_full)))) | (((uint64_t)(s_dut_decode_at_op)) & ((uint64_t)(s_dut_at_pending))));
+}
+// ../ice40/sdram-stm32.v:583
+void Vsim_top::p456_() {
+  s_dut_bbuf_we = ((((uint64_t)(s_dut_burst_busy)) != 0) ? (((uint64_t)(s_dut_burst_sd_rwn)) & ((uint64_t)(s_dut_sdram_data_valid))) : (((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_burst_data))));
+}
+// ../ice40/sdram-stm32.v:585
+void Vsim_top::p457_() {
+  s_dut_bbuf_w_adr = ((((uint64_t)(s_dut_burst_busy)) != 0) ? ((uint64_t)(s_dut_bbuf_sd_idx)) : ((uint64_t)(s_dut_bbuf_idx)));
+}
+// ../ice40/sdram-stm32.v:586
+void Vsim_top::p458_() {
+  s_dut_bbuf_w_data = ((((uint64_t)(s_dut_burst_busy)) != 0) ? ((uint64_t)(s_dut_sdram_data_out)) : ((uint64_t)(s_dut_fsmc_w_data)));
+}
+// ../ice40/sdram-stm32.v:587
+void Vsim_top::p459_() {
+  s_dut_bbuf_r_adr = ((((uint64_t)(s_dut_burst_busy)) != 0) ? ((uint64_t)(s_dut_bbuf_sd_idx)) : ((uint64_t)(s_dut_bbuf_idx)));
+}
+// ../ice40/sdram-stm32.v:610
+void Vsim_top::p460_() {
+  s_dut_rd_go = (((((((uint64_t)(s_dut_st_pending_read)) & ((uint64_t)(s_dut_wq_empty))) & (uint64_t)(((uint64_t)(s_dut_pf_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_cp_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_rdr_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_at_pending)) == 0));
+}
+// ../ice40/sdram-stm32.v:612
+void Vsim_top::p461_() {
+  s_dut_rd_done = ((((uint64_t)(s_dut_st_lookup)) & ((uint64_t)(s_dut_cache_hit))) | ((((uint64_t)(s_dut_st_doing_read)) & ((uint64_t)(s_dut_sdram_data_valid))) & (uint64_t)(((uint64_t)(s_dut_fill_cnt)) == ((uint64_t)((((uint64_t)(s_dut_sdram_i_addr)) >> 0) & 0xfULL)))));
+}
+// ../ice40/sdram-stm32.v:615
+void Vsim_top::p462_() {
+  s_dut_rd_data = ((((uint64_t)(s_dut_st_lookup)) != 0) ? ((uint64_t)(s_dut_cache_q)) : ((uint64_t)(s_dut_sdram_data_out)));
+}
+// ../ice40/sdram-stm32.v:661
+void Vsim_top::p463_() {
+  s_dut_cmd_active = ((((uint64_t)(((uint64_t)(s_dut_sdram_csn)) == 0) & (uint64_t)(((uint64_t)(s_dut_sdram_rasn)) == 0)) & ((uint64_t)(s_dut_sdram_casn))) & ((uint64_t)(s_dut_sdram_wen)));
+}
+// ../ice40/sdram-stm32.v:662
+void Vsim_top::p464_() {
+  s_dut_cmd_read = ((((uint64_t)(((uint64_t)(s_dut_sdram_csn)) == 0) & ((uint64_t)(s_dut_sdram_rasn))) & (uint64_t)(((uint64_t)(s_dut_sdram_casn)) == 0)) & ((uint64_t)(s_dut_sdram_wen)));
+}
+// ../ice40/sdram-stm32.v:663
+void Vsim_top::p465_() {
+  s_dut_cmd_write = ((((uint64_t)(((uint64_t)(s_dut_sdram_csn)) == 0) & ((uint64_t)(s_dut_sdram_rasn))) & (uint64_t)(((uint64_t)(s_dut_sdram_casn)) == 0)) & (uint64_t)(((uint64_t)(s_dut_sdram_wen)) == 0));
+}
+// ../ice40/sdram-stm32.v:664
+void Vsim_top::p466_() {
+  s_dut_cmd_precharge = ((((uint64_t)(((uint64_t)(s_dut_sdram_csn)) == 0) & (uint64_t)(((uint64_t)(s_dut_sdram_rasn)) == 0)) & ((uint64_t)(s_dut_sdram_casn))) & (uint64_t)(((uint64_t)(s_dut_sdram_wen)) == 0));
+}
+// ../ice40/sdram-stm32.v:667
+void Vsim_top::p467_() {
+  s_dut_cmd_refresh = (((((uint64_t)(((uint64_t)(s_dut_sdram_csn)) == 0) & (uint64_t)(((uint64_t)(s_dut_sdram_rasn)) == 0)) & (uint64_t)(((uint64_t)(s_dut_sdram_casn)) == 0)) & ((uint64_t)(s_dut_sdram_wen))) & ((uint64_t)(s_dut_sdram_cke)));
+}
+// ../ice40/sdram-stm32.v:669
+void Vsim_top::p468_() {
+  s_dut_sdram_wanted = ((((((((((uint64_t)(((uint64_t)(s_dut_wq_empty)) == 0) | (uint64_t)(((uint64_t)(s_dut_rq_empty)) == 0)) | ((uint64_t)(s_dut_st_pending_read))) | ((uint64_t)(s_dut_st_pending_fill))) | ((uint64_t)(s_dut_burst_busy))) | ((uint64_t)(s_dut_pf_busy))) | ((uint64_t)(s_dut_bist_busy))) | ((uint64_t)(s_dut_cp_pending))) | ((uint64_t)(s_dut_at_pending))) | ((uint64_t)(s_dut_rdr_pending)));
+}
+// ../ice40/sdram-stm32.v:674
+void Vsim_top::p469_() {
+  { int64_t t76 = (int64_t)(vl_s(0x0ULL, 32)) - 0; if (t76 >= 0 && t76 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t76)) | (((uint64_t)(((uint64_t)(s_dut_cmd_active))) & 0x1ULL) << t76)); }
+}
+// ../ice40/sdram-stm32.v:675
+void Vsim_top::p470_() {
+  { int64_t t77 = (int64_t)(vl_s(0x1ULL, 32)) - 0; if (t77 >= 0 && t77 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t77)) | (((uint64_t)(((uint64_t)(s_dut_cmd_read))) & 0x1ULL) << t77)); }
+}
+// ../ice40/sdram-stm32.v:676
+void Vsim_top::p471_() {
+  { int64_t t78 = (int64_t)(vl_s(0x2ULL, 32)) - 0; if (t78 >= 0 && t78 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t78)) | (((uint64_t)(((uint64_t)(s_dut_cmd_write))) & 0x1ULL) << t78)); }
+}
+// ../ice40/sdram-stm32.v:677
+void Vsim_top::p472_() {
+  { int64_t t79 = (int64_t)(vl_s(0x3ULL, 32)) - 0; if (t79 >= 0 && t79 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t79)) | (((uint64_t)(((uint64_t)(s_dut_cmd_precharge))) & 0x1ULL) << t79)); }
+}
+// ../ice40/sdram-stm32.v:678
+void Vsim_top::p473_() {
+  { int64_t t80 = (int64_t)(vl_s(0x4ULL, 32)) - 0; if (t80 >= 0 && t80 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t80)) | (((uint64_t)(((uint64_t)(s_dut_cmd_refresh))) & 0x1ULL) << t80)); }
+}
+// ../ice40/sdram-stm32.v:679
+void Vsim_top::p474_() {
+  { int64_t t81 = (int64_t)(vl_s(0x5ULL, 32)) - 0; if (t81 >= 0 && t81 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t81)) | (((uint64_t)(((uint64_t)(s_dut_sdram_idle))) & 0x1ULL) << t81)); }
+}
+// ../ice40/sdram-stm32.v:680
+void Vsim_top::p475_() {
+  { int64_t t82 = (int64_t)(vl_s(0x6ULL, 32)) - 0; if (t82 >= 0 && t82 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t82)) | (((uint64_t)((((uint64_t)(s_dut_sdram_init_done)) & ((uint64_t)(s_dut_sdram_busy)))) & 0x1ULL) << t82)); }
+}
+// ../ice40/sdram-stm32.v:681
+void Vsim_top::p476_() {
+  { int64_t t83 = (int64_t)(vl_s(0x7ULL, 32)) - 0; if (t83 >= 0 && t83 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t83)) | (((uint64_t)((((uint64_t)(s_dut_in_refresh)) & ((uint64_t)(s_dut_sdram_wanted)))) & 0x1ULL) << t83)); }
+}
+// ../ice40/sdram-stm32.v:682
+void Vsim_top::p477_() {
+  { int64_t t84 = (int64_t)(vl_s(0x8ULL, 32)) - 0; if (t84 >= 0 && t84 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t84)) | (((uint64_t)(((uint64_t)(s_dut_fsmc_r_taken))) & 0x1ULL) << t84)); }
+}
+// ../ice40/sdram-stm32.v:683
+void Vsim_top::p478_() {
+  { int64_t t85 = (int64_t)(vl_s(0x9ULL, 32)) - 0; if (t85 >= 0 && t85 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t85)) | (((uint64_t)(((uint64_t)(s_dut_fsmc_do_write))) & 0x1ULL) << t85)); }
+}
+// ../ice40/sdram-stm32.v:684
+void Vsim_top::p479_() {
+  { int64_t t86 = (int64_t)(vl_s(0xaULL, 32)) - 0; if (t86 >= 0 && t86 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t86)) | (((uint64_t)((uint64_t)(((uint64_t)(s_dut_sdram_power_state)) == 0x1ULL)) & 0x1ULL) << t86)); }
+}
+// ../ice40/sdram-stm32.v:685
+void Vsim_top::p480_() {
+  { int64_t t87 = (int64_t)(vl_s(0xbULL, 32)) - 0; if (t87 >= 0 && t87 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t87)) | (((uint64_t)((uint64_t)((((uint64_t)(s_dut_sdram_power_state)) >> 1) & 1)) & 0x1ULL) << t87)); }
+}
+// ../ice40/sdram-stm32.v:686
+void Vsim_top::p481_() {
+  { int64_t t88 = (int64_t)(vl_s(0xcULL, 32)) - 0; if (t88 >= 0 && t88 <= 12) s_dut_perf_ev = (uint16_t)((((uint64_t)(s_dut_perf_ev)) & ~(0x1ULL << t88)) | (((uint64_t)(((uint64_t)(s_dut_sdram_wake))) & 0x1ULL) << t88)); }
+}
+// ../ice40/sdram-stm32.v:687
+void Vsim_top::p482_() {
+  s_dut_perf_clr = ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_perf_sel))) & (uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 15) & 1));
+}
+// ../ice40/sdram-stm32.v:761
+void Vsim_top::p483_() {
+  s_dut_bist_start = ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_bist_ctrl))) & (uint64_t)(((uint64_t)(s_dut_cur_status_busy)) == 0));
+}
+// ../ice40/sdram-stm32.v:810
+void Vsim_top::p484_() {
+  s_dut_cp_push = ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_cp_ctrl))) & (uint64_t)(((uint64_t)(s_dut_cp_full)) == 0));
+}
+// ../ice40/sdram-stm32.v:813
+void Vsim_top::p485_() {
+  s_dut_bg_go = ((((((((uint64_t)(((uint64_t)(s_dut_fsmc_do_write)) == 0) & ((uint64_t)(s_dut_wq_empty))) & ((uint64_t)(s_dut_rq_empty))) & (uint64_t)(((uint64_t)(s_dut_st_finishing_write)) == 0)) & (uint64_t)(((uint64_t)(s_dut_read_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_pf_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_pf_start)) == 0)) & (uint64_t)(((uint64_t)(s_dut_at_pending)) == 0));
+}
+// ../ice40/sdram-stm32.v:816
+void Vsim_top::p486_() {
+  s_dut_cp_go = ((((uint64_t)(s_dut_bg_go)) & (uint64_t)(((uint64_t)(s_dut_rdr_busy)) == 0)) & ((uint64_t)(((uint64_t)(s_dut_rdr_pending)) == 0) | (uint64_t)(((uint64_t)(s_dut_bg_turn)) == 0)));
+}
+// ../ice40/sdram-stm32.v:868
+void Vsim_top::p487_() {
+  s_dut_at_go = (((((((((((((uint64_t)(s_dut_wq_empty)) & ((uint64_t)(s_dut_rq_empty))) & (uint64_t)(((uint64_t)(s_dut_st_finishing_write)) == 0)) & (uint64_t)(((uint64_t)(s_dut_st_lookup)) == 0)) & (uint64_t)(((uint64_t)(s_dut_st_pending_fill)) == 0)) & (uint64_t)(((uint64_t)(s_dut_st_doing_read)) == 0)) & (uint64_t)(((uint64_t)(s_dut_burst_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_bist_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_pf_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_pf_start)) == 0)) & (uint64_t)(((uint64_t)(s_dut_cp_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_rdr_busy)) == 0));
+}
+// ../ice40/sdram-stm32.v:936
+void Vsim_top::p488_() {
+  s_dut_nm_busy = ((((uint64_t)(s_dut_rdr_pending)) | ((uint64_t)(s_dut_crc_busy))) | ((uint64_t)(s_dut_scan_busy)));
+}
+// ../ice40/sdram-stm32.v:937
+void Vsim_top::p489_() {
+  s_dut_crc_start = ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_crc_ctrl))) & (uint64_t)(((uint64_t)(s_dut_nm_busy)) == 0));
+}
+// ../ice40/sdram-stm32.v:938
+void Vsim_top::p490_() {
+  s_dut_scan_start = ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_scan_ctrl))) & (uint64_t)(((uint64_t)(s_dut_nm_busy)) == 0));
+}
+// ../ice40/sdram-stm32.v:939
+void Vsim_top::p491_() {
+  s_dut_rdr_start = (((uint64_t)(s_dut_crc_start)) | ((uint64_t)(s_dut_scan_start)));
+}
+// ../ice40/sdram-stm32.v:940
+void Vsim_top::p492_() {
+  s_dut_rdr_go = ((((uint64_t)(s_dut_bg_go)) & (uint64_t)(((uint64_t)(s_dut_cp_busy)) == 0)) & ((uint64_t)(((uint64_t)(s_dut_cp_pending)) == 0) | ((uint64_t)(s_dut_bg_turn))));
+}
+// ../ice40/sdram-stm32.v:958
+void Vsim_top::p493_() {
+  s_dut_sdram_req_addr = ((((uint64_t)(s_dut_burst_busy)) != 0) ? (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_burst_sd_adr))) : ((((uint64_t)(s_dut_bist_busy)) != 0) ? (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_bist_sd_adr))) : ((((uint64_t)(s_dut_at_busy)) != 0) ? (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_at_sd_adr))) : ((((uint64_t)(s_dut_cp_busy)) != 0) ? (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_cp_sd_adr))) : ((((uint64_t)(s_dut_rdr_busy)) != 0) ? (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_rdr_sd_adr))) : ((((uint64_t)(s_dut_pf_busy)) != 0) ? (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_pf_sd_adr))) : ((uint64_t)(s_dut_rq_adr))))))));
+}
+// ../ice40/sdram-stm32.v:965
+void Vsim_top::p494_() {
+  s_dut_sdram_req_rwn = ((((uint64_t)(s_dut_burst_busy)) != 0) ? ((uint64_t)(s_dut_burst_sd_rwn)) : ((((uint64_t)(s_dut_bist_busy)) != 0) ? ((uint64_t)(s_dut_bist_sd_rwn)) : ((((uint64_t)(s_dut_at_busy)) != 0) ? ((uint64_t)(s_dut_at_sd_rwn)) : ((((uint64_t)(s_dut_cp_busy)) != 0) ? ((uint64_t)(s_dut_cp_sd_rwn)) : ((((uint64_t)(s_dut_rdr_busy)) != 0) ? ((uint64_t)(s_dut_rdr_sd_rwn)) : ((((uint64_t)(s_dut_pf_busy)) != 0) ? ((uint64_t)(s_dut_pf_sd_rwn)) : ((uint64_t)(s_dut_rq_rwn))))))));
+}
+// ../ice40/sdram-stm32.v:971
+void Vsim_top::p495_() {
+  s_dut_sdram_req_adv = ((((uint64_t)(s_dut_burst_busy)) != 0) ? ((uint64_t)(s_dut_burst_sd_adv)) : ((((uint64_t)(s_dut_bist_busy)) != 0) ? ((uint64_t)(s_dut_bist_sd_adv)) : ((((uint64_t)(s_dut_at_busy)) != 0) ? ((uint64_t)(s_dut_at_sd_adv)) : ((((uint64_t)(s_dut_cp_busy)) != 0) ? ((uint64_t)(s_dut_cp_sd_adv)) : ((((uint64_t)(s_dut_rdr_busy)) != 0) ? ((uint64_t)(s_dut_rdr_sd_adv)) : ((((uint64_t)(s_dut_pf_busy)) != 0) ? ((uint64_t)(s_dut_pf_sd_adv)) : ((uint64_t)(s_dut_sdram_adv))))))));
+}
+// ../ice40/sdram-stm32.v:977
+void Vsim_top::p496_() {
+  s_dut_sdram_req_len = ((((uint64_t)(s_dut_burst_busy)) != 0) ? ((uint64_t)(s_dut_burst_sd_len)) : ((((uint64_t)(s_dut_bist_busy)) != 0) ? ((uint64_t)(s_dut_bist_sd_len)) : ((((uint64_t)(s_dut_at_busy)) != 0) ? ((uint64_t)(s_dut_at_sd_len)) : ((((uint64_t)(s_dut_cp_busy)) != 0) ? ((uint64_t)(s_dut_cp_sd_len)) : ((((uint64_t)(s_dut_rdr_busy)) != 0) ? ((uint64_t)(s_dut_rdr_sd_len)) : ((((uint64_t)(s_dut_pf_busy)) != 0) ? ((uint64_t)(s_dut_pf_sd_len)) : ((((uint64_t)(s_dut_rq_rwn)) != 0) ? 0x10ULL : 0x1ULL)))))));
+}
+// ../ice40/sdram-stm32.v:983
+void Vsim_top::p497_() {
+  s_dut_sdram_req_data = ((((uint64_t)(s_dut_burst_busy)) != 0) ? ((uint64_t)(s_dut_bbuf_q)) : ((((uint64_t)(s_dut_bist_busy)) != 0) ? ((uint64_t)(s_dut_bist_wdata)) : ((((uint64_t)(s_dut_at_busy)) != 0) ? ((uint64_t)(s_dut_at_wdata)) : ((((uint64_t)(s_dut_cp_busy)) != 0) ? ((uint64_t)(s_dut_cp_wdata)) : ((uint64_t)(s_dut_rq_data))))));
+}
+// ../ice40/sdram-stm32.v:987
+void Vsim_top::p498_() {
+  s_dut_sdram_req_dqm = (((((((uint64_t)(s_dut_burst_busy)) | ((uint64_t)(s_dut_bist_busy))) | ((uint64_t)(s_dut_at_busy))) | ((uint64_t)(s_dut_cp_busy))) != 0) ? 0x0ULL : ((uint64_t)(s_dut_rq_nbl)));
+}
+// ../ice40/sdram-stm32.v:996
+void Vsim_top::p499_() {
+  s_dut_sdram_next_addr = ((((uint64_t)(s_dut_burst_busy)) != 0) ? (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_burst_next_adr))) : ((((uint64_t)(s_dut_bist_busy)) != 0) ? (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_bist_next_adr))) : ((((uint64_t)(s_dut_at_busy)) != 0) ? (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_at_next_adr))) : ((((uint64_t)(s_dut_cp_busy)) != 0) ? (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_cp_next_adr))) : ((((uint64_t)(s_dut_rdr_busy)) != 0) ? (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_rdr_next_adr))) : ((((uint64_t)(s_dut_pf_busy)) != 0) ? (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_pf_next_adr))) : (((uint64_t)(((uint64_t)(s_dut_rq_empty)) == 0) != 0) ? ((uint64_t)(s_dut_rq_adr)) : (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_wq_adr))))))))));
+}
+// ../ice40/sdram-stm32.v:1003
+void Vsim_top::p500_() {
+  s_dut_sdram_next_valid = (((((((((uint64_t)(s_dut_burst_busy)) | ((uint64_t)(s_dut_bist_busy))) | ((uint64_t)(s_dut_at_busy))) | ((uint64_t)(s_dut_cp_busy))) | ((uint64_t)(s_dut_rdr_busy))) | ((uint64_t)(s_dut_pf_busy))) | (uint64_t)(((uint64_t)(s_dut_rq_empty)) == 0)) | ((uint64_t)(((uint64_t)(s_dut_wq_empty)) == 0) & (uint64_t)(((uint64_t)(s_dut_wq_fresh)) == 0)));
+}
+// ../ice40/sdram-stm32.v:1008
+void Vsim_top::p501_() {
+  nwait = ((uint64_t)(s_dut_fsmc_nwait));
+}
+// ../ice40/sdram-stm32.v:1010
+void Vsim_top::p502_() {
+  cp_irq = ((uint64_t)(s_dut_cp_irq));
+}
+// ../ice40/sdram-stm32.v:1020
+void Vsim_top::p503_() {
+  if (((uint64_t)(s_dut_win_read)) != 0) {
+    s_dut_fsmc_r_data = ((uint64_t)(s_dut_win_rdata));
+  } else {
+    { uint64_t t89 = ((uint64_t)(s_dut_fsmc_r_adr));
+      if (t89 == 0x0ULL || t89 == 0x14ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 0) & 0x7fffULL)) << 1) | (uint64_t)((uint64_t)(s_dut_cur_status_busy)));
+      } else if (t89 == 0x1ULL || t89 == 0x15ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)0x0ULL << 12) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 15) & 0xfffULL)));
+      } else if (t89 == 0x2ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_cur_value));
+      } else if (t89 == 0x3ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)(s_dut_burst_len)));
+      } else if (t89 == 0x4ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_burst_count)) >> 0) & 0x7fffULL)) << 1) | (uint64_t)((uint64_t)(s_dut_burst_busy)));
+      } else if (t89 == 0x5ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_bbuf_q));
+      } else if (t89 == 0x6ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)((uint64_t)(s_dut_wq_full)) << 15) | ((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)(s_dut_wq_level)));
+      } else if (t89 == 0x7ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_stream_adr)) >> 0) & 0x7fffULL)) << 1) | (uint64_t)((uint64_t)(s_dut_stream_rwn)));
+      } else if (t89 == 0x8ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_sf_q));
+      } else if (t89 == 0x9ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)(s_dut_sf_level)));
+      } else if (t89 == 0xaULL) {
+        s_dut_fsmc_r_data = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_win_base)) >> 0) & 0xffULL)) << 8) | (uint64_t)0x0ULL);
+      } else if (t89 == 0xbULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_cache_hits));
+      } else if (t89 == 0xcULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_cache_misses));
+      } else if (t89 == 0xdULL) {
+        s_dut_fsmc_r_data = (((uint64_t)0x0ULL << 4) | (uint64_t)((uint64_t)(s_dut_perf_sel)));
+      } else if (t89 == 0xeULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_perf_rd)) >> 0) & 0xffffULL));
+      } else if (t89 == 0xfULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_perf_hi));
+      } else if (t89 == 0x10ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_pwr_pd_idle));
+      } else if (t89 == 0x11ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_pwr_sr_idle));
+      } else if (t89 == 0x12ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_pwr_wake_last));
+      } else if (t89 == 0x18ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)((uint64_t)(s_dut_bist_busy)) << 15) | ((uint64_t)0x0ULL << 12) | ((uint64_t)((uint64_t)(s_dut_bist_nfail)) << 8) | (uint64_t)0x0ULL);
+      } else if (t89 == 0x19ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)0x0ULL << 3) | (uint64_t)((uint64_t)(s_dut_bist_fail_sel)));
+      } else if (t89 == 0x1aULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_bist_len)) >> 0) & 0xffffULL));
+      } else if (t89 == 0x1bULL) {
+        s_dut_fsmc_r_data = (((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_bist_len)) >> 16) & 0x1ffULL)));
+      } else if (t89 == 0x1cULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_bist_errors)) >> 0) & 0xffffULL));
+      } else if (t89 == 0x1dULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_bist_errors)) >> 16) & 0xffffULL));
+      } else if (t89 == 0x1eULL) {
+        s_dut_fsmc_r_data = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_bist_fail_adr)) >> 0) & 0x7fffULL)) << 1) | (uint64_t)0x0ULL);
+      } else if (t89 == 0x1fULL) {
+        s_dut_fsmc_r_data = (((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_bist_fail_adr)) >> 15) & 0x1ffULL)));
+      } else if (t89 == 0x20ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_bist_fail_mask));
+      } else if (t89 == 0x21ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_cp_fill_val));
+      } else if (t89 == 0x22ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_cp_src)) >> 0) & 0x7fffULL)) << 1) | (uint64_t)0x0ULL);
+      } else if (t89 == 0x23ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_cp_src)) >> 15) & 0x1ffULL)));
+      } else if (t89 == 0x24ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_cp_dst)) >> 0) & 0x7fffULL)) << 1) | (uint64_t)0x0ULL);
+      } else if (t89 == 0x25ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_cp_dst)) >> 15) & 0x1ffULL)));
+      } else if (t89 == 0x26ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_cp_len)) >> 0) & 0xffffULL));
+      } else if (t89 == 0x27ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_cp_len)) >> 16) & 0x1ffULL)));
+      } else if (t89 == 0x29ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)((uint64_t)(s_dut_cp_pending)) << 15) | ((uint64_t)((uint64_t)(s_dut_cp_irq)) << 14) | ((uint64_t)((uint64_t)(s_dut_cp_full)) << 13) | ((uint64_t)((uint64_t)(s_dut_cp_level)) << 8) | (uint64_t)((uint64_t)(s_dut_cp_done)));
+      } else if (t89 == 0x2aULL) {
+        s_dut_fsmc_r_data = (((uint64_t)((uint64_t)(s_dut_at_pending)) << 15) | (uint64_t)0x0ULL);
+      } else if (t89 == 0x2cULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_at_arg)) >> 0) & 0xffffULL));
+      } else if (t89 == 0x2dULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_at_arg)) >> 16) & 0xffffULL));
+      } else if (t89 == 0x2eULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_at_cmp)) >> 0) & 0xffffULL));
+      } else if (t89 == 0x2fULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_at_cmp)) >> 16) & 0xffffULL));
+      } else if (t89 == 0x30ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_at_result)) >> 0) & 0xffffULL));
+      } else if (t89 == 0x31ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_at_result)) >> 16) & 0xffffULL));
+      } else if (t89 == 0x32ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_range_len)) >> 0) & 0xffffULL));
+      } else if (t89 == 0x33ULL) {
+        s_dut_fsmc_r_data = (((uint64_t)0x0ULL << 9) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_range_len)) >> 16) & 0x1ffULL)));
+      } else if (t89 == 0x34ULL || t89 == 0x3aULL) {
+        s_dut_fsmc_r_data = (((uint64_t)((uint64_t)(s_dut_nm_busy)) << 15) | (uint64_t)0x0ULL);
+      } else if (t89 == 0x36ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_crc_q)) >> 0) & 0xffffULL));
+      } else if (t89 == 0x37ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_crc_q)) >> 16) & 0xffffULL));
+      } else if (t89 == 0x38ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_crc_sum)) >> 0) & 0xffffULL));
+      } else if (t89 == 0x39ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_crc_sum)) >> 16) & 0xffffULL));
+      } else if (t89 == 0x3bULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_scan_key));
+      } else if (t89 == 0x3cULL) {
+        s_dut_fsmc_r_data = ((uint64_t)(s_dut_scan_mask));
+      } else if (t89 == 0x3eULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_scan_result)) >> 0) & 0xffffULL));
+      } else if (t89 == 0x3fULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_scan_result)) >> 16) & 0xffffULL));
+      } else if (t89 == 0x40ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_scan_index)) >> 0) & 0xffffULL));
+      } else if (t89 == 0x41ULL) {
+        s_dut_fsmc_r_data = ((uint64_t)((((uint64_t)(s_dut_scan_index)) >> 16) & 0xffffULL));
+      } else {
+        s_dut_fsmc_r_data = 0x0ULL;
+      }
+    }
+  }
+}
+// ../ice40/sdram-stm32.v:1144
+void Vsim_top::p504_() {
+  s_dut_cur_status_busy = (((((((((((((uint64_t)(((uint64_t)(s_dut_wq_empty)) == 0) | (uint64_t)(((uint64_t)(s_dut_rq_empty)) == 0)) | ((uint64_t)(s_dut_st_finishing_write))) | ((uint64_t)(s_dut_st_pending_read))) | ((uint64_t)(s_dut_st_lookup))) | ((uint64_t)(s_dut_st_pending_fill))) | ((uint64_t)(s_dut_st_doing_read))) | ((uint64_t)(s_dut_burst_busy))) | ((uint64_t)(s_dut_pf_busy))) | ((uint64_t)(s_dut_bist_busy))) | ((uint64_t)(s_dut_cp_pending))) | ((uint64_t)(s_dut_at_pending))) | ((uint64_t)(s_dut_rdr_pending)));
+}
+// ../ice40/sdram-stm32.v:1148
+void Vsim_top::p505_() {
+  s_dut_read_busy = (((((((uint64_t)(s_dut_st_pending_read)) | ((uint64_t)(s_dut_st_lookup))) | ((uint64_t)(s_dut_st_pending_fill))) | ((uint64_t)(s_dut_st_doing_read))) | ((uint64_t)(s_dut_burst_busy))) | ((uint64_t)(s_dut_bist_busy)));
+}
+// ../ice40/sdram-stm32.v:1152
+void Vsim_top::p506_() {
+  s_dut_decode_adr_low = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x0ULL);
+}
+// ../ice40/sdram-stm32.v:1153
+void Vsim_top::p507_() {
+  s_dut_decode_adr_high = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x1ULL);
+}
+// ../ice40/sdram-stm32.v:1154
+void Vsim_top::p508_() {
+  s_dut_decode_data = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x2ULL);
+}
+// ../ice40/sdram-stm32.v:1155
+void Vsim_top::p509_() {
+  s_dut_decode_burst_len = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x3ULL);
+}
+// ../ice40/sdram-stm32.v:1156
+void Vsim_top::p510_() {
+  s_dut_decode_burst_status = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x4ULL);
+}
+// ../ice40/sdram-stm32.v:1157
+void Vsim_top::p511_() {
+  s_dut_decode_burst_data = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x5ULL);
+}
+// ../ice40/sdram-stm32.v:1158
+void Vsim_top::p512_() {
+  s_dut_decode_stream_adr = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x7ULL);
+}
+// ../ice40/sdram-stm32.v:1159
+void Vsim_top::p513_() {
+  s_dut_decode_data_stream = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x8ULL);
+}
+// ../ice40/sdram-stm32.v:1160
+void Vsim_top::p514_() {
+  s_dut_decode_win_base = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0xaULL);
+}
+// ../ice40/sdram-stm32.v:1161
+void Vsim_top::p515_() {
+  s_dut_decode_cache_hits = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0xbULL);
+}
+// ../ice40/sdram-stm32.v:1162
+void Vsim_top::p516_() {
+  s_dut_decode_cache_misses = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0xcULL);
+}
+// ../ice40/sdram-stm32.v:1163
+void Vsim_top::p517_() {
+  s_dut_decode_perf_sel = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0xdULL);
+}
+// ../ice40/sdram-stm32.v:1164
+void Vsim_top::p518_() {
+  s_dut_decode_pwr_pd_idle = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x10ULL);
+}
+// ../ice40/sdram-stm32.v:1165
+void Vsim_top::p519_() {
+  s_dut_decode_pwr_sr_idle = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x11ULL);
+}
+// ../ice40/sdram-stm32.v:1166
+void Vsim_top::p520_() {
+  s_dut_decode_window_w = vl_bit(((uint64_t)(s_dut_fsmc_w_adr)), (int64_t)(((uint64_t)(0x8ULL - 0x1ULL) & 0xffffffffULL)) - 0, 8);
+}
+// ../ice40/sdram-stm32.v:1167
+void Vsim_top::p521_() {
+  s_dut_decode_adr32_lo = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x14ULL);
+}
+// ../ice40/sdram-stm32.v:1168
+void Vsim_top::p522_() {
+  s_dut_decode_adr32_hi = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x15ULL);
+}
+// ../ice40/sdram-stm32.v:1169
+void Vsim_top::p523_() {
+  s_dut_decode_data32 = ((uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x16ULL) | (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x17ULL));
+}
+// ../ice40/sdram-stm32.v:1171
+void Vsim_top::p524_() {
+  s_dut_read_data32 = ((uint64_t)(((uint64_t)(s_dut_fsmc_r_adr)) == 0x16ULL) | (uint64_t)(((uint64_t)(s_dut_fsmc_r_adr)) == 0x17ULL));
+}
+// ../ice40/sdram-stm32.v:1173
+void Vsim_top::p525_() {
+  s_dut_win_read = (vl_bit(((uint64_t)(s_dut_fsmc_r_adr)), (int64_t)(((uint64_t)(0x8ULL - 0x1ULL) & 0xffffffffULL)) - 0, 8) | ((uint64_t)(s_dut_read_data32)));
+}
+// ../ice40/sdram-stm32.v:1174
+void Vsim_top::p526_() {
+  s_dut_decode_bist_ctrl = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x18ULL);
+}
+// ../ice40/sdram-stm32.v:1175
+void Vsim_top::p527_() {
+  s_dut_decode_bist_fail_sel = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x19ULL);
+}
+// ../ice40/sdram-stm32.v:1176
+void Vsim_top::p528_() {
+  s_dut_decode_bist_len_lo = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x1aULL);
+}
+// ../ice40/sdram-stm32.v:1177
+void Vsim_top::p529_() {
+  s_dut_decode_bist_len_hi = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x1bULL);
+}
+// ../ice40/sdram-stm32.v:1178
+void Vsim_top::p530_() {
+  s_dut_decode_cp_fill = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x21ULL);
+}
+// ../ice40/sdram-stm32.v:1179
+void Vsim_top::p531_() {
+  s_dut_decode_cp_src_lo = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x22ULL);
+}
+// ../ice40/sdram-stm32.v:1180
+void Vsim_top::p532_() {
+  s_dut_decode_cp_src_hi = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x23ULL);
+}
+// ../ice40/sdram-stm32.v:1181
+void Vsim_top::p533_() {
+  s_dut_decode_cp_dst_lo = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x24ULL);
+}
+// ../ice40/sdram-stm32.v:1182
+void Vsim_top::p534_() {
+  s_dut_decode_cp_dst_hi = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x25ULL);
+}
+// ../ice40/sdram-stm32.v:1183
+void Vsim_top::p535_() {
+  s_dut_decode_cp_len_lo = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x26ULL);
+}
+// ../ice40/sdram-stm32.v:1184
+void Vsim_top::p536_() {
+  s_dut_decode_cp_len_hi = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x27ULL);
+}
+// ../ice40/sdram-stm32.v:1185
+void Vsim_top::p537_() {
+  s_dut_decode_cp_ctrl = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x28ULL);
+}
+// ../ice40/sdram-stm32.v:1186
+void Vsim_top::p538_() {
+  s_dut_decode_cp_status = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x29ULL);
+}
+// ../ice40/sdram-stm32.v:1187
+void Vsim_top::p539_() {
+  s_dut_decode_at_op = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x2aULL);
+}
+// ../ice40/sdram-stm32.v:1188
+void Vsim_top::p540_() {
+  s_dut_decode_at_arg_lo = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x2cULL);
+}
+// ../ice40/sdram-stm32.v:1189
+void Vsim_top::p541_() {
+  s_dut_decode_at_arg_hi = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x2dULL);
+}
+// ../ice40/sdram-stm32.v:1190
+void Vsim_top::p542_() {
+  s_dut_decode_at_cmp_lo = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x2eULL);
+}
+// ../ice40/sdram-stm32.v:1191
+void Vsim_top::p543_() {
+  s_dut_decode_at_cmp_hi = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x2fULL);
+}
+// ../ice40/sdram-stm32.v:1192
+void Vsim_top::p544_() {
+  s_dut_decode_range_len_lo = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x32ULL);
+}
+// ../ice40/sdram-stm32.v:1193
+void Vsim_top::p545_() {
+  s_dut_decode_range_len_hi = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x33ULL);
+}
+// ../ice40/sdram-stm32.v:1194
+void Vsim_top::p546_() {
+  s_dut_decode_crc_ctrl = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x34ULL);
+}
+// ../ice40/sdram-stm32.v:1195
+void Vsim_top::p547_() {
+  s_dut_decode_scan_ctrl = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x3aULL);
+}
+// ../ice40/sdram-stm32.v:1196
+void Vsim_top::p548_() {
+  s_dut_decode_scan_key = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x3bULL);
+}
+// ../ice40/sdram-stm32.v:1197
+void Vsim_top::p549_() {
+  s_dut_decode_scan_mask = (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x3cULL);
+}
+// ../ice40/sdram-stm32.v:1202
+void Vsim_top::p550_() {
+  s_dut_burst_start = ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_burst_status))) & (uint64_t)(((uint64_t)(s_dut_cur_status_busy)) == 0));
+}
+// ../ice40/sdram-stm32.v:1268
+void Vsim_top::p551_() {
+  s_dut_sdram_idle = (((uint64_t)(s_dut_sdram_init_done)) & (uint64_t)(((uint64_t)(s_dut_sdram_busy)) == 0));
+}
+// ../ice40/sdram-stm32.v:1273
+void Vsim_top::p552_() {
+  s_dut_sdram_ready = (((uint64_t)(s_dut_sdram_init_done)) & ((uint64_t)(((uint64_t)(s_dut_sdram_busy)) == 0) | ((uint64_t)(s_dut_sdram_pipe_ready))));
+}
+// ../ice40/sdram-stm32.v:1284
+void Vsim_top::p553_() {
+  s_dut_rq_pop = (((uint64_t)(s_dut_sdram_adv)) & ((uint64_t)(s_dut_sdram_ack)));
+}
+// ../ice40/sdram-stm32.v:1285
+void Vsim_top::p554_() {
+  s_dut_rq_more = ((uint64_t)(((uint64_t)(s_dut_rq_level)) > 0x1ULL) | ((uint64_t)(s_dut_rq_push)));
+}
+// ../ice40/sdram-stm32.v:1299
+void Vsim_top::p555_() {
+  s_dut_wq_push = (((((uint64_t)(s_dut_fsmc_do_write)) & ((((((uint64_t)(s_dut_decode_adr_low)) & (uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 1)) | ((uint64_t)(s_dut_decode_data_stream))) | ((uint64_t)(s_dut_decode_window_w))) | ((uint64_t)(s_dut_decode_data32)))) & (uint64_t)(((uint64_t)(s_dut_wq_full)) == 0)) & (uint64_t)(((uint64_t)(s_dut_read_busy)) == 0));
+}
+// ../ice40/sdram-stm32.v:1303
+void Vsim_top::p556_() {
+  s_dut_wq_w_entry = ((((uint64_t)(s_dut_decode_window_w)) != 0) ? (((uint64_t)((uint64_t)(s_dut_win_base)) << 25) | ((uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_adr)) >> 0) & 0x7fULL)) << 18) | ((uint64_t)((uint64_t)(s_dut_fsmc_w_nbl)) << 16) | (uint64_t)((uint64_t)(s_dut_fsmc_w_data))) : ((((uint64_t)(s_dut_decode_data_stream)) != 0) ? (((uint64_t)((uint64_t)(s_dut_stream_adr)) << 18) | ((uint64_t)((uint64_t)(s_dut_fsmc_w_nbl)) << 16) | (uint64_t)((uint64_t)(s_dut_fsmc_w_data))) : ((((uint64_t)(s_dut_decode_data32)) != 0) ? (((uint64_t)((uint64_t)(((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 0) & 0xffffffULL)) + (((uint64_t)0x0ULL << 1) | (uint64_t)(uint64_t)((((uint64_t)(s_dut_fsmc_w_adr)) >> 0) & 1))) & 0xffffffULL) << 18) | ((uint64_t)((uint64_t)(s_dut_fsmc_w_nbl)) << 16) | (uint64_t)((uint64_t)(s_dut_fsmc_w_data))) : (((uint64_t)((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 15) & 0x1ffULL)) << 33) | ((uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 1) & 0x7fffULL)) << 18) | ((uint64_t)((uint64_t)(s_dut_cur_nbl)) << 16) | (uint64_t)((uint64_t)(s_dut_cur_value))))));
+}
+// ../ice40/sdram-stm32.v:1309
+void Vsim_top::p557_() {
+  s_dut_wq_pop = ((((((((uint64_t)(((uint64_t)(s_dut_wq_empty)) == 0) & (uint64_t)(((uint64_t)(s_dut_wq_fresh)) == 0)) & (uint64_t)(((uint64_t)(s_dut_rq_full)) == 0)) & (uint64_t)(((uint64_t)(s_dut_st_pending_fill)) == 0)) & (uint64_t)(((uint64_t)(s_dut_pf_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_cp_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_at_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_rdr_busy)) == 0));
+}
+// ../ice40/sdram-stm32.v:1311
+void Vsim_top::p558_() {
+  s_dut_fill_go = ((((uint64_t)(s_dut_st_pending_fill)) | (((uint64_t)(s_dut_st_lookup)) & (uint64_t)(((uint64_t)(s_dut_cache_hit)) == 0))) & (uint64_t)(((uint64_t)(s_dut_rq_full)) == 0));
+}
+// ../ice40/sdram-stm32.v:1312
+void Vsim_top::p559_() {
+  s_dut_rq_push = (((uint64_t)(s_dut_wq_pop)) | ((uint64_t)(s_dut_fill_go)));
+}
+// sim_top.v:37
+void Vsim_top::p560_() {
+  s_dut_sdram_gpio4 = (uint64_t)((((uint64_t)(fsmc_nbl)) >> 0) & 1);
+}
+// sim_top.v:37
+void Vsim_top::p561_() {
+  s_dut_sdram_gpio5 = (uint64_t)((((uint64_t)(fsmc_nbl)) >> 1) & 1);
+}
+// sim_top.v:33
+void Vsim_top::p562_() {
+  s_aD = ((uint64_t)(aD_in));
+}
+// sim_top.v:34
+void Vsim_top::p563_() {
+  s_mem_d = ((uint64_t)(mem_d_in));
+}
+// sim_top.v:47
+void Vsim_top::p564_() {
+  aD_out = ((uint64_t)(s_dut_aDn_output));
+}
+// sim_top.v:48
+void Vsim_top::p565_() {
+  aD_oe = ((uint64_t)(s_dut_fsmc_io_d_output));
+}
+// sim_top.v:49
+void Vsim_top::p566_() {
+  mem_d_out = ((uint64_t)(s_dut_sdram_o_dq));
+}
+// sim_top.v:50
+void Vsim_top::p567_() {
+  mem_d_oe = ((uint64_t)(s_dut_sdram_busdir));
+}
+// sim_top.v:51
+void Vsim_top::p568_() {
+  init_done = ((uint64_t)(s_dut_sdram_init_done));
+}
+// ../ice40/clocked_bus_slave.v:4
+void Vsim_top::q0_() {
+  n_s_dut_my_bus_slave_cmd_fifo_sync_r2w_M = ((uint64_t)(s_dut_my_bus_slave_cmd_fifo_r_gray));
+}
+// ../ice40/clocked_bus_slave.v:4
+void Vsim_top::q1_() {
+  n_s_dut_my_bus_slave_cmd_fifo_s_r_gray = ((uint64_t)(s_dut_my_bus_slave_cmd_fifo_sync_r2w_M));
+}
+// ../ice40/clocked_bus_slave.v:4
+void Vsim_top::q2_() {
+  n_s_dut_my_bus_slave_cmd_fifo_sync_w2r_M = ((uint64_t)(s_dut_my_bus_slave_cmd_fifo_w_gray));
+}
+// ../ice40/clocked_bus_slave.v:4
+void Vsim_top::q3_() {
+  n_s_dut_my_bus_slave_cmd_fifo_s_w_gray = ((uint64_t)(s_dut_my_bus_slave_cmd_fifo_sync_w2r_M));
+}
+// ../ice40/async_fifo.v:37
+void Vsim_top::q4_() {
+  if ((((uint64_t)(s_dut_my_bus_slave_c_push)) & (~((uint64_t)(s_dut_my_bus_slave_c_full)) & 0x1ULL)) != 0) {
+    { uint64_t t1 = ((uint64_t)((((uint64_t)(s_dut_my_bus_slave_cmd_fifo_w_bin)) >> 0) & 0xfULL)); if (t1 >= 0 && t1 <= 15) nq_s_dut_my_bus_slave_cmd_fifo_mem.push_back(std::make_pair(t1 - 0, (uint64_t)(((uint64_t)(s_dut_my_bus_slave_cmd_fifo_w_data))))); }
+  }
+  n_s_dut_my_bus_slave_cmd_fifo_w_bin = ((uint64_t)(s_dut_my_bus_slave_cmd_fifo_w_bin_next));
+  n_s_dut_my_bus_slave_cmd_fifo_w_gray = ((uint64_t)(s_dut_my_bus_slave_cmd_fifo_w_gray_next));
+}
+// ../ice40/async_fifo.v:45
+void Vsim_top::q5_() {
+  n_s_dut_my_bus_slave_cmd_fifo_r_data = (((((uint64_t)((((uint64_t)(s_dut_my_bus_slave_cmd_fifo_r_bin_next)) >> 0) & 0xfULL))) <= 15) ? (uint64_t)s_dut_my_bus_slave_cmd_fifo_mem[(((uint64_t)((((uint64_t)(s_dut_my_bus_slave_cmd_fifo_r_bin_next)) >> 0) & 0xfULL))) - 0] : 0);
+  n_s_dut_my_bus_slave_cmd_fifo_r_bin = ((uint64_t)(s_dut_my_bus_slave_cmd_fifo_r_bin_next));
+  n_s_dut_my_bus_slave_cmd_fifo_r_gray = ((uint64_t)(s_dut_my_bus_slave_cmd_fifo_r_gray_next));
+}
+// ../ice40/clocked_bus_slave.v:4
+void Vsim_top::q6_() {
+  n_s_dut_my_bus_slave_rsp_fifo_sync_r2w_M = ((uint64_t)(s_dut_my_bus_slave_rsp_fifo_r_gray));
+}
+// ../ice40/clocked_bus_slave.v:4
+void Vsim_top::q7_() {
+  n_s_dut_my_bus_slave_rsp_fifo_s_r_gray = ((uint64_t)(s_dut_my_bus_slave_rsp_fifo_sync_r2w_M));
+}
+// ../ice40/clocked_bus_slave.v:4
+void Vsim_top::q8_() {
+  n_s_dut_my_bus_slave_rsp_fifo_sync_w2r_M = ((uint64_t)(s_dut_my_bus_slave_rsp_fifo_w_gray));
+}
+// ../ice40/clocked_bus_slave.v:4
+void Vsim_top::q9_() {
+  n_s_dut_my_bus_slave_rsp_fifo_s_w_gray = ((uint64_t)(s_dut_my_bus_slave_rsp_fifo_sync_w2r_M));
+}
+// ../ice40/async_fifo.v:37
+void Vsim_top::q10_() {
+  if ((((uint64_t)(s_dut_my_bus_slave_s_done)) & (~((uint64_t)(s_dut_my_bus_slave_rsp_full)) & 0x1ULL)) != 0) {
+    { uint64_t t3 = ((uint64_t)((((uint64_t)(s_dut_my_bus_slave_rsp_fifo_w_bin)) >> 0) & 0x3ULL)); if (t3 >= 0 && t3 <= 3) nq_s_dut_my_bus_slave_rsp_fifo_mem.push_back(std::make_pair(t3 - 0, (uint64_t)(((uint64_t)(s_dut_my_bus_slave_rsp_fifo_w_data))))); }
+  }
+  n_s_dut_my_bus_slave_rsp_fifo_w_bin = ((uint64_t)(s_dut_my_bus_slave_rsp_fifo_w_bin_next));
+  n_s_dut_my_bus_slave_rsp_fifo_w_gray = ((uint64_t)(s_dut_my_bus_slave_rsp_fifo_w_gray_next));
+}
+// ../ice40/async_fifo.v:45
+void Vsim_top::q11_() {
+  n_s_dut_my_bus_slave_rsp_fifo_r_data = (((((uint64_t)((((uint64_t)(s_dut_my_bus_slave_rsp_fifo_r_bin_next)) >> 0) & 0x3ULL))) <= 3) ? (uint64_t)s_dut_my_bus_slave_rsp_fifo_mem[(((uint64_t)((((uint64_t)(s_dut_my_bus_slave_rsp_fifo_r_bin_next)) >> 0) & 0x3ULL))) - 0] : 0);
+  n_s_dut_my_bus_slave_rsp_fifo_r_bin = ((uint64_t)(s_dut_my_bus_slave_rsp_fifo_r_bin_next));
+  n_s_dut_my_bus_slave_rsp_fifo_r_gray = ((uint64_t)(s_dut_my_bus_slave_rsp_fifo_r_gray_next));
+}
+// ../ice40/clocked_bus_slave.v:4
+void Vsim_top::q12_() {
+  n_s_dut_my_bus_slave_stream_q_sync_r2w_M = ((uint64_t)(s_dut_my_bus_slave_stream_q_r_gray));
+}
+// ../ice40/clocked_bus_slave.v:4
+void Vsim_top::q13_() {
+  n_s_dut_my_bus_slave_stream_q_s_r_gray = ((uint64_t)(s_dut_my_bus_slave_stream_q_sync_r2w_M));
+}
+// ../ice40/clocked_bus_slave.v:4
+void Vsim_top::q14_() {
+  n_s_dut_my_bus_slave_stream_q_sync_w2r_M = ((uint64_t)(s_dut_my_bus_slave_stream_q_w_gray));
+}
+// ../ice40/clocked_bus_slave.v:4
+void Vsim_top::q15_() {
+  n_s_dut_my_bus_slave_stream_q_s_w_gray = ((uint64_t)(s_dut_my_bus_slave_stream_q_sync_w2r_M));
+}
+// ../ice40/async_fifo.v:37
+void Vsim_top::q16_() {
+  if ((((uint64_t)(s_dut_fsmc_stream_pop)) & (~((uint64_t)(s_dut_my_bus_slave_sq_full)) & 0x1ULL)) != 0) {
+    { uint64_t t5 = ((uint64_t)((((uint64_t)(s_dut_my_bus_slave_stream_q_w_bin)) >> 0) & 0xffULL)); if (t5 >= 0 && t5 <= 255) nq_s_dut_my_bus_slave_stream_q_mem.push_back(std::make_pair(t5 - 0, (uint64_t)(((uint64_t)(s_dut_my_bus_slave_stream_q_w_data))))); }
+  }
+  n_s_dut_my_bus_slave_stream_q_w_bin = ((uint64_t)(s_dut_my_bus_slave_stream_q_w_bin_next));
+  n_s_dut_my_bus_slave_stream_q_w_gray = ((uint64_t)(s_dut_my_bus_slave_stream_q_w_gray_next));
+}
+// ../ice40/async_fifo.v:45
+void Vsim_top::q17_() {
+  n_s_dut_my_bus_slave_stream_q_r_data = (((((uint64_t)((((uint64_t)(s_dut_my_bus_slave_stream_q_r_bin_next)) >> 0) & 0xffULL))) <= 255) ? (uint64_t)s_dut_my_bus_slave_stream_q_mem[(((uint64_t)((((uint64_t)(s_dut_my_bus_slave_stream_q_r_bin_next)) >> 0) & 0xffULL))) - 0] : 0);
+  n_s_dut_my_bus_slave_stream_q_r_bin = ((uint64_t)(s_dut_my_bus_slave_stream_q_r_bin_next));
+  n_s_dut_my_bus_slave_stream_q_r_gray = ((uint64_t)(s_dut_my_bus_slave_stream_q_r_gray_next));
+}
+// ../ice40/sync_bus_slave.v:116
+void Vsim_top::q18_() {
+  if (((uint64_t)(aNE)) != 0) {
+    n_s_dut_my_bus_slave_active = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if ((~((uint64_t)(s_dut_my_bus_slave_active)) & 0x1ULL) != 0) {
+      n_s_dut_my_bus_slave_active = ((uint64_t)((0x1ULL) & 0x1ULL));
+      n_s_dut_my_bus_slave_cnt = ((uint64_t)((0x1ULL) & 0xfULL));
+      n_s_dut_my_bus_slave_f_adr = ((uint64_t)(aA));
+      n_s_dut_my_bus_slave_is_stream = (uint64_t)(((uint64_t)(aA)) == 0x8ULL);
+      n_s_dut_my_bus_slave_f_want = ((uint64_t)((0x0ULL) & 0x1ULL));
+    } else {
+      if ((uint64_t)(((uint64_t)(s_dut_my_bus_slave_cnt)) != 0xfULL) != 0) {
+        n_s_dut_my_bus_slave_cnt = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bus_slave_cnt)))) + 0x1ULL) & 0xffffffffULL)) & 0xfULL));
+      }
+      if (((((uint64_t)(s_dut_my_bus_slave_rd_beat)) | ((uint64_t)(s_dut_my_bus_slave_wr_beat))) & (uint64_t)(((uint64_t)(s_dut_my_bus_slave_f_adr)) != 0x8ULL)) != 0) {
+        n_s_dut_my_bus_slave_f_adr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bus_slave_f_adr)))) + 0x1ULL) & 0xffffffffULL)) & 0xffULL));
+      }
+      if ((((uint64_t)(s_dut_my_bus_slave_wr_beat)) & (uint64_t)(((uint64_t)(s_dut_my_bus_slave_f_adr)) == 0x7ULL)) != 0) {
+        n_s_dut_my_bus_slave_f_epoch = (~((uint64_t)(s_dut_my_bus_slave_f_epoch)) & 0x1ULL);
+      }
+    }
+  }
+  if (((uint64_t)(s_dut_my_bus_slave_rd_cmd)) != 0) {
+    n_s_dut_my_bus_slave_f_seq = ((uint64_t)(s_dut_my_bus_slave_next_seq));
+    n_s_dut_my_bus_slave_f_want = ((uint64_t)((0x1ULL) & 0x1ULL));
+    n_s_dut_my_bus_slave_outstanding = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if (((uint64_t)(s_dut_my_bus_slave_rsp_pop)) != 0) {
+      n_s_dut_my_bus_slave_outstanding = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+}
+// ../ice40/sync_bus_slave.v:158
+void Vsim_top::q19_() {
+  n_s_dut_fsmc_do_read = ((uint64_t)(s_dut_my_bus_slave_c_read));
+  n_s_dut_fsmc_r_taken = ((uint64_t)(s_dut_my_bus_slave_c_commit));
+  if ((((uint64_t)(s_dut_my_bus_slave_c_read)) | ((uint64_t)(s_dut_my_bus_slave_c_commit))) != 0) {
+    n_s_dut_fsmc_r_adr = ((uint64_t)(s_dut_my_bus_slave_c_adr));
+  }
+  if (((uint64_t)(s_dut_my_bus_slave_c_read)) != 0) {
+    n_s_dut_my_bus_slave_s_seq = ((uint64_t)(s_dut_my_bus_slave_c_seq));
+    n_s_dut_my_bus_slave_s_reading = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if (((uint64_t)(s_dut_my_bus_slave_s_done)) != 0) {
+      n_s_dut_my_bus_slave_s_reading = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+  if (((uint64_t)(s_dut_stream_restart)) != 0) {
+    n_s_dut_my_bus_slave_s_epoch = (~((uint64_t)(s_dut_my_bus_slave_s_epoch)) & 0x1ULL);
+  }
+}
+// ../ice40/sdram_control_fsm.v:224
+void Vsim_top::q20_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_write_cmd_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    n_s_dut_sdram_U0_write_cmd_i = (uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x13ULL) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x2ULL) != 0));
+  }
+}
+// ../ice40/sdram_control_fsm.v:300
+void Vsim_top::q21_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_ras_count_i = ((uint64_t)((0x0ULL) & 0xffffULL));
+    n_s_dut_sdram_U0_wr_count_i = ((uint64_t)((0x0ULL) & 0xffffULL));
+  } else {
+    s_dut_sdram_U0_bank_i = 0x0ULL;
+    for (int t9 = 0; (uint64_t)(vl_s(((uint64_t)(s_dut_sdram_U0_bank_i)), 32) < vl_s(vl_shl<uint64_t>(0x1ULL, 0x2ULL, 32), 32)) != 0; ++t9) {
+      if (t9 > 1000000) vl_fatal("loop");
+      if ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0xeULL) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_req_bank_i)) == ((uint64_t)((((uint64_t)(s_dut_sdram_U0_bank_i)) >> 0) & 0x3ULL))) != 0)) != 0) || ((uint64_t)((((uint64_t)(s_dut_sdram_U0_lookahead_act_i)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_next_bank_i)) == ((uint64_t)((((uint64_t)(s_dut_sdram_U0_bank_i)) >> 0) & 0x3ULL))) != 0)) != 0)) != 0) {
+        { int64_t t10 = (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_dut_sdram_U0_bank_i))) & 0xffffffffULL), 32)) - 0; if (t10 >= 0 && t10 <= 12) n_s_dut_sdram_U0_ras_count_i = (uint16_t)((((uint64_t)(n_s_dut_sdram_U0_ras_count_i)) & ~(0xfULL << t10)) | (((uint64_t)(((uint64_t)((((uint64_t)(0x4ULL - 0x1ULL) & 0xffffffffULL)) & 0xfULL))) & 0xfULL) << t10)); }
+      } else {
+        if ((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_dut_sdram_U0_ras_count_i)), (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_dut_sdram_U0_bank_i))) & 0xffffffffULL), 32)) - 0, 16, 4)))) != 0x0ULL) != 0) {
+          { int64_t t11 = (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_dut_sdram_U0_bank_i))) & 0xffffffffULL), 32)) - 0; if (t11 >= 0 && t11 <= 12) n_s_dut_sdram_U0_ras_count_i = (uint16_t)((((uint64_t)(n_s_dut_sdram_U0_ras_count_i)) & ~(0xfULL << t11)) | (((uint64_t)(((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_dut_sdram_U0_ras_count_i)), (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_dut_sdram_U0_bank_i))) & 0xffffffffULL), 32)) - 0, 16, 4)))) - 0x1ULL) & 0xffffffffULL)) & 0xfULL))) & 0xfULL) << t11)); }
+        }
+      }
+      if ((uint64_t)((((uint64_t)(s_dut_sdram_U0_write_issue_i)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_req_bank_i)) == ((uint64_t)((((uint64_t)(s_dut_sdram_U0_bank_i)) >> 0) & 0x3ULL))) != 0)) != 0) {
+        { int64_t t12 = (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_dut_sdram_U0_bank_i))) & 0xffffffffULL), 32)) - 0; if (t12 >= 0 && t12 <= 12) n_s_dut_sdram_U0_wr_count_i = (uint16_t)((((uint64_t)(n_s_dut_sdram_U0_wr_count_i)) & ~(0xfULL << t12)) | (((uint64_t)(((uint64_t)((((uint64_t)(0x2ULL - 0x1ULL) & 0xffffffffULL)) & 0xfULL))) & 0xfULL) << t12)); }
+      } else {
+        if ((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_dut_sdram_U0_wr_count_i)), (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_dut_sdram_U0_bank_i))) & 0xffffffffULL), 32)) - 0, 16, 4)))) != 0x0ULL) != 0) {
+          { int64_t t13 = (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_dut_sdram_U0_bank_i))) & 0xffffffffULL), 32)) - 0; if (t13 >= 0 && t13 <= 12) n_s_dut_sdram_U0_wr_count_i = (uint16_t)((((uint64_t)(n_s_dut_sdram_U0_wr_count_i)) & ~(0xfULL << t13)) | (((uint64_t)(((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)vl_bits<uint64_t>(((uint64_t)(s_dut_sdram_U0_wr_count_i)), (int64_t)(vl_s(((uint64_t)(0x4ULL * ((uint64_t)(s_dut_sdram_U0_bank_i))) & 0xffffffffULL), 32)) - 0, 16, 4)))) - 0x1ULL) & 0xffffffffULL)) & 0xfULL))) & 0xfULL) << t13)); }
+        }
+      }
+      s_dut_sdram_U0_bank_i = ((uint64_t)(((uint64_t)(s_dut_sdram_U0_bank_i)) + 0x1ULL) & 0xffffffffULL);
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:369
+void Vsim_top::q22_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_row_open_i = ((uint64_t)((0x0ULL) & 0xfULL));
+  } else {
+    { uint64_t t16 = ((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i));
+      if (t16 == 0xeULL) {
+        { int64_t t17 = (int64_t)(((uint64_t)(s_dut_sdram_U0_req_bank_i))) - 0; if (t17 >= 0 && t17 <= 3) n_s_dut_sdram_U0_row_open_i = (uint8_t)((((uint64_t)(n_s_dut_sdram_U0_row_open_i)) & ~(0x1ULL << t17)) | (((uint64_t)(((uint64_t)(s_dut_sdram_disable_precharge))) & 0x1ULL) << t17)); }
+      } else if (t16 == 0x18ULL || t16 == 0x1eULL) {
+        if (((uint64_t)(s_dut_sdram_U0_lookahead_act_i)) != 0) {
+          { int64_t t18 = (int64_t)(((uint64_t)(s_dut_sdram_U0_next_bank_i))) - 0; if (t18 >= 0 && t18 <= 3) n_s_dut_sdram_U0_row_open_i = (uint8_t)((((uint64_t)(n_s_dut_sdram_U0_row_open_i)) & ~(0x1ULL << t18)) | (((uint64_t)(0x1ULL) & 0x1ULL) << t18)); }
+        } else {
+          if (((uint64_t)(s_dut_sdram_U0_lookahead_pre_i)) != 0) {
+            { int64_t t19 = (int64_t)(((uint64_t)(s_dut_sdram_U0_next_bank_i))) - 0; if (t19 >= 0 && t19 <= 3) n_s_dut_sdram_U0_row_open_i = (uint8_t)((((uint64_t)(n_s_dut_sdram_U0_row_open_i)) & ~(0x1ULL << t19)) | (((uint64_t)(0x0ULL) & 0x1ULL) << t19)); }
+          }
+        }
+      } else if (t16 == 0xcULL) {
+        { int64_t t20 = (int64_t)(((uint64_t)(s_dut_sdram_U0_req_bank_i))) - 0; if (t20 >= 0 && t20 <= 3) n_s_dut_sdram_U0_row_open_i = (uint8_t)((((uint64_t)(n_s_dut_sdram_U0_row_open_i)) & ~(0x1ULL << t20)) | (((uint64_t)(0x0ULL) & 0x1ULL) << t20)); }
+      } else if (t16 == 0x6ULL || t16 == 0x2ULL) {
+        if ((uint64_t)(((uint64_t)(s_dut_sdram_disable_precharge)) == 0) != 0) {
+          { int64_t t21 = (int64_t)(((uint64_t)(s_dut_sdram_U0_req_bank_i))) - 0; if (t21 >= 0 && t21 <= 3) n_s_dut_sdram_U0_row_open_i = (uint8_t)((((uint64_t)(n_s_dut_sdram_U0_row_open_i)) & ~(0x1ULL << t21)) | (((uint64_t)(0x0ULL) & 0x1ULL) << t21)); }
+        }
+      } else if (t16 == 0x19ULL || t16 == 0xaULL) {
+        n_s_dut_sdram_U0_row_open_i = ((uint64_t)((0x0ULL) & 0xfULL));
+      } else {
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:395
+void Vsim_top::q23_() {
+  if ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0xeULL) != 0) {
+    { uint64_t t22 = ((uint64_t)(s_dut_sdram_U0_req_bank_i)); if (t22 >= 0 && t22 <= 3) nq_s_dut_sdram_U0_open_row_i.push_back(std::make_pair(t22 - 0, (uint64_t)(((uint64_t)(s_dut_sdram_U0_req_row_i))))); }
+  } else {
+    if (((uint64_t)(s_dut_sdram_U0_lookahead_act_i)) != 0) {
+      { uint64_t t23 = ((uint64_t)(s_dut_sdram_U0_next_bank_i)); if (t23 >= 0 && t23 <= 3) nq_s_dut_sdram_U0_open_row_i.push_back(std::make_pair(t23 - 0, (uint64_t)(((uint64_t)(s_dut_sdram_U0_next_row_i))))); }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:420
+void Vsim_top::q24_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_write_done_i = 0x0ULL;
+    n_s_dut_sdram_U0_read_done_i = 0x0ULL;
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x1ULL) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x1eULL) != 0)) != 0) || ((uint64_t)((((uint64_t)(s_dut_sdram_burststop_req)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x1eULL) != 0)) != 0)) != 0) {
+      n_s_dut_sdram_U0_write_done_i = 0x1ULL;
+      n_s_dut_sdram_U0_read_done_i = 0x0ULL;
+    } else {
+      if ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == ((uint64_t)(0x1ULL - 0x1ULL) & 0xffffffffULL)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x1cULL) != 0)) != 0) || ((uint64_t)((((uint64_t)(s_dut_sdram_burststop_req)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x1cULL) != 0)) != 0)) != 0) {
+        n_s_dut_sdram_U0_write_done_i = 0x0ULL;
+        n_s_dut_sdram_U0_read_done_i = 0x1ULL;
+      } else {
+        if ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x0ULL) != 0) {
+          n_s_dut_sdram_U0_write_done_i = 0x0ULL;
+          n_s_dut_sdram_U0_read_done_i = 0x0ULL;
+        }
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:437
+void Vsim_top::q25_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_write_done_reg_i = 0x0ULL;
+    n_s_dut_sdram_U0_read_done_reg_i = 0x0ULL;
+  } else {
+    n_s_dut_sdram_U0_write_done_reg_i = ((uint64_t)(s_dut_sdram_U0_write_done_i));
+    n_s_dut_sdram_U0_read_done_reg_i = ((uint64_t)(s_dut_sdram_U0_read_done_i));
+  }
+}
+// ../ice40/sdram_control_fsm.v:467
+void Vsim_top::q26_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_burst_col_i = ((uint64_t)((0x0ULL) & 0x3ffULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x1bULL) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x13ULL) != 0)) != 0) {
+      n_s_dut_sdram_U0_burst_col_i = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_burst_col_i)))) + 0x1ULL) & 0xffffffffULL)) & 0x3ffULL));
+    } else {
+      n_s_dut_sdram_U0_burst_col_i = ((uint64_t)((0x0ULL) & 0x3ffULL));
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:483
+void Vsim_top::q27_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_init_fsm_states_i = 0x0ULL;
+  } else {
+    { uint64_t t24 = ((uint64_t)(s_dut_sdram_U0_init_fsm_states_i));
+      if (t24 == 0x0ULL) {
+        if (((uint64_t)(s_dut_sdram_delay_done150us_i)) != 0) {
+          n_s_dut_sdram_U0_init_fsm_states_i = 0x1ULL;
+        }
+      } else if (t24 == 0x1ULL) {
+        n_s_dut_sdram_U0_init_fsm_states_i = (((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0x3ULL : 0x2ULL);
+      } else if (t24 == 0x2ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_dut_sdram_U0_init_fsm_states_i = 0x3ULL;
+        }
+      } else if (t24 == 0x3ULL) {
+        n_s_dut_sdram_U0_init_fsm_states_i = (((uint64_t)(0x5ULL == 0x0ULL) != 0) ? 0x5ULL : 0x4ULL);
+      } else if (t24 == 0x4ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x5ULL) != 0) {
+          n_s_dut_sdram_U0_init_fsm_states_i = 0x5ULL;
+        }
+      } else if (t24 == 0x5ULL) {
+        n_s_dut_sdram_U0_init_fsm_states_i = (((uint64_t)(0x5ULL == 0x0ULL) != 0) ? 0x7ULL : 0x6ULL);
+      } else if (t24 == 0x6ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x5ULL) != 0) {
+          n_s_dut_sdram_U0_init_fsm_states_i = 0x7ULL;
+        }
+      } else if (t24 == 0x7ULL) {
+        n_s_dut_sdram_U0_init_fsm_states_i = (((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0x9ULL : 0x8ULL);
+      } else if (t24 == 0x8ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_dut_sdram_U0_init_fsm_states_i = 0x9ULL;
+        }
+      } else if (t24 == 0x9ULL) {
+        n_s_dut_sdram_U0_init_fsm_states_i = 0x9ULL;
+      } else {
+        n_s_dut_sdram_U0_init_fsm_states_i = 0x0ULL;
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:535
+void Vsim_top::q28_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_init_done_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    { uint64_t t25 = ((uint64_t)(s_dut_sdram_U0_init_fsm_states_i));
+      if (t25 == 0x9ULL) {
+        n_s_dut_sdram_init_done_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_sdram_init_done_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:547
+void Vsim_top::q29_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_cmd_fsm_states_i = 0x0ULL;
+  } else {
+    { uint64_t t26 = ((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i));
+      if (t26 == 0x0ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_selfrefresh_i)) != 0) || (((uint64_t)(s_dut_sdram_refresh_req_i)) != 0)) != 0) && (((uint64_t)(s_dut_sdram_init_done_i)) != 0)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_row_open_i)) != 0) != 0)) != 0) {
+          if ((uint64_t)(((uint64_t)(s_dut_sdram_U0_precharge_ok_i)) == 0xfULL) != 0) {
+            n_s_dut_sdram_U0_cmd_fsm_states_i = 0xaULL;
+          }
+        } else {
+          if ((uint64_t)((((uint64_t)(s_dut_sdram_selfrefresh_i)) != 0) && (((uint64_t)(s_dut_sdram_init_done_i)) != 0)) != 0) {
+            n_s_dut_sdram_U0_cmd_fsm_states_i = 0x1ULL;
+          } else {
+            if ((uint64_t)((((uint64_t)(s_dut_sdram_refresh_req_i)) != 0) && (((uint64_t)(s_dut_sdram_init_done_i)) != 0)) != 0) {
+              n_s_dut_sdram_U0_cmd_fsm_states_i = 0x3ULL;
+            } else {
+              if ((uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_loadmod_req)) != 0) && (((uint64_t)(s_dut_sdram_init_done_i)) != 0)) != 0) && (((uint64_t)(s_dut_sdram_req_adv)) != 0)) != 0) {
+                n_s_dut_sdram_U0_cmd_fsm_states_i = 0xbULL;
+              } else {
+                if ((uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_precharge_req)) != 0) && (((uint64_t)(s_dut_sdram_init_done_i)) != 0)) != 0) && (((uint64_t)(s_dut_sdram_req_adv)) != 0)) != 0) {
+                  n_s_dut_sdram_U0_cmd_fsm_states_i = 0x19ULL;
+                } else {
+                  if ((uint64_t)((((uint64_t)(s_dut_sdram_power_down_i)) != 0) && (((uint64_t)(s_dut_sdram_init_done_i)) != 0)) != 0) {
+                    n_s_dut_sdram_U0_cmd_fsm_states_i = 0xdULL;
+                  } else {
+                    if ((uint64_t)((((uint64_t)(s_dut_sdram_req_adv)) != 0) && (((uint64_t)(s_dut_sdram_init_done_i)) != 0)) != 0) {
+                      if ((uint64_t)((((uint64_t)(s_dut_sdram_disable_active)) != 0) || (((uint64_t)(s_dut_sdram_U0_page_hit_i)) != 0)) != 0) {
+                        n_s_dut_sdram_U0_cmd_fsm_states_i = ((((uint64_t)(s_dut_sdram_req_rwn)) != 0) ? ((uint64_t)(s_dut_sdram_U0_read_cmd_state_i)) : ((uint64_t)(s_dut_sdram_U0_write_cmd_state_i)));
+                      } else {
+                        if (((uint64_t)(s_dut_sdram_U0_page_miss_i)) != 0) {
+                          if (vl_bit(((uint64_t)(s_dut_sdram_U0_precharge_ok_i)), (int64_t)(((uint64_t)(s_dut_sdram_U0_req_bank_i))) - 0, 4) != 0) {
+                            n_s_dut_sdram_U0_cmd_fsm_states_i = 0xcULL;
+                          }
+                        } else {
+                          n_s_dut_sdram_U0_cmd_fsm_states_i = 0xeULL;
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      } else if (t26 == 0xeULL) {
+        if ((uint64_t)(0x2ULL == 0x0ULL) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = ((((uint64_t)(s_dut_sdram_req_rwn)) != 0) ? ((uint64_t)(s_dut_sdram_U0_read_cmd_state_i)) : ((uint64_t)(s_dut_sdram_U0_write_cmd_state_i)));
+        } else {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0x10ULL;
+        }
+      } else if (t26 == 0x10ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = ((((uint64_t)(s_dut_sdram_req_rwn)) != 0) ? ((uint64_t)(s_dut_sdram_U0_read_cmd_state_i)) : ((uint64_t)(s_dut_sdram_U0_write_cmd_state_i)));
+        }
+      } else if (t26 == 0x1bULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_burst_col_i)))) == ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_req_len)))) - 0x2ULL) & 0xffffffffULL)) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0x6ULL;
+        }
+      } else if (t26 == 0x6ULL) {
+        n_s_dut_sdram_U0_cmd_fsm_states_i = 0x18ULL;
+      } else if (t26 == 0x18ULL) {
+        if (((uint64_t)(s_dut_sdram_U0_read_early_i)) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = ((uint64_t)(s_dut_sdram_U0_read_cmd_state_i));
+        } else {
+          if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) {
+            n_s_dut_sdram_U0_cmd_fsm_states_i = 0x1cULL;
+          }
+        }
+      } else if (t26 == 0x1cULL) {
+        if (((uint64_t)(s_dut_sdram_burststop_req)) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0x15ULL;
+        } else {
+          if ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == ((uint64_t)(0x1ULL - 0x1ULL) & 0xffffffffULL)) != 0) && (((uint64_t)(s_dut_sdram_U0_read_pipeline_i)) != 0)) != 0) {
+            n_s_dut_sdram_U0_cmd_fsm_states_i = ((uint64_t)(s_dut_sdram_U0_read_cmd_state_i));
+          } else {
+            if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == ((uint64_t)(0x1ULL - 0x1ULL) & 0xffffffffULL)) != 0) {
+              n_s_dut_sdram_U0_cmd_fsm_states_i = 0x0ULL;
+            }
+          }
+        }
+      } else if (t26 == 0x13ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_burst_col_i)))) == ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_req_len)))) - 0x2ULL) & 0xffffffffULL)) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0x2ULL;
+        }
+      } else if (t26 == 0x2ULL) {
+        n_s_dut_sdram_U0_cmd_fsm_states_i = 0x1eULL;
+      } else if (t26 == 0x1eULL) {
+        if (((uint64_t)(s_dut_sdram_burststop_req)) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0x7ULL;
+        } else {
+          if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x1ULL) != 0) {
+            n_s_dut_sdram_U0_cmd_fsm_states_i = 0xfULL;
+          }
+        }
+      } else if (t26 == 0xfULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x0ULL) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0x0ULL;
+        }
+      } else if (t26 == 0x3ULL) {
+        n_s_dut_sdram_U0_cmd_fsm_states_i = (((uint64_t)(0x5ULL == 0x0ULL) != 0) ? 0x0ULL : 0x1fULL);
+      } else if (t26 == 0x1fULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x5ULL) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0x0ULL;
+        }
+      } else if (t26 == 0x1ULL) {
+        if ((~((uint64_t)(s_dut_sdram_selfrefresh_i)) & 0x1ULL) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0x5ULL;
+        }
+      } else if (t26 == 0x5ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x4ULL) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0x0ULL;
+        }
+      } else if (t26 == 0xbULL) {
+        n_s_dut_sdram_U0_cmd_fsm_states_i = (((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0x0ULL : 0x9ULL);
+      } else if (t26 == 0x9ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0x0ULL;
+        }
+      } else if (t26 == 0x7ULL) {
+        n_s_dut_sdram_U0_cmd_fsm_states_i = 0x17ULL;
+      } else if (t26 == 0x17ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          if ((uint64_t)(((uint64_t)(s_dut_sdram_disable_precharge)) == 0) != 0) {
+            n_s_dut_sdram_U0_cmd_fsm_states_i = 0x19ULL;
+          } else {
+            n_s_dut_sdram_U0_cmd_fsm_states_i = 0x0ULL;
+          }
+        }
+      } else if (t26 == 0x15ULL) {
+        n_s_dut_sdram_U0_cmd_fsm_states_i = 0x11ULL;
+      } else if (t26 == 0x11ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          if ((uint64_t)(((uint64_t)(s_dut_sdram_disable_precharge)) == 0) != 0) {
+            n_s_dut_sdram_U0_cmd_fsm_states_i = 0x19ULL;
+          } else {
+            n_s_dut_sdram_U0_cmd_fsm_states_i = 0x0ULL;
+          }
+        }
+      } else if (t26 == 0x19ULL) {
+        n_s_dut_sdram_U0_cmd_fsm_states_i = 0x1dULL;
+      } else if (t26 == 0x1dULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0x0ULL;
+        }
+      } else if (t26 == 0xcULL) {
+        n_s_dut_sdram_U0_cmd_fsm_states_i = (((uint64_t)(0x2ULL == 0x0ULL) != 0) ? 0xeULL : 0x8ULL);
+      } else if (t26 == 0x8ULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0xeULL;
+        }
+      } else if (t26 == 0xaULL) {
+        n_s_dut_sdram_U0_cmd_fsm_states_i = 0x1aULL;
+      } else if (t26 == 0x1aULL) {
+        if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) == 0x2ULL) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = ((((uint64_t)(s_dut_sdram_selfrefresh_i)) != 0) ? 0x1ULL : 0x3ULL);
+        }
+      } else if (t26 == 0xdULL) {
+        if ((uint64_t)(((uint64_t)(s_dut_sdram_power_down_i)) == 0) != 0) {
+          n_s_dut_sdram_U0_cmd_fsm_states_i = 0x0ULL;
+        }
+      } else {
+        n_s_dut_sdram_U0_cmd_fsm_states_i = 0x0ULL;
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:708
+void Vsim_top::q30_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_autoref_ack_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    { uint64_t t27 = ((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i));
+      if (t27 == 0x3ULL) {
+        n_s_dut_sdram_autoref_ack_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_sdram_autoref_ack_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:723
+void Vsim_top::q31_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_ack = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    { uint64_t t28 = ((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i));
+      if (t28 == 0x0ULL) {
+        if (((uint64_t)(s_dut_sdram_precharge_req)) != 0) {
+          n_s_dut_sdram_ack = ((uint64_t)((0x1ULL) & 0x1ULL));
+        }
+      } else if (t28 == 0x7ULL || t28 == 0x15ULL || t28 == 0x6ULL || t28 == 0x2ULL || t28 == 0xbULL) {
+        n_s_dut_sdram_ack = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_sdram_ack = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:747
+void Vsim_top::q32_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_sdrctl_busyn_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    { uint64_t t29 = ((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i));
+      if (t29 == 0x0ULL) {
+        if (((uint64_t)(s_dut_sdram_init_done_i)) != 0) {
+          if ((uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_refresh_req_i)) != 0) || (((uint64_t)(s_dut_sdram_loadmod_req)) != 0)) != 0) || (((uint64_t)(s_dut_sdram_precharge_req)) != 0)) != 0) || (((uint64_t)(s_dut_sdram_req_adv)) != 0)) != 0) {
+            n_s_dut_sdram_sdrctl_busyn_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+          } else {
+            n_s_dut_sdram_sdrctl_busyn_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+          }
+        }
+      } else if (t29 == 0xeULL || t29 == 0x10ULL || t29 == 0x1bULL || t29 == 0x6ULL || t29 == 0x18ULL || t29 == 0x13ULL || t29 == 0x2ULL || t29 == 0x1eULL || t29 == 0x3ULL || t29 == 0x7ULL || t29 == 0x19ULL || t29 == 0xbULL || t29 == 0x11ULL || t29 == 0x17ULL || t29 == 0x15ULL || t29 == 0x1cULL || t29 == 0xfULL || t29 == 0x9ULL || t29 == 0x1fULL || t29 == 0x1dULL || t29 == 0xcULL || t29 == 0x8ULL || t29 == 0xaULL || t29 == 0x1aULL || t29 == 0x5ULL) {
+        n_s_dut_sdram_sdrctl_busyn_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_sdram_sdrctl_busyn_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:796
+void Vsim_top::q33_() {
+  if (((uint64_t)(s_dut_sdram_U0_reset_clk_counter_i)) != 0) {
+    n_s_dut_sdram_U0_clk_count_i = ((uint64_t)((0x0ULL) & 0xfULL));
+  } else {
+    n_s_dut_sdram_U0_clk_count_i = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_clk_count_i)))) + 0x1ULL) & 0xffffffffULL)) & 0xfULL));
+  }
+}
+// ../ice40/sdram_control_fsm.v:933
+void Vsim_top::q34_() {
+  n_s_dut_sdram_U0_sdram_dq_reg_i = ((uint64_t)(s_dut_sdram_U0_i_sdram_dq));
+}
+// ../ice40/sdram_control_fsm.v:949
+void Vsim_top::q35_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_read_pipe_i = ((uint64_t)((0x0ULL) & 0x7ULL));
+  } else {
+    n_s_dut_sdram_U0_read_pipe_i = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_sdram_U0_read_pipe_i)) >> 0) & 0x3ULL)) << 1) | (uint64_t)(uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x1bULL) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x6ULL) != 0)));
+  }
+}
+// ../ice40/sdram_control_fsm.v:957
+void Vsim_top::q36_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_cpu_den_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)((((uint64_t)(s_dut_sdram_U0_read_pipe_i)) >> 2) & 1) != 0) || ((uint64_t)(((uint64_t)(vl_s(0x1ULL, 32) > vl_s(0x1ULL, 32)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x1cULL) != 0)) != 0)) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x15ULL) != 0)) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x11ULL) != 0)) != 0) {
+      n_s_dut_sdram_U0_cpu_den_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_dut_sdram_U0_cpu_den_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:981
+void Vsim_top::q37_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_cpu2sdram_reg_i = ((0x0ULL) ? 0xffffULL : (uint64_t)0);
+  } else {
+    n_s_dut_sdram_U0_cpu2sdram_reg_i = ((uint64_t)(s_dut_sdram_U0_cpu_data_reg_i));
+  }
+}
+// ../ice40/sdram_control_fsm.v:990
+void Vsim_top::q38_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_sdram_dq_en_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x2ULL) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x13ULL) != 0)) != 0) {
+      n_s_dut_sdram_U0_sdram_dq_en_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x6ULL) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x1bULL) != 0)) != 0) {
+        n_s_dut_sdram_U0_sdram_dq_en_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:1003
+void Vsim_top::q39_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_cpu_data_reg_i = ((0x0ULL) ? 0xffffULL : (uint64_t)0);
+  } else {
+    n_s_dut_sdram_U0_cpu_data_reg_i = ((uint64_t)(s_dut_sdram_U0_i_data));
+  }
+}
+// ../ice40/sdram_control_fsm.v:1022
+void Vsim_top::q40_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_read_req_cnt_rst_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0xfULL) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x7ULL) != 0)) != 0) || ((uint64_t)(((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i)) == 0x0ULL) != 0)) != 0) {
+      n_s_dut_sdram_U0_read_req_cnt_rst_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_dut_sdram_U0_read_req_cnt_rst_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:1032
+void Vsim_top::q41_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_read_data_req_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    { uint64_t t32 = ((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i));
+      if (t32 == 0xeULL || t32 == 0x10ULL) {
+        if ((uint64_t)(((uint64_t)(s_dut_sdram_req_rwn)) == 0) != 0) {
+          n_s_dut_sdram_U0_read_data_req_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+        }
+      } else if (t32 == 0x1eULL || t32 == 0x13ULL || t32 == 0x2ULL) {
+        n_s_dut_sdram_U0_read_data_req_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_sdram_U0_read_data_req_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:1050
+void Vsim_top::q42_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_U0_read_req_cnt_i = ((0x1ULL) ? 0x3ffULL : (uint64_t)0);
+  } else {
+    if ((uint64_t)((((uint64_t)(s_dut_sdram_U0_read_req_cnt_rst_i)) != 0) || (((uint64_t)(s_dut_sdram_burststop_req)) != 0)) != 0) {
+      n_s_dut_sdram_U0_read_req_cnt_i = ((0x1ULL) ? 0x3ffULL : (uint64_t)0);
+    } else {
+      if (((uint64_t)(s_dut_sdram_U0_read_data_req_i)) != 0) {
+        n_s_dut_sdram_U0_read_req_cnt_i = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U0_read_req_cnt_i)))) + 0x1ULL) & 0xffffffffULL)) & 0x3ffULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_control_fsm.v:1099
+void Vsim_top::q43_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+  } else {
+    { uint64_t t34 = ((uint64_t)(s_dut_sdram_U0_init_fsm_states_i));
+      if (t34 == 0x2ULL || t34 == 0x4ULL || t34 == 0x6ULL || t34 == 0x8ULL || t34 == 0x0ULL) {
+        { uint64_t t35 = 0xeULL;
+          n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t35 >> 0) & 0x1ULL));
+          n_s_dut_sdram_wen = ((uint64_t)((t35 >> 1) & 0x1ULL));
+          n_s_dut_sdram_casn = ((uint64_t)((t35 >> 2) & 0x1ULL));
+          n_s_dut_sdram_rasn = ((uint64_t)((t35 >> 3) & 0x1ULL));
+          n_s_dut_sdram_csn = ((uint64_t)((t35 >> 4) & 0x1ULL));
+        }
+        n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+        n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+      } else if (t34 == 0x1ULL) {
+        { uint64_t t36 = 0x5ULL;
+          n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t36 >> 0) & 0x1ULL));
+          n_s_dut_sdram_wen = ((uint64_t)((t36 >> 1) & 0x1ULL));
+          n_s_dut_sdram_casn = ((uint64_t)((t36 >> 2) & 0x1ULL));
+          n_s_dut_sdram_rasn = ((uint64_t)((t36 >> 3) & 0x1ULL));
+          n_s_dut_sdram_csn = ((uint64_t)((t36 >> 4) & 0x1ULL));
+        }
+        n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+        n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+      } else if (t34 == 0x3ULL || t34 == 0x5ULL) {
+        { uint64_t t37 = 0x3ULL;
+          n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t37 >> 0) & 0x1ULL));
+          n_s_dut_sdram_wen = ((uint64_t)((t37 >> 1) & 0x1ULL));
+          n_s_dut_sdram_casn = ((uint64_t)((t37 >> 2) & 0x1ULL));
+          n_s_dut_sdram_rasn = ((uint64_t)((t37 >> 3) & 0x1ULL));
+          n_s_dut_sdram_csn = ((uint64_t)((t37 >> 4) & 0x1ULL));
+        }
+        n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+        n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+      } else if (t34 == 0x7ULL) {
+        { uint64_t t38 = 0x1ULL;
+          n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t38 >> 0) & 0x1ULL));
+          n_s_dut_sdram_wen = ((uint64_t)((t38 >> 1) & 0x1ULL));
+          n_s_dut_sdram_casn = ((uint64_t)((t38 >> 2) & 0x1ULL));
+          n_s_dut_sdram_rasn = ((uint64_t)((t38 >> 3) & 0x1ULL));
+          n_s_dut_sdram_csn = ((uint64_t)((t38 >> 4) & 0x1ULL));
+        }
+        n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_dut_sdram_U0_o_sdram_blkaddr = 0x0ULL;
+        n_s_dut_sdram_U0_o_sdram_addr = (((uint64_t)0x0ULL << 10) | ((uint64_t)0x0ULL << 9) | ((uint64_t)0x0ULL << 7) | ((uint64_t)0x2ULL << 4) | ((uint64_t)0x0ULL << 3) | (uint64_t)0x0ULL);
+      } else if (t34 == 0x9ULL) {
+        { uint64_t t39 = ((uint64_t)(s_dut_sdram_U0_cmd_fsm_states_i));
+          if (t39 == 0x0ULL || t39 == 0x10ULL || t39 == 0x1fULL || t39 == 0x5ULL || t39 == 0x1cULL || t39 == 0x17ULL || t39 == 0x11ULL) {
+            { uint64_t t40 = 0xeULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t40 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t40 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t40 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t40 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t40 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t39 == 0x18ULL || t39 == 0x1eULL) {
+            if (((uint64_t)(s_dut_sdram_U0_lookahead_act_i)) != 0) {
+              { uint64_t t41 = (((uint64_t)((uint64_t)((0x7ULL >> 1) & 0xfULL)) << 1) | (uint64_t)0x0ULL);
+                n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t41 >> 0) & 0x1ULL));
+                n_s_dut_sdram_wen = ((uint64_t)((t41 >> 1) & 0x1ULL));
+                n_s_dut_sdram_casn = ((uint64_t)((t41 >> 2) & 0x1ULL));
+                n_s_dut_sdram_rasn = ((uint64_t)((t41 >> 3) & 0x1ULL));
+                n_s_dut_sdram_csn = ((uint64_t)((t41 >> 4) & 0x1ULL));
+              }
+              n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+              n_s_dut_sdram_U0_o_sdram_blkaddr = ((uint64_t)(s_dut_sdram_U0_next_bank_i));
+              n_s_dut_sdram_U0_o_sdram_addr = ((uint64_t)(s_dut_sdram_U0_next_row_i));
+            } else {
+              if (((uint64_t)(s_dut_sdram_U0_lookahead_pre_i)) != 0) {
+                { uint64_t t42 = (((uint64_t)((uint64_t)((0x5ULL >> 1) & 0xfULL)) << 1) | (uint64_t)0x0ULL);
+                  n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t42 >> 0) & 0x1ULL));
+                  n_s_dut_sdram_wen = ((uint64_t)((t42 >> 1) & 0x1ULL));
+                  n_s_dut_sdram_casn = ((uint64_t)((t42 >> 2) & 0x1ULL));
+                  n_s_dut_sdram_rasn = ((uint64_t)((t42 >> 3) & 0x1ULL));
+                  n_s_dut_sdram_csn = ((uint64_t)((t42 >> 4) & 0x1ULL));
+                }
+                n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+                n_s_dut_sdram_U0_o_sdram_blkaddr = ((uint64_t)(s_dut_sdram_U0_next_bank_i));
+                n_s_dut_sdram_U0_o_sdram_addr = ((0x0ULL) ? 0x1fffULL : (uint64_t)0);
+              } else {
+                { uint64_t t43 = 0xeULL;
+                  n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t43 >> 0) & 0x1ULL));
+                  n_s_dut_sdram_wen = ((uint64_t)((t43 >> 1) & 0x1ULL));
+                  n_s_dut_sdram_casn = ((uint64_t)((t43 >> 2) & 0x1ULL));
+                  n_s_dut_sdram_rasn = ((uint64_t)((t43 >> 3) & 0x1ULL));
+                  n_s_dut_sdram_csn = ((uint64_t)((t43 >> 4) & 0x1ULL));
+                }
+                n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+                n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+                n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+              }
+            }
+          } else if (t39 == 0xeULL) {
+            { uint64_t t44 = 0x7ULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t44 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t44 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t44 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t44 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t44 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = ((uint64_t)((((uint64_t)(s_dut_sdram_U0_i_addr)) >> 9) & 0x3ULL));
+            n_s_dut_sdram_U0_o_sdram_addr = ((uint64_t)((((uint64_t)(s_dut_sdram_U0_i_addr)) >> 11) & 0x1fffULL));
+          } else if (t39 == 0x1bULL || t39 == 0x6ULL) {
+            { uint64_t t45 = 0xaULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t45 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t45 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t45 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t45 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t45 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = ((uint64_t)((((uint64_t)(s_dut_sdram_U0_i_addr)) >> 9) & 0x3ULL));
+            n_s_dut_sdram_U0_o_sdram_addr = (uint16_t)((((uint64_t)(n_s_dut_sdram_U0_o_sdram_addr)) & ~(0x1fffULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_sdram_U0_col_addr_i))) & 0x1fffULL) << 0));
+          } else if (t39 == 0x13ULL || t39 == 0x2ULL) {
+            { uint64_t t46 = 0x8ULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t46 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t46 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t46 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t46 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t46 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = ((uint64_t)((((uint64_t)(s_dut_sdram_U0_i_addr)) >> 9) & 0x3ULL));
+            n_s_dut_sdram_U0_o_sdram_addr = (uint16_t)((((uint64_t)(n_s_dut_sdram_U0_o_sdram_addr)) & ~(0x1fffULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_sdram_U0_col_addr_i))) & 0x1fffULL) << 0));
+          } else if (t39 == 0x3ULL) {
+            { uint64_t t47 = 0x3ULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t47 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t47 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t47 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t47 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t47 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t39 == 0x1ULL) {
+            { uint64_t t48 = 0x3ULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t48 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t48 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t48 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t48 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t48 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x0ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t39 == 0xbULL) {
+            { uint64_t t49 = 0x1ULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t49 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t49 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t49 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t49 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t49 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = 0x0ULL;
+            n_s_dut_sdram_U0_o_sdram_addr = ((uint64_t)((((uint64_t)(s_dut_sdram_U0_i_addr)) >> 0) & 0x1fffULL));
+          } else if (t39 == 0x19ULL || t39 == 0xaULL) {
+            { uint64_t t50 = 0x5ULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t50 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t50 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t50 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t50 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t50 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t39 == 0xcULL) {
+            { uint64_t t51 = 0x5ULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t51 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t51 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t51 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t51 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t51 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = ((uint64_t)((((uint64_t)(s_dut_sdram_U0_i_addr)) >> 9) & 0x3ULL));
+            n_s_dut_sdram_U0_o_sdram_addr = ((0x0ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t39 == 0x15ULL || t39 == 0x7ULL) {
+            { uint64_t t52 = 0xcULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t52 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t52 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t52 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t52 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t52 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t39 == 0x11ULL || t39 == 0x17ULL) {
+            { uint64_t t53 = 0xeULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t53 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t53 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t53 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t53 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t53 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else if (t39 == 0xdULL) {
+            { uint64_t t54 = 0xeULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t54 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t54 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t54 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t54 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t54 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x0ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          } else {
+            { uint64_t t55 = 0xeULL;
+              n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t55 >> 0) & 0x1ULL));
+              n_s_dut_sdram_wen = ((uint64_t)((t55 >> 1) & 0x1ULL));
+              n_s_dut_sdram_casn = ((uint64_t)((t55 >> 2) & 0x1ULL));
+              n_s_dut_sdram_rasn = ((uint64_t)((t55 >> 3) & 0x1ULL));
+              n_s_dut_sdram_csn = ((uint64_t)((t55 >> 4) & 0x1ULL));
+            }
+            n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+            n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+          }
+        }
+      } else {
+        { uint64_t t56 = 0xeULL;
+          n_s_dut_sdram_U0_sdram_dqm_i = ((uint64_t)((t56 >> 0) & 0x1ULL));
+          n_s_dut_sdram_wen = ((uint64_t)((t56 >> 1) & 0x1ULL));
+          n_s_dut_sdram_casn = ((uint64_t)((t56 >> 2) & 0x1ULL));
+          n_s_dut_sdram_rasn = ((uint64_t)((t56 >> 3) & 0x1ULL));
+          n_s_dut_sdram_csn = ((uint64_t)((t56 >> 4) & 0x1ULL));
+        }
+        n_s_dut_sdram_cke = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_dut_sdram_U0_o_sdram_blkaddr = 0x3ULL;
+        n_s_dut_sdram_U0_o_sdram_addr = ((0x1ULL) ? 0x1fffULL : (uint64_t)0);
+      }
+    }
+  }
+}
+// ../ice40/lfsr_count64.v:59
+void Vsim_top::q44_() {
+  if (((uint64_t)(s_dut_sdram_sys_rst_i)) != 0) {
+    n_s_dut_sdram_U1_U1_lfsr_reg_i = ((uint64_t)((0x0ULL) & 0x3fULL));
+    n_s_dut_sdram_U1_lfsr_64_done_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    n_s_dut_sdram_U1_U1_lfsr_reg_i = ((((uint64_t)(s_dut_sdram_U1_U1_lfsr_equal)) != 0) ? 0x0ULL : (((uint64_t)((uint64_t)((((uint64_t)(s_dut_sdram_U1_U1_lfsr_reg_i)) >> 0) & 0x1fULL)) << 1) | (uint64_t)((uint64_t)(s_dut_sdram_U1_U1_lfsr_d0_i))));
+    n_s_dut_sdram_U1_lfsr_64_done_i = ((uint64_t)(s_dut_sdram_U1_U1_lfsr_equal));
+  }
+}
+// ../ice40/lfsr_count255.v:61
+void Vsim_top::q45_() {
+  if (((uint64_t)(s_dut_sdram_sys_rst_i)) != 0) {
+    n_s_dut_sdram_U1_U5_lfsr_reg_i = ((uint64_t)((0x0ULL) & 0xffULL));
+    n_s_dut_sdram_delay_done150us_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    n_s_dut_sdram_U1_U5_lfsr_reg_i = ((((uint64_t)(s_dut_sdram_U1_U5_lfsr_256_equal_i)) != 0) ? 0x0ULL : (((uint64_t)((uint64_t)((((uint64_t)(s_dut_sdram_U1_U5_lfsr_reg_i)) >> 0) & 0x7fULL)) << 1) | (uint64_t)((uint64_t)(s_dut_sdram_U1_U5_lfsr_d0_i))));
+    n_s_dut_sdram_delay_done150us_i = ((uint64_t)(s_dut_sdram_U1_U5_lfsr_256_equal_i));
+  }
+}
+// ../ice40/autorefresh_counter.v:64
+void Vsim_top::q46_() {
+  if (((uint64_t)(s_dut_sdram_sys_rst_i)) != 0) {
+    n_s_dut_sdram_U2_count_i = ((uint64_t)((0x0ULL) & 0xffffULL));
+    n_s_dut_sdram_refresh_count_done_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if (((uint64_t)(s_dut_sdram_autorefresh_enable_i)) != 0) {
+      n_s_dut_sdram_U2_count_i = ((uint64_t)((((((uint64_t)(s_dut_sdram_U2_count_match_i)) != 0) ? 0x0ULL : ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_U2_count_i)))) + 0x1ULL) & 0xffffffffULL))) & 0xffffULL));
+    }
+    n_s_dut_sdram_refresh_count_done_i = (uint64_t)((((uint64_t)(s_dut_sdram_autorefresh_enable_i)) != 0) && (((uint64_t)(s_dut_sdram_U2_count_match_i)) != 0));
+  }
+}
+// ../ice40/sdram_controller.v:305
+void Vsim_top::q47_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_power_down_reg1_i = 0x0ULL;
+    n_s_dut_sdram_power_down_reg2_i = 0x0ULL;
+    n_s_dut_sdram_power_down_reg3_i = 0x0ULL;
+  } else {
+    n_s_dut_sdram_power_down_reg1_i = (uint64_t)((((uint64_t)(s_dut_sdram_power_down_i)) != 0) && ((uint64_t)(((uint64_t)(s_dut_sdram_power_state)) == 0x1ULL) != 0));
+    n_s_dut_sdram_power_down_reg2_i = (uint64_t)((((uint64_t)(s_dut_sdram_power_down_i)) != 0) && (((uint64_t)(s_dut_sdram_power_down_reg1_i)) != 0));
+    n_s_dut_sdram_power_down_reg3_i = (uint64_t)((((uint64_t)(s_dut_sdram_power_down_i)) != 0) && (((uint64_t)(s_dut_sdram_power_down_reg2_i)) != 0));
+  }
+}
+// ../ice40/sdram_controller.v:401
+void Vsim_top::q48_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_refresh_owed_i = ((uint64_t)((0x0ULL) & 0x1fULL));
+  } else {
+    if ((uint64_t)((((uint64_t)(s_dut_sdram_refresh_count_done_i)) != 0) && ((~((uint64_t)(s_dut_sdram_autoref_ack_i)) & 0x1ULL) != 0)) != 0) {
+      n_s_dut_sdram_refresh_owed_i = ((uint64_t)((((uint64_t)((vl_sext<uint64_t>(((uint64_t)(((uint64_t)(s_dut_sdram_refresh_owed_i)))), 5) & 0xffffffffULL) + 0x1ULL) & 0xffffffffULL)) & 0x1fULL));
+    } else {
+      if ((uint64_t)((((uint64_t)(s_dut_sdram_autoref_ack_i)) != 0) && ((~((uint64_t)(s_dut_sdram_refresh_count_done_i)) & 0x1ULL) != 0)) != 0) {
+        n_s_dut_sdram_refresh_owed_i = ((uint64_t)((((uint64_t)((vl_sext<uint64_t>(((uint64_t)(((uint64_t)(s_dut_sdram_refresh_owed_i)))), 5) & 0xffffffffULL) - 0x1ULL) & 0xffffffffULL)) & 0x1fULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_controller.v:409
+void Vsim_top::q49_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_idle_count_i = ((uint64_t)((0x0ULL) & 0x1fULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(((~((uint64_t)(s_dut_sdram_init_done_i)) & 0x1ULL) != 0) || (((uint64_t)(s_dut_sdram_sdrctl_busyn_i)) != 0)) != 0) || (((uint64_t)(s_dut_sdram_req_adv)) != 0)) != 0) {
+      n_s_dut_sdram_idle_count_i = ((uint64_t)((0x0ULL) & 0x1fULL));
+    } else {
+      if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_idle_count_i)))) != 0x10ULL) != 0) {
+        n_s_dut_sdram_idle_count_i = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_idle_count_i)))) + 0x1ULL) & 0xffffffffULL)) & 0x1fULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_controller.v:435
+void Vsim_top::q50_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_power_idle_i = ((uint64_t)((0x0ULL) & 0xffffffULL));
+  } else {
+    if ((uint64_t)(((~((uint64_t)(s_dut_sdram_init_done_i)) & 0x1ULL) != 0) || (((uint64_t)(s_dut_sdram_req_adv)) != 0)) != 0) {
+      n_s_dut_sdram_power_idle_i = ((uint64_t)((0x0ULL) & 0xffffffULL));
+    } else {
+      if ((uint64_t)(((uint64_t)(s_dut_sdram_power_idle_i)) != 0xffffffULL) != 0) {
+        n_s_dut_sdram_power_idle_i = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_power_idle_i)))) + 0x1ULL) & 0xffffffffULL)) & 0xffffffULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_controller.v:443
+void Vsim_top::q51_() {
+  if ((uint64_t)(((uint64_t)(s_dut_sdram_power_state)) != 0x2ULL) != 0) {
+    n_s_dut_sdram_selfrefresh_time_i = ((uint64_t)((0x0ULL) & 0xfULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_selfrefresh_time_i)))) != 0x4ULL) != 0) {
+      n_s_dut_sdram_selfrefresh_time_i = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_sdram_selfrefresh_time_i)))) + 0x1ULL) & 0xffffffffULL)) & 0xfULL));
+    }
+  }
+}
+// ../ice40/sdram_controller.v:465
+void Vsim_top::q52_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_refresh_req_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if (((uint64_t)(s_dut_sdram_disable_autorefresh)) != 0) {
+      n_s_dut_sdram_refresh_req_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+    } else {
+      if (((uint64_t)(s_dut_sdram_init_done_i)) != 0) {
+        n_s_dut_sdram_refresh_req_i = ((uint64_t)(s_dut_sdram_refresh_due_i));
+      } else {
+        n_s_dut_sdram_refresh_req_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+      }
+    }
+  }
+}
+// ../ice40/sdram_controller.v:476
+void Vsim_top::q53_() {
+  if (((uint64_t)(s_dut_sdram_rst)) != 0) {
+    n_s_dut_sdram_autorefresh_enable_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if ((uint64_t)((((uint64_t)(s_dut_sdram_init_done_i)) != 0) && ((~((uint64_t)(s_dut_sdram_selfrefresh_i)) & 0x1ULL) != 0)) != 0) {
+      n_s_dut_sdram_autorefresh_enable_i = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_dut_sdram_autorefresh_enable_i = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+}
+// ../ice40/reg_fifo.v:22
+void Vsim_top::q54_() {
+  if ((((uint64_t)(s_dut_rq_push)) & (~((uint64_t)(s_dut_rq_full)) & 0x1ULL)) != 0) {
+    { uint64_t t58 = ((uint64_t)((((uint64_t)(s_dut_req_queue_w_ptr)) >> 0) & 0x1ULL)); if (t58 >= 0 && t58 <= 1) nq_s_dut_req_queue_mem.push_back(std::make_pair(t58 - 0, (uint64_t)(((uint64_t)(s_dut_req_queue_w_data))))); }
+    n_s_dut_req_queue_w_ptr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_req_queue_w_ptr)))) + 0x1ULL) & 0xffffffffULL)) & 0x3ULL));
+  }
+  if ((((uint64_t)(s_dut_rq_pop)) & (~((uint64_t)(s_dut_rq_empty)) & 0x1ULL)) != 0) {
+    n_s_dut_req_queue_r_ptr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_req_queue_r_ptr)))) + 0x1ULL) & 0xffffffffULL)) & 0x3ULL));
+  }
+}
+// ../ice40/dpram.v:13
+void Vsim_top::q55_() {
+  if (((uint64_t)(s_dut_write_queue_mem_we)) != 0) {
+    { uint64_t t60 = ((uint64_t)(s_dut_write_queue_mem_w_adr)); if (t60 >= 0 && t60 <= 255) nq_s_dut_write_queue_mem_mem.push_back(std::make_pair(t60 - 0, (uint64_t)(((uint64_t)(s_dut_wq_w_entry))))); }
+  }
+  n_s_dut_write_queue_r_data = (((((uint64_t)(s_dut_write_queue_mem_r_adr))) <= 255) ? (uint64_t)s_dut_write_queue_mem_mem[(((uint64_t)(s_dut_write_queue_mem_r_adr))) - 0] : 0);
+}
+// ../ice40/fifo.v:24
+void Vsim_top::q56_() {
+  if (((uint64_t)(s_dut_write_queue_clr)) != 0) {
+    n_s_dut_write_queue_w_ptr = ((uint64_t)((0x0ULL) & 0x1ffULL));
+    n_s_dut_write_queue_r_ptr = ((uint64_t)((0x0ULL) & 0x1ffULL));
+  } else {
+    if ((((uint64_t)(s_dut_wq_push)) & (~((uint64_t)(s_dut_wq_full)) & 0x1ULL)) != 0) {
+      n_s_dut_write_queue_w_ptr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_write_queue_w_ptr)))) + 0x1ULL) & 0xffffffffULL)) & 0x1ffULL));
+    }
+    if ((((uint64_t)(s_dut_wq_pop)) & (~((uint64_t)(s_dut_wq_empty)) & 0x1ULL)) != 0) {
+      n_s_dut_write_queue_r_ptr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_write_queue_r_ptr)))) + 0x1ULL) & 0xffffffffULL)) & 0x1ffULL));
+    }
+  }
+}
+// ../ice40/dpram.v:13
+void Vsim_top::q57_() {
+  if (((uint64_t)(s_dut_stream_fifo_mem_we)) != 0) {
+    { uint64_t t62 = ((uint64_t)(s_dut_stream_fifo_mem_w_adr)); if (t62 >= 0 && t62 <= 255) nq_s_dut_stream_fifo_mem_mem.push_back(std::make_pair(t62 - 0, (uint64_t)(((uint64_t)(s_dut_sdram_data_out))))); }
+  }
+  n_s_dut_sf_q = (((((uint64_t)(s_dut_stream_fifo_mem_r_adr))) <= 255) ? (uint64_t)s_dut_stream_fifo_mem_mem[(((uint64_t)(s_dut_stream_fifo_mem_r_adr))) - 0] : 0);
+}
+// ../ice40/fifo.v:24
+void Vsim_top::q58_() {
+  if (((uint64_t)(s_dut_stream_restart)) != 0) {
+    n_s_dut_stream_fifo_w_ptr = ((uint64_t)((0x0ULL) & 0x1ffULL));
+    n_s_dut_stream_fifo_r_ptr = ((uint64_t)((0x0ULL) & 0x1ffULL));
+  } else {
+    if ((((uint64_t)(s_dut_sf_push)) & (~((uint64_t)(s_dut_sf_full)) & 0x1ULL)) != 0) {
+      n_s_dut_stream_fifo_w_ptr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_stream_fifo_w_ptr)))) + 0x1ULL) & 0xffffffffULL)) & 0x1ffULL));
+    }
+    if ((((uint64_t)(s_dut_stream_pop)) & (~((uint64_t)(s_dut_sf_empty)) & 0x1ULL)) != 0) {
+      n_s_dut_stream_fifo_r_ptr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_stream_fifo_r_ptr)))) + 0x1ULL) & 0xffffffffULL)) & 0x1ffULL));
+    }
+  }
+}
+// ../ice40/sdram_burst.v:52
+void Vsim_top::q59_() {
+  if (((~((uint64_t)(s_dut_pf_busy)) & 0x1ULL) & ((uint64_t)(s_dut_pf_start))) != 0) {
+    n_s_dut_prefetch_cur_adr = ((uint64_t)(s_dut_pf_adr));
+    n_s_dut_prefetch_left = ((uint64_t)(s_dut_prefetch_len));
+    n_s_dut_prefetch_rd_left = ((uint64_t)((((((uint64_t)(s_dut_prefetch_rwn)) != 0) ? ((uint64_t)(((uint64_t)(s_dut_prefetch_len)))) : 0x0ULL)) & 0xffffffULL));
+    n_s_dut_pf_count = ((uint64_t)((0x0ULL) & 0xffffffULL));
+    n_s_dut_pf_sd_rwn = ((uint64_t)(s_dut_prefetch_rwn));
+    n_s_dut_prefetch_st_idle = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_prefetch_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if (((uint64_t)(s_dut_prefetch_st_next)) != 0) {
+    n_s_dut_prefetch_st_next = ((uint64_t)((0x0ULL) & 0x1ULL));
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_prefetch_left)))) == 0x0ULL) != 0) {
+      n_s_dut_prefetch_st_idle = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_dut_pf_sd_adr = ((uint64_t)(s_dut_prefetch_cur_adr));
+      n_s_dut_pf_sd_len = ((uint64_t)(s_dut_prefetch_chunk));
+      n_s_dut_prefetch_req_len = ((uint64_t)((((uint64_t)(s_dut_prefetch_chunk_x)) >> 0) & 0xffffffULL));
+      n_s_dut_prefetch_cur_adr = ((uint64_t)(((uint64_t)(s_dut_prefetch_cur_adr)) + (((uint64_t)((0x0ULL) ? 0x3fffULL : (uint64_t)0) << 10) | (uint64_t)((uint64_t)(s_dut_prefetch_chunk)))) & 0xffffffULL);
+      n_s_dut_prefetch_left = ((uint64_t)(((uint64_t)(s_dut_prefetch_left)) - ((uint64_t)((((uint64_t)(s_dut_prefetch_chunk_x)) >> 0) & 0xffffffULL))) & 0xffffffULL);
+      if (((uint64_t)(s_dut_sdram_ready)) != 0) {
+        n_s_dut_pf_sd_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_dut_prefetch_st_doing = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_prefetch_st_pending = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if ((((uint64_t)(s_dut_prefetch_st_pending)) & ((uint64_t)(s_dut_sdram_ready))) != 0) {
+    n_s_dut_pf_sd_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+    n_s_dut_prefetch_st_pending = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_prefetch_st_doing = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if ((((uint64_t)(s_dut_prefetch_st_doing)) & ((uint64_t)(s_dut_sdram_ack))) != 0) {
+      n_s_dut_pf_sd_adv = ((uint64_t)((0x0ULL) & 0x1ULL));
+      if (((uint64_t)(s_dut_pf_sd_rwn)) != 0) {
+        n_s_dut_prefetch_st_doing = ((uint64_t)((0x0ULL) & 0x1ULL));
+        n_s_dut_prefetch_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if (((((uint64_t)(s_dut_pf_sd_rwn)) & (uint64_t)(((uint64_t)(((uint64_t)(s_dut_prefetch_rd_left)))) != 0x0ULL)) & ((uint64_t)(s_dut_sdram_data_valid))) != 0) {
+    n_s_dut_pf_count = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_pf_count)))) + 0x1ULL) & 0xffffffffULL)) & 0xffffffULL));
+    n_s_dut_prefetch_rd_left = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_prefetch_rd_left)))) - 0x1ULL) & 0xffffffffULL)) & 0xffffffULL));
+  }
+  if (((((uint64_t)(s_dut_prefetch_st_doing)) & (~((uint64_t)(s_dut_pf_sd_rwn)) & 0x1ULL)) & ((uint64_t)(s_dut_sdram_write_done))) != 0) {
+    n_s_dut_pf_count = ((uint64_t)(((uint64_t)(s_dut_pf_count)) + ((uint64_t)(s_dut_prefetch_req_len))) & 0xffffffULL);
+    n_s_dut_prefetch_st_doing = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_prefetch_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+}
+// ../ice40/sdram_burst.v:52
+void Vsim_top::q60_() {
+  if (((~((uint64_t)(s_dut_burst_busy)) & 0x1ULL) & ((uint64_t)(s_dut_burst_start))) != 0) {
+    n_s_dut_my_burst_cur_adr = ((uint64_t)(s_dut_my_burst_adr));
+    n_s_dut_my_burst_left = ((uint64_t)(s_dut_my_burst_len));
+    n_s_dut_my_burst_rd_left = ((uint64_t)((((((uint64_t)(s_dut_my_burst_rwn)) != 0) ? ((uint64_t)(((uint64_t)(s_dut_my_burst_len)))) : 0x0ULL)) & 0xffffffULL));
+    n_s_dut_burst_count = ((uint64_t)((0x0ULL) & 0xffffffULL));
+    n_s_dut_burst_sd_rwn = ((uint64_t)(s_dut_my_burst_rwn));
+    n_s_dut_my_burst_st_idle = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if (((uint64_t)(s_dut_my_burst_st_next)) != 0) {
+    n_s_dut_my_burst_st_next = ((uint64_t)((0x0ULL) & 0x1ULL));
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_burst_left)))) == 0x0ULL) != 0) {
+      n_s_dut_my_burst_st_idle = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_dut_burst_sd_adr = ((uint64_t)(s_dut_my_burst_cur_adr));
+      n_s_dut_burst_sd_len = ((uint64_t)(s_dut_my_burst_chunk));
+      n_s_dut_my_burst_req_len = ((uint64_t)((((uint64_t)(s_dut_my_burst_chunk_x)) >> 0) & 0xffffffULL));
+      n_s_dut_my_burst_cur_adr = ((uint64_t)(((uint64_t)(s_dut_my_burst_cur_adr)) + (((uint64_t)((0x0ULL) ? 0x3fffULL : (uint64_t)0) << 10) | (uint64_t)((uint64_t)(s_dut_my_burst_chunk)))) & 0xffffffULL);
+      n_s_dut_my_burst_left = ((uint64_t)(((uint64_t)(s_dut_my_burst_left)) - ((uint64_t)((((uint64_t)(s_dut_my_burst_chunk_x)) >> 0) & 0xffffffULL))) & 0xffffffULL);
+      if (((uint64_t)(s_dut_sdram_ready)) != 0) {
+        n_s_dut_burst_sd_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_dut_my_burst_st_doing = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_my_burst_st_pending = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if ((((uint64_t)(s_dut_my_burst_st_pending)) & ((uint64_t)(s_dut_sdram_ready))) != 0) {
+    n_s_dut_burst_sd_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+    n_s_dut_my_burst_st_pending = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_burst_st_doing = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if ((((uint64_t)(s_dut_my_burst_st_doing)) & ((uint64_t)(s_dut_sdram_ack))) != 0) {
+      n_s_dut_burst_sd_adv = ((uint64_t)((0x0ULL) & 0x1ULL));
+      if (((uint64_t)(s_dut_burst_sd_rwn)) != 0) {
+        n_s_dut_my_burst_st_doing = ((uint64_t)((0x0ULL) & 0x1ULL));
+        n_s_dut_my_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if (((((uint64_t)(s_dut_burst_sd_rwn)) & (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_burst_rd_left)))) != 0x0ULL)) & ((uint64_t)(s_dut_sdram_data_valid))) != 0) {
+    n_s_dut_burst_count = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_burst_count)))) + 0x1ULL) & 0xffffffffULL)) & 0xffffffULL));
+    n_s_dut_my_burst_rd_left = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_burst_rd_left)))) - 0x1ULL) & 0xffffffffULL)) & 0xffffffULL));
+  }
+  if (((((uint64_t)(s_dut_my_burst_st_doing)) & (~((uint64_t)(s_dut_burst_sd_rwn)) & 0x1ULL)) & ((uint64_t)(s_dut_sdram_write_done))) != 0) {
+    n_s_dut_burst_count = ((uint64_t)(((uint64_t)(s_dut_burst_count)) + ((uint64_t)(s_dut_my_burst_req_len))) & 0xffffffULL);
+    n_s_dut_my_burst_st_doing = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+}
+// ../ice40/dpram.v:13
+void Vsim_top::q61_() {
+  if (((uint64_t)(s_dut_bbuf_we)) != 0) {
+    { uint64_t t63 = ((uint64_t)(s_dut_bbuf_w_adr)); if (t63 >= 0 && t63 <= 255) nq_s_dut_burst_buf_mem.push_back(std::make_pair(t63 - 0, (uint64_t)(((uint64_t)(s_dut_bbuf_w_data))))); }
+  }
+  n_s_dut_bbuf_q = (((((uint64_t)(s_dut_bbuf_r_adr))) <= 255) ? (uint64_t)s_dut_burst_buf_mem[(((uint64_t)(s_dut_bbuf_r_adr))) - 0] : 0);
+}
+// ../ice40/dpram.v:13
+void Vsim_top::q62_() {
+  if (((uint64_t)(s_dut_my_cache_fill_done)) != 0) {
+    { uint64_t t64 = ((uint64_t)(s_dut_my_cache_idx)); if (t64 >= 0 && t64 <= 63) nq_s_dut_my_cache_tags_mem.push_back(std::make_pair(t64 - 0, (uint64_t)(((uint64_t)(s_dut_my_cache_tags_w_data))))); }
+  }
+  n_s_dut_my_cache_tag_q = (((((uint64_t)(s_dut_my_cache_idx))) <= 63) ? (uint64_t)s_dut_my_cache_tags_mem[(((uint64_t)(s_dut_my_cache_idx))) - 0] : 0);
+}
+// ../ice40/dpram.v:13
+void Vsim_top::q63_() {
+  if (((uint64_t)(s_dut_my_cache_fill_we)) != 0) {
+    { uint64_t t65 = ((uint64_t)(s_dut_my_cache_lines_w_adr)); if (t65 >= 0 && t65 <= 1023) nq_s_dut_my_cache_lines_mem.push_back(std::make_pair(t65 - 0, (uint64_t)(((uint64_t)(s_dut_sdram_data_out))))); }
+  }
+  n_s_dut_cache_q = (((((uint64_t)(s_dut_my_cache_lines_r_adr))) <= 1023) ? (uint64_t)s_dut_my_cache_lines_mem[(((uint64_t)(s_dut_my_cache_lines_r_adr))) - 0] : 0);
+}
+// ../ice40/read_cache.v:33
+void Vsim_top::q64_() {
+  if (((uint64_t)(s_dut_my_cache_inv_all)) != 0) {
+    n_s_dut_my_cache_valid = 0x0ULL;
+  } else {
+    if (((uint64_t)(s_dut_my_cache_fill_done)) != 0) {
+      { int64_t t66 = (int64_t)(((uint64_t)(s_dut_my_cache_idx))) - 0; if (t66 >= 0 && t66 <= 63) n_s_dut_my_cache_valid = (uint64_t)((((uint64_t)(n_s_dut_my_cache_valid)) & ~(0x1ULL << t66)) | (((uint64_t)(((uint64_t)((0x1ULL) & 0x1ULL))) & 0x1ULL) << t66)); }
+    }
+    if (((uint64_t)(s_dut_my_cache_inv)) != 0) {
+      { int64_t t67 = (int64_t)(((uint64_t)((((uint64_t)(s_dut_my_cache_inv_adr)) >> 4) & 0x3fULL))) - 0; if (t67 >= 0 && t67 <= 63) n_s_dut_my_cache_valid = (uint64_t)((((uint64_t)(n_s_dut_my_cache_valid)) & ~(0x1ULL << t67)) | (((uint64_t)(((uint64_t)((0x0ULL) & 0x1ULL))) & 0x1ULL) << t67)); }
+    }
+  }
+}
+// ../ice40/perf_counters.v:16
+void Vsim_top::q65_() {
+  s_dut_my_perf_i = 0x0ULL;
+  for (int t68 = 0; (uint64_t)(vl_s(((uint64_t)(s_dut_my_perf_i)), 32) < vl_s(0xdULL, 32)) != 0; ++t68) {
+    if (t68 > 1000000) vl_fatal("loop");
+    if (((uint64_t)(s_dut_perf_clr)) != 0) {
+      n_s_dut_my_perf_cnt.set((int64_t)(vl_s(((uint64_t)(0x20ULL * ((uint64_t)(s_dut_my_perf_i))) & 0xffffffffULL), 32)) - 0, 32, 0x0ULL);
+    } else {
+      if (vl_bit(((uint64_t)(s_dut_perf_ev)), (int64_t)(((uint64_t)(s_dut_my_perf_i))) - 0, 13) != 0) {
+        n_s_dut_my_perf_cnt.set((int64_t)(vl_s(((uint64_t)(0x20ULL * ((uint64_t)(s_dut_my_perf_i))) & 0xffffffffULL), 32)) - 0, 32, ((uint64_t)(s_dut_my_perf_cnt.get((int64_t)(vl_s(((uint64_t)(0x20ULL * ((uint64_t)(s_dut_my_perf_i))) & 0xffffffffULL), 32)) - 0, 32) + 0x1ULL) & 0xffffffffULL));
+      }
+    }
+    s_dut_my_perf_i = ((uint64_t)(((uint64_t)(s_dut_my_perf_i)) + 0x1ULL) & 0xffffffffULL);
+  }
+}
+// ../ice40/sdram_burst.v:52
+void Vsim_top::q66_() {
+  if (((~((uint64_t)(s_dut_my_bist_b_busy)) & 0x1ULL) & ((uint64_t)(s_dut_my_bist_b_start))) != 0) {
+    n_s_dut_my_bist_bist_burst_cur_adr = ((uint64_t)(s_dut_my_bist_c_adr));
+    n_s_dut_my_bist_bist_burst_left = ((uint64_t)(s_dut_my_bist_c_len));
+    n_s_dut_my_bist_bist_burst_rd_left = ((uint64_t)((((((uint64_t)(s_dut_my_bist_b_rwn)) != 0) ? ((uint64_t)(((uint64_t)(s_dut_my_bist_c_len)))) : 0x0ULL)) & 0x1ffffffULL));
+    n_s_dut_my_bist_b_count_unused = ((uint64_t)((0x0ULL) & 0x1ffffffULL));
+    n_s_dut_bist_sd_rwn = ((uint64_t)(s_dut_my_bist_b_rwn));
+    n_s_dut_my_bist_bist_burst_st_idle = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_bist_bist_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if (((uint64_t)(s_dut_my_bist_bist_burst_st_next)) != 0) {
+    n_s_dut_my_bist_bist_burst_st_next = ((uint64_t)((0x0ULL) & 0x1ULL));
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_bist_burst_left)))) == 0x0ULL) != 0) {
+      n_s_dut_my_bist_bist_burst_st_idle = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_dut_bist_sd_adr = ((uint64_t)(s_dut_my_bist_bist_burst_cur_adr));
+      n_s_dut_bist_sd_len = ((uint64_t)(s_dut_my_bist_bist_burst_chunk));
+      n_s_dut_my_bist_bist_burst_req_len = ((uint64_t)((((uint64_t)(s_dut_my_bist_bist_burst_chunk_x)) >> 0) & 0x1ffffffULL));
+      n_s_dut_my_bist_bist_burst_cur_adr = ((uint64_t)(((uint64_t)(s_dut_my_bist_bist_burst_cur_adr)) + (((uint64_t)((0x0ULL) ? 0x3fffULL : (uint64_t)0) << 10) | (uint64_t)((uint64_t)(s_dut_my_bist_bist_burst_chunk)))) & 0xffffffULL);
+      n_s_dut_my_bist_bist_burst_left = ((uint64_t)(((uint64_t)(s_dut_my_bist_bist_burst_left)) - ((uint64_t)((((uint64_t)(s_dut_my_bist_bist_burst_chunk_x)) >> 0) & 0x1ffffffULL))) & 0x1ffffffULL);
+      if (((uint64_t)(s_dut_sdram_ready)) != 0) {
+        n_s_dut_bist_sd_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_dut_my_bist_bist_burst_st_doing = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_my_bist_bist_burst_st_pending = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if ((((uint64_t)(s_dut_my_bist_bist_burst_st_pending)) & ((uint64_t)(s_dut_sdram_ready))) != 0) {
+    n_s_dut_bist_sd_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+    n_s_dut_my_bist_bist_burst_st_pending = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_bist_bist_burst_st_doing = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if ((((uint64_t)(s_dut_my_bist_bist_burst_st_doing)) & ((uint64_t)(s_dut_sdram_ack))) != 0) {
+      n_s_dut_bist_sd_adv = ((uint64_t)((0x0ULL) & 0x1ULL));
+      if (((uint64_t)(s_dut_bist_sd_rwn)) != 0) {
+        n_s_dut_my_bist_bist_burst_st_doing = ((uint64_t)((0x0ULL) & 0x1ULL));
+        n_s_dut_my_bist_bist_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if (((((uint64_t)(s_dut_bist_sd_rwn)) & (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_bist_burst_rd_left)))) != 0x0ULL)) & ((uint64_t)(s_dut_sdram_data_valid))) != 0) {
+    n_s_dut_my_bist_b_count_unused = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_b_count_unused)))) + 0x1ULL) & 0xffffffffULL)) & 0x1ffffffULL));
+    n_s_dut_my_bist_bist_burst_rd_left = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_bist_burst_rd_left)))) - 0x1ULL) & 0xffffffffULL)) & 0x1ffffffULL));
+  }
+  if (((((uint64_t)(s_dut_my_bist_bist_burst_st_doing)) & (~((uint64_t)(s_dut_bist_sd_rwn)) & 0x1ULL)) & ((uint64_t)(s_dut_sdram_write_done))) != 0) {
+    n_s_dut_my_bist_b_count_unused = ((uint64_t)(((uint64_t)(s_dut_my_bist_b_count_unused)) + ((uint64_t)(s_dut_my_bist_bist_burst_req_len))) & 0x1ffffffULL);
+    n_s_dut_my_bist_bist_burst_st_doing = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_bist_bist_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+}
+// ../ice40/sdram_bist.v:153
+void Vsim_top::q67_() {
+  n_s_dut_my_bist_b_start = ((uint64_t)((0x0ULL) & 0x1ULL));
+  if ((((uint64_t)(s_dut_my_bist_st_idle)) & ((uint64_t)(s_dut_bist_start))) != 0) {
+    n_s_dut_my_bist_pat_r = ((uint64_t)(s_dut_my_bist_pat));
+    n_s_dut_my_bist_seed_r = ((uint64_t)(s_dut_my_bist_seed));
+    n_s_dut_my_bist_base = ((uint64_t)(s_dut_my_bist_adr));
+    n_s_dut_my_bist_len_r = ((uint64_t)(s_dut_bist_len));
+    n_s_dut_my_bist_elem = ((uint64_t)((0x0ULL) & 0x7ULL));
+    n_s_dut_bist_errors = 0x0ULL;
+    n_s_dut_bist_fail_mask = ((uint64_t)((0x0ULL) & 0xffffULL));
+    n_s_dut_bist_nfail = ((uint64_t)((0x0ULL) & 0xfULL));
+    n_s_dut_my_bist_st_idle = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_bist_st_elem = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if (((uint64_t)(s_dut_my_bist_st_elem)) != 0) {
+    n_s_dut_my_bist_left = ((uint64_t)(s_dut_my_bist_len_r));
+    n_s_dut_my_bist_wr_lfsr = (((uint64_t)((uint64_t)(s_dut_my_bist_seed_r)) << 24) | ((uint64_t)0x5aULL << 16) | ((uint64_t)(~((uint64_t)(s_dut_my_bist_seed_r)) & 0xffULL) << 8) | (uint64_t)0xa5ULL);
+    n_s_dut_my_bist_rd_lfsr = (((uint64_t)((uint64_t)(s_dut_my_bist_seed_r)) << 24) | ((uint64_t)0x5aULL << 16) | ((uint64_t)(~((uint64_t)(s_dut_my_bist_seed_r)) & 0xffULL) << 8) | (uint64_t)0xa5ULL);
+    n_s_dut_my_bist_st_elem = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_bist_st_chunk = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if (((uint64_t)(s_dut_my_bist_st_chunk)) != 0) {
+    n_s_dut_my_bist_st_chunk = ((uint64_t)((0x0ULL) & 0x1ULL));
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_left)))) == 0x0ULL) != 0) {
+      if (((uint64_t)(s_dut_my_bist_el_last)) != 0) {
+        n_s_dut_my_bist_st_idle = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_my_bist_elem = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_elem)))) + 0x1ULL) & 0xffffffffULL)) & 0x7ULL));
+        n_s_dut_my_bist_st_elem = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    } else {
+      n_s_dut_my_bist_c_adr = ((uint64_t)(s_dut_my_bist_blk_adr));
+      n_s_dut_my_bist_c_len = ((uint64_t)(s_dut_my_bist_blk));
+      n_s_dut_my_bist_left = ((uint64_t)(((uint64_t)(s_dut_my_bist_left)) - ((uint64_t)(s_dut_my_bist_blk))) & 0x1ffffffULL);
+      n_s_dut_my_bist_rd_adr = ((uint64_t)(s_dut_my_bist_blk_adr));
+      n_s_dut_my_bist_wr_adr = ((uint64_t)(s_dut_my_bist_blk_adr));
+      n_s_dut_my_bist_b_rwn = ((uint64_t)(s_dut_my_bist_el_rd));
+      n_s_dut_my_bist_b_start = ((uint64_t)((0x1ULL) & 0x1ULL));
+      if (((uint64_t)(s_dut_my_bist_el_rd)) != 0) {
+        n_s_dut_my_bist_st_read = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_my_bist_st_write = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if (((((uint64_t)(s_dut_my_bist_st_read)) & (uint64_t)(((uint64_t)(s_dut_my_bist_b_start)) == 0)) & (uint64_t)(((uint64_t)(s_dut_my_bist_b_busy)) == 0)) != 0) {
+    n_s_dut_my_bist_st_read = ((uint64_t)((0x0ULL) & 0x1ULL));
+    if (((uint64_t)(s_dut_my_bist_el_wr)) != 0) {
+      n_s_dut_my_bist_b_rwn = ((uint64_t)((0x0ULL) & 0x1ULL));
+      n_s_dut_my_bist_b_start = ((uint64_t)((0x1ULL) & 0x1ULL));
+      n_s_dut_my_bist_st_write = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_dut_my_bist_st_chunk = ((uint64_t)((0x1ULL) & 0x1ULL));
+    }
+  }
+  if (((((uint64_t)(s_dut_my_bist_st_write)) & (uint64_t)(((uint64_t)(s_dut_my_bist_b_start)) == 0)) & (uint64_t)(((uint64_t)(s_dut_my_bist_b_busy)) == 0)) != 0) {
+    n_s_dut_my_bist_st_write = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_bist_st_chunk = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  n_s_dut_bist_wdata = f_dut_my_bist_pattern(((uint64_t)(s_dut_my_bist_pat_r)), ((uint64_t)(s_dut_my_bist_seed_r)), ((uint64_t)(s_dut_my_bist_wr_adr)), ((uint64_t)(s_dut_my_bist_wr_lfsr)), ((uint64_t)(s_dut_my_bist_el_wr_inv)));
+  if ((((uint64_t)(s_dut_my_bist_st_write)) & ((uint64_t)(s_dut_sdram_data_next))) != 0) {
+    n_s_dut_my_bist_wr_adr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_wr_adr)))) + 0x1ULL) & 0xffffffffULL)) & 0xffffffULL));
+    n_s_dut_my_bist_wr_lfsr = f_dut_my_bist_lfsr_next(((uint64_t)(s_dut_my_bist_wr_lfsr)));
+  }
+  n_s_dut_my_bist_c1_valid = (((uint64_t)(s_dut_my_bist_st_read)) & ((uint64_t)(s_dut_sdram_data_valid)));
+  if ((((uint64_t)(s_dut_my_bist_st_read)) & ((uint64_t)(s_dut_sdram_data_valid))) != 0) {
+    n_s_dut_my_bist_c1_got = ((uint64_t)(s_dut_sdram_data_out));
+    n_s_dut_my_bist_c1_exp = f_dut_my_bist_pattern(((uint64_t)(s_dut_my_bist_pat_r)), ((uint64_t)(s_dut_my_bist_seed_r)), ((uint64_t)(s_dut_my_bist_rd_adr)), ((uint64_t)(s_dut_my_bist_rd_lfsr)), ((uint64_t)(s_dut_my_bist_el_rd_inv)));
+    n_s_dut_my_bist_c1_adr = ((uint64_t)(s_dut_my_bist_rd_adr));
+    n_s_dut_my_bist_rd_adr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_bist_rd_adr)))) + 0x1ULL) & 0xffffffffULL)) & 0xffffffULL));
+    n_s_dut_my_bist_rd_lfsr = f_dut_my_bist_lfsr_next(((uint64_t)(s_dut_my_bist_rd_lfsr)));
+  }
+  if ((((uint64_t)(s_dut_my_bist_c1_valid)) & (uint64_t)(((uint64_t)(s_dut_my_bist_c1_got)) != ((uint64_t)(s_dut_my_bist_c1_exp)))) != 0) {
+    n_s_dut_bist_errors = ((uint64_t)(((uint64_t)(s_dut_bist_errors)) + 0x1ULL) & 0xffffffffULL);
+    n_s_dut_bist_fail_mask = (((uint64_t)(s_dut_bist_fail_mask)) | (((uint64_t)(s_dut_my_bist_c1_got)) ^ ((uint64_t)(s_dut_my_bist_c1_exp))));
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_bist_nfail)))) < 0x8ULL) != 0) {
+      { uint64_t t71 = ((uint64_t)((((uint64_t)(s_dut_bist_nfail)) >> 0) & 0x7ULL)); if (t71 >= 0 && t71 <= 7) nq_s_dut_my_bist_fails.push_back(std::make_pair(t71 - 0, (uint64_t)(((uint64_t)(s_dut_my_bist_c1_adr))))); }
+      n_s_dut_bist_nfail = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_bist_nfail)))) + 0x1ULL) & 0xffffffffULL)) & 0xfULL));
+    }
+  }
+}
+// ../ice40/dpram.v:13
+void Vsim_top::q68_() {
+  if (((uint64_t)(s_dut_my_copy_desc_q_mem_we)) != 0) {
+    { uint64_t t72 = ((uint64_t)(s_dut_my_copy_desc_q_mem_w_adr)); if (t72 >= 0 && t72 <= 15) nq_s_dut_my_copy_desc_q_mem_mem.push_back(std::make_pair(t72 - 0, (u128)(((u128)(s_dut_my_copy_desc_q_w_data))))); }
+  }
+  n_s_dut_my_copy_dq_head = (((((uint64_t)(s_dut_my_copy_desc_q_mem_r_adr))) <= 15) ? (u128)s_dut_my_copy_desc_q_mem_mem[(((uint64_t)(s_dut_my_copy_desc_q_mem_r_adr))) - 0] : 0);
+}
+// ../ice40/fifo.v:24
+void Vsim_top::q69_() {
+  if (((uint64_t)(s_dut_my_copy_desc_q_clr)) != 0) {
+    n_s_dut_my_copy_desc_q_w_ptr = ((uint64_t)((0x0ULL) & 0x1fULL));
+    n_s_dut_my_copy_desc_q_r_ptr = ((uint64_t)((0x0ULL) & 0x1fULL));
+  } else {
+    if ((((uint64_t)(s_dut_cp_push)) & (~((uint64_t)(s_dut_cp_full)) & 0x1ULL)) != 0) {
+      n_s_dut_my_copy_desc_q_w_ptr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_desc_q_w_ptr)))) + 0x1ULL) & 0xffffffffULL)) & 0x1fULL));
+    }
+    if ((((uint64_t)(s_dut_my_copy_dq_pop)) & (~((uint64_t)(s_dut_my_copy_dq_empty)) & 0x1ULL)) != 0) {
+      n_s_dut_my_copy_desc_q_r_ptr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_desc_q_r_ptr)))) + 0x1ULL) & 0xffffffffULL)) & 0x1fULL));
+    }
+  }
+}
+// ../ice40/sdram_burst.v:52
+void Vsim_top::q70_() {
+  if (((~((uint64_t)(s_dut_my_copy_b_busy)) & 0x1ULL) & ((uint64_t)(s_dut_my_copy_b_start))) != 0) {
+    n_s_dut_my_copy_copy_burst_cur_adr = ((uint64_t)(s_dut_my_copy_b_adr));
+    n_s_dut_my_copy_copy_burst_left = ((uint64_t)(s_dut_my_copy_blk));
+    n_s_dut_my_copy_copy_burst_rd_left = ((uint64_t)((((((uint64_t)(s_dut_my_copy_b_rwn)) != 0) ? ((uint64_t)(((uint64_t)(s_dut_my_copy_blk)))) : 0x0ULL)) & 0x1ffffffULL));
+    n_s_dut_my_copy_b_count_unused = ((uint64_t)((0x0ULL) & 0x1ffffffULL));
+    n_s_dut_cp_sd_rwn = ((uint64_t)(s_dut_my_copy_b_rwn));
+    n_s_dut_my_copy_copy_burst_st_idle = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_copy_copy_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if (((uint64_t)(s_dut_my_copy_copy_burst_st_next)) != 0) {
+    n_s_dut_my_copy_copy_burst_st_next = ((uint64_t)((0x0ULL) & 0x1ULL));
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_copy_burst_left)))) == 0x0ULL) != 0) {
+      n_s_dut_my_copy_copy_burst_st_idle = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_dut_cp_sd_adr = ((uint64_t)(s_dut_my_copy_copy_burst_cur_adr));
+      n_s_dut_cp_sd_len = ((uint64_t)(s_dut_my_copy_copy_burst_chunk));
+      n_s_dut_my_copy_copy_burst_req_len = ((uint64_t)((((uint64_t)(s_dut_my_copy_copy_burst_chunk_x)) >> 0) & 0x1ffffffULL));
+      n_s_dut_my_copy_copy_burst_cur_adr = ((uint64_t)(((uint64_t)(s_dut_my_copy_copy_burst_cur_adr)) + (((uint64_t)((0x0ULL) ? 0x3fffULL : (uint64_t)0) << 10) | (uint64_t)((uint64_t)(s_dut_my_copy_copy_burst_chunk)))) & 0xffffffULL);
+      n_s_dut_my_copy_copy_burst_left = ((uint64_t)(((uint64_t)(s_dut_my_copy_copy_burst_left)) - ((uint64_t)((((uint64_t)(s_dut_my_copy_copy_burst_chunk_x)) >> 0) & 0x1ffffffULL))) & 0x1ffffffULL);
+      if (((uint64_t)(s_dut_sdram_ready)) != 0) {
+        n_s_dut_cp_sd_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_dut_my_copy_copy_burst_st_doing = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_my_copy_copy_burst_st_pending = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if ((((uint64_t)(s_dut_my_copy_copy_burst_st_pending)) & ((uint64_t)(s_dut_sdram_ready))) != 0) {
+    n_s_dut_cp_sd_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+    n_s_dut_my_copy_copy_burst_st_pending = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_copy_copy_burst_st_doing = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if ((((uint64_t)(s_dut_my_copy_copy_burst_st_doing)) & ((uint64_t)(s_dut_sdram_ack))) != 0) {
+      n_s_dut_cp_sd_adv = ((uint64_t)((0x0ULL) & 0x1ULL));
+      if (((uint64_t)(s_dut_cp_sd_rwn)) != 0) {
+        n_s_dut_my_copy_copy_burst_st_doing = ((uint64_t)((0x0ULL) & 0x1ULL));
+        n_s_dut_my_copy_copy_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if (((((uint64_t)(s_dut_cp_sd_rwn)) & (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_copy_burst_rd_left)))) != 0x0ULL)) & ((uint64_t)(s_dut_sdram_data_valid))) != 0) {
+    n_s_dut_my_copy_b_count_unused = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_b_count_unused)))) + 0x1ULL) & 0xffffffffULL)) & 0x1ffffffULL));
+    n_s_dut_my_copy_copy_burst_rd_left = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_copy_burst_rd_left)))) - 0x1ULL) & 0xffffffffULL)) & 0x1ffffffULL));
+  }
+  if (((((uint64_t)(s_dut_my_copy_copy_burst_st_doing)) & (~((uint64_t)(s_dut_cp_sd_rwn)) & 0x1ULL)) & ((uint64_t)(s_dut_sdram_write_done))) != 0) {
+    n_s_dut_my_copy_b_count_unused = ((uint64_t)(((uint64_t)(s_dut_my_copy_b_count_unused)) + ((uint64_t)(s_dut_my_copy_copy_burst_req_len))) & 0x1ffffffULL);
+    n_s_dut_my_copy_copy_burst_st_doing = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_copy_copy_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+}
+// ../ice40/dpram.v:13
+void Vsim_top::q71_() {
+  if (((uint64_t)(s_dut_my_copy_copy_buf_we)) != 0) {
+    { uint64_t t73 = ((uint64_t)(s_dut_my_copy_buf_w_idx)); if (t73 >= 0 && t73 <= 511) nq_s_dut_my_copy_copy_buf_mem.push_back(std::make_pair(t73 - 0, (uint64_t)(((uint64_t)(s_dut_sdram_data_out))))); }
+  }
+  n_s_dut_my_copy_buf_q = (((((uint64_t)(s_dut_my_copy_buf_r_idx))) <= 511) ? (uint64_t)s_dut_my_copy_copy_buf_mem[(((uint64_t)(s_dut_my_copy_buf_r_idx))) - 0] : 0);
+}
+// ../ice40/sdram_copy.v:95
+void Vsim_top::q72_() {
+  n_s_dut_my_copy_dq_ready = ((uint64_t)(((uint64_t)(s_dut_my_copy_dq_empty)) == 0) & (uint64_t)(((uint64_t)(s_dut_my_copy_dq_pop)) == 0));
+  n_s_dut_my_copy_b_start = ((uint64_t)((0x0ULL) & 0x1ULL));
+  if (((uint64_t)(s_dut_my_copy_dq_pop)) != 0) {
+    { u128 t74 = ((u128)(s_dut_my_copy_dq_head));
+      n_s_dut_my_copy_c_src = ((uint64_t)((t74 >> 0) & ((((u128)0x0ULL) << 64) | 0xffffffULL)));
+      n_s_dut_my_copy_c_dst = ((uint64_t)((t74 >> 24) & ((((u128)0x0ULL) << 64) | 0xffffffULL)));
+      n_s_dut_my_copy_c_left = ((uint64_t)((t74 >> 48) & ((((u128)0x0ULL) << 64) | 0x1ffffffULL)));
+      n_s_dut_my_copy_c_irq = ((uint64_t)((t74 >> 73) & ((((u128)0x0ULL) << 64) | 0x1ULL)));
+      n_s_dut_my_copy_c_fill = ((uint64_t)((t74 >> 74) & ((((u128)0x0ULL) << 64) | 0x1ULL)));
+    }
+    n_s_dut_my_copy_have = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if (((uint64_t)(s_dut_my_copy_irq_clr)) != 0) {
+    n_s_dut_my_copy_irq_r = ((uint64_t)((0x0ULL) & 0x1ULL));
+  }
+  if ((((((uint64_t)(s_dut_my_copy_have)) & (uint64_t)(((uint64_t)(s_dut_cp_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_my_copy_b_start)) == 0)) & (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_c_left)))) == 0x0ULL)) != 0) {
+    n_s_dut_my_copy_have = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_copy_n_done = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_n_done)))) + 0x1ULL) & 0xffffffffULL)) & 0xffULL));
+    if (((uint64_t)(s_dut_my_copy_c_irq)) != 0) {
+      n_s_dut_my_copy_irq_r = ((uint64_t)((0x1ULL) & 0x1ULL));
+    }
+  } else {
+    if ((((((uint64_t)(s_dut_my_copy_have)) & (uint64_t)(((uint64_t)(s_dut_cp_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_my_copy_b_start)) == 0)) & ((uint64_t)(s_dut_cp_go))) != 0) {
+      n_s_dut_my_copy_blk = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_c_left)))) > 0x200ULL) != 0) ? 0x200ULL : ((uint64_t)(((uint64_t)(s_dut_my_copy_c_left)))))) & 0x1ffffffULL));
+      n_s_dut_my_copy_b_rwn = (uint64_t)(((uint64_t)(s_dut_my_copy_c_fill)) == 0);
+      n_s_dut_my_copy_b_adr = ((((uint64_t)(s_dut_my_copy_c_fill)) != 0) ? ((uint64_t)(s_dut_my_copy_c_dst)) : ((uint64_t)(s_dut_my_copy_c_src)));
+      n_s_dut_my_copy_b_start = ((uint64_t)((0x1ULL) & 0x1ULL));
+      n_s_dut_my_copy_buf_w_idx = ((uint64_t)((0x0ULL) & 0x1ffULL));
+      n_s_dut_my_copy_buf_r_idx = ((uint64_t)((0x0ULL) & 0x1ffULL));
+      if (((uint64_t)(s_dut_my_copy_c_fill)) != 0) {
+        n_s_dut_my_copy_st_write = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_my_copy_st_read = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if ((((uint64_t)(s_dut_my_copy_st_read)) & ((uint64_t)(s_dut_sdram_data_valid))) != 0) {
+    n_s_dut_my_copy_buf_w_idx = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_buf_w_idx)))) + 0x1ULL) & 0xffffffffULL)) & 0x1ffULL));
+  }
+  if ((((uint64_t)(s_dut_my_copy_st_write)) & ((uint64_t)(s_dut_sdram_data_next))) != 0) {
+    n_s_dut_my_copy_buf_r_idx = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_copy_buf_r_idx)))) + 0x1ULL) & 0xffffffffULL)) & 0x1ffULL));
+  }
+  if (((((uint64_t)(s_dut_my_copy_st_read)) & (uint64_t)(((uint64_t)(s_dut_my_copy_b_start)) == 0)) & (uint64_t)(((uint64_t)(s_dut_my_copy_b_busy)) == 0)) != 0) {
+    n_s_dut_my_copy_st_read = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_copy_st_write = ((uint64_t)((0x1ULL) & 0x1ULL));
+    n_s_dut_my_copy_b_rwn = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_copy_b_adr = ((uint64_t)(s_dut_my_copy_c_dst));
+    n_s_dut_my_copy_b_start = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if (((((uint64_t)(s_dut_my_copy_st_write)) & (uint64_t)(((uint64_t)(s_dut_my_copy_b_start)) == 0)) & (uint64_t)(((uint64_t)(s_dut_my_copy_b_busy)) == 0)) != 0) {
+    n_s_dut_my_copy_st_write = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_copy_c_left = ((uint64_t)(((uint64_t)(s_dut_my_copy_c_left)) - ((uint64_t)(s_dut_my_copy_blk))) & 0x1ffffffULL);
+    n_s_dut_my_copy_c_dst = ((uint64_t)(((uint64_t)(s_dut_my_copy_c_dst)) + ((uint64_t)((((uint64_t)(s_dut_my_copy_blk)) >> 0) & 0xffffffULL))) & 0xffffffULL);
+    if ((uint64_t)(((uint64_t)(s_dut_my_copy_c_fill)) == 0) != 0) {
+      n_s_dut_my_copy_c_src = ((uint64_t)(((uint64_t)(s_dut_my_copy_c_src)) + ((uint64_t)((((uint64_t)(s_dut_my_copy_blk)) >> 0) & 0xffffffULL))) & 0xffffffULL);
+    }
+  }
+}
+// ../ice40/sdram_burst.v:52
+void Vsim_top::q73_() {
+  if (((~((uint64_t)(s_dut_my_atomic_b_busy)) & 0x1ULL) & ((uint64_t)(s_dut_my_atomic_b_start))) != 0) {
+    n_s_dut_my_atomic_atomic_burst_cur_adr = ((uint64_t)(s_dut_my_atomic_adr_r));
+    n_s_dut_my_atomic_atomic_burst_left = ((uint64_t)(s_dut_my_atomic_atomic_burst_len));
+    n_s_dut_my_atomic_atomic_burst_rd_left = ((uint64_t)((((((uint64_t)(s_dut_my_atomic_b_rwn)) != 0) ? ((uint64_t)(((uint64_t)(s_dut_my_atomic_atomic_burst_len)))) : 0x0ULL)) & 0x3ULL));
+    n_s_dut_my_atomic_b_count_unused = ((uint64_t)((0x0ULL) & 0x3ULL));
+    n_s_dut_at_sd_rwn = ((uint64_t)(s_dut_my_atomic_b_rwn));
+    n_s_dut_my_atomic_atomic_burst_st_idle = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_atomic_atomic_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if (((uint64_t)(s_dut_my_atomic_atomic_burst_st_next)) != 0) {
+    n_s_dut_my_atomic_atomic_burst_st_next = ((uint64_t)((0x0ULL) & 0x1ULL));
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_atomic_atomic_burst_left)))) == 0x0ULL) != 0) {
+      n_s_dut_my_atomic_atomic_burst_st_idle = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_dut_at_sd_adr = ((uint64_t)(s_dut_my_atomic_atomic_burst_cur_adr));
+      n_s_dut_at_sd_len = ((uint64_t)(s_dut_my_atomic_atomic_burst_chunk));
+      n_s_dut_my_atomic_atomic_burst_req_len = ((uint64_t)((((uint64_t)(s_dut_my_atomic_atomic_burst_chunk_x)) >> 0) & 0x3ULL));
+      n_s_dut_my_atomic_atomic_burst_cur_adr = ((uint64_t)(((uint64_t)(s_dut_my_atomic_atomic_burst_cur_adr)) + (((uint64_t)((0x0ULL) ? 0x3fffULL : (uint64_t)0) << 10) | (uint64_t)((uint64_t)(s_dut_my_atomic_atomic_burst_chunk)))) & 0xffffffULL);
+      n_s_dut_my_atomic_atomic_burst_left = ((uint64_t)(((uint64_t)(s_dut_my_atomic_atomic_burst_left)) - ((uint64_t)((((uint64_t)(s_dut_my_atomic_atomic_burst_chunk_x)) >> 0) & 0x3ULL))) & 0x3ULL);
+      if (((uint64_t)(s_dut_sdram_ready)) != 0) {
+        n_s_dut_at_sd_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_dut_my_atomic_atomic_burst_st_doing = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_my_atomic_atomic_burst_st_pending = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if ((((uint64_t)(s_dut_my_atomic_atomic_burst_st_pending)) & ((uint64_t)(s_dut_sdram_ready))) != 0) {
+    n_s_dut_at_sd_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+    n_s_dut_my_atomic_atomic_burst_st_pending = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_atomic_atomic_burst_st_doing = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if ((((uint64_t)(s_dut_my_atomic_atomic_burst_st_doing)) & ((uint64_t)(s_dut_sdram_ack))) != 0) {
+      n_s_dut_at_sd_adv = ((uint64_t)((0x0ULL) & 0x1ULL));
+      if (((uint64_t)(s_dut_at_sd_rwn)) != 0) {
+        n_s_dut_my_atomic_atomic_burst_st_doing = ((uint64_t)((0x0ULL) & 0x1ULL));
+        n_s_dut_my_atomic_atomic_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if (((((uint64_t)(s_dut_at_sd_rwn)) & (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_atomic_atomic_burst_rd_left)))) != 0x0ULL)) & ((uint64_t)(s_dut_sdram_data_valid))) != 0) {
+    n_s_dut_my_atomic_b_count_unused = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_atomic_b_count_unused)))) + 0x1ULL) & 0xffffffffULL)) & 0x3ULL));
+    n_s_dut_my_atomic_atomic_burst_rd_left = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_atomic_atomic_burst_rd_left)))) - 0x1ULL) & 0xffffffffULL)) & 0x3ULL));
+  }
+  if (((((uint64_t)(s_dut_my_atomic_atomic_burst_st_doing)) & (~((uint64_t)(s_dut_at_sd_rwn)) & 0x1ULL)) & ((uint64_t)(s_dut_sdram_write_done))) != 0) {
+    n_s_dut_my_atomic_b_count_unused = ((uint64_t)(((uint64_t)(s_dut_my_atomic_b_count_unused)) + ((uint64_t)(s_dut_my_atomic_atomic_burst_req_len))) & 0x3ULL);
+    n_s_dut_my_atomic_atomic_burst_st_doing = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_atomic_atomic_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+}
+// ../ice40/sdram_atomic.v:72
+void Vsim_top::q74_() {
+  n_s_dut_my_atomic_b_start = ((uint64_t)((0x0ULL) & 0x1ULL));
+  if ((((uint64_t)(s_dut_my_atomic_start)) & (uint64_t)(((uint64_t)(s_dut_my_atomic_pend)) == 0)) != 0) {
+    n_s_dut_my_atomic_op_r = ((uint64_t)(s_dut_my_atomic_op));
+    n_s_dut_my_atomic_size32_r = ((uint64_t)(s_dut_my_atomic_size32));
+    n_s_dut_my_atomic_adr_r = ((uint64_t)(s_dut_my_atomic_adr));
+    n_s_dut_my_atomic_arg_r = ((uint64_t)(s_dut_at_arg));
+    n_s_dut_my_atomic_cmp_r = ((uint64_t)(s_dut_at_cmp));
+    n_s_dut_my_atomic_pend = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if ((((((uint64_t)(s_dut_my_atomic_pend)) & (uint64_t)(((uint64_t)(s_dut_at_busy)) == 0)) & (uint64_t)(((uint64_t)(s_dut_my_atomic_b_start)) == 0)) & ((uint64_t)(s_dut_at_go))) != 0) {
+    n_s_dut_my_atomic_b_rwn = ((uint64_t)((0x1ULL) & 0x1ULL));
+    n_s_dut_my_atomic_b_start = ((uint64_t)((0x1ULL) & 0x1ULL));
+    n_s_dut_my_atomic_r_idx = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_at_result = 0x0ULL;
+    n_s_dut_my_atomic_st_read = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if ((((uint64_t)(s_dut_my_atomic_st_read)) & ((uint64_t)(s_dut_sdram_data_valid))) != 0) {
+    if (((uint64_t)(s_dut_my_atomic_r_idx)) != 0) {
+      n_s_dut_at_result = (uint32_t)((((uint64_t)(n_s_dut_at_result)) & ~(0xffffULL << 16)) | (((uint64_t)(((uint64_t)(s_dut_sdram_data_out))) & 0xffffULL) << 16));
+    } else {
+      n_s_dut_at_result = (uint32_t)((((uint64_t)(n_s_dut_at_result)) & ~(0xffffULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_sdram_data_out))) & 0xffffULL) << 0));
+    }
+    n_s_dut_my_atomic_r_idx = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if (((((uint64_t)(s_dut_my_atomic_st_read)) & (uint64_t)(((uint64_t)(s_dut_my_atomic_b_start)) == 0)) & (uint64_t)(((uint64_t)(s_dut_my_atomic_b_busy)) == 0)) != 0) {
+    n_s_dut_my_atomic_st_read = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_atomic_nv = ((uint64_t)(s_dut_my_atomic_alu));
+    n_s_dut_my_atomic_w_idx = ((uint64_t)((0x0ULL) & 0x1ULL));
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_atomic_op_r)) != 0x2ULL) != 0) || (((uint64_t)(s_dut_my_atomic_match)) != 0)) != 0) {
+      n_s_dut_my_atomic_b_rwn = ((uint64_t)((0x0ULL) & 0x1ULL));
+      n_s_dut_my_atomic_b_start = ((uint64_t)((0x1ULL) & 0x1ULL));
+      n_s_dut_my_atomic_st_write = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_dut_my_atomic_pend = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+  n_s_dut_at_wdata = ((((uint64_t)(s_dut_my_atomic_w_idx)) != 0) ? ((uint64_t)((((uint64_t)(s_dut_my_atomic_nv)) >> 16) & 0xffffULL)) : ((uint64_t)((((uint64_t)(s_dut_my_atomic_nv)) >> 0) & 0xffffULL)));
+  if ((((uint64_t)(s_dut_my_atomic_st_write)) & ((uint64_t)(s_dut_sdram_data_next))) != 0) {
+    n_s_dut_my_atomic_w_idx = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if (((((uint64_t)(s_dut_my_atomic_st_write)) & (uint64_t)(((uint64_t)(s_dut_my_atomic_b_start)) == 0)) & (uint64_t)(((uint64_t)(s_dut_my_atomic_b_busy)) == 0)) != 0) {
+    n_s_dut_my_atomic_st_write = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_atomic_pend = ((uint64_t)((0x0ULL) & 0x1ULL));
+  }
+}
+// ../ice40/sdram_burst.v:52
+void Vsim_top::q75_() {
+  if (((~((uint64_t)(s_dut_my_reader_b_busy)) & 0x1ULL) & ((uint64_t)(s_dut_my_reader_b_start))) != 0) {
+    n_s_dut_my_reader_reader_burst_cur_adr = ((uint64_t)(s_dut_my_reader_cur));
+    n_s_dut_my_reader_reader_burst_left = ((uint64_t)(s_dut_my_reader_blk));
+    n_s_dut_my_reader_reader_burst_rd_left = ((uint64_t)((((((uint64_t)(s_dut_my_reader_reader_burst_rwn)) != 0) ? ((uint64_t)(((uint64_t)(s_dut_my_reader_blk)))) : 0x0ULL)) & 0x1ffffffULL));
+    n_s_dut_my_reader_b_count_unused = ((uint64_t)((0x0ULL) & 0x1ffffffULL));
+    n_s_dut_rdr_sd_rwn = ((uint64_t)(s_dut_my_reader_reader_burst_rwn));
+    n_s_dut_my_reader_reader_burst_st_idle = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_reader_reader_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if (((uint64_t)(s_dut_my_reader_reader_burst_st_next)) != 0) {
+    n_s_dut_my_reader_reader_burst_st_next = ((uint64_t)((0x0ULL) & 0x1ULL));
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_reader_reader_burst_left)))) == 0x0ULL) != 0) {
+      n_s_dut_my_reader_reader_burst_st_idle = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      n_s_dut_rdr_sd_adr = ((uint64_t)(s_dut_my_reader_reader_burst_cur_adr));
+      n_s_dut_rdr_sd_len = ((uint64_t)(s_dut_my_reader_reader_burst_chunk));
+      n_s_dut_my_reader_reader_burst_req_len = ((uint64_t)((((uint64_t)(s_dut_my_reader_reader_burst_chunk_x)) >> 0) & 0x1ffffffULL));
+      n_s_dut_my_reader_reader_burst_cur_adr = ((uint64_t)(((uint64_t)(s_dut_my_reader_reader_burst_cur_adr)) + (((uint64_t)((0x0ULL) ? 0x3fffULL : (uint64_t)0) << 10) | (uint64_t)((uint64_t)(s_dut_my_reader_reader_burst_chunk)))) & 0xffffffULL);
+      n_s_dut_my_reader_reader_burst_left = ((uint64_t)(((uint64_t)(s_dut_my_reader_reader_burst_left)) - ((uint64_t)((((uint64_t)(s_dut_my_reader_reader_burst_chunk_x)) >> 0) & 0x1ffffffULL))) & 0x1ffffffULL);
+      if (((uint64_t)(s_dut_sdram_ready)) != 0) {
+        n_s_dut_rdr_sd_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_dut_my_reader_reader_burst_st_doing = ((uint64_t)((0x1ULL) & 0x1ULL));
+      } else {
+        n_s_dut_my_reader_reader_burst_st_pending = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if ((((uint64_t)(s_dut_my_reader_reader_burst_st_pending)) & ((uint64_t)(s_dut_sdram_ready))) != 0) {
+    n_s_dut_rdr_sd_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+    n_s_dut_my_reader_reader_burst_st_pending = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_reader_reader_burst_st_doing = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if ((((uint64_t)(s_dut_my_reader_reader_burst_st_doing)) & ((uint64_t)(s_dut_sdram_ack))) != 0) {
+      n_s_dut_rdr_sd_adv = ((uint64_t)((0x0ULL) & 0x1ULL));
+      if (((uint64_t)(s_dut_rdr_sd_rwn)) != 0) {
+        n_s_dut_my_reader_reader_burst_st_doing = ((uint64_t)((0x0ULL) & 0x1ULL));
+        n_s_dut_my_reader_reader_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+      }
+    }
+  }
+  if (((((uint64_t)(s_dut_rdr_sd_rwn)) & (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_reader_reader_burst_rd_left)))) != 0x0ULL)) & ((uint64_t)(s_dut_sdram_data_valid))) != 0) {
+    n_s_dut_my_reader_b_count_unused = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_reader_b_count_unused)))) + 0x1ULL) & 0xffffffffULL)) & 0x1ffffffULL));
+    n_s_dut_my_reader_reader_burst_rd_left = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_reader_reader_burst_rd_left)))) - 0x1ULL) & 0xffffffffULL)) & 0x1ffffffULL));
+  }
+  if (((((uint64_t)(s_dut_my_reader_reader_burst_st_doing)) & (~((uint64_t)(s_dut_rdr_sd_rwn)) & 0x1ULL)) & ((uint64_t)(s_dut_sdram_write_done))) != 0) {
+    n_s_dut_my_reader_b_count_unused = ((uint64_t)(((uint64_t)(s_dut_my_reader_b_count_unused)) + ((uint64_t)(s_dut_my_reader_reader_burst_req_len))) & 0x1ffffffULL);
+    n_s_dut_my_reader_reader_burst_st_doing = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_reader_reader_burst_st_next = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+}
+// ../ice40/sdram_reader.v:45
+void Vsim_top::q76_() {
+  n_s_dut_my_reader_b_start = ((uint64_t)((0x0ULL) & 0x1ULL));
+  if ((((uint64_t)(s_dut_rdr_start)) & (uint64_t)(((uint64_t)(s_dut_my_reader_pend)) == 0)) != 0) {
+    n_s_dut_my_reader_cur = ((uint64_t)(s_dut_my_reader_adr));
+    n_s_dut_my_reader_left = ((uint64_t)(s_dut_range_len));
+    n_s_dut_my_reader_pend = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+  if ((((((uint64_t)(s_dut_my_reader_pend)) & (uint64_t)(((uint64_t)(s_dut_my_reader_st_read)) == 0)) & (uint64_t)(((uint64_t)(s_dut_my_reader_b_start)) == 0)) & ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_reader_left)))) == 0x0ULL) | ((uint64_t)(s_dut_my_reader_stop)))) != 0) {
+    n_s_dut_my_reader_pend = ((uint64_t)((0x0ULL) & 0x1ULL));
+  } else {
+    if ((((((uint64_t)(s_dut_my_reader_pend)) & (uint64_t)(((uint64_t)(s_dut_my_reader_st_read)) == 0)) & (uint64_t)(((uint64_t)(s_dut_my_reader_b_start)) == 0)) & ((uint64_t)(s_dut_rdr_go))) != 0) {
+      n_s_dut_my_reader_blk = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_reader_left)))) > 0x200ULL) != 0) ? 0x200ULL : ((uint64_t)(((uint64_t)(s_dut_my_reader_left)))))) & 0x1ffffffULL));
+      n_s_dut_my_reader_b_start = ((uint64_t)((0x1ULL) & 0x1ULL));
+      n_s_dut_my_reader_st_read = ((uint64_t)((0x1ULL) & 0x1ULL));
+    }
+  }
+  if (((((uint64_t)(s_dut_my_reader_st_read)) & (uint64_t)(((uint64_t)(s_dut_my_reader_b_start)) == 0)) & (uint64_t)(((uint64_t)(s_dut_my_reader_b_busy)) == 0)) != 0) {
+    n_s_dut_my_reader_st_read = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_reader_cur = ((uint64_t)(((uint64_t)(s_dut_my_reader_cur)) + ((uint64_t)((((uint64_t)(s_dut_my_reader_blk)) >> 0) & 0xffffffULL))) & 0xffffffULL);
+    n_s_dut_my_reader_left = ((uint64_t)(((uint64_t)(s_dut_my_reader_left)) - ((uint64_t)(s_dut_my_reader_blk))) & 0x1ffffffULL);
+  }
+}
+// ../ice40/sdram_crc.v:34
+void Vsim_top::q77_() {
+  n_s_dut_my_crc_d_valid = (((uint64_t)(s_dut_my_crc_valid)) & (uint64_t)(((uint64_t)(s_dut_crc_start)) == 0));
+  n_s_dut_my_crc_d = ((uint64_t)(s_dut_rdr_data));
+  if (((uint64_t)(s_dut_crc_start)) != 0) {
+    n_s_dut_my_crc_c = 0xffffffffULL;
+    n_s_dut_crc_sum = 0x0ULL;
+  } else {
+    if (((uint64_t)(s_dut_my_crc_d_valid)) != 0) {
+      n_s_dut_my_crc_c = f_dut_my_crc_crc32_16(((uint64_t)(s_dut_my_crc_c)), ((uint64_t)(s_dut_my_crc_d)));
+      n_s_dut_crc_sum = ((uint64_t)(((uint64_t)(s_dut_crc_sum)) + (((uint64_t)0x0ULL << 16) | (uint64_t)((uint64_t)(s_dut_my_crc_d)))) & 0xffffffffULL);
+    }
+  }
+}
+// ../ice40/sdram_scan.v:58
+void Vsim_top::q78_() {
+  if (((uint64_t)(s_dut_scan_start)) != 0) {
+    n_s_dut_my_scan_op_r = ((uint64_t)(s_dut_my_scan_op));
+    n_s_dut_my_scan_sgn_r = ((uint64_t)(s_dut_my_scan_sgn));
+    n_s_dut_my_scan_key_r = ((uint64_t)(s_dut_scan_key));
+    n_s_dut_my_scan_mask_r = ((uint64_t)(s_dut_scan_mask));
+    n_s_dut_my_scan_step = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_scan_stride)))) == 0x0ULL) != 0) ? 0x0ULL : ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_scan_stride)))) - 0x1ULL) & 0xffffffffULL))) & 0xffULL));
+    n_s_dut_my_scan_skip = ((uint64_t)((0x0ULL) & 0xffULL));
+    n_s_dut_my_scan_pos = ((uint64_t)((0x0ULL) & 0x1ffffffULL));
+    n_s_dut_my_scan_hit = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_my_scan_d_valid = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_scan_result = 0x0ULL;
+    n_s_dut_scan_index = (((uint64_t)(((uint64_t)(s_dut_my_scan_op)) == 0x4ULL) != 0) ? 0x0ULL : 0xffffffffULL);
+  } else {
+    n_s_dut_my_scan_d_valid = (((uint64_t)(s_dut_my_scan_valid)) & (uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_scan_skip)))) == 0x0ULL));
+    n_s_dut_my_scan_d = ((uint64_t)(s_dut_rdr_data));
+    n_s_dut_my_scan_d_pos = ((uint64_t)(s_dut_my_scan_pos));
+    if (((uint64_t)(s_dut_my_scan_valid)) != 0) {
+      n_s_dut_my_scan_pos = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_scan_pos)))) + 0x1ULL) & 0xffffffffULL)) & 0x1ffffffULL));
+      n_s_dut_my_scan_skip = ((uint64_t)(((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_scan_skip)))) == 0x0ULL) != 0) ? ((uint64_t)(((uint64_t)(s_dut_my_scan_step)))) : ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_my_scan_skip)))) - 0x1ULL) & 0xffffffffULL))) & 0xffULL));
+    }
+    if (((uint64_t)(s_dut_my_scan_d_valid)) != 0) {
+      { uint64_t t75 = ((uint64_t)(s_dut_my_scan_op_r));
+        if (t75 == 0x0ULL) {
+          if ((((uint64_t)(s_dut_my_scan_match)) & (uint64_t)(((uint64_t)(s_dut_my_scan_hit)) == 0)) != 0) {
+            n_s_dut_my_scan_hit = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_scan_result = (((uint64_t)0x0ULL << 16) | (uint64_t)((uint64_t)(s_dut_my_scan_d)));
+            n_s_dut_scan_index = ((uint64_t)(s_dut_my_scan_d_index));
+          }
+        } else if (t75 == 0x1ULL) {
+          if (((uint64_t)(s_dut_my_scan_match)) != 0) {
+            n_s_dut_my_scan_hit = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_scan_result = ((uint64_t)(((uint64_t)(s_dut_scan_result)) + 0x1ULL) & 0xffffffffULL);
+            if ((uint64_t)(((uint64_t)(s_dut_my_scan_hit)) == 0) != 0) {
+              n_s_dut_scan_index = ((uint64_t)(s_dut_my_scan_d_index));
+            }
+          }
+        } else if (t75 == 0x2ULL || t75 == 0x3ULL) {
+          if (((uint64_t)(((uint64_t)(s_dut_my_scan_hit)) == 0) | (((uint64_t)(((uint64_t)(s_dut_my_scan_op_r)) == 0x2ULL) != 0) ? ((uint64_t)(s_dut_my_scan_less)) : ((uint64_t)(s_dut_my_scan_more)))) != 0) {
+            n_s_dut_my_scan_hit = ((uint64_t)((0x1ULL) & 0x1ULL));
+            n_s_dut_scan_result = ((uint64_t)(s_dut_my_scan_vx));
+            n_s_dut_scan_index = ((uint64_t)(s_dut_my_scan_d_index));
+          }
+        } else {
+          n_s_dut_scan_result = ((uint64_t)(((uint64_t)(s_dut_scan_result)) + ((uint64_t)(s_dut_my_scan_vx))) & 0xffffffffULL);
+          n_s_dut_scan_index = ((uint64_t)(((uint64_t)(s_dut_scan_index)) + 0x1ULL) & 0xffffffffULL);
+        }
+      }
+    }
+  }
+}
+// ../ice40/sdram-stm32.v:146
+void Vsim_top::q79_() {
+  n_s_dut_startup_counter = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_startup_counter)))) + 0x1ULL) & 0xffffffffULL)) & 0x3ULL));
+  if ((uint64_t)(((uint64_t)(s_dut_startup_counter)) == 0x3ULL) != 0) {
+    n_s_dut_st_after_startup = ((uint64_t)((0x1ULL) & 0x1ULL));
+  }
+}
+// ../ice40/sdram-stm32.v:477
+void Vsim_top::q80_() {
+  if (((uint64_t)(s_dut_stream_restart)) != 0) {
+    n_s_dut_stream_adr = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 15) & 0x1ffULL)) << 15) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 1) & 0x7fffULL)));
+    n_s_dut_pf_adr = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 15) & 0x1ffULL)) << 15) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 1) & 0x7fffULL)));
+    n_s_dut_stream_rwn = (uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 1) == 0);
+  } else {
+    if ((((uint64_t)(s_dut_stream_pop)) | (((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_data_stream)))) != 0) {
+      n_s_dut_stream_adr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_stream_adr)))) + 0x1ULL) & 0xffffffffULL)) & 0xffffffULL));
+    }
+    if (((uint64_t)(s_dut_pf_start)) != 0) {
+      n_s_dut_pf_adr = ((uint64_t)(((uint64_t)(s_dut_pf_adr)) + 0x40ULL) & 0xffffffULL);
+    }
+  }
+  if ((((uint64_t)(s_dut_stream_restart)) & ((uint64_t)(s_dut_pf_busy))) != 0) {
+    n_s_dut_pf_drop = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if ((uint64_t)(((uint64_t)(s_dut_pf_busy)) == 0) != 0) {
+      n_s_dut_pf_drop = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+  n_s_dut_sf_ready = (((uint64_t)(((uint64_t)(s_dut_sf_empty)) == 0) & (uint64_t)(((uint64_t)(s_dut_stream_pop)) == 0)) & (uint64_t)(((uint64_t)(s_dut_stream_restart)) == 0));
+}
+// ../ice40/sdram-stm32.v:534
+void Vsim_top::q81_() {
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_win_base))) != 0) {
+    n_s_dut_win_base = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 15) & 0x1ffULL)) << 8) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 8) & 0xffULL)));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_read)) & ((uint64_t)(s_dut_win_read))) != 0) {
+    n_s_dut_win_pending = ((uint64_t)((0x1ULL) & 0x1ULL));
+    n_s_dut_win_ready = ((uint64_t)((0x0ULL) & 0x1ULL));
+    n_s_dut_win_rd_adr = ((((uint64_t)(s_dut_read_data32)) != 0) ? ((uint64_t)(((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 0) & 0xffffffULL)) + (((uint64_t)0x0ULL << 1) | (uint64_t)(uint64_t)((((uint64_t)(s_dut_fsmc_r_adr)) >> 0) & 1))) & 0xffffffULL) : (((uint64_t)((uint64_t)(s_dut_win_base)) << 7) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_r_adr)) >> 0) & 0x7fULL))));
+  } else {
+    if ((((uint64_t)(s_dut_win_pending)) & (uint64_t)(((uint64_t)(s_dut_read_busy)) == 0)) != 0) {
+      n_s_dut_win_pending = ((uint64_t)((0x0ULL) & 0x1ULL));
+      n_s_dut_read_to_win = ((uint64_t)((0x1ULL) & 0x1ULL));
+    } else {
+      if ((((uint64_t)(s_dut_read_to_win)) & ((uint64_t)(s_dut_rd_done))) != 0) {
+        n_s_dut_read_to_win = ((uint64_t)((0x0ULL) & 0x1ULL));
+        n_s_dut_win_ready = ((uint64_t)((0x1ULL) & 0x1ULL));
+        n_s_dut_win_rdata = ((uint64_t)(s_dut_rd_data));
+      }
+    }
+  }
+}
+// ../ice40/sdram-stm32.v:617
+void Vsim_top::q82_() {
+  if (((uint64_t)(s_dut_st_lookup)) != 0) {
+    n_s_dut_fill_cnt = ((uint64_t)((0x0ULL) & 0xfULL));
+  } else {
+    if ((((uint64_t)(s_dut_st_doing_read)) & ((uint64_t)(s_dut_sdram_data_valid))) != 0) {
+      n_s_dut_fill_cnt = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_fill_cnt)))) + 0x1ULL) & 0xffffffffULL)) & 0xfULL));
+    }
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_cache_hits))) != 0) {
+    n_s_dut_cache_hits = ((uint64_t)((0x0ULL) & 0xffffULL));
+  } else {
+    if ((((uint64_t)(s_dut_st_lookup)) & ((uint64_t)(s_dut_cache_hit))) != 0) {
+      n_s_dut_cache_hits = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_cache_hits)))) + 0x1ULL) & 0xffffffffULL)) & 0xffffULL));
+    }
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_cache_misses))) != 0) {
+    n_s_dut_cache_misses = ((uint64_t)((0x0ULL) & 0xffffULL));
+  } else {
+    if ((((uint64_t)(s_dut_st_lookup)) & (uint64_t)(((uint64_t)(s_dut_cache_hit)) == 0)) != 0) {
+      n_s_dut_cache_misses = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_cache_misses)))) + 0x1ULL) & 0xffffffffULL)) & 0xffffULL));
+    }
+  }
+}
+// ../ice40/sdram-stm32.v:689
+void Vsim_top::q83_() {
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_perf_sel))) != 0) {
+    n_s_dut_perf_sel = ((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0xfULL));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_read)) & (uint64_t)(((uint64_t)(s_dut_fsmc_r_adr)) == 0xeULL)) != 0) {
+    n_s_dut_perf_rd = ((uint64_t)(s_dut_perf_q));
+  }
+  if ((((uint64_t)(s_dut_fsmc_r_taken)) & (uint64_t)(((uint64_t)(s_dut_fsmc_r_adr)) == 0xeULL)) != 0) {
+    n_s_dut_perf_hi = ((uint64_t)((((uint64_t)(s_dut_perf_rd)) >> 16) & 0xffffULL));
+  }
+  if ((((uint64_t)(s_dut_cmd_refresh)) | (((uint64_t)(s_dut_cmd_precharge)) & (uint64_t)((((uint64_t)(mem_a)) >> 10) & 1))) != 0) {
+    n_s_dut_in_refresh = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if (((uint64_t)(s_dut_sdram_idle)) != 0) {
+      n_s_dut_in_refresh = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+}
+// ../ice40/sdram-stm32.v:711
+void Vsim_top::q84_() {
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_pwr_pd_idle))) != 0) {
+    n_s_dut_pwr_pd_idle = ((uint64_t)(s_dut_fsmc_w_data));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_pwr_sr_idle))) != 0) {
+    n_s_dut_pwr_sr_idle = ((uint64_t)(s_dut_fsmc_w_data));
+  }
+  if (((uint64_t)(s_dut_sdram_wake)) != 0) {
+    if ((uint64_t)(((uint64_t)(s_dut_pwr_wake_cnt)) != 0xffffULL) != 0) {
+      n_s_dut_pwr_wake_cnt = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_pwr_wake_cnt)))) + 0x1ULL) & 0xffffffffULL)) & 0xffffULL));
+    }
+  } else {
+    if ((uint64_t)(((uint64_t)(((uint64_t)(s_dut_pwr_wake_cnt)))) != 0x0ULL) != 0) {
+      n_s_dut_pwr_wake_last = ((uint64_t)(s_dut_pwr_wake_cnt));
+    }
+    n_s_dut_pwr_wake_cnt = ((uint64_t)((0x0ULL) & 0xffffULL));
+  }
+}
+// ../ice40/sdram-stm32.v:763
+void Vsim_top::q85_() {
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_bist_len_lo))) != 0) {
+    n_s_dut_bist_len = (uint32_t)((((uint64_t)(n_s_dut_bist_len)) & ~(0xffffULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_fsmc_w_data))) & 0xffffULL) << 0));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_bist_len_hi))) != 0) {
+    n_s_dut_bist_len = (uint32_t)((((uint64_t)(n_s_dut_bist_len)) & ~(0x1ffULL << 16)) | (((uint64_t)(((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0x1ffULL))) & 0x1ffULL) << 16));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_bist_fail_sel))) != 0) {
+    n_s_dut_bist_fail_sel = ((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0x7ULL));
+  }
+}
+// ../ice40/sdram-stm32.v:818
+void Vsim_top::q86_() {
+  if (((uint64_t)(s_dut_cp_busy)) != 0) {
+    n_s_dut_bg_turn = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if (((uint64_t)(s_dut_rdr_busy)) != 0) {
+      n_s_dut_bg_turn = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_cp_src_lo))) != 0) {
+    n_s_dut_cp_src = (uint32_t)((((uint64_t)(n_s_dut_cp_src)) & ~(0x7fffULL << 0)) | (((uint64_t)(((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 1) & 0x7fffULL))) & 0x7fffULL) << 0));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_cp_src_hi))) != 0) {
+    n_s_dut_cp_src = (uint32_t)((((uint64_t)(n_s_dut_cp_src)) & ~(0x1ffULL << 15)) | (((uint64_t)(((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0x1ffULL))) & 0x1ffULL) << 15));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_cp_dst_lo))) != 0) {
+    n_s_dut_cp_dst = (uint32_t)((((uint64_t)(n_s_dut_cp_dst)) & ~(0x7fffULL << 0)) | (((uint64_t)(((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 1) & 0x7fffULL))) & 0x7fffULL) << 0));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_cp_dst_hi))) != 0) {
+    n_s_dut_cp_dst = (uint32_t)((((uint64_t)(n_s_dut_cp_dst)) & ~(0x1ffULL << 15)) | (((uint64_t)(((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0x1ffULL))) & 0x1ffULL) << 15));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_cp_len_lo))) != 0) {
+    n_s_dut_cp_len = (uint32_t)((((uint64_t)(n_s_dut_cp_len)) & ~(0xffffULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_fsmc_w_data))) & 0xffffULL) << 0));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_cp_len_hi))) != 0) {
+    n_s_dut_cp_len = (uint32_t)((((uint64_t)(n_s_dut_cp_len)) & ~(0x1ffULL << 16)) | (((uint64_t)(((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0x1ffULL))) & 0x1ffULL) << 16));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_cp_fill))) != 0) {
+    n_s_dut_cp_fill_val = ((uint64_t)(s_dut_fsmc_w_data));
+  }
+}
+// ../ice40/sdram-stm32.v:873
+void Vsim_top::q87_() {
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_at_arg_lo))) != 0) {
+    n_s_dut_at_arg = (uint32_t)((((uint64_t)(n_s_dut_at_arg)) & ~(0xffffULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_fsmc_w_data))) & 0xffffULL) << 0));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_at_arg_hi))) != 0) {
+    n_s_dut_at_arg = (uint32_t)((((uint64_t)(n_s_dut_at_arg)) & ~(0xffffULL << 16)) | (((uint64_t)(((uint64_t)(s_dut_fsmc_w_data))) & 0xffffULL) << 16));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_at_cmp_lo))) != 0) {
+    n_s_dut_at_cmp = (uint32_t)((((uint64_t)(n_s_dut_at_cmp)) & ~(0xffffULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_fsmc_w_data))) & 0xffffULL) << 0));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_at_cmp_hi))) != 0) {
+    n_s_dut_at_cmp = (uint32_t)((((uint64_t)(n_s_dut_at_cmp)) & ~(0xffffULL << 16)) | (((uint64_t)(((uint64_t)(s_dut_fsmc_w_data))) & 0xffffULL) << 16));
+  }
+}
+// ../ice40/sdram-stm32.v:942
+void Vsim_top::q88_() {
+  if ((((uint64_t)(s_dut_crc_start)) | ((uint64_t)(s_dut_scan_start))) != 0) {
+    n_s_dut_rdr_to_scan = ((uint64_t)(s_dut_scan_start));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_scan_key))) != 0) {
+    n_s_dut_scan_key = ((uint64_t)(s_dut_fsmc_w_data));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_scan_mask))) != 0) {
+    n_s_dut_scan_mask = ((uint64_t)(s_dut_fsmc_w_data));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_range_len_lo))) != 0) {
+    n_s_dut_range_len = (uint32_t)((((uint64_t)(n_s_dut_range_len)) & ~(0xffffULL << 0)) | (((uint64_t)(((uint64_t)(s_dut_fsmc_w_data))) & 0xffffULL) << 0));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_range_len_hi))) != 0) {
+    n_s_dut_range_len = (uint32_t)((((uint64_t)(n_s_dut_range_len)) & ~(0x1ffULL << 16)) | (((uint64_t)(((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0x1ffULL))) & 0x1ffULL) << 16));
+  }
+}
+// ../ice40/sdram-stm32.v:1204
+void Vsim_top::q89_() {
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_burst_len))) != 0) {
+    n_s_dut_burst_len = (((uint64_t)(((uint64_t)(((uint64_t)(s_dut_fsmc_w_data)))) > 0x100ULL) != 0) ? 0x100ULL : ((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0x1ffULL)));
+  }
+  if (((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_burst_len))) | ((uint64_t)(s_dut_burst_start))) != 0) {
+    n_s_dut_bbuf_idx = ((uint64_t)((0x0ULL) & 0xffULL));
+  } else {
+    if (((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_burst_data))) | (((uint64_t)(s_dut_fsmc_r_taken)) & (uint64_t)(((uint64_t)(s_dut_fsmc_r_adr)) == 0x5ULL))) != 0) {
+      n_s_dut_bbuf_idx = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_bbuf_idx)))) + 0x1ULL) & 0xffffffffULL)) & 0xffULL));
+    }
+  }
+  if (((uint64_t)(s_dut_burst_start)) != 0) {
+    n_s_dut_bbuf_sd_idx = ((uint64_t)((0x0ULL) & 0xffULL));
+  } else {
+    if ((((uint64_t)(s_dut_burst_busy)) & ((((uint64_t)(s_dut_burst_sd_rwn)) != 0) ? ((uint64_t)(s_dut_sdram_data_valid)) : ((uint64_t)(s_dut_sdram_data_next)))) != 0) {
+      n_s_dut_bbuf_sd_idx = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_bbuf_sd_idx)))) + 0x1ULL) & 0xffffffffULL)) & 0xffULL));
+    }
+  }
+}
+// ../ice40/sdram-stm32.v:1224
+void Vsim_top::q90_() {
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_adr_low))) != 0) {
+    n_s_dut_cur_adr = (uint32_t)((((uint64_t)(n_s_dut_cur_adr)) & ~(0x7fffULL << 0)) | (((uint64_t)(((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 1) & 0x7fffULL))) & 0x7fffULL) << 0));
+    if (((uint64_t)(((uint64_t)(s_dut_read_busy)) == 0) & (uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 1) == 0)) != 0) {
+      n_s_dut_sdram_i_addr = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_cur_adr)) >> 15) & 0xfffULL)) << 15) | (uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 1) & 0x7fffULL)));
+    }
+  }
+  if ((((uint64_t)(s_dut_win_pending)) & (uint64_t)(((uint64_t)(s_dut_read_busy)) == 0)) != 0) {
+    n_s_dut_sdram_i_addr = (((uint64_t)0x0ULL << 24) | (uint64_t)((uint64_t)(s_dut_win_rd_adr)));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_adr_high))) != 0) {
+    n_s_dut_cur_adr = (uint32_t)((((uint64_t)(n_s_dut_cur_adr)) & ~(0xfffULL << 15)) | (((uint64_t)(((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0xfffULL))) & 0xfffULL) << 15));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_adr32_lo))) != 0) {
+    n_s_dut_adr32_lo = ((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 1) & 0x7fffULL));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_adr32_hi))) != 0) {
+    n_s_dut_cur_adr = (((uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0xfffULL)) << 15) | (uint64_t)((uint64_t)(s_dut_adr32_lo)));
+  }
+  if (((((uint64_t)(s_dut_fsmc_do_write)) & (uint64_t)(((uint64_t)(s_dut_fsmc_w_adr)) == 0x17ULL)) | (((uint64_t)(s_dut_fsmc_r_taken)) & (uint64_t)(((uint64_t)(s_dut_fsmc_r_adr)) == 0x17ULL))) != 0) {
+    n_s_dut_cur_adr = ((uint64_t)((((uint64_t)(((uint64_t)(((uint64_t)(s_dut_cur_adr)))) + 0x2ULL) & 0xffffffffULL)) & 0x7ffffffULL));
+  }
+  if ((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_data))) != 0) {
+    if ((uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_nbl)) >> 0) & 1) == 0) != 0) {
+      n_s_dut_cur_value = (uint16_t)((((uint64_t)(n_s_dut_cur_value)) & ~(0xffULL << 0)) | (((uint64_t)(((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 0xffULL))) & 0xffULL) << 0));
+    }
+    if ((uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_nbl)) >> 1) & 1) == 0) != 0) {
+      n_s_dut_cur_value = (uint16_t)((((uint64_t)(n_s_dut_cur_value)) & ~(0xffULL << 8)) | (((uint64_t)(((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 8) & 0xffULL))) & 0xffULL) << 8));
+    }
+    n_s_dut_cur_nbl = ((uint64_t)(s_dut_fsmc_w_nbl));
+  } else {
+    if ((((uint64_t)(s_dut_rd_done)) & (uint64_t)(((uint64_t)(s_dut_read_to_win)) == 0)) != 0) {
+      n_s_dut_cur_value = ((uint64_t)(s_dut_rd_data));
+      n_s_dut_cur_nbl = 0x0ULL;
+    }
+  }
+}
+// ../ice40/sdram-stm32.v:1286
+void Vsim_top::q91_() {
+  if (((uint64_t)(s_dut_rq_pop)) != 0) {
+    n_s_dut_sdram_adv = ((uint64_t)(s_dut_rq_more));
+  } else {
+    if ((((uint64_t)(((uint64_t)(s_dut_rq_empty)) == 0) | ((uint64_t)(s_dut_rq_push))) & ((uint64_t)(s_dut_sdram_ready))) != 0) {
+      n_s_dut_sdram_adv = ((uint64_t)((0x1ULL) & 0x1ULL));
+    }
+  }
+}
+// ../ice40/sdram-stm32.v:1315
+void Vsim_top::q92_() {
+  n_s_dut_wq_fresh = (((uint64_t)(s_dut_wq_pop)) | (((uint64_t)(s_dut_wq_push)) & ((uint64_t)(s_dut_wq_empty))));
+  if (((((((uint64_t)(s_dut_fsmc_do_write)) & ((uint64_t)(s_dut_decode_adr_low))) & (uint64_t)(((uint64_t)(s_dut_read_busy)) == 0)) & (uint64_t)((uint64_t)((((uint64_t)(s_dut_fsmc_w_data)) >> 0) & 1) == 0)) | (((uint64_t)(s_dut_win_pending)) & (uint64_t)(((uint64_t)(s_dut_read_busy)) == 0))) != 0) {
+    n_s_dut_st_pending_read = ((uint64_t)((0x1ULL) & 0x1ULL));
+    n_s_dut_rd_result_pending = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if (((uint64_t)(s_dut_rd_go)) != 0) {
+      n_s_dut_st_pending_read = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+  if (((uint64_t)(s_dut_rd_done)) != 0) {
+    n_s_dut_rd_result_pending = ((uint64_t)((0x0ULL) & 0x1ULL));
+  }
+  n_s_dut_st_lookup = ((uint64_t)(s_dut_rd_go));
+  if (((((uint64_t)(s_dut_st_lookup)) & (uint64_t)(((uint64_t)(s_dut_cache_hit)) == 0)) & ((uint64_t)(s_dut_rq_full))) != 0) {
+    n_s_dut_st_pending_fill = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if (((uint64_t)(s_dut_fill_go)) != 0) {
+      n_s_dut_st_pending_fill = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+  if (((uint64_t)(s_dut_fill_go)) != 0) {
+    n_s_dut_st_doing_read = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if (((((uint64_t)(s_dut_st_doing_read)) & ((uint64_t)(s_dut_sdram_data_valid))) & (uint64_t)(((uint64_t)(s_dut_fill_cnt)) == 0xfULL)) != 0) {
+      n_s_dut_st_doing_read = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+  if ((((uint64_t)(s_dut_rq_pop)) & (uint64_t)(((uint64_t)(s_dut_rq_rwn)) == 0)) != 0) {
+    n_s_dut_st_finishing_write = ((uint64_t)((0x1ULL) & 0x1ULL));
+  } else {
+    if (((uint64_t)(s_dut_sdram_write_done)) != 0) {
+      n_s_dut_st_finishing_write = ((uint64_t)((0x0ULL) & 0x1ULL));
+    }
+  }
+}
+void Vsim_top::settle_() {
+  p563_();
+  p562_();
+  p561_();
+  p560_();
+  p553_();
+  p524_();
+  p525_();
+  p477_();
+  p467_();
+  p473_();
+  p466_();
+  p472_();
+  p465_();
+  p471_();
+  p464_();
+  p470_();
+  p463_();
+  p469_();
+  p449_();
+  p448_();
+  p447_();
+  p446_();
+  p445_();
+  p444_();
+  p443_();
+  p442_();
+  p441_();
+  p438_();
+  p437_();
+  p435_();
+  p434_();
+  p433_();
+  p432_();
+  p429_();
+  p428_();
+  p421_();
+  p418_();
+  p423_();
+  p422_();
+  p420_();
+  p419_();
+  p417_();
+  p416_();
+  p415_();
+  p413_();
+  p412_();
+  p411_();
+  p410_();
+  p407_();
+  p406_();
+  p488_();
+  p405_();
+  p404_();
+  p403_();
+  p402_();
+  p398_();
+  p397_();
+  p399_();
+  p400_();
+  p401_();
+  p396_();
+  p389_();
+  p391_();
+  p390_();
+  p392_();
+  p388_();
+  p387_();
+  p386_();
+  p385_();
+  p454_();
+  p384_();
+  p383_();
+  p382_();
+  p378_();
+  p377_();
+  p379_();
+  p380_();
+  p381_();
+  p372_();
+  p502_();
+  p371_();
+  p370_();
+  p369_();
+  p367_();
+  p366_();
+  p365_();
+  p363_();
+  p362_();
+  p358_();
+  p357_();
+  p359_();
+  p360_();
+  p361_();
+  p355_();
+  p353_();
+  p368_();
+  p352_();
+  p354_();
+  p351_();
+  p350_();
+  p348_();
+  p344_();
+  p343_();
+  p342_();
+  p340_();
+  p339_();
+  p337_();
+  p338_();
+  p341_();
+  p345_();
+  p336_();
+  p335_();
+  p331_();
+  p330_();
+  p332_();
+  p333_();
+  p334_();
+  p329_();
+  p323_();
+  p321_();
+  p322_();
+  p320_();
+  p319_();
+  p318_();
+  p317_();
+  p316_();
+  p313_();
+  p312_();
+  p505_();
+  p459_();
+  p457_();
+  p308_();
+  p307_();
+  p309_();
+  p310_();
+  p311_();
+  p306_();
+  p305_();
+  p304_();
+  p303_();
+  p495_();
+  p299_();
+  p298_();
+  p300_();
+  p301_();
+  p302_();
+  p296_();
+  p295_();
+  p297_();
+  p294_();
+  p293_();
+  p291_();
+  p327_();
+  p290_();
+  p288_();
+  p460_();
+  p287_();
+  p289_();
+  p286_();
+  p285_();
+  p280_();
+  p504_();
+  p503_();
+  p500_();
+  p468_();
+  p476_();
+  p279_();
+  p281_();
+  p558_();
+  p557_();
+  p559_();
+  p554_();
+  p326_();
+  p282_();
+  p278_();
+  p283_();
+  p499_();
+  p498_();
+  p497_();
+  p496_();
+  p494_();
+  p493_();
+  p277_();
+  p272_();
+  p273_();
+  p271_();
+  p275_();
+  p270_();
+  p269_();
+  p267_();
+  p568_();
+  p551_();
+  p474_();
+  p475_();
+  p265_();
+  p263_();
+  p262_();
+  p261_();
+  p260_();
+  p259_();
+  p258_();
+  p257_();
+  p256_();
+  p252_();
+  p250_();
+  p430_();
+  p249_();
+  p431_();
+  p248_();
+  p246_();
+  p245_();
+  p247_();
+  p244_();
+  p243_();
+  p567_();
+  p242_();
+  p254_();
+  p566_();
+  p241_();
+  p240_();
+  p253_();
+  p264_();
+  p462_();
+  p409_();
+  p239_();
+  p461_();
+  p452_();
+  p292_();
+  p408_();
+  p427_();
+  p414_();
+  p364_();
+  p325_();
+  p324_();
+  p237_();
+  p236_();
+  p235_();
+  p234_();
+  p233_();
+  p232_();
+  p480_();
+  p479_();
+  p276_();
+  p481_();
+  p274_();
+  p231_();
+  p552_();
+  p228_();
+  p227_();
+  p223_();
+  p222_();
+  p219_();
+  p218_();
+  p224_();
+  p226_();
+  p225_();
+  p221_();
+  p220_();
+  p229_();
+  p230_();
+  p238_();
+  p217_();
+  p251_();
+  p436_();
+  p216_();
+  p213_();
+  p210_();
+  p202_();
+  p565_();
+  p198_();
+  p191_();
+  p190_();
+  p189_();
+  p188_();
+  p187_();
+  p186_();
+  p185_();
+  p211_();
+  p451_();
+  p181_();
+  p182_();
+  p180_();
+  p203_();
+  p215_();
+  p564_();
+  p179_();
+  p178_();
+  p177_();
+  p173_();
+  p174_();
+  p172_();
+  p209_();
+  p214_();
+  p458_();
+  p426_();
+  p425_();
+  p424_();
+  p395_();
+  p394_();
+  p375_();
+  p374_();
+  p373_();
+  p356_();
+  p347_();
+  p346_();
+  p315_();
+  p314_();
+  p208_();
+  p549_();
+  p548_();
+  p547_();
+  p546_();
+  p545_();
+  p544_();
+  p543_();
+  p542_();
+  p541_();
+  p540_();
+  p539_();
+  p538_();
+  p537_();
+  p536_();
+  p535_();
+  p534_();
+  p533_();
+  p532_();
+  p531_();
+  p530_();
+  p529_();
+  p528_();
+  p527_();
+  p526_();
+  p523_();
+  p522_();
+  p521_();
+  p520_();
+  p519_();
+  p518_();
+  p517_();
+  p516_();
+  p515_();
+  p514_();
+  p513_();
+  p556_();
+  p512_();
+  p511_();
+  p510_();
+  p509_();
+  p508_();
+  p507_();
+  p506_();
+  p455_();
+  p170_();
+  p206_();
+  p555_();
+  p284_();
+  p550_();
+  p490_();
+  p489_();
+  p491_();
+  p484_();
+  p349_();
+  p483_();
+  p328_();
+  p482_();
+  p478_();
+  p456_();
+  p453_();
+  p487_();
+  p485_();
+  p492_();
+  p486_();
+  p450_();
+  p393_();
+  p376_();
+  p205_();
+  p204_();
+  p207_();
+  p169_();
+  p196_();
+  p194_();
+  p192_();
+  p201_();
+  p501_();
+  p193_();
+  p200_();
+  p183_();
+  p184_();
+  p195_();
+  p199_();
+  p175_();
+  p176_();
+  p197_();
+  p167_();
+  p168_();
+  p165_();
+  p166_();
+  p164_();
+  p162_();
+  p161_();
+  p160_();
+  p159_();
+  p163_();
+  p157_();
+  p156_();
+  p155_();
+  p154_();
+  p158_();
+  p152_();
+  p151_();
+  p150_();
+  p149_();
+  p153_();
+  p147_();
+  p146_();
+  p145_();
+  p144_();
+  p148_();
+  p142_();
+  p141_();
+  p140_();
+  p139_();
+  p143_();
+  p137_();
+  p136_();
+  p135_();
+  p134_();
+  p138_();
+  p132_();
+  p131_();
+  p130_();
+  p129_();
+  p133_();
+  p127_();
+  p126_();
+  p125_();
+  p124_();
+  p128_();
+  p122_();
+  p121_();
+  p120_();
+  p119_();
+  p123_();
+  p117_();
+  p116_();
+  p115_();
+  p114_();
+  p118_();
+  p112_();
+  p111_();
+  p110_();
+  p109_();
+  p113_();
+  p107_();
+  p106_();
+  p105_();
+  p104_();
+  p108_();
+  p102_();
+  p101_();
+  p100_();
+  p99_();
+  p103_();
+  p97_();
+  p96_();
+  p95_();
+  p94_();
+  p98_();
+  p92_();
+  p91_();
+  p90_();
+  p89_();
+  p93_();
+  p87_();
+  p86_();
+  p85_();
+  p84_();
+  p88_();
+  p255_();
+  p82_();
+  p81_();
+  p80_();
+  p79_();
+  p83_();
+  p77_();
+  p76_();
+  p75_();
+  p74_();
+  p78_();
+  p72_();
+  p71_();
+  p70_();
+  p69_();
+  p73_();
+  p67_();
+  p66_();
+  p65_();
+  p64_();
+  p68_();
+  p62_();
+  p61_();
+  p60_();
+  p59_();
+  p63_();
+  p57_();
+  p56_();
+  p55_();
+  p54_();
+  p58_();
+  p52_();
+  p51_();
+  p50_();
+  p49_();
+  p53_();
+  p47_();
+  p46_();
+  p45_();
+  p44_();
+  p48_();
+  p42_();
+  p41_();
+  p40_();
+  p39_();
+  p43_();
+  p37_();
+  p36_();
+  p35_();
+  p34_();
+  p38_();
+  p32_();
+  p31_();
+  p30_();
+  p29_();
+  p33_();
+  p27_();
+  p26_();
+  p25_();
+  p24_();
+  p28_();
+  p22_();
+  p21_();
+  p20_();
+  p19_();
+  p23_();
+  p17_();
+  p16_();
+  p15_();
+  p14_();
+  p18_();
+  p12_();
+  p11_();
+  p10_();
+  p9_();
+  p13_();
+  p7_();
+  p6_();
+  p5_();
+  p4_();
+  p8_();
+  p212_();
+  p171_();
+  p3_();
+  p2_();
+  p1_();
+  p0_();
+  p440_();
+  p268_();
+  p266_();
+  p439_();
+}
+void Vsim_top::commit_() {
+  s_dut_adr32_lo = n_s_dut_adr32_lo;
+  s_dut_at_arg = n_s_dut_at_arg;
+  s_dut_at_cmp = n_s_dut_at_cmp;
+  s_dut_at_result = n_s_dut_at_result;
+  s_dut_at_sd_adr = n_s_dut_at_sd_adr;
+  s_dut_at_sd_adv = n_s_dut_at_sd_adv;
+  s_dut_at_sd_len = n_s_dut_at_sd_len;
+  s_dut_at_sd_rwn = n_s_dut_at_sd_rwn;
+  s_dut_at_wdata = n_s_dut_at_wdata;
+  s_dut_bbuf_idx = n_s_dut_bbuf_idx;
+  s_dut_bbuf_q = n_s_dut_bbuf_q;
+  s_dut_bbuf_sd_idx = n_s_dut_bbuf_sd_idx;
+  s_dut_bg_turn = n_s_dut_bg_turn;
+  s_dut_bist_errors = n_s_dut_bist_errors;
+  s_dut_bist_fail_mask = n_s_dut_bist_fail_mask;
+  s_dut_bist_fail_sel = n_s_dut_bist_fail_sel;
+  s_dut_bist_len = n_s_dut_bist_len;
+  s_dut_bist_nfail = n_s_dut_bist_nfail;
+  s_dut_bist_sd_adr = n_s_dut_bist_sd_adr;
+  s_dut_bist_sd_adv = n_s_dut_bist_sd_adv;
+  s_dut_bist_sd_len = n_s_dut_bist_sd_len;
+  s_dut_bist_sd_rwn = n_s_dut_bist_sd_rwn;
+  s_dut_bist_wdata = n_s_dut_bist_wdata;
+  s_dut_burst_count = n_s_dut_burst_count;
+  s_dut_burst_len = n_s_dut_burst_len;
+  s_dut_burst_sd_adr = n_s_dut_burst_sd_adr;
+  s_dut_burst_sd_adv = n_s_dut_burst_sd_adv;
+  s_dut_burst_sd_len = n_s_dut_burst_sd_len;
+  s_dut_burst_sd_rwn = n_s_dut_burst_sd_rwn;
+  s_dut_cache_hits = n_s_dut_cache_hits;
+  s_dut_cache_misses = n_s_dut_cache_misses;
+  s_dut_cache_q = n_s_dut_cache_q;
+  s_dut_cp_dst = n_s_dut_cp_dst;
+  s_dut_cp_fill_val = n_s_dut_cp_fill_val;
+  s_dut_cp_len = n_s_dut_cp_len;
+  s_dut_cp_sd_adr = n_s_dut_cp_sd_adr;
+  s_dut_cp_sd_adv = n_s_dut_cp_sd_adv;
+  s_dut_cp_sd_len = n_s_dut_cp_sd_len;
+  s_dut_cp_sd_rwn = n_s_dut_cp_sd_rwn;
+  s_dut_cp_src = n_s_dut_cp_src;
+  s_dut_crc_sum = n_s_dut_crc_sum;
+  s_dut_cur_adr = n_s_dut_cur_adr;
+  s_dut_cur_nbl = n_s_dut_cur_nbl;
+  s_dut_cur_value = n_s_dut_cur_value;
+  s_dut_fill_cnt = n_s_dut_fill_cnt;
+  s_dut_fsmc_do_read = n_s_dut_fsmc_do_read;
+  s_dut_fsmc_r_adr = n_s_dut_fsmc_r_adr;
+  s_dut_fsmc_r_taken = n_s_dut_fsmc_r_taken;
+  s_dut_in_refresh = n_s_dut_in_refresh;
+  s_dut_my_atomic_adr_r = n_s_dut_my_atomic_adr_r;
+  s_dut_my_atomic_arg_r = n_s_dut_my_atomic_arg_r;
+  s_dut_my_atomic_atomic_burst_cur_adr = n_s_dut_my_atomic_atomic_burst_cur_adr;
+  s_dut_my_atomic_atomic_burst_left = n_s_dut_my_atomic_atomic_burst_left;
+  s_dut_my_atomic_atomic_burst_rd_left = n_s_dut_my_atomic_atomic_burst_rd_left;
+  s_dut_my_atomic_atomic_burst_req_len = n_s_dut_my_atomic_atomic_burst_req_len;
+  s_dut_my_atomic_atomic_burst_st_doing = n_s_dut_my_atomic_atomic_burst_st_doing;
+  s_dut_my_atomic_atomic_burst_st_idle = n_s_dut_my_atomic_atomic_burst_st_idle;
+  s_dut_my_atomic_atomic_burst_st_next = n_s_dut_my_atomic_atomic_burst_st_next;
+  s_dut_my_atomic_atomic_burst_st_pending = n_s_dut_my_atomic_atomic_burst_st_pending;
+  s_dut_my_atomic_b_count_unused = n_s_dut_my_atomic_b_count_unused;
+  s_dut_my_atomic_b_rwn = n_s_dut_my_atomic_b_rwn;
+  s_dut_my_atomic_b_start = n_s_dut_my_atomic_b_start;
+  s_dut_my_atomic_cmp_r = n_s_dut_my_atomic_cmp_r;
+  s_dut_my_atomic_nv = n_s_dut_my_atomic_nv;
+  s_dut_my_atomic_op_r = n_s_dut_my_atomic_op_r;
+  s_dut_my_atomic_pend = n_s_dut_my_atomic_pend;
+  s_dut_my_atomic_r_idx = n_s_dut_my_atomic_r_idx;
+  s_dut_my_atomic_size32_r = n_s_dut_my_atomic_size32_r;
+  s_dut_my_atomic_st_read = n_s_dut_my_atomic_st_read;
+  s_dut_my_atomic_st_write = n_s_dut_my_atomic_st_write;
+  s_dut_my_atomic_w_idx = n_s_dut_my_atomic_w_idx;
+  s_dut_my_bist_b_count_unused = n_s_dut_my_bist_b_count_unused;
+  s_dut_my_bist_b_rwn = n_s_dut_my_bist_b_rwn;
+  s_dut_my_bist_b_start = n_s_dut_my_bist_b_start;
+  s_dut_my_bist_base = n_s_dut_my_bist_base;
+  s_dut_my_bist_bist_burst_cur_adr = n_s_dut_my_bist_bist_burst_cur_adr;
+  s_dut_my_bist_bist_burst_left = n_s_dut_my_bist_bist_burst_left;
+  s_dut_my_bist_bist_burst_rd_left = n_s_dut_my_bist_bist_burst_rd_left;
+  s_dut_my_bist_bist_burst_req_len = n_s_dut_my_bist_bist_burst_req_len;
+  s_dut_my_bist_bist_burst_st_doing = n_s_dut_my_bist_bist_burst_st_doing;
+  s_dut_my_bist_bist_burst_st_idle = n_s_dut_my_bist_bist_burst_st_idle;
+  s_dut_my_bist_bist_burst_st_next = n_s_dut_my_bist_bist_burst_st_next;
+  s_dut_my_bist_bist_burst_st_pending = n_s_dut_my_bist_bist_burst_st_pending;
+  s_dut_my_bist_c1_adr = n_s_dut_my_bist_c1_adr;
+  s_dut_my_bist_c1_exp = n_s_dut_my_bist_c1_exp;
+  s_dut_my_bist_c1_got = n_s_dut_my_bist_c1_got;
+  s_dut_my_bist_c1_valid = n_s_dut_my_bist_c1_valid;
+  s_dut_my_bist_c_adr = n_s_dut_my_bist_c_adr;
+  s_dut_my_bist_c_len = n_s_dut_my_bist_c_len;
+  s_dut_my_bist_elem = n_s_dut_my_bist_elem;
+  s_dut_my_bist_left = n_s_dut_my_bist_left;
+  s_dut_my_bist_len_r = n_s_dut_my_bist_len_r;
+  s_dut_my_bist_pat_r = n_s_dut_my_bist_pat_r;
+  s_dut_my_bist_rd_adr = n_s_dut_my_bist_rd_adr;
+  s_dut_my_bist_rd_lfsr = n_s_dut_my_bist_rd_lfsr;
+  s_dut_my_bist_seed_r = n_s_dut_my_bist_seed_r;
+  s_dut_my_bist_st_chunk = n_s_dut_my_bist_st_chunk;
+  s_dut_my_bist_st_elem = n_s_dut_my_bist_st_elem;
+  s_dut_my_bist_st_idle = n_s_dut_my_bist_st_idle;
+  s_dut_my_bist_st_read = n_s_dut_my_bist_st_read;
+  s_dut_my_bist_st_write = n_s_dut_my_bist_st_write;
+  s_dut_my_bist_wr_adr = n_s_dut_my_bist_wr_adr;
+  s_dut_my_bist_wr_lfsr = n_s_dut_my_bist_wr_lfsr;
+  s_dut_my_burst_cur_adr = n_s_dut_my_burst_cur_adr;
+  s_dut_my_burst_left = n_s_dut_my_burst_left;
+  s_dut_my_burst_rd_left = n_s_dut_my_burst_rd_left;
+  s_dut_my_burst_req_len = n_s_dut_my_burst_req_len;
+  s_dut_my_burst_st_doing = n_s_dut_my_burst_st_doing;
+  s_dut_my_burst_st_idle = n_s_dut_my_burst_st_idle;
+  s_dut_my_burst_st_next = n_s_dut_my_burst_st_next;
+  s_dut_my_burst_st_pending = n_s_dut_my_burst_st_pending;
+  s_dut_my_bus_slave_active = n_s_dut_my_bus_slave_active;
+  s_dut_my_bus_slave_cmd_fifo_r_bin = n_s_dut_my_bus_slave_cmd_fifo_r_bin;
+  s_dut_my_bus_slave_cmd_fifo_r_data = n_s_dut_my_bus_slave_cmd_fifo_r_data;
+  s_dut_my_bus_slave_cmd_fifo_r_gray = n_s_dut_my_bus_slave_cmd_fifo_r_gray;
+  s_dut_my_bus_slave_cmd_fifo_s_r_gray = n_s_dut_my_bus_slave_cmd_fifo_s_r_gray;
+  s_dut_my_bus_slave_cmd_fifo_s_w_gray = n_s_dut_my_bus_slave_cmd_fifo_s_w_gray;
+  s_dut_my_bus_slave_cmd_fifo_sync_r2w_M = n_s_dut_my_bus_slave_cmd_fifo_sync_r2w_M;
+  s_dut_my_bus_slave_cmd_fifo_sync_w2r_M = n_s_dut_my_bus_slave_cmd_fifo_sync_w2r_M;
+  s_dut_my_bus_slave_cmd_fifo_w_bin = n_s_dut_my_bus_slave_cmd_fifo_w_bin;
+  s_dut_my_bus_slave_cmd_fifo_w_gray = n_s_dut_my_bus_slave_cmd_fifo_w_gray;
+  s_dut_my_bus_slave_cnt = n_s_dut_my_bus_slave_cnt;
+  s_dut_my_bus_slave_f_adr = n_s_dut_my_bus_slave_f_adr;
+  s_dut_my_bus_slave_f_epoch = n_s_dut_my_bus_slave_f_epoch;
+  s_dut_my_bus_slave_f_seq = n_s_dut_my_bus_slave_f_seq;
+  s_dut_my_bus_slave_f_want = n_s_dut_my_bus_slave_f_want;
+  s_dut_my_bus_slave_is_stream = n_s_dut_my_bus_slave_is_stream;
+  s_dut_my_bus_slave_outstanding = n_s_dut_my_bus_slave_outstanding;
+  s_dut_my_bus_slave_rsp_fifo_r_bin = n_s_dut_my_bus_slave_rsp_fifo_r_bin;
+  s_dut_my_bus_slave_rsp_fifo_r_data = n_s_dut_my_bus_slave_rsp_fifo_r_data;
+  s_dut_my_bus_slave_rsp_fifo_r_gray = n_s_dut_my_bus_slave_rsp_fifo_r_gray;
+  s_dut_my_bus_slave_rsp_fifo_s_r_gray = n_s_dut_my_bus_slave_rsp_fifo_s_r_gray;
+  s_dut_my_bus_slave_rsp_fifo_s_w_gray = n_s_dut_my_bus_slave_rsp_fifo_s_w_gray;
+  s_dut_my_bus_slave_rsp_fifo_sync_r2w_M = n_s_dut_my_bus_slave_rsp_fifo_sync_r2w_M;
+  s_dut_my_bus_slave_rsp_fifo_sync_w2r_M = n_s_dut_my_bus_slave_rsp_fifo_sync_w2r_M;
+  s_dut_my_bus_slave_rsp_fifo_w_bin = n_s_dut_my_bus_slave_rsp_fifo_w_bin;
+  s_dut_my_bus_slave_rsp_fifo_w_gray = n_s_dut_my_bus_slave_rsp_fifo_w_gray;
+  s_dut_my_bus_slave_s_epoch = n_s_dut_my_bus_slave_s_epoch;
+  s_dut_my_bus_slave_s_reading = n_s_dut_my_bus_slave_s_reading;
+  s_dut_my_bus_slave_s_seq = n_s_dut_my_bus_slave_s_seq;
+  s_dut_my_bus_slave_stream_q_r_bin = n_s_dut_my_bus_slave_stream_q_r_bin;
+  s_dut_my_bus_slave_stream_q_r_data = n_s_dut_my_bus_slave_stream_q_r_data;
+  s_dut_my_bus_slave_stream_q_r_gray = n_s_dut_my_bus_slave_stream_q_r_gray;
+  s_dut_my_bus_slave_stream_q_s_r_gray = n_s_dut_my_bus_slave_stream_q_s_r_gray;
+  s_dut_my_bus_slave_stream_q_s_w_gray = n_s_dut_my_bus_slave_stream_q_s_w_gray;
+  s_dut_my_bus_slave_stream_q_sync_r2w_M = n_s_dut_my_bus_slave_stream_q_sync_r2w_M;
+  s_dut_my_bus_slave_stream_q_sync_w2r_M = n_s_dut_my_bus_slave_stream_q_sync_w2r_M;
+  s_dut_my_bus_slave_stream_q_w_bin = n_s_dut_my_bus_slave_stream_q_w_bin;
+  s_dut_my_bus_slave_stream_q_w_gray = n_s_dut_my_bus_slave_stream_q_w_gray;
+  s_dut_my_cache_tag_q = n_s_dut_my_cache_tag_q;
+  s_dut_my_cache_valid = n_s_dut_my_cache_valid;
+  s_dut_my_copy_b_adr = n_s_dut_my_copy_b_adr;
+  s_dut_my_copy_b_count_unused = n_s_dut_my_copy_b_count_unused;
+  s_dut_my_copy_b_rwn = n_s_dut_my_copy_b_rwn;
+  s_dut_my_copy_b_start = n_s_dut_my_copy_b_start;
+  s_dut_my_copy_blk = n_s_dut_my_copy_blk;
+  s_dut_my_copy_buf_q = n_s_dut_my_copy_buf_q;
+  s_dut_my_copy_buf_r_idx = n_s_dut_my_copy_buf_r_idx;
+  s_dut_my_copy_buf_w_idx = n_s_dut_my_copy_buf_w_idx;
+  s_dut_my_copy_c_dst = n_s_dut_my_copy_c_dst;
+  s_dut_my_copy_c_fill = n_s_dut_my_copy_c_fill;
+  s_dut_my_copy_c_irq = n_s_dut_my_copy_c_irq;
+  s_dut_my_copy_c_left = n_s_dut_my_copy_c_left;
+  s_dut_my_copy_c_src = n_s_dut_my_copy_c_src;
+  s_dut_my_copy_copy_burst_cur_adr = n_s_dut_my_copy_copy_burst_cur_adr;
+  s_dut_my_copy_copy_burst_left = n_s_dut_my_copy_copy_burst_left;
+  s_dut_my_copy_copy_burst_rd_left = n_s_dut_my_copy_copy_burst_rd_left;
+  s_dut_my_copy_copy_burst_req_len = n_s_dut_my_copy_copy_burst_req_len;
+  s_dut_my_copy_copy_burst_st_doing = n_s_dut_my_copy_copy_burst_st_doing;
+  s_dut_my_copy_copy_burst_st_idle = n_s_dut_my_copy_copy_burst_st_idle;
+  s_dut_my_copy_copy_burst_st_next = n_s_dut_my_copy_copy_burst_st_next;
+  s_dut_my_copy_copy_burst_st_pending = n_s_dut_my_copy_copy_burst_st_pending;
+  s_dut_my_copy_desc_q_r_ptr = n_s_dut_my_copy_desc_q_r_ptr;
+  s_dut_my_copy_desc_q_w_ptr = n_s_dut_my_copy_desc_q_w_ptr;
+  s_dut_my_copy_dq_head = n_s_dut_my_copy_dq_head;
+  s_dut_my_copy_dq_ready = n_s_dut_my_copy_dq_ready;
+  s_dut_my_copy_have = n_s_dut_my_copy_have;
+  s_dut_my_copy_irq_r = n_s_dut_my_copy_irq_r;
+  s_dut_my_copy_n_done = n_s_dut_my_copy_n_done;
+  s_dut_my_copy_st_read = n_s_dut_my_copy_st_read;
+  s_dut_my_copy_st_write = n_s_dut_my_copy_st_write;
+  s_dut_my_crc_c = n_s_dut_my_crc_c;
+  s_dut_my_crc_d = n_s_dut_my_crc_d;
+  s_dut_my_crc_d_valid = n_s_dut_my_crc_d_valid;
+  s_dut_my_perf_cnt = n_s_dut_my_perf_cnt;
+  s_dut_my_reader_b_count_unused = n_s_dut_my_reader_b_count_unused;
+  s_dut_my_reader_b_start = n_s_dut_my_reader_b_start;
+  s_dut_my_reader_blk = n_s_dut_my_reader_blk;
+  s_dut_my_reader_cur = n_s_dut_my_reader_cur;
+  s_dut_my_reader_left = n_s_dut_my_reader_left;
+  s_dut_my_reader_pend = n_s_dut_my_reader_pend;
+  s_dut_my_reader_reader_burst_cur_adr = n_s_dut_my_reader_reader_burst_cur_adr;
+  s_dut_my_reader_reader_burst_left = n_s_dut_my_reader_reader_burst_left;
+  s_dut_my_reader_reader_burst_rd_left = n_s_dut_my_reader_reader_burst_rd_left;
+  s_dut_my_reader_reader_burst_req_len = n_s_dut_my_reader_reader_burst_req_len;
+  s_dut_my_reader_reader_burst_st_doing = n_s_dut_my_reader_reader_burst_st_doing;
+  s_dut_my_reader_reader_burst_st_idle = n_s_dut_my_reader_reader_burst_st_idle;
+  s_dut_my_reader_reader_burst_st_next = n_s_dut_my_reader_reader_burst_st_next;
+  s_dut_my_reader_reader_burst_st_pending = n_s_dut_my_reader_reader_burst_st_pending;
+  s_dut_my_reader_st_read = n_s_dut_my_reader_st_read;
+  s_dut_my_scan_d = n_s_dut_my_scan_d;
+  s_dut_my_scan_d_pos = n_s_dut_my_scan_d_pos;
+  s_dut_my_scan_d_valid = n_s_dut_my_scan_d_valid;
+  s_dut_my_scan_hit = n_s_dut_my_scan_hit;
+  s_dut_my_scan_key_r = n_s_dut_my_scan_key_r;
+  s_dut_my_scan_mask_r = n_s_dut_my_scan_mask_r;
+  s_dut_my_scan_op_r = n_s_dut_my_scan_op_r;
+  s_dut_my_scan_pos = n_s_dut_my_scan_pos;
+  s_dut_my_scan_sgn_r = n_s_dut_my_scan_sgn_r;
+  s_dut_my_scan_skip = n_s_dut_my_scan_skip;
+  s_dut_my_scan_step = n_s_dut_my_scan_step;
+  s_dut_perf_hi = n_s_dut_perf_hi;
+  s_dut_perf_rd = n_s_dut_perf_rd;
+  s_dut_perf_sel = n_s_dut_perf_sel;
+  s_dut_pf_adr = n_s_dut_pf_adr;
+  s_dut_pf_count = n_s_dut_pf_count;
+  s_dut_pf_drop = n_s_dut_pf_drop;
+  s_dut_pf_sd_adr = n_s_dut_pf_sd_adr;
+  s_dut_pf_sd_adv = n_s_dut_pf_sd_adv;
+  s_dut_pf_sd_len = n_s_dut_pf_sd_len;
+  s_dut_pf_sd_rwn = n_s_dut_pf_sd_rwn;
+  s_dut_prefetch_cur_adr = n_s_dut_prefetch_cur_adr;
+  s_dut_prefetch_left = n_s_dut_prefetch_left;
+  s_dut_prefetch_rd_left = n_s_dut_prefetch_rd_left;
+  s_dut_prefetch_req_len = n_s_dut_prefetch_req_len;
+  s_dut_prefetch_st_doing = n_s_dut_prefetch_st_doing;
+  s_dut_prefetch_st_idle = n_s_dut_prefetch_st_idle;
+  s_dut_prefetch_st_next = n_s_dut_prefetch_st_next;
+  s_dut_prefetch_st_pending = n_s_dut_prefetch_st_pending;
+  s_dut_pwr_pd_idle = n_s_dut_pwr_pd_idle;
+  s_dut_pwr_sr_idle = n_s_dut_pwr_sr_idle;
+  s_dut_pwr_wake_cnt = n_s_dut_pwr_wake_cnt;
+  s_dut_pwr_wake_last = n_s_dut_pwr_wake_last;
+  s_dut_range_len = n_s_dut_range_len;
+  s_dut_rd_result_pending = n_s_dut_rd_result_pending;
+  s_dut_rdr_sd_adr = n_s_dut_rdr_sd_adr;
+  s_dut_rdr_sd_adv = n_s_dut_rdr_sd_adv;
+  s_dut_rdr_sd_len = n_s_dut_rdr_sd_len;
+  s_dut_rdr_sd_rwn = n_s_dut_rdr_sd_rwn;
+  s_dut_rdr_to_scan = n_s_dut_rdr_to_scan;
+  s_dut_read_to_win = n_s_dut_read_to_win;
+  s_dut_req_queue_r_ptr = n_s_dut_req_queue_r_ptr;
+  s_dut_req_queue_w_ptr = n_s_dut_req_queue_w_ptr;
+  s_dut_scan_index = n_s_dut_scan_index;
+  s_dut_scan_key = n_s_dut_scan_key;
+  s_dut_scan_mask = n_s_dut_scan_mask;
+  s_dut_scan_result = n_s_dut_scan_result;
+  s_dut_sdram_U0_burst_col_i = n_s_dut_sdram_U0_burst_col_i;
+  s_dut_sdram_U0_clk_count_i = n_s_dut_sdram_U0_clk_count_i;
+  s_dut_sdram_U0_cmd_fsm_states_i = n_s_dut_sdram_U0_cmd_fsm_states_i;
+  s_dut_sdram_U0_cpu2sdram_reg_i = n_s_dut_sdram_U0_cpu2sdram_reg_i;
+  s_dut_sdram_U0_cpu_data_reg_i = n_s_dut_sdram_U0_cpu_data_reg_i;
+  s_dut_sdram_U0_cpu_den_i = n_s_dut_sdram_U0_cpu_den_i;
+  s_dut_sdram_U0_init_fsm_states_i = n_s_dut_sdram_U0_init_fsm_states_i;
+  s_dut_sdram_U0_o_sdram_addr = n_s_dut_sdram_U0_o_sdram_addr;
+  s_dut_sdram_U0_o_sdram_blkaddr = n_s_dut_sdram_U0_o_sdram_blkaddr;
+  s_dut_sdram_U0_ras_count_i = n_s_dut_sdram_U0_ras_count_i;
+  s_dut_sdram_U0_read_data_req_i = n_s_dut_sdram_U0_read_data_req_i;
+  s_dut_sdram_U0_read_done_i = n_s_dut_sdram_U0_read_done_i;
+  s_dut_sdram_U0_read_done_reg_i = n_s_dut_sdram_U0_read_done_reg_i;
+  s_dut_sdram_U0_read_pipe_i = n_s_dut_sdram_U0_read_pipe_i;
+  s_dut_sdram_U0_read_req_cnt_i = n_s_dut_sdram_U0_read_req_cnt_i;
+  s_dut_sdram_U0_read_req_cnt_rst_i = n_s_dut_sdram_U0_read_req_cnt_rst_i;
+  s_dut_sdram_U0_row_open_i = n_s_dut_sdram_U0_row_open_i;
+  s_dut_sdram_U0_sdram_dq_en_i = n_s_dut_sdram_U0_sdram_dq_en_i;
+  s_dut_sdram_U0_sdram_dq_reg_i = n_s_dut_sdram_U0_sdram_dq_reg_i;
+  s_dut_sdram_U0_sdram_dqm_i = n_s_dut_sdram_U0_sdram_dqm_i;
+  s_dut_sdram_U0_wr_count_i = n_s_dut_sdram_U0_wr_count_i;
+  s_dut_sdram_U0_write_cmd_i = n_s_dut_sdram_U0_write_cmd_i;
+  s_dut_sdram_U0_write_done_i = n_s_dut_sdram_U0_write_done_i;
+  s_dut_sdram_U0_write_done_reg_i = n_s_dut_sdram_U0_write_done_reg_i;
+  s_dut_sdram_U1_U1_lfsr_reg_i = n_s_dut_sdram_U1_U1_lfsr_reg_i;
+  s_dut_sdram_U1_U5_lfsr_reg_i = n_s_dut_sdram_U1_U5_lfsr_reg_i;
+  s_dut_sdram_U1_lfsr_64_done_i = n_s_dut_sdram_U1_lfsr_64_done_i;
+  s_dut_sdram_U2_count_i = n_s_dut_sdram_U2_count_i;
+  s_dut_sdram_autoref_ack_i = n_s_dut_sdram_autoref_ack_i;
+  s_dut_sdram_autorefresh_enable_i = n_s_dut_sdram_autorefresh_enable_i;
+  s_dut_sdram_delay_done150us_i = n_s_dut_sdram_delay_done150us_i;
+  s_dut_sdram_idle_count_i = n_s_dut_sdram_idle_count_i;
+  s_dut_sdram_init_done_i = n_s_dut_sdram_init_done_i;
+  s_dut_sdram_power_down_reg1_i = n_s_dut_sdram_power_down_reg1_i;
+  s_dut_sdram_power_down_reg2_i = n_s_dut_sdram_power_down_reg2_i;
+  s_dut_sdram_power_down_reg3_i = n_s_dut_sdram_power_down_reg3_i;
+  s_dut_sdram_power_idle_i = n_s_dut_sdram_power_idle_i;
+  s_dut_sdram_refresh_count_done_i = n_s_dut_sdram_refresh_count_done_i;
+  s_dut_sdram_refresh_owed_i = n_s_dut_sdram_refresh_owed_i;
+  s_dut_sdram_refresh_req_i = n_s_dut_sdram_refresh_req_i;
+  s_dut_sdram_sdrctl_busyn_i = n_s_dut_sdram_sdrctl_busyn_i;
+  s_dut_sdram_selfrefresh_time_i = n_s_dut_sdram_selfrefresh_time_i;
+  s_dut_sdram_ack = n_s_dut_sdram_ack;
+  s_dut_sdram_adv = n_s_dut_sdram_adv;
+  s_dut_sdram_casn = n_s_dut_sdram_casn;
+  s_dut_sdram_cke = n_s_dut_sdram_cke;
+  s_dut_sdram_csn = n_s_dut_sdram_csn;
+  s_dut_sdram_i_addr = n_s_dut_sdram_i_addr;
+  s_dut_sdram_rasn = n_s_dut_sdram_rasn;
+  s_dut_sdram_wen = n_s_dut_sdram_wen;
+  s_dut_sf_q = n_s_dut_sf_q;
+  s_dut_sf_ready = n_s_dut_sf_ready;
+  s_dut_st_after_startup = n_s_dut_st_after_startup;
+  s_dut_st_doing_read = n_s_dut_st_doing_read;
+  s_dut_st_finishing_write = n_s_dut_st_finishing_write;
+  s_dut_st_lookup = n_s_dut_st_lookup;
+  s_dut_st_pending_fill = n_s_dut_st_pending_fill;
+  s_dut_st_pending_read = n_s_dut_st_pending_read;
+  s_dut_startup_counter = n_s_dut_startup_counter;
+  s_dut_stream_adr = n_s_dut_stream_adr;
+  s_dut_stream_fifo_r_ptr = n_s_dut_stream_fifo_r_ptr;
+  s_dut_stream_fifo_w_ptr = n_s_dut_stream_fifo_w_ptr;
+  s_dut_stream_rwn = n_s_dut_stream_rwn;
+  s_dut_win_base = n_s_dut_win_base;
+  s_dut_win_pending = n_s_dut_win_pending;
+  s_dut_win_rd_adr = n_s_dut_win_rd_adr;
+  s_dut_win_rdata = n_s_dut_win_rdata;
+  s_dut_win_ready = n_s_dut_win_ready;
+  s_dut_wq_fresh = n_s_dut_wq_fresh;
+  s_dut_write_queue_r_data = n_s_dut_write_queue_r_data;
+  s_dut_write_queue_r_ptr = n_s_dut_write_queue_r_ptr;
+  s_dut_write_queue_w_ptr = n_s_dut_write_queue_w_ptr;
+  for (size_t i = 0; i < nq_s_dut_burst_buf_mem.size(); ++i) s_dut_burst_buf_mem[nq_s_dut_burst_buf_mem[i].first] = nq_s_dut_burst_buf_mem[i].second;
+  nq_s_dut_burst_buf_mem.clear();
+  for (size_t i = 0; i < nq_s_dut_my_bist_fails.size(); ++i) s_dut_my_bist_fails[nq_s_dut_my_bist_fails[i].first] = nq_s_dut_my_bist_fails[i].second;
+  nq_s_dut_my_bist_fails.clear();
+  for (size_t i = 0; i < nq_s_dut_my_bus_slave_cmd_fifo_mem.size(); ++i) s_dut_my_bus_slave_cmd_fifo_mem[nq_s_dut_my_bus_slave_cmd_fifo_mem[i].first] = nq_s_dut_my_bus_slave_cmd_fifo_mem[i].second;
+  nq_s_dut_my_bus_slave_cmd_fifo_mem.clear();
+  for (size_t i = 0; i < nq_s_dut_my_bus_slave_rsp_fifo_mem.size(); ++i) s_dut_my_bus_slave_rsp_fifo_mem[nq_s_dut_my_bus_slave_rsp_fifo_mem[i].first] = nq_s_dut_my_bus_slave_rsp_fifo_mem[i].second;
+  nq_s_dut_my_bus_slave_rsp_fifo_mem.clear();
+  for (size_t i = 0; i < nq_s_dut_my_bus_slave_stream_q_mem.size(); ++i) s_dut_my_bus_slave_stream_q_mem[nq_s_dut_my_bus_slave_stream_q_mem[i].first] = nq_s_dut_my_bus_slave_stream_q_mem[i].second;
+  nq_s_dut_my_bus_slave_stream_q_mem.clear();
+  for (size_t i = 0; i < nq_s_dut_my_cache_lines_mem.size(); ++i) s_dut_my_cache_lines_mem[nq_s_dut_my_cache_lines_mem[i].first] = nq_s_dut_my_cache_lines_mem[i].second;
+  nq_s_dut_my_cache_lines_mem.clear();
+  for (size_t i = 0; i < nq_s_dut_my_cache_tags_mem.size(); ++i) s_dut_my_cache_tags_mem[nq_s_dut_my_cache_tags_mem[i].first] = nq_s_dut_my_cache_tags_mem[i].second;
+  nq_s_dut_my_cache_tags_mem.clear();
+  for (size_t i = 0; i < nq_s_dut_my_copy_copy_buf_mem.size(); ++i) s_dut_my_copy_copy_buf_mem[nq_s_dut_my_copy_copy_buf_mem[i].first] = nq_s_dut_my_copy_copy_buf_mem[i].second;
+  nq_s_dut_my_copy_copy_buf_mem.clear();
+  for (size_t i = 0; i < nq_s_dut_my_copy_desc_q_mem_mem.size(); ++i) s_dut_my_copy_desc_q_mem_mem[nq_s_dut_my_copy_desc_q_mem_mem[i].first] = nq_s_dut_my_copy_desc_q_mem_mem[i].second;
+  nq_s_dut_my_copy_desc_q_mem_mem.clear();
+  for (size_t i = 0; i < nq_s_dut_req_queue_mem.size(); ++i) s_dut_req_queue_mem[nq_s_dut_req_queue_mem[i].first] = nq_s_dut_req_queue_mem[i].second;
+  nq_s_dut_req_queue_mem.clear();
+  for (size_t i = 0; i < nq_s_dut_sdram_U0_open_row_i.size(); ++i) s_dut_sdram_U0_open_row_i[nq_s_dut_sdram_U0_open_row_i[i].first] = nq_s_dut_sdram_U0_open_row_i[i].second;
+  nq_s_dut_sdram_U0_open_row_i.clear();
+  for (size_t i = 0; i < nq_s_dut_stream_fifo_mem_mem.size(); ++i) s_dut_stream_fifo_mem_mem[nq_s_dut_stream_fifo_mem_mem[i].first] = nq_s_dut_stream_fifo_mem_mem[i].second;
+  nq_s_dut_stream_fifo_mem_mem.clear();
+  for (size_t i = 0; i < nq_s_dut_write_queue_mem_mem.size(); ++i) s_dut_write_queue_mem_mem[nq_s_dut_write_queue_mem_mem[i].first] = nq_s_dut_write_queue_mem_mem[i].second;
+  nq_s_dut_write_queue_mem_mem.clear();
+}
+void Vsim_top::eval() {
+  crystal_clk &= 0x1ULL;
+  aNE &= 0x1ULL;
+  aNOE &= 0x1ULL;
+  aNWE &= 0x1ULL;
+  fsmc_clk &= 0x1ULL;
+  fsmc_nbl &= 0x3ULL;
+  settle_();
+  if (!inited_) {
+    tp_0 = ((uint64_t)(s_dut_fsmc_clk));
+    tp_1 = ((uint64_t)(s_dut_clk));
+    tp_2 = ((uint64_t)(s_dut_sdram_i_clk));
+    tp_3 = ((uint64_t)(s_dut_sdram_rst));
+    tp_4 = ((uint64_t)(s_dut_sdram_sys_clk_i));
+    tp_5 = ((uint64_t)(s_dut_sdram_sys_rst_i));
+    tp_6 = ((uint64_t)(s_dut_sdram_U1_lfsr_64_done_i));
+    inited_ = true;
+  }
+  for (int it = 0; ; ++it) {
+    uint8_t c_0 = ((uint64_t)(s_dut_fsmc_clk));
+    uint8_t c_1 = ((uint64_t)(s_dut_clk));
+    uint8_t c_2 = ((uint64_t)(s_dut_sdram_i_clk));
+    uint8_t c_3 = ((uint64_t)(s_dut_sdram_rst));
+    uint8_t c_4 = ((uint64_t)(s_dut_sdram_sys_clk_i));
+    uint8_t c_5 = ((uint64_t)(s_dut_sdram_sys_rst_i));
+    uint8_t c_6 = ((uint64_t)(s_dut_sdram_U1_lfsr_64_done_i));
+    bool g_0 = (!tp_0 && c_0);
+    bool g_1 = (!tp_1 && c_1);
+    bool g_2 = (!tp_2 && c_2);
+    bool g_3 = (!tp_2 && c_2) || (!tp_3 && c_3);
+    bool g_4 = (!tp_4 && c_4) || (!tp_5 && c_5);
+    bool g_5 = (!tp_5 && c_5) || (!tp_6 && c_6);
+    tp_0 = c_0;
+    tp_1 = c_1;
+    tp_2 = c_2;
+    tp_3 = c_3;
+    tp_4 = c_4;
+    tp_5 = c_5;
+    tp_6 = c_6;
+    if (!(g_0 || g_1 || g_2 || g_3 || g_4 || g_5)) break;
+    if (g_0) { q0_(); q1_(); q4_(); q8_(); q9_(); q11_(); q14_(); q15_(); q17_(); q18_(); }
+    if (g_1) { q2_(); q3_(); q5_(); q6_(); q7_(); q10_(); q12_(); q13_(); q16_(); q19_(); q54_(); q55_(); q56_(); q57_(); q58_(); q59_(); q60_(); q61_(); q62_(); q63_(); q64_(); q65_(); q66_(); q67_(); q68_(); q69_(); q70_(); q71_(); q72_(); q73_(); q74_(); q75_(); q76_(); q77_(); q78_(); q79_(); q80_(); q81_(); q82_(); q83_(); q84_(); q85_(); q86_(); q87_(); q88_(); q89_(); q90_(); q91_(); q92_(); }
+    if (g_2) { q23_(); q33_(); q34_(); q43_(); q51_(); }
+    if (g_3) { q20_(); q21_(); q22_(); q24_(); q25_(); q26_(); q27_(); q28_(); q29_(); q30_(); q31_(); q32_(); q35_(); q36_(); q37_(); q38_(); q39_(); q40_(); q41_(); q42_(); q47_(); q48_(); q49_(); q50_(); q52_(); q53_(); }
+    if (g_4) { q44_(); q46_(); }
+    if (g_5) { q45_(); }
+    commit_();
+    settle_();
+    if (it > 1000) vl_fatal("clock loop");
+  }
+}
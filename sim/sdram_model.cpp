@@ -0,0 +1,345 @@
+#include <stdarg.h>
+
+#include "sdram_model.h"
+
+/* Errors printed in full; the rest are only counted. */
+static const uint64_t MAX_PRINTED = 20;
+
+static const char * const cmd_names[SdramModel::CMD_NUM] = {
+  "act", "read", "write", "pre", "ref", "mrs", "bst"
+};
+
+
+SdramModel::SdramModel(const SdramTiming &timing)
+  : errors(0), tm(timing), mem(WORDS, 0), now(0), n_edge(0), t_prev_edge(0),
+    t_act_any(0), t_ref(0), t_sr_exit(0), mrs_edge(0),
+    mode_set(false), pall_done(false), init_refs(0), cl(2), cke_q(false),
+    self_refresh(false), power_down(false), ref_base(0), refs_since_base(0),
+    refresh_late(false), period_reported(false)
+{
+  for (unsigned b = 0; b < BANKS; ++b)
+    banks[b] = Bank{false, 0, 0, 0, 0, false};
+  for (unsigned i = 0; i < 4; ++i)
+    dqm_hist[i] = 0;
+  reset_stats();
+}
+
+
+void
+SdramModel::reset_stats()
+{
+  for (unsigned i = 0; i < CMD_NUM; ++i)
+    cmds[i] = 0;
+  edges = 0;
+  data_edges = 0;
+  t_first = t_last = now;
+}
+
+
+void
+SdramModel::error(const char *fmt, ...)
+{
+  va_list ap;
+
+  if (errors++ >= MAX_PRINTED)
+    return;
+  fprintf(stderr, "sdram: %.1f ns: ", now / 1000.0);
+  va_start(ap, fmt);
+  vfprintf(stderr, fmt, ap);
+  va_end(ap);
+  fputc('\n', stderr);
+}
+
+
+/* Check that at least NS have passed since SINCE. */
+void
+SdramModel::check(double ns, uint64_t since, const char *what, unsigned bank)
+{
+  double passed = ((int64_t)now - (int64_t)since) / 1000.0;
+
+  if (passed < ns)
+    error("%s violated on bank %u: %.1f ns < %.1f ns", what, bank, passed, ns);
+}
+
+
+void
+SdramModel::refresh_check()
+{
+  uint64_t trefi_ps, intervals;
+  int64_t owed;
+
+  if (!mode_set || self_refresh)
+    return;
+  trefi_ps = (uint64_t)(tm.tREF_ms * 1e9 / tm.refresh_rows);
+  intervals = (now - ref_base) / trefi_ps;
+  owed = (int64_t)intervals - (int64_t)refs_since_base;
+  if (owed > (int64_t)tm.refresh_postpone + 1)
+  {
+    if (!refresh_late)
+      error("refresh overdue, %lld intervals owed", (long long)owed);
+    refresh_late = true;
+  }
+  else if (owed <= (int64_t)tm.refresh_postpone)
+    refresh_late = false;
+}
+
+
+void
+SdramModel::edge(uint64_t t_ps, const SdramPins &p)
+{
+  bool cke_prev = cke_q;
+  unsigned cmd;
+
+  now = t_ps;
+  ++n_edge;
+  if (edges++ == 0)
+    t_first = now;
+  t_last = now;
+
+  /* CAS latency against the clock period, for back-to-back edges. */
+  if (mode_set && !period_reported && t_prev_edge != 0)
+  {
+    double tck = (now - t_prev_edge) / 1000.0;
+    double min = (cl == 2) ? tm.tCK_cl2 : tm.tCK_cl3;
+    if (tck < min)
+    {
+      error("clock period %.2f ns too short for CAS latency %u", tck, cl);
+      period_reported = true;
+    }
+  }
+  t_prev_edge = now;
+
+  for (unsigned i = 3; i > 0; --i)
+    dqm_hist[i] = dqm_hist[i-1];
+  dqm_hist[0] = p.dqm;
+
+  /* Read data due at this edge has been driven during the last clock. */
+  while (!rd_q.empty() && rd_q.front().edge <= n_edge)
+  {
+    if (rd_q.front().edge == n_edge)
+    {
+      ++data_edges;
+      if (p.dq_oe)
+        error("DQ contention, controller drives during read data");
+    }
+    rd_q.erase(rd_q.begin());
+  }
+
+  refresh_check();
+
+  cke_q = p.cke;
+  if (!cke_prev)
+  {
+    /* Commands are ignored while CKE is low, and at the exit edge. */
+    if (p.cke)
+    {
+      if (self_refresh)
+      {
+        self_refresh = false;
+        t_sr_exit = now;
+        ref_base = now;
+        refs_since_base = 0;
+      }
+      power_down = false;
+    }
+    return;
+  }
+
+  cmd = p.csn ? 0xf : ((p.rasn << 2) | (p.casn << 1) | p.wen);
+  if (!p.cke)
+  {
+    /* Entry into self-refresh (REFRESH) or power-down (NOP). */
+    if (cmd == 1)
+    {
+      for (unsigned b = 0; b < BANKS; ++b)
+      {
+        if (banks[b].active)
+          error("self-refresh entry with bank %u open", b);
+        check(tm.tRP, banks[b].t_pre, "tRP", b);
+      }
+      check(tm.tRFC, t_ref, "tRFC", 0);
+      self_refresh = true;
+    }
+    else if (cmd == 0xf || cmd == 7)
+      power_down = true;
+    else
+      error("command %u with CKE going low", cmd);
+    return;
+  }
+
+  if (cmd != 0xf && cmd != 7)
+    command(p);
+}
+
+
+void
+SdramModel::command(const SdramPins &p)
+{
+  unsigned b = p.ba & (BANKS - 1);
+  Bank &bk = banks[b];
+  unsigned cmd = (p.rasn << 2) | (p.casn << 1) | p.wen;
+
+  if (mode_set && n_edge - mrs_edge < tm.tMRD)
+    error("tMRD violated");
+
+  switch (cmd)
+  {
+  case 3:                               /* ACTIVE */
+    ++cmds[CMD_ACT];
+    if (!mode_set)
+      error("ACTIVE before initialisation");
+    if (bk.active)
+      error("ACTIVE to bank %u with row %u open", b, bk.row);
+    check(tm.tRP, bk.t_pre, "tRP", b);
+    check(tm.tRC, bk.t_act, "tRC", b);
+    check(tm.tRRD, t_act_any, "tRRD", b);
+    check(tm.tRFC, t_ref, "tRFC", b);
+    check(tm.tXSR, t_sr_exit, "tXSR", b);
+    bk.active = true;
+    bk.row = p.a & (ROWS - 1);
+    bk.t_act = now;
+    bk.written = false;
+    t_act_any = now;
+    break;
+
+  case 5:                               /* READ */
+  case 4:                               /* WRITE */
+  {
+    bool is_read = (cmd == 5);
+    uint32_t adr;
+
+    ++cmds[is_read ? CMD_READ : CMD_WRITE];
+    if (!bk.active)
+    {
+      error("%s to bank %u with no row open", is_read ? "READ" : "WRITE", b);
+      break;
+    }
+    check(tm.tRCD, bk.t_act, "tRCD", b);
+    adr = (bk.row << 11) | (b << 9) | (p.a & (COLS - 1));
+    if (is_read)
+      rd_q.push_back(ReadData{n_edge + cl, mem[adr]});
+    else
+    {
+      uint16_t keep = ((p.dqm & 1) ? 0x00ff : 0) | ((p.dqm & 2) ? 0xff00 : 0);
+
+      if (!p.dq_oe)
+        error("WRITE to bank %u with DQ not driven", b);
+      mem[adr] = (mem[adr] & keep) | (p.dq & ~keep);
+      bk.t_write = now;
+      bk.written = true;
+      ++data_edges;
+    }
+    if (p.a & 0x400)
+    {
+      /* Auto-precharge, after the write recovery for writes. */
+      bk.active = false;
+      bk.t_pre = is_read ? now : now + (uint64_t)(tm.tWR * 1000);
+    }
+    break;
+  }
+
+  case 2:                               /* PRECHARGE */
+    ++cmds[CMD_PRE];
+    for (unsigned i = 0; i < BANKS; ++i)
+    {
+      Bank &pb = banks[i];
+
+      if (!(p.a & 0x400) && i != b)
+        continue;
+      if (!pb.active)
+        continue;
+      check(tm.tRAS, pb.t_act, "tRAS", i);
+      if ((now - pb.t_act) / 1000.0 > tm.tRAS_max)
+        error("tRAS max exceeded on bank %u", i);
+      if (pb.written)
+        check(tm.tWR, pb.t_write, "tWR", i);
+      pb.active = false;
+      pb.t_pre = now;
+    }
+    if (p.a & 0x400)
+      pall_done = true;
+    break;
+
+  case 1:                               /* AUTO REFRESH */
+    ++cmds[CMD_REF];
+    for (unsigned i = 0; i < BANKS; ++i)
+    {
+      if (banks[i].active)
+        error("REFRESH with bank %u open", i);
+      check(tm.tRP, banks[i].t_pre, "tRP", i);
+    }
+    check(tm.tRFC, t_ref, "tRFC", 0);
+    check(tm.tXSR, t_sr_exit, "tXSR", 0);
+    t_ref = now;
+    if (mode_set)
+      ++refs_since_base;
+    else
+      ++init_refs;
+    break;
+
+  case 0:                               /* LOAD MODE REGISTER */
+    ++cmds[CMD_MRS];
+    for (unsigned i = 0; i < BANKS; ++i)
+      if (banks[i].active)
+        error("LOAD MODE REGISTER with bank %u open", i);
+    if (!mode_set && (!pall_done || init_refs < 2))
+      error("LOAD MODE REGISTER before precharge-all and two refreshes");
+    if ((p.a & 7) != 0)
+      error("burst length code %u not modelled", p.a & 7);
+    cl = (p.a >> 4) & 7;
+    if (cl != 2 && cl != 3)
+    {
+      error("CAS latency %u not supported", cl);
+      cl = 2;
+    }
+    mrs_edge = n_edge;
+    if (!mode_set)
+    {
+      mode_set = true;
+      ref_base = now;
+      refs_since_base = 0;
+    }
+    break;
+
+  case 6:                               /* BURST TERMINATE */
+    ++cmds[CMD_BST];
+    break;
+  }
+}
+
+
+bool
+SdramModel::drive(uint16_t *dq) const
+{
+  unsigned mask;
+
+  if (rd_q.empty() || rd_q.front().edge != n_edge + 1)
+    return false;
+  /* DQM two clocks before the data masks it (high-Z per byte lane). */
+  mask = dqm_hist[1];
+  if (mask == 3)
+    return false;
+  *dq = rd_q.front().data;
+  if (mask & 1)
+    *dq &= 0xff00;
+  if (mask & 2)
+    *dq &= 0x00ff;
+  return true;
+}
+
+
+void
+SdramModel::report(FILE *f) const
+{
+  double ns = (t_last - t_first) / 1000.0;
+
+  fprintf(f, "sdram:");
+  for (unsigned i = 0; i < CMD_NUM; ++i)
+    fprintf(f, " %s=%llu", cmd_names[i], (unsigned long long)cmds[i]);
+  fprintf(f, "\nsdram: %llu clocks, %llu data (%.1f%%), %.1f MB/s, "
+          "%llu errors\n",
+          (unsigned long long)edges, (unsigned long long)data_edges,
+          edges ? 100.0 * data_edges / edges : 0.0,
+          ns > 0 ? data_edges * 2 * 1000.0 / ns : 0.0,
+          (unsigned long long)errors);
+}
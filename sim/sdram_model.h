@@ -0,0 +1,114 @@
+/*
+  Behavioural model of the SDRAM on the board (256 Mbit: 4 banks of 8192
+  rows of 512 16-bit columns), for the Verilator testbenches.
+
+  The model is clocked on each rising edge of the SDRAM clock, with the pins
+  as they were just before the edge. Every command is checked against the
+  state of its bank and against the datasheet timing: tRCD, tRP, tRAS
+  (min and max), tRC, tRRD, tRFC, tWR, tMRD and tXSR, the CAS latency set in
+  the mode register against the clock period, and the refresh interval
+  (8192 refreshes per 64 ms, up to 8 of them postponed). Power-down and
+  self-refresh follow CKE. Violations are counted, and the first ones are
+  printed with their time.
+
+  Read data is driven from CAS latency - 1 clocks after the READ, so the
+  controller samples it at the CAS latency edge; DQM masks it with a latency
+  of two clocks. Write data and DQM are taken at the WRITE edge. Only burst
+  length 1 is modelled, which is what the controller programs.
+
+  Word addresses are the controller's system addresses: column in bits 8:0,
+  bank in 10:9, row in 23:11.
+*/
+#ifndef SDRAM_MODEL_H
+#define SDRAM_MODEL_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+/* Datasheet timing in ns (clocks where noted), -75 speed grade. */
+struct SdramTiming {
+  double tRCD = 20, tRP = 20, tRAS = 44, tRAS_max = 120000, tRC = 66;
+  double tRRD = 15, tRFC = 66, tWR = 15, tXSR = 75;
+  double tCK_cl2 = 10, tCK_cl3 = 7.5;   // Minimum clock period per CL
+  unsigned tMRD = 2;                    // Clocks
+  double tREF_ms = 64;
+  unsigned refresh_rows = 8192;
+  unsigned refresh_postpone = 8;
+};
+
+struct SdramPins {
+  bool cke, csn, rasn, casn, wen;
+  unsigned ba, a, dqm;
+  bool dq_oe;                           // Controller drives DQ
+  uint16_t dq;                          // Value the controller drives
+};
+
+class SdramModel {
+public:
+  static const unsigned BANKS = 4, ROWS = 8192, COLS = 512;
+  static const uint32_t WORDS = BANKS * ROWS * COLS;
+
+  enum { CMD_ACT, CMD_READ, CMD_WRITE, CMD_PRE, CMD_REF, CMD_MRS,
+         CMD_BST, CMD_NUM };
+
+  explicit SdramModel(const SdramTiming &timing = SdramTiming());
+
+  /* Rising edge of the SDRAM clock at time T_PS (in ps). */
+  void edge(uint64_t t_ps, const SdramPins &p);
+  /* Value driven on DQ until the next edge; false if not driving. */
+  bool drive(uint16_t *dq) const;
+
+  uint16_t peek(uint32_t adr) const { return mem[adr % WORDS]; }
+  void poke(uint32_t adr, uint16_t v) { mem[adr % WORDS] = v; }
+
+  bool initialised() const { return mode_set; }
+
+  /* Statistics since the last reset_stats(). */
+  uint64_t cmds[CMD_NUM];
+  uint64_t edges;                       // SDRAM clock edges
+  uint64_t data_edges;                  // Edges with a word on DQ
+  uint64_t t_first, t_last;             // Time of first and last edge
+  void reset_stats();
+  void report(FILE *f) const;
+
+  uint64_t errors;
+
+private:
+  struct Bank {
+    bool active;
+    unsigned row;
+    uint64_t t_act, t_pre, t_write;
+    bool written;                       // WRITE since the ACTIVE
+  };
+  struct ReadData {
+    uint64_t edge;                      // Edge the controller samples it at
+    uint16_t data;
+  };
+
+  SdramTiming tm;
+  std::vector<uint16_t> mem;
+  Bank banks[BANKS];
+  uint64_t now, n_edge;
+  uint64_t t_prev_edge;
+  uint64_t t_act_any, t_ref, t_sr_exit;
+  uint64_t mrs_edge;
+  bool mode_set, pall_done;
+  unsigned init_refs;
+  unsigned cl;
+  bool cke_q;                           // Low at power-up, until driven high
+  bool self_refresh, power_down;
+  uint64_t ref_base;                    // Start of refresh accounting
+  uint64_t refs_since_base;
+  bool refresh_late;                    // Reported, until caught up
+  std::vector<ReadData> rd_q;
+  unsigned dqm_hist[4];                 // DQM at the last edges
+  bool period_reported;
+
+  void error(const char *fmt, ...);
+  void check(double ns, uint64_t since, const char *what, unsigned bank);
+  void refresh_check();
+  void command(const SdramPins &p);
+};
+
+#endif
@@ -0,0 +1,52 @@
+/*
+  Simulation wrapper around top (ice40/sdram-stm32.v) for Verilator.
+
+  The two bidirectional data buses are split into separate input and
+  output/enable ports, and resolved in the testbench (sim/system.cpp),
+  which also checks them for contention. With the cell models in
+  ice40_cells.v the I/O cells only read the package pin, so the pin is
+  driven from the *_in port here, and the FPGA's output and output enable
+  are taken from inside top.
+*/
+module sim_top
+  (input crystal_clk,
+   // FSMC
+   input 	 aNE, aNOE, aNWE,
+   input [7:0] 	 aA,
+   input [15:0]  aD_in,
+   output [15:0] aD_out,
+   output 	 aD_oe,
+   input 	 fsmc_clk,	// sdram_gpio3
+   input [1:0] 	 fsmc_nbl,	// sdram_gpio5, sdram_gpio4
+   output 	 nwait,		// sdram_gpio1
+   output 	 cp_irq,	// sdram_gpio2
+   // SDRAM
+   input [15:0]  mem_d_in,
+   output [15:0] mem_d_out,
+   output 	 mem_d_oe,
+   output [12:0] mem_a,
+   output [1:0]  mem_ba,
+   output [1:0]  mem_dqm,
+   output 	 mem_ras, mem_cas, mem_we, mem_cs, mem_cke, mem_clk,
+   output 	 init_done);
+
+   wire [15:0] 	 aD = aD_in;
+   wire [15:0] 	 mem_d = mem_d_in;
+   wire 	 mem_cs2_unused;
+
+   top dut(.crystal_clk(crystal_clk),
+	   .aNE(aNE), .aNOE(aNOE), .aNWE(aNWE), .aA(aA), .aD(aD),
+	   .sdram_gpio1(nwait), .sdram_gpio2(cp_irq),
+	   .sdram_gpio3(fsmc_clk), .sdram_gpio4(fsmc_nbl[0]),
+	   .sdram_gpio5(fsmc_nbl[1]),
+	   .mem_d(mem_d), .mem_a(mem_a), .mem_ras(mem_ras), .mem_cas(mem_cas),
+	   .mem_dqm(mem_dqm), .mem_clk(mem_clk), .mem_cke(mem_cke),
+	   .mem_we(mem_we), .mem_ba(mem_ba), .mem_cs1(mem_cs),
+	   .mem_cs2(mem_cs2_unused));
+
+   assign aD_out = dut.aDn_output;
+   assign aD_oe = dut.fsmc_io_d_output;
+   assign mem_d_out = dut.sdram_o_dq;
+   assign mem_d_oe = dut.sdram_busdir;
+   assign init_done = dut.sdram_init_done;
+endmodule
@@ -0,0 +1,338 @@
+#include "Vsim_top.h"
+#include "verilated.h"
+#if VM_TRACE
+#include "verilated_vcd_c.h"
+#endif
+
+#include "system.h"
+
+/* Value seen on a data bus that nothing drives. */
+static const uint16_t FLOATING = 0xdead;
+
+static uint64_t sim_now;
+
+double
+sc_time_stamp()
+{
+  return sim_now;
+}
+
+
+System::System(const SystemConfig &c)
+  : sdram(c.sdram), fsmc(c.fsmc), cfg(c), tfp(nullptr), now(0), n_hclk(0),
+    fpga_i(0), hclk_i(0), fclk_i(0), sd_drive(false), sd_val(0),
+    ad_contention(false), md_contention(false), bus_errors(0)
+{
+  top = new Vsim_top;
+#if VM_TRACE
+  if (cfg.vcd)
+  {
+    Verilated::traceEverOn(true);
+    tfp = new VerilatedVcdC;
+    top->trace(tfp, 99);
+    tfp->open(cfg.vcd);
+  }
+#endif
+  top->crystal_clk = 0;
+  top->fsmc_clk = 0;
+  top->aNE = top->aNOE = top->aNWE = 1;
+  top->aA = 0;
+  top->fsmc_nbl = 0;
+  top->aD_in = FLOATING;
+  top->mem_d_in = FLOATING;
+  top->eval();
+  t_fpga = edge_time(++fpga_i, 2 * (uint64_t)cfg.fpga_khz, 1);
+  t_hclk = edge_time(++hclk_i, cfg.hclk_khz, 1);
+  t_fclk = edge_time(++fclk_i, 2 * (uint64_t)cfg.hclk_khz,
+                     cfg.fsmc.clkdiv + 1);
+}
+
+
+System::~System()
+{
+  top->final();
+#if VM_TRACE
+  if (tfp)
+  {
+    tfp->close();
+    delete tfp;
+  }
+#endif
+  delete top;
+}
+
+
+/* Time of edge K of a clock with K edges per MUL / KHZ2 ms. */
+uint64_t
+System::edge_time(uint64_t k, uint64_t khz2, unsigned mul) const
+{
+  return k * 1000000000ULL * mul / khz2;
+}
+
+
+bool
+System::cp_irq() const
+{
+  return top->cp_irq;
+}
+
+
+void
+System::set_fsmc_timing(const FsmcTiming &t)
+{
+  if (t.sync != cfg.fsmc.sync)
+    fprintf(stderr, "system: FSMC mode is fixed by the FPGA build\n");
+  cfg.fsmc = t;
+  cfg.fsmc.sync = fsmc.timing().sync;
+  fsmc.set_timing(cfg.fsmc);
+}
+
+
+/* Resolve both data buses until the design's outputs stop changing. */
+void
+System::settle()
+{
+  for (unsigned k = 0; k < 4; ++k)
+  {
+    uint16_t ad = fsmc.pins.d_oe ? fsmc.pins.d :
+                  (top->aD_oe ? top->aD_out : FLOATING);
+    uint16_t md = sd_drive ? sd_val :
+                  (top->mem_d_oe ? top->mem_d_out : FLOATING);
+
+    if (ad == top->aD_in && md == top->mem_d_in)
+      break;
+    top->aD_in = ad;
+    top->mem_d_in = md;
+    top->eval();
+  }
+
+  if (fsmc.pins.d_oe && top->aD_oe)
+  {
+    if (!ad_contention && bus_errors++ < 20)
+      fprintf(stderr, "system: %.1f ns: FSMC data bus driven by both\n",
+              now / 1000.0);
+    ad_contention = true;
+  }
+  else
+    ad_contention = false;
+  if (sd_drive && top->mem_d_oe)
+  {
+    if (!md_contention && bus_errors++ < 20)
+      fprintf(stderr, "system: %.1f ns: SDRAM data bus driven by both\n",
+              now / 1000.0);
+    md_contention = true;
+  }
+  else
+    md_contention = false;
+}
+
+
+void
+System::step()
+{
+  uint64_t t = t_fpga < t_hclk ? t_fpga : t_hclk;
+  bool ad_valid = top->aD_oe;
+  uint16_t ad = top->aD_out;
+  bool nwait = top->nwait;
+
+  if (cfg.fsmc.sync && t_fclk < t)
+    t = t_fclk;
+  now = sim_now = t;
+
+  /* Clock edges, with the inputs as they were before them. */
+  if (t == t_hclk)
+  {
+    ++n_hclk;
+    if (!cfg.fsmc.sync)
+      fsmc.hclk(ad, ad_valid, nwait);
+    t_hclk = edge_time(++hclk_i, cfg.hclk_khz, 1);
+  }
+  if (cfg.fsmc.sync && t == t_fclk)
+  {
+    if (!top->fsmc_clk)
+    {
+      fsmc.clk_rise(ad, ad_valid, nwait);
+      top->fsmc_clk = 1;
+    }
+    else
+    {
+      top->fsmc_clk = 0;
+      fsmc.clk_fall();
+    }
+    t_fclk = edge_time(++fclk_i, 2 * (uint64_t)cfg.hclk_khz,
+                       cfg.fsmc.clkdiv + 1);
+  }
+  if (t == t_fpga)
+  {
+    SdramPins p;
+    bool mem_clk = top->mem_clk;
+
+    p.cke = top->mem_cke;
+    p.csn = top->mem_cs;
+    p.rasn = top->mem_ras;
+    p.casn = top->mem_cas;
+    p.wen = top->mem_we;
+    p.ba = top->mem_ba;
+    p.a = top->mem_a;
+    p.dqm = top->mem_dqm;
+    p.dq_oe = top->mem_d_oe;
+    p.dq = top->mem_d_out;
+    top->crystal_clk = !top->crystal_clk;
+    top->eval();
+    if (!mem_clk && top->mem_clk)
+    {
+      sdram.edge(t, p);
+      sd_drive = sdram.drive(&sd_val);
+    }
+    t_fpga = edge_time(++fpga_i, 2 * (uint64_t)cfg.fpga_khz, 1);
+  }
+  else
+    top->eval();
+
+  /* Then the FSMC outputs that changed at this time. */
+  top->aNE = fsmc.pins.ne;
+  top->aNOE = fsmc.pins.noe;
+  top->aNWE = fsmc.pins.nwe;
+  top->aA = fsmc.pins.a;
+  top->fsmc_nbl = fsmc.pins.nbl;
+  top->eval();
+  settle();
+
+#if VM_TRACE
+  if (tfp)
+    tfp->dump(now);
+#endif
+}
+
+
+bool
+System::wait_init(uint64_t max_us)
+{
+  uint64_t end = now + max_us * 1000000;
+
+  while (!top->init_done && now < end)
+    step();
+  return top->init_done;
+}
+
+
+void
+System::idle_hclk(uint64_t n)
+{
+  uint64_t end = n_hclk + n;
+
+  while (n_hclk < end)
+    step();
+}
+
+
+void
+System::access(bool write, uint8_t reg, unsigned n, const uint16_t *d,
+               unsigned nbl)
+{
+  fsmc.start(write, reg, n, d, nbl);
+  while (fsmc.busy())
+    step();
+}
+
+
+void
+System::write16(uint8_t reg, uint16_t v, unsigned nbl)
+{
+  access(true, reg, 1, &v, nbl);
+}
+
+
+uint16_t
+System::read16(uint8_t reg)
+{
+  access(false, reg, 1, nullptr, 0);
+  return fsmc.data()[0];
+}
+
+
+void
+System::write32(uint8_t reg, uint32_t v)
+{
+  uint16_t d[2] = { (uint16_t)v, (uint16_t)(v >> 16) };
+
+  burst_write(reg, d, 2, false);
+}
+
+
+uint32_t
+System::read32(uint8_t reg)
+{
+  uint16_t d[2];
+
+  burst_read(reg, d, 2, false);
+  return d[0] | ((uint32_t)d[1] << 16);
+}
+
+
+void
+System::burst_write(uint8_t reg, const uint16_t *d, unsigned n, bool stay)
+{
+  if (cfg.fsmc.sync)
+    access(true, reg, n, d, 0);
+  else
+    for (unsigned k = 0; k < n; ++k)
+      access(true, stay ? reg : reg + k, 1, d + k, 0);
+}
+
+
+void
+System::burst_read(uint8_t reg, uint16_t *d, unsigned n, bool stay)
+{
+  if (cfg.fsmc.sync)
+  {
+    access(false, reg, n, nullptr, 0);
+    for (unsigned k = 0; k < n; ++k)
+      d[k] = fsmc.data()[k];
+  }
+  else
+    for (unsigned k = 0; k < n; ++k)
+      d[k] = read16(stay ? reg : reg + k);
+}
+
+
+void
+System::record(const std::string &label, uint64_t hclks, uint64_t words)
+{
+  for (Stat &s : stats)
+    if (s.label == label)
+    {
+      ++s.count;
+      s.words += words;
+      s.sum += hclks;
+      if (hclks < s.min)
+        s.min = hclks;
+      if (hclks > s.max)
+        s.max = hclks;
+      return;
+    }
+  stats.push_back(Stat{label, 1, words, hclks, hclks, hclks});
+}
+
+
+void
+System::report(FILE *f) const
+{
+  fprintf(f, "%-24s %8s %6s %8s %6s %10s\n",
+          "access", "count", "min", "avg", "max", "kwords/s");
+  for (const Stat &s : stats)
+    fprintf(f, "%-24s %8llu %6llu %8.1f %6llu %10.0f\n", s.label.c_str(),
+            (unsigned long long)s.count, (unsigned long long)s.min,
+            (double)s.sum / s.count, (unsigned long long)s.max,
+            s.sum ? s.words * (double)cfg.hclk_khz / s.sum : 0.0);
+  fprintf(f, "(latency in HCLK cycles at %u kHz, FPGA clock %u kHz)\n",
+          cfg.hclk_khz, cfg.fpga_khz);
+  sdram.report(f);
+}
+
+
+uint64_t
+System::errors() const
+{
+  return bus_errors + sdram.errors + fsmc.errors;
+}
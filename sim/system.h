@@ -0,0 +1,107 @@
+/*
+  The board as seen by the testbenches: the FPGA design (Verilated
+  sim_top), the STM32 FSMC model on one side and the SDRAM model on the
+  other, stepped together in picoseconds.
+
+  The FPGA clock runs at the PLL output frequency, HCLK at 168 MHz, and in
+  synchronous mode FSMC_CLK at HCLK / (CLKDIV + 1). Clock edges are applied
+  first and the design evaluated, then the FSMC outputs change and both
+  data buses are resolved, so an input that changes at the same time as a
+  clock edge is seen after that edge. Both buses are checked for two
+  drivers at once.
+
+  Each MCU access runs until the FSMC is ready for the next one, including
+  the bus turnaround, and its length in HCLK cycles can be recorded under a
+  label for the latency report.
+*/
+#ifndef SYSTEM_H
+#define SYSTEM_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "fsmc_model.h"
+#include "sdram_model.h"
+
+class Vsim_top;
+class VerilatedVcdC;
+
+struct SystemConfig {
+  unsigned fpga_khz = 79500;            // PLL_KHZ for CLK_KHZ 79500
+  unsigned hclk_khz = 168000;
+  FsmcTiming fsmc;
+  SdramTiming sdram;
+  const char *vcd = nullptr;            // Trace file, with VM_TRACE
+};
+
+class System {
+public:
+  explicit System(const SystemConfig &cfg = SystemConfig());
+  ~System();
+
+  /* Run until the SDRAM controller has initialised the SDRAM. */
+  bool wait_init(uint64_t max_us = 1000);
+
+  /* MCU accesses; REG is the FPGA register (FSMC A[7:0]). 32-bit accesses
+     are two halfword accesses, low half first, or a two-beat burst in
+     synchronous mode. */
+  void write16(uint8_t reg, uint16_t v, unsigned nbl = 0);
+  uint16_t read16(uint8_t reg);
+  void write32(uint8_t reg, uint32_t v);
+  uint32_t read32(uint8_t reg);
+  /* N words from/to REG, incrementing the register unless STAY. One burst
+     in synchronous mode, single accesses otherwise. */
+  void burst_write(uint8_t reg, const uint16_t *d, unsigned n, bool stay);
+  void burst_read(uint8_t reg, uint16_t *d, unsigned n, bool stay);
+
+  /* Let time pass with the FSMC idle. */
+  void idle_hclk(uint64_t n);
+  void idle_us(unsigned us) { idle_hclk((uint64_t)us * cfg.hclk_khz / 1000); }
+
+  uint64_t hclk() const { return n_hclk; }
+  uint64_t time_ps() const { return now; }
+  bool sync() const { return cfg.fsmc.sync; }
+  bool cp_irq() const;
+
+  void set_fsmc_timing(const FsmcTiming &t);
+
+  /* Latency statistics, per label in order of first use. */
+  void record(const std::string &label, uint64_t hclks, uint64_t words = 1);
+  void clear_stats() { stats.clear(); }
+  void report(FILE *f) const;
+
+  /* All errors so far: bus contention and model checks. */
+  uint64_t errors() const;
+
+  SdramModel sdram;
+  FsmcModel fsmc;
+
+private:
+  struct Stat {
+    std::string label;
+    uint64_t count, words, sum, min, max;
+  };
+
+  SystemConfig cfg;
+  Vsim_top *top;
+  VerilatedVcdC *tfp;
+  uint64_t now;
+  uint64_t n_hclk;
+  uint64_t fpga_i, hclk_i, fclk_i;      // Edge numbers
+  uint64_t t_fpga, t_hclk, t_fclk;      // Time of next edge
+  bool sd_drive;
+  uint16_t sd_val;
+  bool ad_contention, md_contention;
+  uint64_t bus_errors;
+  std::vector<Stat> stats;
+
+  void step();
+  void settle();
+  void access(bool write, uint8_t reg, unsigned n, const uint16_t *d,
+              unsigned nbl);
+  uint64_t edge_time(uint64_t k, uint64_t khz2, unsigned mul) const;
+};
+
+#endif
@@ -0,0 +1,306 @@
+/*
+  Testbench for the SDRAM controller alone (ice40/sdram_controller.v, at
+  the clock of the full design), against the SDRAM model.
+
+  A client like the engines in top issues single-word requests with the
+  same handshake: the request is presented while the controller is ready
+  (not busy, or pipe_ready) and held until o_ack, and the next one follows
+  in the clock after, as from the request queue in top. For each
+  access pattern it reports the controller clocks per access, without a
+  look-ahead hint (what single-word reads from the MCU get), with the
+  following address as the hint (what they used to get; a wrong guess can
+  close a row still in use), and with the true next address as the
+  engines and queued single-word writes give it. Read data is checked
+  against the model, and every SDRAM timing violation counts as an error.
+
+  Usage: tb_ctrl [-n accesses] [-s seed]
+*/
+#include <stdlib.h>
+#include <unistd.h>
+#include <deque>
+#include <vector>
+
+#include "Vsdram_controller.h"
+#include "verilated.h"
+
+#include "sdram_model.h"
+
+static const unsigned CLK_KHZ = 79500;
+static const uint32_t ADR_MASK = SdramModel::WORDS - 1;
+
+enum Hint { HINT_NONE, HINT_FOLLOWING, HINT_NEXT, HINT_NUM };
+static const char * const hint_names[HINT_NUM] = {
+  "none", "following", "next"
+};
+
+static Vsdram_controller *top;
+static SdramModel *sdram;
+static uint64_t now, n_edge, errors;
+static uint32_t rnd_state = 1;
+
+double
+sc_time_stamp()
+{
+  return now;
+}
+
+
+static uint32_t
+rnd(void)
+{
+  rnd_state ^= rnd_state << 13;
+  rnd_state ^= rnd_state >> 17;
+  rnd_state ^= rnd_state << 5;
+  return rnd_state;
+}
+
+
+static uint64_t
+edge_time(uint64_t k)
+{
+  return k * 1000000000ULL / (2 * CLK_KHZ);
+}
+
+
+struct Outputs {
+  bool ack, busy, pipe_ready, data_valid, write_done, init_done;
+  uint16_t data;
+};
+
+
+/*
+  One controller clock. Returns the outputs as they were during the clock
+  that ends with this edge, which is what a registered client sees.
+*/
+static Outputs
+tick(void)
+{
+  Outputs o;
+  SdramPins p;
+  uint16_t dq;
+
+  o.ack = top->o_ack;
+  o.busy = top->o_busy;
+  o.pipe_ready = top->o_pipe_ready;
+  o.data_valid = top->o_data_valid;
+  o.write_done = top->o_write_done;
+  o.init_done = top->o_init_done;
+  o.data = top->o_data & 0xffff;
+
+  p.cke = top->o_sdram_cke;
+  p.csn = top->o_sdram_csn;
+  p.rasn = top->o_sdram_rasn;
+  p.casn = top->o_sdram_casn;
+  p.wen = top->o_sdram_wen;
+  p.ba = top->o_sdram_blkaddr;
+  p.a = top->o_sdram_addr;
+  p.dqm = top->o_sdram_dqm & 3;
+  p.dq_oe = top->o_sdram_busdir;
+  p.dq = top->o_sdram_dq;
+
+  now = edge_time(++n_edge);
+  top->i_clk = 1;
+  top->eval();
+  if (top->o_sdram_clk)
+    sdram->edge(now, p);
+  top->i_sdram_dq = sdram->drive(&dq) ? dq :
+                    (top->o_sdram_busdir ? top->o_sdram_dq : 0xdead);
+  top->eval();
+
+  now = edge_time(++n_edge);
+  top->i_clk = 0;
+  top->eval();
+  return o;
+}
+
+
+struct Result {
+  uint64_t clocks;
+  uint64_t n;
+};
+
+
+/* Issue the requests in ADRS, all reads or all writes. */
+static Result
+run(const std::vector<uint32_t> &adrs, bool read, Hint hint)
+{
+  enum { NEXT, PENDING, DOING, DONE } st = NEXT;
+  std::deque<uint32_t> expect;
+  unsigned writing = 0;
+  size_t i = 0;
+  uint64_t start = n_edge;
+  uint32_t adr = 0;
+
+  top->i_rwn = read;
+  top->i_adv = 0;
+  while (st != DONE || !expect.empty() || writing)
+  {
+    Outputs o = tick();
+    bool ready = o.init_done && (!o.busy || o.pipe_ready);
+
+    if (o.data_valid)
+    {
+      if (expect.empty())
+      {
+        fprintf(stderr, "tb_ctrl: read data without a read\n");
+        ++errors;
+      }
+      else
+      {
+        uint16_t want = sdram->peek(expect.front());
+        if (o.data != want && errors++ < 20)
+          fprintf(stderr, "tb_ctrl: read 0x%06x: got 0x%04x, expected "
+                  "0x%04x\n", expect.front(), o.data, want);
+        expect.pop_front();
+      }
+    }
+
+    if (o.write_done)
+    {
+      if (!writing)
+      {
+        fprintf(stderr, "tb_ctrl: write done without a write\n");
+        ++errors;
+      }
+      else
+        --writing;
+    }
+
+    switch (st)
+    {
+    case DOING:
+      if (!o.ack)
+        break;
+      if (read)
+        expect.push_back(adr);
+      else
+        ++writing;
+      // The next request is presented at once.
+      top->i_adv = 0;
+      st = NEXT;
+      // fall through
+
+    case NEXT:
+      if (i == adrs.size())
+      {
+        st = DONE;
+        break;
+      }
+      adr = adrs[i++];
+      top->i_addr = adr;
+      top->i_data = rnd() & 0xffff;
+      top->i_next_valid = hint != HINT_NONE &&
+                          (hint == HINT_FOLLOWING || i < adrs.size());
+      top->i_next_addr = hint == HINT_FOLLOWING ? ((adr + 1) & ADR_MASK) :
+                         (i < adrs.size() ? adrs[i] : 0);
+      if (ready)
+      {
+        top->i_adv = 1;
+        st = DOING;
+      }
+      else
+        st = PENDING;
+      break;
+
+    case PENDING:
+      if (ready)
+      {
+        top->i_adv = 1;
+        st = DOING;
+      }
+      break;
+
+    case DONE:
+      break;
+    }
+    if ((n_edge - start) / 2 > 100 * (uint64_t)adrs.size() + 10000)
+    {
+      fprintf(stderr, "tb_ctrl: controller stuck\n");
+      ++errors;
+      break;
+    }
+  }
+  return Result{(n_edge - start) / 2, adrs.size()};
+}
+
+
+int
+main(int argc, char **argv)
+{
+  unsigned n = 4096;
+  int opt;
+  const char *patterns[] = {
+    "sequential", "random", "bank interleave", "row miss, same bank"
+  };
+
+  Verilated::commandArgs(argc, argv);
+  while ((opt = getopt(argc, argv, "n:s:")) != -1)
+  {
+    switch (opt)
+    {
+    case 'n': n = strtoul(optarg, nullptr, 0); break;
+    case 's': rnd_state = strtoul(optarg, nullptr, 0) | 1; break;
+    default:
+      fprintf(stderr, "usage: %s [-n accesses] [-s seed]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  top = new Vsdram_controller;
+  sdram = new SdramModel;
+  top->i_rst = 1;
+  top->i_clk = 0;
+  top->i_burst_len = 1;
+  top->i_dqm = 0;
+  top->i_disable_precharge = 1;
+  top->i_powerdown_idle = 0;
+  top->i_selfrefresh_idle = 0;
+  top->eval();
+  for (unsigned k = 0; k < 4; ++k)
+    tick();
+  top->i_rst = 0;
+  while (!top->o_init_done && now < 1000000000ULL)
+    tick();
+  if (!top->o_init_done)
+  {
+    fprintf(stderr, "tb_ctrl: no init_done\n");
+    return 1;
+  }
+  sdram->reset_stats();
+
+  printf("%-22s %-6s %10s %10s %10s\n", "clocks per access", "",
+         hint_names[0], hint_names[1], hint_names[2]);
+  for (unsigned pat = 0; pat < 4; ++pat)
+  {
+    std::vector<uint32_t> adrs(n);
+    uint32_t base = rnd() & ADR_MASK & ~0x1ffu;
+
+    for (unsigned k = 0; k < n; ++k)
+      switch (pat)
+      {
+      case 0: adrs[k] = (base + k) & ADR_MASK; break;
+      case 1: adrs[k] = rnd() & ADR_MASK; break;
+      case 2: adrs[k] = ((rnd() & 0x1fff) << 11) | ((k & 3) << 9) |
+                        (rnd() & 0x1ff); break;
+      case 3: adrs[k] = ((k & 1 ? 0x155 : 0x0aa) << 11) | (1 << 9) |
+                        (rnd() & 0x1ff); break;
+      }
+    for (unsigned rd = 0; rd < 2; ++rd)
+    {
+      printf("%-22s %-6s", patterns[pat], rd ? "read" : "write");
+      for (unsigned h = 0; h < HINT_NUM; ++h)
+      {
+        Result r = run(adrs, rd, (Hint)h);
+        printf(" %10.2f", (double)r.clocks / r.n);
+      }
+      printf("\n");
+    }
+  }
+  sdram->report(stdout);
+  errors += sdram->errors;
+  printf("%llu errors\n", (unsigned long long)errors);
+  top->final();
+  delete top;
+  delete sdram;
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,524 @@
+/*
+  Testbench for the whole FPGA design: the STM32 access sequences of
+  stm32/main.c run against the Verilated design and the SDRAM model, every
+  SDRAM word read back is compared with what was written, and the latency
+  of each kind of access is reported.
+
+  Usage: tb_top [-n words] [-d datast] [-s seed] [-t trace.vcd]
+*/
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+#include <unordered_map>
+
+#include "verilated.h"
+
+#include "system.h"
+
+/* Register byte offsets, as in stm32/main.c. */
+#define PERIPH_REG_ADR_LOW 0x00
+#define PERIPH_REG_ADR_HIGH 0x02
+#define PERIPH_REG_DATA 0x04
+#define PERIPH_REG_BURST_LEN 0x06
+#define PERIPH_REG_BURST_STATUS 0x08
+#define PERIPH_REG_BURST_DATA 0x0a
+#define PERIPH_REG_STREAM_ADR 0x0e
+#define PERIPH_REG_DATA_STREAM 0x10
+#define PERIPH_REG_WIN_BASE 0x14
+#define PERIPH_REG_ADR32 0x28
+#define PERIPH_REG_CP_FILL 0x42
+#define PERIPH_REG_CP_SRC 0x44
+#define PERIPH_REG_DATA32 0x2c
+#define FPGA_WINDOW_OFFSET 0x100
+#define WINDOW_BYTES 256
+#define BURST_MAX_WORDS 256
+
+/* Bytes of SDRAM. */
+#define SDRAM_BYTES (2 * SdramModel::WORDS)
+
+static System *sys;
+static std::unordered_map<uint32_t, uint16_t> shadow;
+static uint64_t mismatches;
+static uint32_t rnd_state = 1;
+
+
+static uint32_t
+rnd(void)
+{
+  rnd_state ^= rnd_state << 13;
+  rnd_state ^= rnd_state >> 17;
+  rnd_state ^= rnd_state << 5;
+  return rnd_state;
+}
+
+
+/* FSMC address lines A[7:0] are HADDR[8:1] for the 16-bit bus. */
+static uint8_t
+reg(uint32_t offset)
+{
+  return offset >> 1;
+}
+
+
+static void
+write_fpga(uint32_t offset, uint16_t val)
+{
+  sys->write16(reg(offset), val);
+}
+
+
+static uint16_t
+read_fpga(uint32_t offset)
+{
+  return sys->read16(reg(offset));
+}
+
+
+static void
+check(const char *what, uint32_t addr, uint16_t got)
+{
+  auto it = shadow.find(addr >> 1);
+  uint16_t want = it == shadow.end() ? 0 : it->second;
+
+  if (got != want && mismatches++ < 20)
+    fprintf(stderr, "tb: %s at 0x%06x: got 0x%04x, expected 0x%04x\n",
+            what, addr, got, want);
+}
+
+
+static void
+sdram_flush(void)
+{
+  uint64_t t0 = sys->hclk();
+
+  while (read_fpga(PERIPH_REG_ADR_LOW) & 1)
+    ;
+  sys->record("flush", sys->hclk() - t0, 0);
+}
+
+
+static void
+write_sdram(uint32_t addr, uint16_t val)
+{
+  uint64_t t0 = sys->hclk();
+
+  write_fpga(PERIPH_REG_DATA, val);
+  write_fpga(PERIPH_REG_ADR_HIGH, addr >> 16);
+  write_fpga(PERIPH_REG_ADR_LOW, (addr & 0xfffe) | 1);
+  sys->record("write_sdram", sys->hclk() - t0);
+  shadow[addr >> 1] = val;
+}
+
+
+static uint16_t
+read_sdram(uint32_t addr)
+{
+  uint64_t t0 = sys->hclk();
+  uint16_t v;
+
+  write_fpga(PERIPH_REG_ADR_HIGH, addr >> 16);
+  write_fpga(PERIPH_REG_ADR_LOW, addr & 0xfffe);
+  v = read_fpga(PERIPH_REG_DATA);
+  sys->record("read_sdram", sys->hclk() - t0);
+  return v;
+}
+
+
+/* Single words at random addresses, checked against the shadow copy. */
+static void
+test_single(unsigned n)
+{
+  std::vector<uint32_t> addrs;
+
+  for (unsigned i = 0; i < n; ++i)
+  {
+    uint32_t addr = (rnd() % SDRAM_BYTES) & ~1u;
+
+    write_sdram(addr, rnd());
+    addrs.push_back(addr);
+  }
+  sdram_flush();
+  for (uint32_t addr : addrs)
+    check("read_sdram", addr, read_sdram(addr));
+}
+
+
+/* 32-bit accesses through ADR32/DATA32, which auto-increment. */
+static void
+test_32(uint32_t addr, unsigned n)
+{
+  uint64_t t0;
+
+  sys->write32(reg(PERIPH_REG_ADR32), addr);
+  for (unsigned i = 0; i < n; ++i)
+  {
+    uint32_t v = rnd();
+
+    t0 = sys->hclk();
+    sys->write32(reg(PERIPH_REG_DATA32), v);
+    sys->record("write32", sys->hclk() - t0, 2);
+    shadow[(addr >> 1) + 2*i] = v;
+    shadow[(addr >> 1) + 2*i + 1] = v >> 16;
+  }
+  sdram_flush();
+  sys->write32(reg(PERIPH_REG_ADR32), addr);
+  for (unsigned i = 0; i < n; ++i)
+  {
+    uint32_t v;
+
+    t0 = sys->hclk();
+    v = sys->read32(reg(PERIPH_REG_DATA32));
+    sys->record("read32", sys->hclk() - t0, 2);
+    check("read32 lo", addr + 4*i, v);
+    check("read32 hi", addr + 4*i + 2, v >> 16);
+  }
+}
+
+
+/*
+  Streaming port, in pieces of 32 words; in synchronous mode each piece is
+  one FSMC burst.
+*/
+static void
+test_stream(uint32_t addr, unsigned n)
+{
+  const unsigned piece = 32;
+  uint16_t buf[piece];
+  uint64_t t0;
+
+  write_fpga(PERIPH_REG_ADR_HIGH, addr >> 16);
+  write_fpga(PERIPH_REG_STREAM_ADR, (addr & 0xfffe) | 1);
+  for (unsigned i = 0; i < n; i += piece)
+  {
+    for (unsigned k = 0; k < piece; ++k)
+    {
+      buf[k] = rnd();
+      shadow[(addr >> 1) + i + k] = buf[k];
+    }
+    t0 = sys->hclk();
+    sys->burst_write(reg(PERIPH_REG_DATA_STREAM), buf, piece, true);
+    sys->record("stream write", sys->hclk() - t0, piece);
+  }
+  write_fpga(PERIPH_REG_STREAM_ADR, 1);
+  sdram_flush();
+
+  write_fpga(PERIPH_REG_ADR_HIGH, addr >> 16);
+  write_fpga(PERIPH_REG_STREAM_ADR, addr & 0xfffe);
+  for (unsigned i = 0; i < n; i += piece)
+  {
+    t0 = sys->hclk();
+    sys->burst_read(reg(PERIPH_REG_DATA_STREAM), buf, piece, true);
+    sys->record("stream read", sys->hclk() - t0, piece);
+    for (unsigned k = 0; k < piece; ++k)
+      check("stream read", addr + 2*(i + k), buf[k]);
+  }
+  write_fpga(PERIPH_REG_STREAM_ADR, 1);
+  sdram_flush();
+}
+
+
+/*
+  Restart a read stream after taking only part of what was prefetched. The
+  words already prefetched (in the synchronous bus slave, of the old
+  epoch) must be dropped, so the new stream starts at its own address.
+*/
+static void
+test_stream_restart(uint32_t addr, unsigned n)
+{
+  uint16_t buf[32];
+
+  for (unsigned i = 0; i < 16; ++i)
+  {
+    uint32_t a = addr + 2 * (rnd() % (n - 32));
+    unsigned taken = 1 + rnd() % 31;
+    uint64_t t0;
+
+    write_fpga(PERIPH_REG_ADR_HIGH, a >> 16);
+    write_fpga(PERIPH_REG_STREAM_ADR, a & 0xfffe);
+    sys->burst_read(reg(PERIPH_REG_DATA_STREAM), buf, taken, true);
+    for (unsigned k = 0; k < taken; ++k)
+      check("stream read", a + 2*k, buf[k]);
+
+    a = addr + 2 * (rnd() % (n - 32));
+    t0 = sys->hclk();
+    write_fpga(PERIPH_REG_ADR_HIGH, a >> 16);
+    write_fpga(PERIPH_REG_STREAM_ADR, a & 0xfffe);
+    sys->burst_read(reg(PERIPH_REG_DATA_STREAM), buf, 32, true);
+    sys->record("stream restart", sys->hclk() - t0, 32);
+    for (unsigned k = 0; k < 32; ++k)
+      check("stream after restart", a + 2*k, buf[k]);
+  }
+  write_fpga(PERIPH_REG_STREAM_ADR, 1);
+  sdram_flush();
+}
+
+
+/*
+  In synchronous mode, have the FSMC hold NE a clock after the last beat
+  of a read, so the bus slave reads one register beyond the end of the
+  access. That read must neither be returned for the next access nor have
+  side effects. Stream reads are not covered: words already in flight to
+  the FSMC count as taken once it samples them with NE low.
+*/
+static void
+set_ne_hold(unsigned clocks)
+{
+  FsmcTiming t = sys->fsmc.timing();
+
+  t.ne_hold = clocks;
+  sys->set_fsmc_timing(t);
+}
+
+
+/*
+  Plain registers read as one burst (the four copy engine address halves),
+  then a single read of another register, with NE held as above.
+*/
+static void
+test_reg_burst(void)
+{
+  set_ne_hold(1);
+  for (unsigned i = 0; i < 64; ++i)
+  {
+    uint16_t want[4], got[4];
+    uint16_t fill = rnd();
+    uint64_t t0;
+
+    for (unsigned k = 0; k < 4; ++k)
+    {
+      want[k] = (k & 1) ? rnd() & 0x1ff : rnd() & 0xfffe;
+      write_fpga(PERIPH_REG_CP_SRC + 2*k, want[k]);
+    }
+    write_fpga(PERIPH_REG_CP_FILL, fill);
+    t0 = sys->hclk();
+    sys->burst_read(reg(PERIPH_REG_CP_SRC), got, 4, false);
+    sys->record("register burst", sys->hclk() - t0, 4);
+    for (unsigned k = 0; k < 4; ++k)
+      if (got[k] != want[k] && mismatches++ < 20)
+        fprintf(stderr, "tb: register burst word %u: got 0x%04x, "
+                "expected 0x%04x\n", k, got[k], want[k]);
+    if (read_fpga(PERIPH_REG_CP_FILL) != fill && mismatches++ < 20)
+      fprintf(stderr, "tb: register read after burst returned stale data\n");
+  }
+  set_ne_hold(0);
+}
+
+
+/*
+  Bursts through the FPGA burst buffer, as sdram_burst_write/read. NE is
+  held as in test_reg_burst, so each poll of BURST_STATUS also reads
+  BURST_DATA, which must not advance the buffer index.
+*/
+static void
+test_burst(uint32_t addr, unsigned n)
+{
+  uint16_t buf[BURST_MAX_WORDS];
+  uint64_t t0;
+
+  set_ne_hold(1);
+  for (unsigned done = 0; done < n; done += BURST_MAX_WORDS)
+  {
+    uint32_t a = addr + 2*done;
+
+    for (unsigned i = 0; i < BURST_MAX_WORDS; ++i)
+    {
+      buf[i] = rnd();
+      shadow[(a >> 1) + i] = buf[i];
+    }
+    t0 = sys->hclk();
+    write_fpga(PERIPH_REG_BURST_LEN, BURST_MAX_WORDS);
+    for (unsigned i = 0; i < BURST_MAX_WORDS; ++i)
+      write_fpga(PERIPH_REG_BURST_DATA, buf[i]);
+    write_fpga(PERIPH_REG_ADR_HIGH, a >> 16);
+    sdram_flush();
+    write_fpga(PERIPH_REG_BURST_STATUS, (a & 0xfffe) | 1);
+    while (read_fpga(PERIPH_REG_BURST_STATUS) & 1)
+      ;
+    sys->record("burst write", sys->hclk() - t0, BURST_MAX_WORDS);
+
+    t0 = sys->hclk();
+    write_fpga(PERIPH_REG_BURST_LEN, BURST_MAX_WORDS);
+    write_fpga(PERIPH_REG_ADR_HIGH, a >> 16);
+    sdram_flush();
+    write_fpga(PERIPH_REG_BURST_STATUS, a & 0xfffe);
+    while (read_fpga(PERIPH_REG_BURST_STATUS) & 1)
+      ;
+    for (unsigned i = 0; i < BURST_MAX_WORDS; ++i)
+      buf[i] = read_fpga(PERIPH_REG_BURST_DATA);
+    sys->record("burst read", sys->hclk() - t0, BURST_MAX_WORDS);
+    for (unsigned i = 0; i < BURST_MAX_WORDS; ++i)
+      check("burst read", a + 2*i, buf[i]);
+  }
+  set_ne_hold(0);
+}
+
+
+/* Memory-mapped window, as sdram_window_copy_to/from. */
+static void
+test_window(uint32_t addr, unsigned n)
+{
+  uint64_t t0;
+
+  for (unsigned pass = 0; pass < 2; ++pass)
+  {
+    uint32_t a = addr;
+    unsigned count = n;
+
+    while (count > 0)
+    {
+      unsigned k = (WINDOW_BYTES - (a & (WINDOW_BYTES-1))) >> 1;
+      uint8_t r;
+
+      if (k > count)
+        k = count;
+      write_fpga(PERIPH_REG_ADR_HIGH, a >> 16);
+      write_fpga(PERIPH_REG_WIN_BASE, a & 0xff00);
+      r = reg(FPGA_WINDOW_OFFSET + (a & 0xfe));
+      for (unsigned i = 0; i < k; ++i, a += 2)
+      {
+        t0 = sys->hclk();
+        if (pass == 0)
+        {
+          uint16_t v = rnd();
+
+          sys->write16(r + i, v);
+          sys->record("window write", sys->hclk() - t0);
+          shadow[a >> 1] = v;
+        }
+        else
+        {
+          uint16_t v = sys->read16(r + i);
+
+          sys->record("window read", sys->hclk() - t0);
+          check("window read", a, v);
+        }
+      }
+      count -= k;
+    }
+    sdram_flush();
+  }
+}
+
+
+/*
+  Back-to-back accesses to the same location with nothing in between: a read
+  right after a write (RAW) and a write right after a read (WAR), both to a
+  register and to an SDRAM word. The NWAIT handshake has to end each access
+  cleanly whatever the FSMC timing, so in asynchronous mode this runs with
+  DATAST 8 (the firmware setting) and 12, and reports both.
+*/
+static void
+test_raw_war(uint32_t addr, unsigned n)
+{
+  static const unsigned datast[2] = { 8, 12 };
+  FsmcTiming saved = sys->fsmc.timing();
+  unsigned passes = sys->sync() ? 1 : 2;
+
+  for (unsigned p = 0; p < passes; ++p)
+  {
+    std::string sfx;
+
+    if (!sys->sync())
+    {
+      FsmcTiming t = saved;
+
+      t.datast = datast[p];
+      sys->set_fsmc_timing(t);
+      sfx = " datast " + std::to_string(datast[p]);
+    }
+    for (unsigned i = 0; i < n; ++i)
+    {
+      uint32_t a = addr + 2 * (rnd() & 0xfff);
+      uint16_t v = rnd(), r;
+      uint64_t t0 = sys->hclk();
+
+      write_fpga(PERIPH_REG_ADR_HIGH, v & 0x0fff);
+      r = read_fpga(PERIPH_REG_ADR_HIGH);
+      sys->record("RAW register" + sfx, sys->hclk() - t0, 2);
+      if (r != (v & 0x0fff) && mismatches++ < 20)
+        fprintf(stderr, "tb: RAW register: got 0x%04x, expected 0x%04x\n",
+                r, v & 0x0fff);
+
+      t0 = sys->hclk();
+      write_sdram(a, v);
+      check("RAW", a, read_sdram(a));
+      sys->record("RAW sdram" + sfx, sys->hclk() - t0, 2);
+
+      t0 = sys->hclk();
+      check("WAR", a, read_sdram(a));
+      write_sdram(a, ~v);
+      sys->record("WAR sdram" + sfx, sys->hclk() - t0, 2);
+    }
+    sdram_flush();
+  }
+  if (!sys->sync())
+    sys->set_fsmc_timing(saved);
+}
+
+
+/* Everything written must be in the SDRAM model. */
+static void
+check_memory(void)
+{
+  for (auto &w : shadow)
+    if (sys->sdram.peek(w.first) != w.second && mismatches++ < 20)
+      fprintf(stderr, "tb: SDRAM word 0x%06x is 0x%04x, expected 0x%04x\n",
+              w.first, sys->sdram.peek(w.first), w.second);
+}
+
+
+int
+main(int argc, char **argv)
+{
+  SystemConfig cfg;
+  unsigned words = 8192;
+  int opt, fail;
+
+  Verilated::commandArgs(argc, argv);
+#ifdef FSMC_SYNC
+  cfg.fsmc.sync = true;
+  cfg.fsmc.busturn = 1;
+#endif
+  while ((opt = getopt(argc, argv, "n:d:s:t:")) != -1)
+  {
+    switch (opt)
+    {
+    case 'n': words = strtoul(optarg, nullptr, 0); break;
+    case 'd': cfg.fsmc.datast = strtoul(optarg, nullptr, 0); break;
+    case 's': rnd_state = strtoul(optarg, nullptr, 0) | 1; break;
+    case 't': cfg.vcd = optarg; break;
+    default:
+      fprintf(stderr, "usage: %s [-n words] [-d datast] [-s seed] "
+              "[-t trace.vcd]\n", argv[0]);
+      return 2;
+    }
+  }
+  words = (words + BURST_MAX_WORDS - 1) & ~(BURST_MAX_WORDS - 1);
+
+  sys = new System(cfg);
+  if (!sys->wait_init())
+  {
+    fprintf(stderr, "tb: SDRAM controller did not finish initialisation\n");
+    return 1;
+  }
+  printf("init done after %.1f us\n", sys->time_ps() / 1e6);
+  sys->sdram.reset_stats();
+
+  test_single(words / 16);
+  test_32(0x100000, words / 8);
+  test_stream(0x200000, words);
+  test_stream_restart(0x200000, words);
+  test_reg_burst();
+  test_burst(0x300000, words / 4);
+  test_window(0x400000 + 0x80, words / 8);
+  test_raw_war(0x500000, words / 16);
+  check_memory();
+
+  sys->report(stdout);
+  printf("%llu mismatches, %llu errors\n", (unsigned long long)mismatches,
+         (unsigned long long)sys->errors());
+  fail = mismatches || sys->errors();
+  delete sys;
+  return fail;
+}
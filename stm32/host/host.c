@@ -0,0 +1,169 @@
+/*
+  Host implementation of the peripherals in host/stm32f4xx.h: console
+  output to stdout, LEDs that do nothing, and a DMA stream that copies
+  halfwords between host memory and the FPGA through host_bus.h.
+
+  A transfer enabled with DMA_Cmd() runs to the end in the next
+  host_dma_poll(), which main.c calls from its wait loops, and then raises
+  the transfer complete interrupt by calling DMA2_Stream0_IRQHandler(). The
+  CPU therefore does not run while the DMA does, but the order of events
+  seen by main.c is the same.
+*/
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32f4xx.h"
+#include "host_bus.h"
+
+/* Bits of DMA_SxCR, and DMA_LISR bits of the stream 0 interrupts. */
+#define DMA_SxCR_TCIE 0x00000010u
+#define DMA_SxCR_DIR 0x000000c0u
+#define DMA_SxCR_PINC 0x00000200u
+#define DMA_SxCR_MINC 0x00000400u
+#define DMA_LISR_MASK 0x0f7d0f7du
+
+USART_TypeDef host_usart1 = { USART_FLAG_TC };
+GPIO_TypeDef host_gpioa, host_gpioc;
+DWT_Type host_dwt;
+CoreDebug_Type host_coredebug;
+DMA_Stream_TypeDef host_dma2_stream0;
+
+
+void
+USART_SendData(USART_TypeDef *USARTx, uint16_t Data)
+{
+  (void)USARTx;
+  if (Data != '\r')
+    putchar(Data);
+}
+
+
+void
+GPIO_SetBits(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  GPIOx->ODR |= GPIO_Pin;
+}
+
+
+void
+GPIO_ResetBits(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+}
+
+
+void
+DMA_StructInit(DMA_InitTypeDef *DMA_InitStruct)
+{
+  memset(DMA_InitStruct, 0, sizeof(*DMA_InitStruct));
+}
+
+
+void
+DMA_Init(DMA_Stream_TypeDef *DMAy_Streamx, DMA_InitTypeDef *DMA_InitStruct)
+{
+  DMAy_Streamx->CR = DMA_InitStruct->DMA_DIR |
+                     DMA_InitStruct->DMA_PeripheralInc |
+                     DMA_InitStruct->DMA_MemoryInc |
+                     DMA_InitStruct->DMA_PeripheralDataSize |
+                     DMA_InitStruct->DMA_MemoryDataSize;
+  DMAy_Streamx->NDTR = DMA_InitStruct->DMA_BufferSize;
+  DMAy_Streamx->PAR = DMA_InitStruct->DMA_PeripheralBaseAddr;
+  DMAy_Streamx->M0AR = DMA_InitStruct->DMA_Memory0BaseAddr;
+}
+
+
+void
+DMA_ITConfig(DMA_Stream_TypeDef *DMAy_Streamx, uint32_t DMA_IT,
+             FunctionalState NewState)
+{
+  if (NewState != DISABLE)
+    DMAy_Streamx->CR |= DMA_IT & DMA_SxCR_TCIE;
+  else
+    DMAy_Streamx->CR &= ~(DMA_IT & DMA_SxCR_TCIE);
+}
+
+
+void
+DMA_Cmd(DMA_Stream_TypeDef *DMAy_Streamx, FunctionalState NewState)
+{
+  if (NewState != DISABLE)
+    DMAy_Streamx->CR |= DMA_SxCR_EN;
+  else
+    DMAy_Streamx->CR &= ~DMA_SxCR_EN;
+}
+
+
+ITStatus
+DMA_GetITStatus(DMA_Stream_TypeDef *DMAy_Streamx, uint32_t DMA_IT)
+{
+  return (DMAy_Streamx->ISR & DMA_IT & DMA_LISR_MASK) ? SET : RESET;
+}
+
+
+void
+DMA_ClearITPendingBit(DMA_Stream_TypeDef *DMAy_Streamx, uint32_t DMA_IT)
+{
+  DMAy_Streamx->ISR &= ~(DMA_IT & DMA_LISR_MASK);
+}
+
+
+/* Halfword at bus address ADDR: an FPGA register, or host memory. */
+static uint16_t
+bus_read16(uintptr_t addr)
+{
+  if (addr >= HOST_FPGA_BASE && addr < HOST_FPGA_BASE + HOST_FPGA_SIZE)
+    return host_bus_read16(addr - HOST_FPGA_BASE);
+  return *(const uint16_t *)addr;
+}
+
+
+static void
+bus_write16(uintptr_t addr, uint16_t val)
+{
+  if (addr >= HOST_FPGA_BASE && addr < HOST_FPGA_BASE + HOST_FPGA_SIZE)
+    host_bus_write16(addr - HOST_FPGA_BASE, val);
+  else
+    *(uint16_t *)addr = val;
+}
+
+
+/*
+  Only what main.c uses is emulated: memory-to-memory transfers of
+  halfwords, from PAR to M0AR.
+*/
+void
+host_dma_poll(void)
+{
+  DMA_Stream_TypeDef *s = DMA2_Stream0;
+  uintptr_t src, dst;
+
+  if (!(s->CR & DMA_SxCR_EN))
+    return;
+  if ((s->CR & DMA_SxCR_DIR) != DMA_DIR_MemoryToMemory ||
+      (s->CR & ~(DMA_SxCR_EN | DMA_SxCR_TCIE | DMA_SxCR_DIR |
+                 DMA_SxCR_PINC | DMA_SxCR_MINC)) !=
+      (DMA_PeripheralDataSize_HalfWord | DMA_MemoryDataSize_HalfWord))
+  {
+    fprintf(stderr, "host: DMA mode 0x%08x not emulated\n",
+            (unsigned)s->CR);
+    s->CR &= ~DMA_SxCR_EN;
+    return;
+  }
+
+  src = s->PAR;
+  dst = s->M0AR;
+  while (s->NDTR > 0)
+  {
+    bus_write16(dst, bus_read16(src));
+    if (s->CR & DMA_SxCR_PINC)
+      src += 2;
+    if (s->CR & DMA_SxCR_MINC)
+      dst += 2;
+    --s->NDTR;
+  }
+  s->CR &= ~DMA_SxCR_EN;
+  s->ISR |= DMA_IT_TCIF0 & DMA_LISR_MASK;
+  if (s->CR & DMA_SxCR_TCIE)
+    DMA2_Stream0_IRQHandler();
+}
@@ -0,0 +1,50 @@
+/*
+  Host access layer: what main.c uses instead of the FSMC, the DWT cycle
+  counter and the delay loop when built with HOST_BUILD. It is implemented
+  by sim/host_bus_sim.cpp, over the simulation model of the board, so the
+  tests run on Linux against the FPGA design, or by host/host_model.c, over
+  a software model of the FPGA registers.
+
+  Offsets are FPGA register byte offsets, as the PERIPH_REG_* in main.c.
+*/
+#ifndef HOST_BUS_H
+#define HOST_BUS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bus address of the FPGA (bank1 SRAM2), as seen by the DMA emulation. */
+#define HOST_FPGA_BASE 0x64000000u
+/* Size of the FPGA address space: A[7:0] on 16-bit words. */
+#define HOST_FPGA_SIZE 0x200u
+
+/*
+  Parse the command line and bring up the model. Returns the number of the
+  test to run.
+*/
+uint32_t host_bus_init(int argc, char **argv);
+
+void host_bus_write8(uint32_t offset, uint8_t val);
+void host_bus_write16(uint32_t offset, uint16_t val);
+uint16_t host_bus_read16(uint32_t offset);
+void host_bus_write32(uint32_t offset, uint32_t val);
+uint32_t host_bus_read32(uint32_t offset);
+
+/* HCLK cycles so far, for DWT->CYCCNT. */
+uint32_t host_bus_cycles(void);
+/* Let HCLKS cycles pass with the bus idle. */
+void host_bus_idle(uint32_t hclks);
+/* End of a test round; does not return after the last one. */
+void host_bus_round_end(void);
+
+/* Run a DMA transfer started with DMA_Cmd(), if any (host/host.c). */
+void host_dma_poll(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,810 @@
+/*
+  The host access layer of main.c (host_bus.h) over a software model of the
+  FPGA register file, for "make host HOST_MODEL=sw": the tests then build
+  and run with just a C compiler, without Verilator and the board model in
+  ../sim.
+
+  The registers behave as in ice40/sdram-stm32.v, over an array holding
+  the whole SDRAM, but every operation is done at once, within the FSMC
+  access that starts it: busy and pending bits always read as 0, the write
+  queue is always empty and the read prefetch always full. The SDRAM has
+  no faults, so the self-test finds none. Of the performance counters,
+  only the SDRAM read and write commands (one per word) and the FSMC
+  accesses are counted.
+
+  There is no timing either: each FSMC access takes ACCESS_HCLK from
+  cycle_count(), so rates printed by the tests only compare numbers of
+  FSMC accesses. Use the Verilator build for timings.
+
+  Usage: sdram-stm32-host [-t test] [-r rounds]
+*/
+/* For getopt() with -std=c99. */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "host_bus.h"
+
+/* Word offsets of the registers, as the PERIPH_REG_* in sdram-stm32.v. */
+enum {
+  REG_ADR_LOW = 0x00, REG_ADR_HIGH = 0x01, REG_DATA = 0x02,
+  REG_BURST_LEN = 0x03, REG_BURST_STATUS = 0x04, REG_BURST_DATA = 0x05,
+  REG_WQ_STATUS = 0x06, REG_STREAM_ADR = 0x07, REG_DATA_STREAM = 0x08,
+  REG_STREAM_LEVEL = 0x09, REG_WIN_BASE = 0x0a, REG_CACHE_HITS = 0x0b,
+  REG_CACHE_MISSES = 0x0c, REG_PERF_SEL = 0x0d, REG_PERF_LO = 0x0e,
+  REG_PERF_HI = 0x0f, REG_PWR_PD_IDLE = 0x10, REG_PWR_SR_IDLE = 0x11,
+  REG_PWR_WAKE = 0x12, REG_ADR32_LO = 0x14, REG_ADR32_HI = 0x15,
+  REG_DATA32_LO = 0x16, REG_DATA32_HI = 0x17, REG_BIST_CTRL = 0x18,
+  REG_BIST_FAIL_SEL = 0x19, REG_BIST_LEN_LO = 0x1a, REG_BIST_LEN_HI = 0x1b,
+  REG_BIST_ERR_LO = 0x1c, REG_BIST_ERR_HI = 0x1d, REG_BIST_FAIL_LO = 0x1e,
+  REG_BIST_FAIL_HI = 0x1f, REG_BIST_FAIL_MASK = 0x20, REG_CP_FILL = 0x21,
+  REG_CP_SRC_LO = 0x22, REG_CP_SRC_HI = 0x23, REG_CP_DST_LO = 0x24,
+  REG_CP_DST_HI = 0x25, REG_CP_LEN_LO = 0x26, REG_CP_LEN_HI = 0x27,
+  REG_CP_CTRL = 0x28, REG_CP_STATUS = 0x29, REG_AT_OP = 0x2a,
+  REG_AT_ARG_LO = 0x2c, REG_AT_ARG_HI = 0x2d, REG_AT_CMP_LO = 0x2e,
+  REG_AT_CMP_HI = 0x2f, REG_AT_RESULT_LO = 0x30, REG_AT_RESULT_HI = 0x31,
+  REG_RANGE_LEN_LO = 0x32, REG_RANGE_LEN_HI = 0x33, REG_CRC_CTRL = 0x34,
+  REG_CRC_LO = 0x36, REG_CRC_HI = 0x37, REG_SUM_LO = 0x38, REG_SUM_HI = 0x39,
+  REG_SCAN_CTRL = 0x3a, REG_SCAN_KEY = 0x3b, REG_SCAN_MASK = 0x3c,
+  REG_SCAN_RESULT_LO = 0x3e, REG_SCAN_RESULT_HI = 0x3f,
+  REG_SCAN_INDEX_LO = 0x40, REG_SCAN_INDEX_HI = 0x41,
+  /* A[7] set is the window. */
+  REG_WINDOW = 0x80
+};
+
+/* Performance counters that are kept, and how many there are. */
+enum { PERF_READ = 1, PERF_WRITE = 2, PERF_FSMC_READ = 8,
+       PERF_FSMC_WRITE = 9, PERF_N = 13 };
+
+enum { BIST_PAT_ADDR, BIST_PAT_LFSR, BIST_PAT_WALK, BIST_PAT_MARCH };
+enum { SCAN_OP_FIND, SCAN_OP_COUNT, SCAN_OP_MIN, SCAN_OP_MAX };
+
+/* HCLK per FSMC access: an asynchronous access without wait states. */
+#define ACCESS_HCLK 12
+#define SDRAM_WORDS (1u << 24)
+#define WADR_MASK (SDRAM_WORDS - 1)
+#define BURST_WORDS 256
+#define BIST_MARCH_BLOCK 256
+#define CP_CHUNK 512
+
+static uint16_t *sdram;
+static unsigned rounds = 1, round_no;
+static uint64_t hclk, fsmc_reads, fsmc_writes, errors;
+
+static struct {
+  uint32_t cur_adr;             /* Address registers, 27 bits */
+  uint16_t cur_value;           /* Data register */
+  uint16_t cur_lanes;           /* Byte lanes of the last write to it */
+  uint16_t adr32_lo;
+  uint16_t burst_len, burst_count;
+  uint8_t bbuf_idx;
+  uint16_t bbuf[BURST_WORDS];
+  uint32_t stream_adr;
+  int stream_rwn;
+  uint32_t win_base;            /* Word address of the window */
+  uint16_t cache_hits, cache_misses;
+  uint32_t perf[PERF_N];
+  uint16_t perf_sel, perf_hi;
+  uint16_t pwr_pd_idle, pwr_sr_idle;
+  uint32_t bist_len, bist_errors, bist_nfail, bist_fail_sel;
+  uint32_t bist_fails[8];
+  uint16_t bist_fail_mask;
+  uint32_t cp_src, cp_dst, cp_len;
+  uint16_t cp_fill;
+  uint8_t cp_done;
+  int cp_irq;
+  uint32_t at_arg, at_cmp, at_result;
+  uint32_t range_len, crc, sum;
+  uint16_t scan_key, scan_mask;
+  uint32_t scan_result, scan_index;
+} r;
+
+
+static uint16_t
+mem_read(uint32_t wadr)
+{
+  ++r.perf[PERF_READ];
+  return sdram[wadr & WADR_MASK];
+}
+
+
+/* Write the byte lanes LANES (a mask of the data bits) of VAL. */
+static void
+mem_write(uint32_t wadr, uint16_t val, uint16_t lanes)
+{
+  uint16_t *p = &sdram[wadr & WADR_MASK];
+
+  ++r.perf[PERF_WRITE];
+  *p = (*p & ~lanes) | (val & lanes);
+}
+
+
+/* Word address from a low address register value and the high register. */
+static uint32_t
+low_adr(uint16_t val)
+{
+  return (r.cur_adr & 0x7ff8000) | (val >> 1);
+}
+
+
+/* Byte address in the format of the address registers, for 32-bit reads. */
+static uint16_t
+adr_reg(uint32_t wadr, int hi)
+{
+  return hi ? (wadr >> 15) & 0x1ff : (uint16_t)(wadr << 1);
+}
+
+
+static void
+set_lo(uint32_t *reg, uint16_t val)
+{
+  *reg = (*reg & 0xffff0000) | val;
+}
+
+
+static void
+set_hi(uint32_t *reg, uint16_t val)
+{
+  *reg = (*reg & 0xffff) | ((uint32_t)val << 16);
+}
+
+
+/* Next LFSR state, 16 steps of x^32+x^22+x^2+x+1, as in sdram_bist. */
+static uint32_t
+bist_lfsr_next(uint32_t s)
+{
+  int k;
+
+  for (k = 0; k < 16; ++k)
+    s = (s & 1) ? (s >> 1) ^ 0x80200003 : s >> 1;
+  return s;
+}
+
+
+static uint16_t
+bist_pattern(uint32_t pat, uint8_t seed, uint32_t a, uint32_t lfsr, int inv)
+{
+  uint16_t ss = ((uint16_t)seed << 8) | seed;
+
+  switch (pat)
+  {
+  case BIST_PAT_ADDR:
+    return (uint16_t)(a ^ ((a >> 8) & 0xff00)) ^ ss;
+  case BIST_PAT_LFSR:
+    return (uint16_t)lfsr;
+  case BIST_PAT_WALK:
+    return (uint16_t)(1u << ((a + seed) & 15)) ^ ((seed & 0x10) ? 0xffff : 0);
+  default:
+    return inv ? ~ss : ss;
+  }
+}
+
+
+/*
+  One element of a self-test over LEN words from word address BASE: read
+  and check (RD), then write (WR) each block, blocks in ascending or
+  descending (DOWN) order. Blocks are BIST_MARCH_BLOCK words for March C-,
+  the whole range otherwise.
+*/
+static void
+bist_element(uint32_t pat, uint8_t seed, uint32_t base, uint32_t len,
+             int rd, int rd_inv, int wr, int wr_inv, int down)
+{
+  uint32_t left = len, blk, adr, i, rd_lfsr, wr_lfsr;
+  uint16_t got, exp;
+
+  rd_lfsr = wr_lfsr = ((uint32_t)seed << 24) | 0x5a00a5 |
+    ((uint32_t)(uint8_t)~seed << 8);
+  while (left > 0)
+  {
+    blk = (pat == BIST_PAT_MARCH && left > BIST_MARCH_BLOCK) ?
+      BIST_MARCH_BLOCK : left;
+    adr = down ? base + left - blk : base + len - left;
+    left -= blk;
+    for (i = 0; rd && i < blk; ++i)
+    {
+      got = mem_read(adr + i);
+      exp = bist_pattern(pat, seed, (adr + i) & WADR_MASK, rd_lfsr, rd_inv);
+      rd_lfsr = bist_lfsr_next(rd_lfsr);
+      if (got != exp)
+      {
+        ++r.bist_errors;
+        r.bist_fail_mask |= got ^ exp;
+        if (r.bist_nfail < 8)
+          r.bist_fails[r.bist_nfail++] = (adr + i) & WADR_MASK;
+      }
+    }
+    for (i = 0; wr && i < blk; ++i)
+    {
+      mem_write(adr + i, bist_pattern(pat, seed, (adr + i) & WADR_MASK,
+                                      wr_lfsr, wr_inv), 0xffff);
+      wr_lfsr = bist_lfsr_next(wr_lfsr);
+    }
+  }
+}
+
+
+static void
+bist_run(uint16_t ctrl)
+{
+  uint32_t pat = ctrl & 3, base = r.cur_adr & WADR_MASK;
+  uint8_t seed = ctrl >> 8;
+
+  r.bist_errors = 0;
+  r.bist_fail_mask = 0;
+  r.bist_nfail = 0;
+  bist_element(pat, seed, base, r.bist_len, 0, 0, 1, 0, 0);
+  if (pat == BIST_PAT_MARCH)
+  {
+    bist_element(pat, seed, base, r.bist_len, 1, 0, 1, 1, 0);
+    bist_element(pat, seed, base, r.bist_len, 1, 1, 1, 0, 0);
+    bist_element(pat, seed, base, r.bist_len, 1, 0, 1, 1, 1);
+    bist_element(pat, seed, base, r.bist_len, 1, 1, 1, 0, 1);
+  }
+  bist_element(pat, seed, base, r.bist_len, 1, 0, 0, 0, 0);
+}
+
+
+/*
+  A copy or fill descriptor, in chunks like sdram_copy: each copy chunk is
+  read whole before it is written, which matters for overlapping copies.
+*/
+static void
+cp_run(uint16_t ctrl)
+{
+  static uint16_t buf[CP_CHUNK];
+  uint32_t left = r.cp_len, src = r.cp_src, dst = r.cp_dst, n, i;
+
+  for (; left > 0; left -= n, src += n, dst += n)
+  {
+    n = left < CP_CHUNK ? left : CP_CHUNK;
+    for (i = 0; i < n; ++i)
+      buf[i] = (ctrl & 1) ? r.cp_fill : mem_read(src + i);
+    for (i = 0; i < n; ++i)
+      mem_write(dst + i, buf[i], 0xffff);
+  }
+  ++r.cp_done;
+  if (ctrl & 2)
+    r.cp_irq = 1;
+}
+
+
+static void
+at_run(uint16_t op)
+{
+  uint32_t wadr = r.cur_adr & WADR_MASK;
+  uint32_t old, val, mask = (op & 0x10) ? 0xffffffff : 0xffff;
+
+  old = mem_read(wadr);
+  if (op & 0x10)
+    old |= (uint32_t)mem_read(wadr + 1) << 16;
+  switch (op & 7)
+  {
+  case 0: val = old + r.at_arg; break;
+  case 1: val = r.at_arg; break;
+  case 2: val = ((old & mask) == (r.at_cmp & mask)) ? r.at_arg : old; break;
+  case 3: val = old & r.at_arg; break;
+  case 4: val = old | r.at_arg; break;
+  case 5: val = old ^ r.at_arg; break;
+  default: val = old; break;
+  }
+  mem_write(wadr, (uint16_t)val, 0xffff);
+  if (op & 0x10)
+    mem_write(wadr + 1, (uint16_t)(val >> 16), 0xffff);
+  r.at_result = old & mask;
+}
+
+
+/* CRC-32 (as zlib's) and sum of the range, like sdram_crc. */
+static void
+crc_run(void)
+{
+  uint32_t i, k, v, crc = 0xffffffff;
+
+  r.sum = 0;
+  for (i = 0; i < r.range_len; ++i)
+  {
+    v = mem_read(r.cur_adr + i);
+    r.sum += v;
+    for (k = 0; k < 16; ++k, v >>= 1)
+      crc = (crc >> 1) ^ (((crc ^ v) & 1) ? 0xedb88320 : 0);
+  }
+  r.crc = ~crc;
+}
+
+
+/* Scan of the range, like sdram_scan. */
+static void
+scan_run(uint16_t ctrl)
+{
+  uint32_t op = ctrl & 7, step = (ctrl >> 8) ? (ctrl >> 8) - 1 : 0;
+  uint32_t flip = (ctrl & 8) ? 0x8000 : 0;
+  uint32_t i, skip, v, vx;
+  int hit = 0;
+
+  r.scan_result = 0;
+  r.scan_index = (op == 4) ? 0 : 0xffffffff;
+  for (i = 0, skip = 0; i < r.range_len; ++i)
+  {
+    uint16_t w = mem_read(r.cur_adr + i);
+
+    if (skip)
+    {
+      --skip;
+      continue;
+    }
+    skip = step;
+    v = w & r.scan_mask;
+    vx = (flip && (v & 0x8000)) ? v | 0xffff0000 : v;
+    switch (op)
+    {
+    case SCAN_OP_FIND:
+      if (v == (uint32_t)(r.scan_key & r.scan_mask))
+      {
+        r.scan_result = w;
+        r.scan_index = i;
+        return;
+      }
+      break;
+    case SCAN_OP_COUNT:
+      if (v == (uint32_t)(r.scan_key & r.scan_mask))
+      {
+        if (!hit)
+          r.scan_index = i;
+        hit = 1;
+        ++r.scan_result;
+      }
+      break;
+    case SCAN_OP_MIN:
+    case SCAN_OP_MAX:
+      if (!hit ||
+          (op == SCAN_OP_MIN ?
+           (v ^ flip) < ((r.scan_result ^ flip) & 0xffff) :
+           (v ^ flip) > ((r.scan_result ^ flip) & 0xffff)))
+      {
+        hit = 1;
+        r.scan_result = vx;
+        r.scan_index = i;
+      }
+      break;
+    default:
+      r.scan_result += vx;
+      ++r.scan_index;
+      break;
+    }
+  }
+}
+
+
+/* FSMC write of VAL to register REG, with the data bits in LANES. */
+static void
+reg_write(uint8_t reg, uint16_t val, uint16_t lanes)
+{
+  hclk += ACCESS_HCLK;
+  ++fsmc_writes;
+  ++r.perf[PERF_FSMC_WRITE];
+  if (reg & REG_WINDOW)
+  {
+    mem_write(r.win_base + (reg & 0x7f), val, lanes);
+    return;
+  }
+  switch (reg)
+  {
+  case REG_ADR_LOW:
+    r.cur_adr = low_adr(val);
+    if (val & 1)
+      mem_write(r.cur_adr, r.cur_value, r.cur_lanes);
+    else
+    {
+      r.cur_value = mem_read(r.cur_adr);
+      r.cur_lanes = 0xffff;
+    }
+    break;
+  case REG_ADR_HIGH:
+    r.cur_adr = (r.cur_adr & 0x7fff) | ((uint32_t)(val & 0xfff) << 15);
+    break;
+  case REG_DATA:
+    r.cur_value = (r.cur_value & ~lanes) | (val & lanes);
+    r.cur_lanes = lanes;
+    break;
+  case REG_BURST_LEN:
+    r.burst_len = val > BURST_WORDS ? BURST_WORDS : val;
+    r.bbuf_idx = 0;
+    break;
+  case REG_BURST_STATUS:
+  {
+    uint32_t wadr = low_adr(val), i;
+
+    for (i = 0; i < r.burst_len; ++i)
+    {
+      if (val & 1)
+        mem_write(wadr + i, r.bbuf[i], 0xffff);
+      else
+        r.bbuf[i] = mem_read(wadr + i);
+    }
+    r.burst_count = r.burst_len;
+    r.bbuf_idx = 0;
+    break;
+  }
+  case REG_BURST_DATA:
+    r.bbuf[r.bbuf_idx++] = val;
+    break;
+  case REG_STREAM_ADR:
+    r.stream_adr = low_adr(val) & WADR_MASK;
+    r.stream_rwn = !(val & 1);
+    break;
+  case REG_DATA_STREAM:
+    if (r.stream_rwn)
+      ++errors;
+    mem_write(r.stream_adr++, val, lanes);
+    break;
+  case REG_WIN_BASE:
+    r.win_base = low_adr(val & 0xff00) & WADR_MASK;
+    break;
+  case REG_CACHE_HITS:
+    r.cache_hits = 0;
+    break;
+  case REG_CACHE_MISSES:
+    r.cache_misses = 0;
+    break;
+  case REG_PERF_SEL:
+    r.perf_sel = val & 0xf;
+    if (val & 0x8000)
+    {
+      unsigned i;
+
+      for (i = 0; i < PERF_N; ++i)
+        r.perf[i] = 0;
+    }
+    break;
+  case REG_PWR_PD_IDLE:
+    r.pwr_pd_idle = val;
+    break;
+  case REG_PWR_SR_IDLE:
+    r.pwr_sr_idle = val;
+    break;
+  case REG_ADR32_LO:
+    r.adr32_lo = val;
+    break;
+  case REG_ADR32_HI:
+    r.cur_adr = ((uint32_t)(val & 0xfff) << 15) | (r.adr32_lo >> 1);
+    break;
+  case REG_DATA32_LO:
+    mem_write(r.cur_adr, val, lanes);
+    break;
+  case REG_DATA32_HI:
+    mem_write(r.cur_adr + 1, val, lanes);
+    r.cur_adr += 2;
+    break;
+  case REG_BIST_CTRL:
+    bist_run(val);
+    break;
+  case REG_BIST_FAIL_SEL:
+    r.bist_fail_sel = val & 7;
+    break;
+  case REG_BIST_LEN_LO:
+    set_lo(&r.bist_len, val);
+    break;
+  case REG_BIST_LEN_HI:
+    set_hi(&r.bist_len, val & 0x1ff);
+    break;
+  case REG_CP_FILL:
+    r.cp_fill = val;
+    break;
+  case REG_CP_SRC_LO:
+    r.cp_src = (r.cp_src & 0xff8000) | (val >> 1);
+    break;
+  case REG_CP_SRC_HI:
+    r.cp_src = (r.cp_src & 0x7fff) | ((uint32_t)(val & 0x1ff) << 15);
+    break;
+  case REG_CP_DST_LO:
+    r.cp_dst = (r.cp_dst & 0xff8000) | (val >> 1);
+    break;
+  case REG_CP_DST_HI:
+    r.cp_dst = (r.cp_dst & 0x7fff) | ((uint32_t)(val & 0x1ff) << 15);
+    break;
+  case REG_CP_LEN_LO:
+    set_lo(&r.cp_len, val);
+    break;
+  case REG_CP_LEN_HI:
+    set_hi(&r.cp_len, val & 0x1ff);
+    break;
+  case REG_CP_CTRL:
+    cp_run(val);
+    break;
+  case REG_CP_STATUS:
+    if (val & 0x4000)
+      r.cp_irq = 0;
+    break;
+  case REG_AT_OP:
+    at_run(val);
+    break;
+  case REG_AT_ARG_LO:
+    set_lo(&r.at_arg, val);
+    break;
+  case REG_AT_ARG_HI:
+    set_hi(&r.at_arg, val);
+    break;
+  case REG_AT_CMP_LO:
+    set_lo(&r.at_cmp, val);
+    break;
+  case REG_AT_CMP_HI:
+    set_hi(&r.at_cmp, val);
+    break;
+  case REG_RANGE_LEN_LO:
+    set_lo(&r.range_len, val);
+    break;
+  case REG_RANGE_LEN_HI:
+    set_hi(&r.range_len, val & 0x1ff);
+    break;
+  case REG_CRC_CTRL:
+    crc_run();
+    break;
+  case REG_SCAN_CTRL:
+    scan_run(val);
+    break;
+  case REG_SCAN_KEY:
+    r.scan_key = val;
+    break;
+  case REG_SCAN_MASK:
+    r.scan_mask = val;
+    break;
+  default:
+    /* Read-only or unused. */
+    break;
+  }
+}
+
+
+static uint16_t
+reg_read(uint8_t reg)
+{
+  hclk += ACCESS_HCLK;
+  ++fsmc_reads;
+  ++r.perf[PERF_FSMC_READ];
+  if (reg & REG_WINDOW)
+    return mem_read(r.win_base + (reg & 0x7f));
+  switch (reg)
+  {
+  case REG_ADR_LOW:
+  case REG_ADR32_LO:
+    return (uint16_t)(r.cur_adr << 1);
+  case REG_ADR_HIGH:
+  case REG_ADR32_HI:
+    return (r.cur_adr >> 15) & 0xfff;
+  case REG_DATA:
+    return r.cur_value;
+  case REG_BURST_LEN:
+    return r.burst_len;
+  case REG_BURST_STATUS:
+    return (uint16_t)(r.burst_count << 1);
+  case REG_BURST_DATA:
+    return r.bbuf[r.bbuf_idx++];
+  case REG_STREAM_ADR:
+    return (uint16_t)(r.stream_adr << 1) | r.stream_rwn;
+  case REG_DATA_STREAM:
+    if (!r.stream_rwn)
+      ++errors;
+    return mem_read(r.stream_adr++);
+  case REG_STREAM_LEVEL:
+    return r.stream_rwn ? 256 : 0;
+  case REG_WIN_BASE:
+    return (uint16_t)(r.win_base << 1) & 0xff00;
+  case REG_CACHE_HITS:
+    return r.cache_hits;
+  case REG_CACHE_MISSES:
+    return r.cache_misses;
+  case REG_PERF_SEL:
+    return r.perf_sel;
+  case REG_PERF_LO:
+  {
+    uint32_t q = r.perf_sel < PERF_N ? r.perf[r.perf_sel] : 0;
+
+    r.perf_hi = q >> 16;
+    return (uint16_t)q;
+  }
+  case REG_PERF_HI:
+    return r.perf_hi;
+  case REG_PWR_PD_IDLE:
+    return r.pwr_pd_idle;
+  case REG_PWR_SR_IDLE:
+    return r.pwr_sr_idle;
+  case REG_PWR_WAKE:
+    return 0;
+  case REG_DATA32_LO:
+    return mem_read(r.cur_adr);
+  case REG_DATA32_HI:
+  {
+    uint16_t v = mem_read(r.cur_adr + 1);
+
+    r.cur_adr += 2;
+    return v;
+  }
+  case REG_BIST_CTRL:
+    return r.bist_nfail << 8;
+  case REG_BIST_FAIL_SEL:
+    return r.bist_fail_sel;
+  case REG_BIST_LEN_LO:
+    return (uint16_t)r.bist_len;
+  case REG_BIST_LEN_HI:
+    return r.bist_len >> 16;
+  case REG_BIST_ERR_LO:
+    return (uint16_t)r.bist_errors;
+  case REG_BIST_ERR_HI:
+    return r.bist_errors >> 16;
+  case REG_BIST_FAIL_LO:
+  case REG_BIST_FAIL_HI:
+    return adr_reg(r.bist_fails[r.bist_fail_sel], reg == REG_BIST_FAIL_HI);
+  case REG_BIST_FAIL_MASK:
+    return r.bist_fail_mask;
+  case REG_CP_FILL:
+    return r.cp_fill;
+  case REG_CP_SRC_LO:
+  case REG_CP_SRC_HI:
+    return adr_reg(r.cp_src, reg == REG_CP_SRC_HI);
+  case REG_CP_DST_LO:
+  case REG_CP_DST_HI:
+    return adr_reg(r.cp_dst, reg == REG_CP_DST_HI);
+  case REG_CP_LEN_LO:
+    return (uint16_t)r.cp_len;
+  case REG_CP_LEN_HI:
+    return r.cp_len >> 16;
+  case REG_CP_STATUS:
+    return (r.cp_irq << 14) | r.cp_done;
+  case REG_AT_ARG_LO:
+    return (uint16_t)r.at_arg;
+  case REG_AT_ARG_HI:
+    return r.at_arg >> 16;
+  case REG_AT_CMP_LO:
+    return (uint16_t)r.at_cmp;
+  case REG_AT_CMP_HI:
+    return r.at_cmp >> 16;
+  case REG_AT_RESULT_LO:
+    return (uint16_t)r.at_result;
+  case REG_AT_RESULT_HI:
+    return r.at_result >> 16;
+  case REG_RANGE_LEN_LO:
+    return (uint16_t)r.range_len;
+  case REG_RANGE_LEN_HI:
+    return r.range_len >> 16;
+  case REG_CRC_LO:
+    return (uint16_t)r.crc;
+  case REG_CRC_HI:
+    return r.crc >> 16;
+  case REG_SUM_LO:
+    return (uint16_t)r.sum;
+  case REG_SUM_HI:
+    return r.sum >> 16;
+  case REG_SCAN_KEY:
+    return r.scan_key;
+  case REG_SCAN_MASK:
+    return r.scan_mask;
+  case REG_SCAN_RESULT_LO:
+    return (uint16_t)r.scan_result;
+  case REG_SCAN_RESULT_HI:
+    return r.scan_result >> 16;
+  case REG_SCAN_INDEX_LO:
+    return (uint16_t)r.scan_index;
+  case REG_SCAN_INDEX_HI:
+    return r.scan_index >> 16;
+  default:
+    /* Status bits that are never set here, and unused registers. */
+    return 0;
+  }
+}
+
+
+/* FSMC address lines A[7:0] are HADDR[8:1] for the 16-bit bus. */
+static uint8_t
+reg(uint32_t offset)
+{
+  if (offset >= HOST_FPGA_SIZE)
+  {
+    fprintf(stderr, "host: FPGA offset 0x%x out of range\n",
+            (unsigned)offset);
+    ++errors;
+  }
+  return offset >> 1;
+}
+
+
+uint32_t
+host_bus_init(int argc, char **argv)
+{
+  unsigned test = 8;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "t:r:")) != -1)
+  {
+    switch (opt)
+    {
+    case 't': test = strtoul(optarg, NULL, 0); break;
+    case 'r': rounds = strtoul(optarg, NULL, 0); break;
+    default:
+      fprintf(stderr, "usage: %s [-t test] [-r rounds]\n", argv[0]);
+      exit(2);
+    }
+  }
+
+  sdram = calloc(SDRAM_WORDS, sizeof(*sdram));
+  if (!sdram)
+  {
+    fprintf(stderr, "host: out of memory\n");
+    exit(1);
+  }
+  r.scan_mask = 0xffff;
+  return test;
+}
+
+
+/* A byte store enables only the byte lane of OFFSET. */
+void
+host_bus_write8(uint32_t offset, uint8_t val)
+{
+  if (offset & 1)
+    reg_write(reg(offset), (uint16_t)val << 8, 0xff00);
+  else
+    reg_write(reg(offset), val, 0x00ff);
+}
+
+
+void
+host_bus_write16(uint32_t offset, uint16_t val)
+{
+  reg_write(reg(offset), val, 0xffff);
+}
+
+
+uint16_t
+host_bus_read16(uint32_t offset)
+{
+  return reg_read(reg(offset));
+}
+
+
+/* Split by the FSMC into two 16-bit accesses, low half first. */
+void
+host_bus_write32(uint32_t offset, uint32_t val)
+{
+  host_bus_write16(offset, (uint16_t)val);
+  host_bus_write16(offset + 2, (uint16_t)(val >> 16));
+}
+
+
+uint32_t
+host_bus_read32(uint32_t offset)
+{
+  uint32_t lo = host_bus_read16(offset);
+
+  return lo | ((uint32_t)host_bus_read16(offset + 2) << 16);
+}
+
+
+uint32_t
+host_bus_cycles(void)
+{
+  return (uint32_t)hclk;
+}
+
+
+void
+host_bus_idle(uint32_t hclks)
+{
+  hclk += hclks;
+}
+
+
+void
+host_bus_round_end(void)
+{
+  if (++round_no < rounds)
+    return;
+  fflush(stdout);
+  printf("model: %llu FSMC reads, %llu FSMC writes\n",
+         (unsigned long long)fsmc_reads, (unsigned long long)fsmc_writes);
+  printf("%llu errors\n", (unsigned long long)errors);
+  free(sdram);
+  exit(errors ? 1 : 0);
+}
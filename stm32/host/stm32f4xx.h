@@ -0,0 +1,139 @@
+/*
+  Stand-in for the STM32F4 device and Standard Peripheral Library headers,
+  for the host build of main.c (HOST_BUILD). Only what main.c uses outside
+  the hardware set-up is provided: the console USART, the LEDs, the DWT
+  cycle counter and the DMA stream used for the FPGA, with the register
+  and constant values of the real library. host.c implements it.
+*/
+#ifndef STM32F4XX_H
+#define STM32F4XX_H
+
+#include <stdint.h>
+
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+
+
+/* USART: characters go to stdout. */
+typedef struct {
+  volatile uint16_t SR;
+} USART_TypeDef;
+
+extern USART_TypeDef host_usart1;
+#define USART1 (&host_usart1)
+#define USART_FLAG_TC ((uint16_t)0x0040)
+
+void USART_SendData(USART_TypeDef *USARTx, uint16_t Data);
+
+
+/* GPIO: the LEDs do nothing. */
+typedef struct {
+  volatile uint32_t ODR;
+} GPIO_TypeDef;
+
+extern GPIO_TypeDef host_gpioa, host_gpioc;
+#define GPIOA (&host_gpioa)
+#define GPIOC (&host_gpioc)
+#define GPIO_Pin_7 ((uint16_t)0x0080)
+#define GPIO_Pin_8 ((uint16_t)0x0100)
+#define RCC_AHB1Periph_GPIOA ((uint32_t)0x00000001)
+#define RCC_AHB1Periph_GPIOC ((uint32_t)0x00000004)
+
+void GPIO_SetBits(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void GPIO_ResetBits(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+
+/* DWT cycle counter. main.c reads cycle_count() instead of CYCCNT. */
+typedef struct {
+  volatile uint32_t CTRL;
+  volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+  volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type host_dwt;
+extern CoreDebug_Type host_coredebug;
+#define DWT (&host_dwt)
+#define CoreDebug (&host_coredebug)
+#define DWT_CTRL_CYCCNTENA_Msk (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+
+
+/*
+  DMA. A transfer enabled with DMA_Cmd() runs in host_dma_poll(), as the
+  base addresses may be FPGA bus addresses (HOST_FPGA_BASE) or host
+  pointers, hence uintptr_t where the library has uint32_t.
+*/
+typedef struct {
+  volatile uint32_t CR;
+  volatile uint32_t NDTR;
+  volatile uintptr_t PAR;
+  volatile uintptr_t M0AR;
+  volatile uint32_t ISR;                /* TCIF, in place of DMA2->LISR */
+} DMA_Stream_TypeDef;
+
+typedef struct {
+  uint32_t DMA_Channel;
+  uintptr_t DMA_PeripheralBaseAddr;
+  uintptr_t DMA_Memory0BaseAddr;
+  uint32_t DMA_DIR;
+  uint32_t DMA_BufferSize;
+  uint32_t DMA_PeripheralInc;
+  uint32_t DMA_MemoryInc;
+  uint32_t DMA_PeripheralDataSize;
+  uint32_t DMA_MemoryDataSize;
+  uint32_t DMA_Mode;
+  uint32_t DMA_Priority;
+  uint32_t DMA_FIFOMode;
+  uint32_t DMA_FIFOThreshold;
+  uint32_t DMA_MemoryBurst;
+  uint32_t DMA_PeripheralBurst;
+} DMA_InitTypeDef;
+
+extern DMA_Stream_TypeDef host_dma2_stream0;
+#define DMA2_Stream0 (&host_dma2_stream0)
+
+#define DMA_SxCR_EN ((uint32_t)0x00000001)
+
+#define DMA_Channel_0 ((uint32_t)0x00000000)
+#define DMA_DIR_PeripheralToMemory ((uint32_t)0x00000000)
+#define DMA_DIR_MemoryToPeripheral ((uint32_t)0x00000040)
+#define DMA_DIR_MemoryToMemory ((uint32_t)0x00000080)
+#define DMA_PeripheralInc_Enable ((uint32_t)0x00000200)
+#define DMA_PeripheralInc_Disable ((uint32_t)0x00000000)
+#define DMA_MemoryInc_Enable ((uint32_t)0x00000400)
+#define DMA_MemoryInc_Disable ((uint32_t)0x00000000)
+#define DMA_PeripheralDataSize_Byte ((uint32_t)0x00000000)
+#define DMA_PeripheralDataSize_HalfWord ((uint32_t)0x00000800)
+#define DMA_PeripheralDataSize_Word ((uint32_t)0x00001000)
+#define DMA_MemoryDataSize_Byte ((uint32_t)0x00000000)
+#define DMA_MemoryDataSize_HalfWord ((uint32_t)0x00002000)
+#define DMA_MemoryDataSize_Word ((uint32_t)0x00004000)
+#define DMA_Mode_Normal ((uint32_t)0x00000000)
+#define DMA_Mode_Circular ((uint32_t)0x00000100)
+#define DMA_Priority_Low ((uint32_t)0x00000000)
+#define DMA_Priority_High ((uint32_t)0x00020000)
+#define DMA_FIFOMode_Disable ((uint32_t)0x00000000)
+#define DMA_FIFOMode_Enable ((uint32_t)0x00000004)
+#define DMA_FIFOThreshold_Full ((uint32_t)0x00000003)
+#define DMA_MemoryBurst_Single ((uint32_t)0x00000000)
+#define DMA_PeripheralBurst_Single ((uint32_t)0x00000000)
+#define DMA_IT_TC ((uint32_t)0x00000010)
+#define DMA_IT_TCIF0 ((uint32_t)0x10008020)
+
+void DMA_StructInit(DMA_InitTypeDef *DMA_InitStruct);
+void DMA_Init(DMA_Stream_TypeDef *DMAy_Streamx,
+              DMA_InitTypeDef *DMA_InitStruct);
+void DMA_ITConfig(DMA_Stream_TypeDef *DMAy_Streamx, uint32_t DMA_IT,
+                  FunctionalState NewState);
+void DMA_Cmd(DMA_Stream_TypeDef *DMAy_Streamx, FunctionalState NewState);
+ITStatus DMA_GetITStatus(DMA_Stream_TypeDef *DMAy_Streamx, uint32_t DMA_IT);
+void DMA_ClearITPendingBit(DMA_Stream_TypeDef *DMAy_Streamx,
+                           uint32_t DMA_IT);
+
+/* In main.c; host_dma_poll() calls it as the NVIC would. */
+void DMA2_Stream0_IRQHandler(void);
+
+#endif
@@ -0,0 +1,445 @@
+/*
+  Unit tests of the DMA transfers of main.c (sdram_dma_*), on the host,
+  against a mocked FPGA register file: ADR_HIGH, STREAM_ADR and the
+  streaming data port, over an array standing in for the SDRAM. The DMA
+  stream is the emulation in host.c.
+
+  Checked: the split into chunks of at most DMA_CHUNK_WORDS and at buffer
+  ends, the switching between the two buffers, the completion callbacks
+  and their arguments, the data in order both ways, the end of read
+  prefetching, and that nothing else touches the FPGA during a transfer.
+
+  Run with "make host-test".
+*/
+#define main firmware_main
+#include "../main.c"
+#undef main
+
+#include <stdio.h>
+
+/* Words of the mocked SDRAM (byte addresses below 2 MB). */
+#define MOCK_WORDS (1 << 20)
+#define MAX_CHUNKS 64
+#define MAX_CALLS 16
+
+static uint16_t mock_sdram[MOCK_WORDS];
+static uint16_t mock_adr_high;
+static uint32_t mock_pos;
+static int mock_stream_write;
+static uint16_t mock_stream_adr_writes[8];
+static unsigned mock_n_stream_adr;
+static unsigned mock_other_during_dma;
+static uint32_t mock_cycles;
+
+/* Chunks seen by the DMA: word count and buffer address. */
+static struct {
+  uint32_t words;
+  uintptr_t buf;
+} chunks[MAX_CHUNKS];
+static unsigned n_chunks;
+
+/* Callbacks, with a check of the buffer contents at callback time. */
+static struct {
+  uint16_t *buf;
+  uint32_t words;
+  int data_ok;
+} calls[MAX_CALLS];
+static unsigned n_calls;
+
+static unsigned failures;
+
+#define CHECK(cond)                                                     \
+  do {                                                                  \
+    if (!(cond)) {                                                      \
+      printf("%s:%d: %s: check failed: %s\n", __FILE__, __LINE__,       \
+             __func__, #cond);                                          \
+      ++failures;                                                       \
+    }                                                                   \
+  } while (0)
+
+
+static uint16_t
+pattern(uint32_t word)
+{
+  return (uint16_t)(word * 0x9e37u + (word >> 16));
+}
+
+
+/* Data written by the tests, different from what is there already. */
+static uint16_t
+wpattern(uint32_t word)
+{
+  return ~pattern(word);
+}
+
+
+static void
+mock_check_idle(uint32_t offset)
+{
+  if (offset != PERIPH_REG_DATA_STREAM &&
+      (DMA2_Stream0->CR & DMA_SxCR_EN))
+    ++mock_other_during_dma;
+}
+
+
+uint32_t
+host_bus_init(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  return 0;
+}
+
+
+void
+host_bus_write8(uint32_t offset, uint8_t val)
+{
+  (void)val;
+  mock_check_idle(offset);
+}
+
+
+void
+host_bus_write16(uint32_t offset, uint16_t val)
+{
+  ++mock_cycles;
+  mock_check_idle(offset);
+  switch (offset)
+  {
+  case PERIPH_REG_ADR_HIGH:
+    mock_adr_high = val;
+    break;
+  case PERIPH_REG_STREAM_ADR:
+    if (mock_n_stream_adr < 8)
+      mock_stream_adr_writes[mock_n_stream_adr] = val;
+    ++mock_n_stream_adr;
+    mock_pos = (((uint32_t)mock_adr_high << 16) | (val & 0xfffe)) >> 1;
+    mock_stream_write = val & 1;
+    break;
+  case PERIPH_REG_DATA_STREAM:
+    CHECK(mock_stream_write);
+    mock_sdram[mock_pos++ % MOCK_WORDS] = val;
+    break;
+  }
+}
+
+
+uint16_t
+host_bus_read16(uint32_t offset)
+{
+  ++mock_cycles;
+  mock_check_idle(offset);
+  if (offset == PERIPH_REG_DATA_STREAM)
+  {
+    CHECK(!mock_stream_write);
+    return mock_sdram[mock_pos++ % MOCK_WORDS];
+  }
+  return 0;
+}
+
+
+void
+host_bus_write32(uint32_t offset, uint32_t val)
+{
+  host_bus_write16(offset, val);
+  host_bus_write16(offset + 2, val >> 16);
+}
+
+
+uint32_t
+host_bus_read32(uint32_t offset)
+{
+  uint32_t lo = host_bus_read16(offset);
+
+  return lo | ((uint32_t)host_bus_read16(offset + 2) << 16);
+}
+
+
+uint32_t
+host_bus_cycles(void)
+{
+  return mock_cycles;
+}
+
+
+void
+host_bus_idle(uint32_t hclks)
+{
+  mock_cycles += hclks;
+}
+
+
+void
+host_bus_round_end(void)
+{
+}
+
+
+static void
+reset(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < MOCK_WORDS; ++i)
+    mock_sdram[i] = pattern(i);
+  mock_adr_high = 0;
+  mock_pos = 0;
+  mock_stream_write = 0;
+  mock_n_stream_adr = 0;
+  mock_other_during_dma = 0;
+  n_chunks = 0;
+  n_calls = 0;
+}
+
+
+/* sdram_dma_wait(), noting each chunk the DMA is given. */
+static void
+run_dma(void)
+{
+  while (sdram_dma.busy)
+  {
+    if ((DMA2_Stream0->CR & DMA_SxCR_EN) && n_chunks < MAX_CHUNKS)
+    {
+      chunks[n_chunks].words = DMA2_Stream0->NDTR;
+      chunks[n_chunks].buf = sdram_dma.is_write ? DMA2_Stream0->PAR :
+                                                  DMA2_Stream0->M0AR;
+      ++n_chunks;
+    }
+    host_dma_poll();
+  }
+}
+
+
+/* Callback for reads: check the buffer against the SDRAM from *ARG on. */
+static void
+read_cb(void *arg, uint16_t *buf, uint32_t words)
+{
+  uint32_t *next = arg;
+  uint32_t i;
+
+  if (n_calls >= MAX_CALLS)
+    return;
+  calls[n_calls].buf = buf;
+  calls[n_calls].words = words;
+  calls[n_calls].data_ok = 1;
+  for (i = 0; i < words; ++i)
+    if (buf[i] != mock_sdram[*next + i])
+      calls[n_calls].data_ok = 0;
+  *next += words;
+  ++n_calls;
+}
+
+
+/* Callback for double-buffered writes: refill BUF with the next data. */
+static uint32_t write_fill_pos, write_fill_end;
+
+static void
+write_cb(void *arg, uint16_t *buf, uint32_t words)
+{
+  uint32_t i;
+
+  (void)arg;
+  if (n_calls < MAX_CALLS)
+  {
+    calls[n_calls].buf = buf;
+    calls[n_calls].words = words;
+    calls[n_calls].data_ok = 1;
+    ++n_calls;
+  }
+  for (i = 0; i < words && write_fill_pos < write_fill_end; ++i)
+    buf[i] = wpattern(write_fill_pos++);
+}
+
+
+static uint16_t buf0[100000], buf1[100000];
+
+
+/* One buffer, more than DMA_CHUNK_WORDS: 3 full chunks and the rest. */
+static void
+test_read_chunks(void)
+{
+  static const uint32_t sizes[] = { 32768, 32768, 32768, 1696 };
+  uint32_t addr = 0x123400;
+  uint32_t next = addr >> 1;
+  unsigned i;
+
+  reset();
+  sdram_dma_read(buf0, addr, 100000, read_cb, &next);
+  run_dma();
+
+  CHECK(n_chunks == 4);
+  for (i = 0; i < 4 && i < n_chunks; ++i)
+  {
+    CHECK(chunks[i].words == sizes[i]);
+    CHECK(chunks[i].buf == (uintptr_t)(buf0 + i * DMA_CHUNK_WORDS));
+  }
+  CHECK(n_calls == 1);
+  CHECK(calls[0].buf == buf0);
+  CHECK(calls[0].words == 100000);
+  CHECK(calls[0].data_ok);
+  CHECK(mock_adr_high == (addr >> 16));
+  CHECK(mock_n_stream_adr == 2);
+  CHECK(mock_stream_adr_writes[0] == (addr & 0xfffe));
+  /* Prefetching stopped at the end. */
+  CHECK(mock_stream_adr_writes[1] == 1);
+  CHECK(mock_other_during_dma == 0);
+  CHECK(!sdram_dma.busy);
+}
+
+
+static void
+test_write_chunks(void)
+{
+  static const uint32_t sizes[] = { 32768, 32768, 32768, 1696 };
+  uint32_t addr = 0x0a0002;
+  uint32_t i, bad = 0;
+
+  reset();
+  for (i = 0; i < 100000; ++i)
+    buf0[i] = wpattern(i);
+  sdram_dma_write(addr, buf0, 100000, NULL, NULL);
+  run_dma();
+
+  CHECK(n_chunks == 4);
+  for (i = 0; i < 4 && i < n_chunks; ++i)
+  {
+    CHECK(chunks[i].words == sizes[i]);
+    CHECK(chunks[i].buf == (uintptr_t)(buf0 + i * DMA_CHUNK_WORDS));
+  }
+  for (i = 0; i < 100000; ++i)
+    if (mock_sdram[(addr >> 1) + i] != wpattern(i))
+      ++bad;
+  CHECK(bad == 0);
+  /* The words around it are untouched. */
+  CHECK(mock_sdram[(addr >> 1) - 1] == pattern((addr >> 1) - 1));
+  CHECK(mock_sdram[(addr >> 1) + 100000] == pattern((addr >> 1) + 100000));
+  CHECK(mock_n_stream_adr == 1);
+  CHECK(mock_stream_adr_writes[0] == ((addr & 0xfffe) | 1));
+  CHECK(mock_other_during_dma == 0);
+  CHECK(!sdram_dma.busy);
+}
+
+
+/* Two buffers of 1000 words: alternate callbacks, the last one short. */
+static void
+test_read_double(void)
+{
+  uint32_t addr = 0x020000;
+  uint32_t next = addr >> 1;
+  unsigned i;
+
+  reset();
+  sdram_dma_read_double(addr, 4500, buf0, buf1, 1000, read_cb, &next);
+  run_dma();
+
+  CHECK(n_chunks == 5);
+  CHECK(n_calls == 5);
+  for (i = 0; i < 5 && i < n_calls; ++i)
+  {
+    CHECK(calls[i].buf == (i & 1 ? buf1 : buf0));
+    CHECK(calls[i].words == (i < 4 ? 1000 : 500));
+    CHECK(calls[i].data_ok);
+    CHECK(chunks[i].words == calls[i].words);
+    CHECK(chunks[i].buf == (uintptr_t)calls[i].buf);
+  }
+  CHECK(next == (addr >> 1) + 4500);
+  CHECK(mock_n_stream_adr == 2);
+  CHECK(mock_stream_adr_writes[1] == 1);
+  CHECK(mock_other_during_dma == 0);
+}
+
+
+/* Buffers larger than a chunk: each is done in two chunks. */
+static void
+test_read_double_large(void)
+{
+  static const uint32_t sizes[] = { 32768, 7232, 32768, 7232, 20000 };
+  uint32_t addr = 0x010000;
+  uint32_t next = addr >> 1;
+  unsigned i;
+
+  reset();
+  sdram_dma_read_double(addr, 100000, buf0, buf1, 40000, read_cb, &next);
+  run_dma();
+
+  CHECK(n_chunks == 5);
+  for (i = 0; i < 5 && i < n_chunks; ++i)
+  {
+    uint16_t *b = (i / 2) & 1 ? buf1 : buf0;
+
+    CHECK(chunks[i].words == sizes[i]);
+    CHECK(chunks[i].buf == (uintptr_t)(b + (i & 1 ? DMA_CHUNK_WORDS : 0)));
+  }
+  CHECK(n_calls == 3);
+  CHECK(calls[0].buf == buf0 && calls[0].words == 40000 && calls[0].data_ok);
+  CHECK(calls[1].buf == buf1 && calls[1].words == 40000 && calls[1].data_ok);
+  CHECK(calls[2].buf == buf0 && calls[2].words == 20000 && calls[2].data_ok);
+}
+
+
+/* Double-buffered write, refilling each buffer from the callback. */
+static void
+test_write_double(void)
+{
+  uint32_t addr = 0x030000;
+  uint32_t i, bad = 0;
+
+  reset();
+  write_fill_pos = 0;
+  write_fill_end = 3500;
+  write_cb(NULL, buf0, 1000);
+  write_cb(NULL, buf1, 1000);
+  n_calls = 0;
+  sdram_dma_write_double(addr, 3500, buf0, buf1, 1000, write_cb, NULL);
+  run_dma();
+
+  CHECK(n_calls == 4);
+  for (i = 0; i < 4 && i < n_calls; ++i)
+  {
+    CHECK(calls[i].buf == (i & 1 ? buf1 : buf0));
+    CHECK(calls[i].words == (i < 3 ? 1000 : 500));
+  }
+  for (i = 0; i < 3500; ++i)
+    if (mock_sdram[(addr >> 1) + i] != wpattern(i))
+      ++bad;
+  CHECK(bad == 0);
+  CHECK(mock_sdram[(addr >> 1) + 3500] == pattern((addr >> 1) + 3500));
+  CHECK(mock_other_during_dma == 0);
+}
+
+
+/* A transfer of nothing does nothing; a second transfer waits for one. */
+static void
+test_empty_and_back_to_back(void)
+{
+  uint32_t next0 = 0x1000 >> 1, next1 = 0x1000 >> 1;
+
+  reset();
+  sdram_dma_read(buf0, 0x1000, 0, read_cb, &next0);
+  CHECK(!sdram_dma.busy);
+  CHECK(n_calls == 0);
+  CHECK(mock_n_stream_adr == 0);
+
+  sdram_dma_read(buf0, 0x1000, 100, read_cb, &next0);
+  sdram_dma_read(buf1, 0x1000, 100, read_cb, &next1);
+  run_dma();
+  CHECK(n_calls == 2);
+  CHECK(calls[0].buf == buf0 && calls[0].data_ok);
+  CHECK(calls[1].buf == buf1 && calls[1].data_ok);
+  CHECK(mock_n_stream_adr == 4);
+}
+
+
+int
+main(void)
+{
+  test_read_chunks();
+  test_write_chunks();
+  test_read_double();
+  test_read_double_large();
+  test_write_double();
+  test_empty_and_back_to_back();
+
+  printf("test_dma: %u failures\n", failures);
+  return failures ? 1 : 0;
+}
@@ -14,18 +14,138 @@
 #include <string.h>
 
 #include <stm32f4xx.h>
+#ifdef HOST_BUILD
+#include "host_bus.h"
+#endif
 
 
 #define PERIPH_REG_ADR_LOW 0x00
 #define PERIPH_REG_ADR_HIGH 0x02
 #define PERIPH_REG_DATA 0x04
+#define PERIPH_REG_BURST_LEN 0x06
+#define PERIPH_REG_BURST_STATUS 0x08
+#define PERIPH_REG_BURST_DATA 0x0a
+#define PERIPH_REG_WQ_STATUS 0x0c
+#define PERIPH_REG_STREAM_ADR 0x0e
+#define PERIPH_REG_DATA_STREAM 0x10
+#define PERIPH_REG_STREAM_LEVEL 0x12
+#define PERIPH_REG_WIN_BASE 0x14
+#define PERIPH_REG_CACHE_HITS 0x16
+#define PERIPH_REG_CACHE_MISSES 0x18
+#define PERIPH_REG_PERF_SEL 0x1a
+#define PERIPH_REG_PERF_LO 0x1c
+#define PERIPH_REG_PERF_HI 0x1e
+#define PERIPH_REG_PWR_PD_IDLE 0x20
+#define PERIPH_REG_PWR_SR_IDLE 0x22
+#define PERIPH_REG_PWR_WAKE 0x24
+/* 32-bit registers, for 32-bit FSMC accesses. */
+#define PERIPH_REG_ADR32 0x28
+#define PERIPH_REG_DATA32 0x2c
+#define PERIPH_REG_BIST_CTRL 0x30
+#define PERIPH_REG_BIST_FAIL_SEL 0x32
+#define PERIPH_REG_BIST_LEN 0x34
+#define PERIPH_REG_BIST_ERR 0x38
+#define PERIPH_REG_BIST_FAIL 0x3c
+#define PERIPH_REG_BIST_FAIL_MASK 0x40
+#define PERIPH_REG_CP_FILL 0x42
+#define PERIPH_REG_CP_SRC 0x44
+#define PERIPH_REG_CP_DST 0x48
+#define PERIPH_REG_CP_LEN 0x4c
+#define PERIPH_REG_CP_CTRL 0x50
+#define PERIPH_REG_CP_STATUS 0x52
+#define PERIPH_REG_AT_OP 0x54
+#define PERIPH_REG_AT_ARG 0x58
+#define PERIPH_REG_AT_CMP 0x5c
+#define PERIPH_REG_AT_RESULT 0x60
+#define PERIPH_REG_RANGE_LEN 0x64
+#define PERIPH_REG_CRC_CTRL 0x68
+#define PERIPH_REG_CRC 0x6c
+#define PERIPH_REG_SUM 0x70
+#define PERIPH_REG_SCAN_CTRL 0x74
+#define PERIPH_REG_SCAN_KEY 0x76
+#define PERIPH_REG_SCAN_MASK 0x78
+#define PERIPH_REG_SCAN_RESULT 0x7c
+#define PERIPH_REG_SCAN_INDEX 0x80
+
+/* The upper half of the FPGA address space is a window into the SDRAM. */
+#define FPGA_WINDOW_OFFSET 0x100
+#define WINDOW_BYTES 256
+
+/* Size of the FPGA burst buffer, in 16-bit words. */
+#define BURST_MAX_WORDS 256
+/* Size of the FPGA posted write queue, in entries. */
+#define WQ_SIZE 256
+#define WQ_STATUS_FULL 0x8000
+#define WQ_STATUS_LEVEL 0x01ff
+/* FPGA performance counters, selected with PERIPH_REG_PERF_SEL. */
+#define PERF_SEL_CLEAR 0x8000
+#define PERF_NUM_COUNTERS 13
+
+/* FPGA memory self-test patterns, and PERIPH_REG_BIST_CTRL bits. */
+#define BIST_PAT_ADDR 0
+#define BIST_PAT_LFSR 1
+#define BIST_PAT_WALK 2
+#define BIST_PAT_MARCH 3
+#define BIST_NUM_PATTERNS 4
+#define BIST_CTRL_BUSY 0x8000
+#define BIST_MAX_FAILS 8
+
+/* FPGA copy engine descriptor flags and status bits. */
+#define CP_CTRL_FILL 0x0001
+#define CP_CTRL_IRQ 0x0002
+#define CP_STATUS_PENDING 0x8000
+#define CP_STATUS_IRQ 0x4000
+#define CP_QUEUE_SIZE 16
+
+/* FPGA atomic operations, for PERIPH_REG_AT_OP. */
+#define AT_OP_ADD 0
+#define AT_OP_SWAP 1
+#define AT_OP_CAS 2
+#define AT_OP_AND 3
+#define AT_OP_OR 4
+#define AT_OP_XOR 5
+#define AT_OP_32 0x10
+
+/* FPGA near-memory CRC, PERIPH_REG_CRC_CTRL bits. */
+#define CRC_CTRL_BUSY 0x8000
+
+/* FPGA scan operations, for PERIPH_REG_SCAN_CTRL. */
+#define SCAN_OP_FIND 0
+#define SCAN_OP_COUNT 1
+#define SCAN_OP_MIN 2
+#define SCAN_OP_MAX 3
+#define SCAN_OP_SUM 4
+#define SCAN_OP_SIGNED 0x08
+#define SCAN_CTRL_BUSY 0x8000
+#define SCAN_MAX_STRIDE 255
+#define SCAN_NONE 0xffffffff
 
 #define MCU_HZ 168000000
 
+/* The USART that all test output goes to. */
+#ifndef CONSOLE
+#define CONSOLE USART1
+#endif
+
+/*
+  Words of SDRAM covered by the soak tests; the others use a 16th of it.
+  The host build makes it smaller, as the simulation is much slower.
+*/
+#ifndef SDRAM_TEST_WORDS
+#define SDRAM_TEST_WORDS (1<<24)
+#endif
+
 /* This is apparently needed for libc/libm (eg. powf()). */
 int __errno;
 
 
+#ifdef HOST_BUILD
+__attribute__((unused))
+static void delay(uint32_t nCount)
+{
+  host_bus_idle(3*nCount);
+}
+#else
 static void delay(uint32_t nCount)
 {
   /* This should be 3 cycles per iteration. nCount must be > 0. */
@@ -73,6 +193,7 @@ static void setup_serial(void)
 
   USART_Cmd(USART1, ENABLE); // enable USART1
 }
+#endif
 
 
 #define LED1_GPIO_PERIPH RCC_AHB1Periph_GPIOC
@@ -82,6 +203,7 @@ static void setup_serial(void)
 #define LED2_GPIO GPIOA
 #define LED2_PIN GPIO_Pin_8
 
+#ifndef HOST_BUILD
 static void
 setup_leds(void)
 {
@@ -103,6 +225,7 @@ setup_leds(void)
   GPIO_InitStructure.GPIO_PuPd  = GPIO_PuPd_NOPULL;
   GPIO_Init(LED2_GPIO, &GPIO_InitStructure);
 }
+#endif
 
 
 __attribute__((unused))
@@ -321,14 +444,97 @@ println_float(USART_TypeDef* usart, float f,
 }
 
 
+/*
+  Hardware access. All FPGA accesses go through write_fpga()/read_fpga() and
+  their 8- and 32-bit variants, console output through serial_putchar() to
+  CONSOLE, and timing through cycle_count(). Busy-wait loops that do not
+  access the FPGA call wait_poll(). With HOST_BUILD, these go to the host
+  access layer (host/host_bus.h) instead of the FSMC, USART1 and the DWT
+  cycle counter, so the code below runs on Linux against a model.
+*/
+/* 0x64000000 is the start of bank1 SRAM2. */
+#define FPGA_BASE ((uint32_t)0x64000000)
+
+/* Bus address of FPGA register OFFSET, for the DMA. */
+static inline uintptr_t
+fpga_bus_addr(uint32_t offset)
+{
+  return FPGA_BASE + offset;
+}
+
+
+#ifdef HOST_BUILD
+static inline uint32_t
+cycle_count(void)
+{
+  return host_bus_cycles();
+}
+
+
+static inline void
+wait_poll(void)
+{
+  host_dma_poll();
+}
+
+
 __attribute__((unused))
 static void
 write_fpga(uint32_t offset, uint16_t val)
 {
-  /* 0x64000000 is the start of bank1 SRAM2. */
-  volatile uint16_t *fpga = (volatile uint16_t *)(uint32_t)0x64000000;
+  host_bus_write16(offset, val);
+}
+
+
+__attribute__((unused))
+static uint16_t
+read_fpga(uint32_t offset)
+{
+  return host_bus_read16(offset);
+}
+
+
+__attribute__((unused))
+static void
+write_fpga8(uint32_t offset, uint8_t val)
+{
+  host_bus_write8(offset, val);
+}
+
+
+__attribute__((unused))
+static void
+write_fpga32(uint32_t offset, uint32_t val)
+{
+  host_bus_write32(offset, val);
+}
+
+
+__attribute__((unused))
+static uint32_t
+read_fpga32(uint32_t offset)
+{
+  return host_bus_read32(offset);
+}
+#else
+static inline uint32_t
+cycle_count(void)
+{
+  return DWT->CYCCNT;
+}
+
+
+static inline void
+wait_poll(void)
+{
+}
 
-  *(fpga+(offset>>1)) = val;
+
+__attribute__((unused))
+static void
+write_fpga(uint32_t offset, uint16_t val)
+{
+  *(volatile uint16_t *)(FPGA_BASE + offset) = val;
 }
 
 
@@ -336,13 +542,62 @@ __attribute__((unused))
 static uint16_t
 read_fpga(uint32_t offset)
 {
-  /* 0x64000000 is the start of bank1 SRAM2. */
-  volatile uint16_t *fpga = (volatile uint16_t *)(uint32_t)0x64000000;
+  return *(volatile uint16_t *)(FPGA_BASE + offset);
+}
+
+
+/* A byte store, with only the byte lane of OFFSET enabled (NBL). */
+__attribute__((unused))
+static void
+write_fpga8(uint32_t offset, uint8_t val)
+{
+  *(volatile uint8_t *)(FPGA_BASE + offset) = val;
+}
+
+
+/*
+  The FSMC splits a 32-bit access into two 16-bit ones, low half first, so
+  this reaches a register pair of the FPGA as one instruction.
+*/
+__attribute__((unused))
+static void
+write_fpga32(uint32_t offset, uint32_t val)
+{
+  *(volatile uint32_t *)(FPGA_BASE + offset) = val;
+}
+
+
+__attribute__((unused))
+static uint32_t
+read_fpga32(uint32_t offset)
+{
+  return *(volatile uint32_t *)(FPGA_BASE + offset);
+}
+#endif
+
 
-  return *(fpga+(offset>>1));
+/*
+  End of a round of a test loop: pause, so that the output can be followed.
+  In the host build, the run ends here after the rounds asked for.
+*/
+__attribute__((unused))
+static void
+test_round_end(void)
+{
+#ifdef HOST_BUILD
+  host_bus_round_end();
+#else
+  delay(MCU_HZ/3);
+#endif
 }
 
 
+/*
+  Writes are posted into the FPGA write queue and complete in the background.
+  Subsequent reads see the written data, as the FPGA drains the queue before
+  doing a read. If the queue is full, the FPGA stalls the FSMC write (NWAIT)
+  until there is room.
+*/
 __attribute__((unused))
 static void
 write_sdram(uint32_t addr, uint16_t val)
@@ -352,7 +607,14 @@ write_sdram(uint32_t addr, uint16_t val)
   write_fpga(PERIPH_REG_DATA, val);
   write_fpga(PERIPH_REG_ADR_HIGH, addr_high);
   write_fpga(PERIPH_REG_ADR_LOW, addr_low | 1);
-  // Wait until operation done.
+}
+
+
+/* Wait until all posted writes (and any other operation) have completed. */
+__attribute__((unused))
+static void
+sdram_flush(void)
+{
   while (read_fpga(PERIPH_REG_ADR_LOW) & 1)
     ;
 }
@@ -366,261 +628,1087 @@ read_sdram(uint32_t addr)
   uint16_t addr_low = (addr & 0xfffe);
   write_fpga(PERIPH_REG_ADR_HIGH, addr_high);
   write_fpga(PERIPH_REG_ADR_LOW, addr_low | 0);
-  // Wait until operation done.
-  while (read_fpga(PERIPH_REG_ADR_LOW) & 1)
-    ;
+  // The FPGA stalls this read (NWAIT) until the data has arrived.
   return read_fpga(PERIPH_REG_DATA);
 }
 
 
+/*
+  Write the byte VAL to SDRAM byte address ADDR. With FSMC_NBL, the FPGA sees
+  the FSMC byte lane enables, so a byte store to the data register makes the
+  triggered write a single masked SDRAM write. Otherwise it has to be a
+  read-modify-write of the containing word.
+*/
 __attribute__((unused))
 static void
-ice40_sdram_test1(void)
+write_sdram_byte(uint32_t addr, uint8_t val)
 {
-  uint16_t val;
-  uint32_t ledstate;
-  uint16_t counter;
-  uint16_t v1, v2, v3, v4;
-  uint16_t status1, status2, status3, status4;
+#ifdef FSMC_NBL
+  write_fpga8(PERIPH_REG_DATA + (addr & 1), val);
+  write_fpga(PERIPH_REG_ADR_HIGH, addr >> 16);
+  write_fpga(PERIPH_REG_ADR_LOW, (addr & 0xfffe) | 1);
+#else
+  uint16_t w = read_sdram(addr);
+
+  if (addr & 1)
+    w = (w & 0x00ff) | ((uint16_t)val << 8);
+  else
+    w = (w & 0xff00) | val;
+  write_sdram(addr, w);
+#endif
+}
 
-  ledstate = 0;
-  counter = 0;
-  for(;;) {
-    val = read_fpga(PERIPH_REG_ADR_LOW);
-    serial_puts(USART1, "Read adr_low: ");
-    serial_output_hex(USART1, val);
-    serial_puts(USART1, "\r\n");
-    val = read_fpga(PERIPH_REG_ADR_HIGH);
-    serial_puts(USART1, "Read adr_high: ");
-    serial_output_hex(USART1, val);
-    serial_puts(USART1, "\r\n");
-    val = read_fpga(PERIPH_REG_DATA);
-    serial_puts(USART1, "Read data: ");
-    serial_output_hex(USART1, val);
-    serial_puts(USART1, "\r\n");
 
-    write_fpga(PERIPH_REG_ADR_HIGH, (uint16_t)0x0800 + counter);
-    val = read_fpga(PERIPH_REG_ADR_HIGH);
-    serial_puts(USART1, "Read after write adr_high: ");
-    serial_output_hex(USART1, val);
-    serial_puts(USART1, "\r\n");
-    write_fpga(PERIPH_REG_DATA, counter);
-    val = read_fpga(PERIPH_REG_DATA);
-    serial_puts(USART1, "Read after write data: ");
-    serial_output_hex(USART1, val);
-    serial_puts(USART1, "\r\n");
+/*
+  32-bit access to SDRAM byte address ADDR (must be 4-byte aligned), low
+  half at ADDR. The address is set with one 32-bit store to
+  PERIPH_REG_ADR32, which the FPGA only takes once both halves are there,
+  and the two SDRAM words are transferred by one 32-bit access to
+  PERIPH_REG_DATA32, which then advances the address to the next 32-bit
+  word. So a 32-bit word costs two FSMC instructions instead of six, and
+  further words at consecutive addresses just one each.
+*/
+__attribute__((unused))
+static void
+sdram_write32(uint32_t addr, uint32_t val)
+{
+  write_fpga32(PERIPH_REG_ADR32, addr);
+  write_fpga32(PERIPH_REG_DATA32, val);
+}
 
-    // Execute a write-to-SDRAM.
-    status1 = read_fpga(0x10);
-    serial_puts(USART1, "Status pre: ");
-    serial_output_hex(USART1, status1);
-    serial_puts(USART1, "\r\n");
 
-    write_fpga(PERIPH_REG_ADR_HIGH, 0x0006);
-    write_fpga(PERIPH_REG_DATA, 0xfd00 | (counter & 0xffff));
-    write_fpga(PERIPH_REG_ADR_LOW, 0x0101);
-    v1 = read_fpga(PERIPH_REG_ADR_LOW);
-    v2 = read_fpga(PERIPH_REG_ADR_LOW);
-    v3 = read_fpga(PERIPH_REG_ADR_LOW);
-    v4 = read_fpga(PERIPH_REG_ADR_LOW);
-    serial_puts(USART1, "Attempt to do write: ");
-    serial_output_hex(USART1, v1);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v2);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v3);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v4);
-    serial_puts(USART1, "\r\n");
-    // Execute a write-to-SDRAM.
-    status2 = read_fpga(0x10);
-    serial_puts(USART1, "Status post-write: ");
-    serial_output_hex(USART1, status2);
-    serial_puts(USART1, "\r\n");
+__attribute__((unused))
+static uint32_t
+sdram_read32(uint32_t addr)
+{
+  write_fpga32(PERIPH_REG_ADR32, addr);
+  // Each half is stalled (NWAIT) until its word has been read.
+  return read_fpga32(PERIPH_REG_DATA32);
+}
 
-    // Execute a read-from-SDRAM.
-    write_fpga(PERIPH_REG_DATA, 0xabad);
-    status3 = read_fpga(0x10);
-    serial_puts(USART1, "Status pre-read: ");
-    serial_output_hex(USART1, status3);
-    serial_puts(USART1, "\r\n");
-    write_fpga(PERIPH_REG_ADR_LOW, 0x0100);
-    v1 = read_fpga(PERIPH_REG_ADR_LOW);
-    v2 = read_fpga(PERIPH_REG_ADR_LOW);
-    v3 = read_fpga(PERIPH_REG_ADR_LOW);
-    val = read_fpga(PERIPH_REG_DATA);
-    v4 = read_fpga(PERIPH_REG_ADR_LOW);
-    serial_puts(USART1, "Attempt to do read: ");
-    serial_output_hex(USART1, v1);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v2);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v3);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, val);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v4);
-    serial_puts(USART1, "\r\n");
-    status4 = read_fpga(0x10);
-    serial_puts(USART1, "Status post-read: ");
-    serial_output_hex(USART1, status4);
-    serial_puts(USART1, "\r\n");
 
-    ++counter;
-    if ((ledstate = !ledstate))
-      led1_on();
-    else
-      led1_off();
-    delay(MCU_HZ/3);
-  }
+/*
+  Streaming access. sdram_stream_start() sets the SDRAM byte address ADDR
+  of the first word; then each sdram_stream_put() writes, or each
+  sdram_stream_get() reads, the next word with a single FSMC access. For
+  reading, the FPGA prefetches ahead, and stalls the access (NWAIT) in case
+  the next word is not ready yet.
+*/
+__attribute__((unused))
+static void
+sdram_stream_start(uint32_t addr, int is_write)
+{
+  write_fpga(PERIPH_REG_ADR_HIGH, addr >> 16);
+  write_fpga(PERIPH_REG_STREAM_ADR, (addr & 0xfffe) | (is_write ? 1 : 0));
 }
 
 
 __attribute__((unused))
 static void
-ice40_sdram_test2(void)
+sdram_stream_put(uint16_t val)
 {
-  uint32_t ledstate;
-  uint16_t counter;
-  uint16_t v1, v2, v3, v4, v5;
+  write_fpga(PERIPH_REG_DATA_STREAM, val);
+}
 
-  ledstate = 0;
-  counter = 0;
-  for(;;) {
-    write_sdram(0x1238, (counter+3)&0xffff);
-    write_sdram(0x1232, counter&0xffff);
-    write_sdram(0x1236, (counter+2)&0xffff);
-    write_sdram(0x1234, (counter+1)&0xffff);
-    v1 = read_sdram(0x1232);
-    //delay(MCU_HZ/3/1000000*100);
-    v2 = read_sdram(0x1234);
-    v3 = read_sdram(0x1236);
-    v4 = read_sdram(0x1238);
-    v5 = read_sdram(0x1232);
-    serial_puts(USART1, "Readback after write ");
-    serial_output_hex(USART1, (counter&0xffff));
-    serial_puts(USART1, ": ");
-    serial_output_hex(USART1, v1);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v2);
-    serial_puts(USART1, ": ");
-    serial_output_hex(USART1, v3);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v4);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v5);
-    serial_puts(USART1, "\r\n");
 
-    ++counter;
-    if ((ledstate = !ledstate))
-      led1_on();
-    else
-      led1_off();
-    if (counter & 2)
-      led2_on();
-    else
-      led2_off();
-    delay(MCU_HZ/3);
-  }
+__attribute__((unused))
+static uint16_t
+sdram_stream_get(void)
+{
+  return read_fpga(PERIPH_REG_DATA_STREAM);
 }
 
 
+/*
+  Stop read prefetching, so the FPGA is free for other accesses, and wait
+  until posted stream writes have completed.
+*/
 __attribute__((unused))
 static void
-ice40_sdram_test3(void)
+sdram_stream_stop(void)
 {
-  uint32_t ledstate;
-  uint16_t counter;
-  uint16_t v1, v2, v3, v4, v5;
-
-  ledstate = 0;
-  counter = 0;
-  for(;;) {
-    write_fpga(PERIPH_REG_ADR_HIGH, 0x2222);
-    v1 = read_fpga(PERIPH_REG_ADR_HIGH);
-    write_fpga(PERIPH_REG_ADR_HIGH, 0x4444);
-    v2 = read_fpga(PERIPH_REG_ADR_HIGH);
-    write_fpga(PERIPH_REG_ADR_HIGH, 0x6666);
-    v3 = read_fpga(PERIPH_REG_ADR_HIGH);
-    write_fpga(PERIPH_REG_ADR_HIGH, 0x8888);
-    v4 = read_fpga(PERIPH_REG_ADR_HIGH);
-    write_fpga(PERIPH_REG_ADR_HIGH, 0xaaaa);
-    v5 = read_fpga(PERIPH_REG_ADR_HIGH);
+  write_fpga(PERIPH_REG_STREAM_ADR, 1);
+  sdram_flush();
+}
 
-    serial_puts(USART1, "FSMC interface readback: ");
-    serial_output_hex(USART1, v1);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v2);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v3);
-    serial_puts(USART1, ": ");
-    serial_output_hex(USART1, v4);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v5);
-    serial_puts(USART1, "\r\n");
 
-    ++counter;
-    if ((ledstate = !ledstate))
-      led1_on();
-    else
-      led1_off();
-    if (counter & 2)
-      led2_on();
-    else
-      led2_off();
-    delay(MCU_HZ/3);
-  }
+/*
+  Memory-mapped access. sdram_window() maps the 256-byte block of SDRAM
+  containing byte address ADDR into the FPGA window and returns the FPGA
+  register offset of ADDR in it, for read_fpga()/write_fpga() and friends;
+  it is valid until the window is moved. Reads stall on NWAIT until the data
+  arrives from SDRAM. Byte stores need FSMC_NBL (the FPGA must see the byte
+  lane enables); without it only 16- or 32-bit accesses may be used.
+*/
+__attribute__((unused))
+static uint32_t
+sdram_window(uint32_t addr)
+{
+  write_fpga(PERIPH_REG_ADR_HIGH, addr >> 16);
+  write_fpga(PERIPH_REG_WIN_BASE, addr & 0xff00);
+  return FPGA_WINDOW_OFFSET + (addr & 0xfe);
 }
 
 
+/* Copy COUNT words from SDRAM byte address ADDR to DST through the window. */
 __attribute__((unused))
 static void
-ice40_sdram_test4(void)
+sdram_window_copy_from(uint16_t *dst, uint32_t addr, uint32_t count)
 {
-  uint32_t i, j;
-  static const uint32_t fixadr = 0x00000000;
-  static const uint32_t SHIFT = 0;
+  while (count > 0)
+  {
+    uint32_t p = sdram_window(addr);
+    uint32_t n = (WINDOW_BYTES - (addr & (WINDOW_BYTES-1))) >> 1;
+
+    if (n > count)
+      n = count;
+    addr += n << 1;
+    count -= n;
+    for (; n > 0; --n, p += 2)
+      *dst++ = read_fpga(p);
+  }
+}
 
-  for(;;) {
-    for (i = 0; i < 128; ++i) {
-      write_sdram(((i<<SHIFT)+fixadr)<<1, ((i|(i<<8)))&0xffff);
-      if (i & 1)
-        led1_off();
-      else
-        led1_on();
-    }
-    for (i = 0; i < 128; i += 8) {
-      serial_output_hex(USART1, (((i+0)<<SHIFT)+fixadr) << 1);
-      serial_puts(USART1, ":");
-      for (j = 0; j < 8; ++j) {
-        uint16_t v = read_sdram( (((i+j)<<SHIFT)+fixadr) << 1 );
-        serial_puts(USART1, " ");
-        serial_output_hex(USART1, v);
-        if (j & 1)
-          led2_off();
-        else
-          led2_on();
-      }
-      serial_puts(USART1, "\r\n");
-    }
-    serial_puts(USART1, "\r\n");
 
-    delay(MCU_HZ/3);
+/* Copy COUNT words from SRC to SDRAM byte address ADDR through the window. */
+__attribute__((unused))
+static void
+sdram_window_copy_to(uint32_t addr, const uint16_t *src, uint32_t count)
+{
+  while (count > 0)
+  {
+    uint32_t p = sdram_window(addr);
+    uint32_t n = (WINDOW_BYTES - (addr & (WINDOW_BYTES-1))) >> 1;
+
+    if (n > count)
+      n = count;
+    addr += n << 1;
+    count -= n;
+    for (; n > 0; --n, p += 2)
+      write_fpga(p, *src++);
   }
 }
 
 
+/*
+  Write COUNT (1..BURST_MAX_WORDS) words from BUF to SDRAM starting at byte
+  address ADDR. The words are first loaded into the FPGA burst buffer, then
+  written to SDRAM in one burst.
+*/
 __attribute__((unused))
 static void
-ice40_sdram_test5(void)
+sdram_burst_write(uint32_t addr, const uint16_t *buf, uint32_t count)
 {
-  uint32_t i, j;
+  uint32_t i;
 
-  for(;;) {
-    led1_on();
-    for (i = 0; i < 0x10000; ++i) {
-      write_sdram(i<<1, i&0xffff);
-    }
+  write_fpga(PERIPH_REG_BURST_LEN, count);
+  for (i = 0; i < count; ++i)
+    write_fpga(PERIPH_REG_BURST_DATA, buf[i]);
+  write_fpga(PERIPH_REG_ADR_HIGH, addr >> 16);
+  // A burst is not started until posted writes have completed.
+  sdram_flush();
+  write_fpga(PERIPH_REG_BURST_STATUS, (addr & 0xfffe) | 1);
+  // Wait until burst done.
+  while (read_fpga(PERIPH_REG_BURST_STATUS) & 1)
+    ;
+}
+
+
+/*
+  Read COUNT (1..BURST_MAX_WORDS) words from SDRAM byte address ADDR into
+  BUF, as one burst into the FPGA burst buffer.
+*/
+__attribute__((unused))
+static void
+sdram_burst_read(uint32_t addr, uint16_t *buf, uint32_t count)
+{
+  uint32_t i;
+
+  write_fpga(PERIPH_REG_BURST_LEN, count);
+  write_fpga(PERIPH_REG_ADR_HIGH, addr >> 16);
+  sdram_flush();
+  write_fpga(PERIPH_REG_BURST_STATUS, (addr & 0xfffe) | 0);
+  // Wait until burst done.
+  while (read_fpga(PERIPH_REG_BURST_STATUS) & 1)
+    ;
+  for (i = 0; i < count; ++i)
+    buf[i] = read_fpga(PERIPH_REG_BURST_DATA);
+}
+
+
+/*
+  DMA transfers to/from SDRAM through the streaming data port, using DMA2 in
+  memory-to-memory mode with the FPGA data port as the non-incrementing side.
+
+  The transfer is done in chunks of at most DMA_CHUNK_WORDS (the DMA counter
+  is 16 bits). The FPGA stalls the FSMC accesses (NWAIT) whenever it is not
+  ready, so the DMA can never run ahead of it.
+
+  Data goes to/from one or two buffers of buf_words words each. When a
+  buffer is done, the callback is called (from interrupt context) with that
+  buffer while the DMA continues with the other one, so the CPU can process
+  (or refill) one buffer while the other is being transferred. With a single
+  buffer, the callback is called once at the end.
+
+  The FPGA must not be accessed otherwise while a transfer is running.
+*/
+#define SDRAM_DMA_STREAM DMA2_Stream0
+#define DMA_CHUNK_WORDS 32768
+
+typedef void (*sdram_dma_callback)(void *arg, uint16_t *buf, uint32_t words);
+
+static struct {
+  uint16_t *bufs[2];
+  uint32_t buf_words;
+  uint32_t left;          /* Words not yet transferred */
+  uint32_t cur_buf;       /* Index in bufs[] of the buffer being transferred */
+  uint32_t buf_pos;       /* Words done in the current buffer */
+  uint32_t chunk;         /* Size of the DMA chunk in progress */
+  int is_write;
+  sdram_dma_callback cb;
+  void *cb_arg;
+  volatile int busy;
+} sdram_dma;
+
+
+#ifndef HOST_BUILD
+__attribute__((unused))
+static void
+sdram_dma_init(void)
+{
+  NVIC_InitTypeDef nvic_init;
+
+  RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
+
+  nvic_init.NVIC_IRQChannel = DMA2_Stream0_IRQn;
+  nvic_init.NVIC_IRQChannelPreemptionPriority = 1;
+  nvic_init.NVIC_IRQChannelSubPriority = 0;
+  nvic_init.NVIC_IRQChannelCmd = ENABLE;
+  NVIC_Init(&nvic_init);
+}
+#endif
+
+
+static void
+sdram_dma_next_chunk(void)
+{
+  DMA_InitTypeDef dma_init;
+  /* Bus address of the FPGA streaming data register. */
+  uintptr_t fpga_port = fpga_bus_addr(PERIPH_REG_DATA_STREAM);
+  uintptr_t buf =
+    (uintptr_t)(sdram_dma.bufs[sdram_dma.cur_buf] + sdram_dma.buf_pos);
+  uint32_t chunk = sdram_dma.buf_words - sdram_dma.buf_pos;
+
+  if (chunk > sdram_dma.left)
+    chunk = sdram_dma.left;
+  if (chunk > DMA_CHUNK_WORDS)
+    chunk = DMA_CHUNK_WORDS;
+
+  /* In memory-to-memory mode, the "peripheral" side is the source. */
+  DMA_StructInit(&dma_init);
+  dma_init.DMA_Channel = DMA_Channel_0;
+  dma_init.DMA_DIR = DMA_DIR_MemoryToMemory;
+  dma_init.DMA_BufferSize = chunk;
+  if (sdram_dma.is_write)
+  {
+    dma_init.DMA_PeripheralBaseAddr = buf;
+    dma_init.DMA_PeripheralInc = DMA_PeripheralInc_Enable;
+    dma_init.DMA_Memory0BaseAddr = fpga_port;
+    dma_init.DMA_MemoryInc = DMA_MemoryInc_Disable;
+  }
+  else
+  {
+    dma_init.DMA_PeripheralBaseAddr = fpga_port;
+    dma_init.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    dma_init.DMA_Memory0BaseAddr = buf;
+    dma_init.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  }
+  dma_init.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+  dma_init.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+  dma_init.DMA_Mode = DMA_Mode_Normal;
+  dma_init.DMA_Priority = DMA_Priority_High;
+  dma_init.DMA_FIFOMode = DMA_FIFOMode_Enable;
+  dma_init.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+  dma_init.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+  dma_init.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+  DMA_Init(SDRAM_DMA_STREAM, &dma_init);
+  DMA_ITConfig(SDRAM_DMA_STREAM, DMA_IT_TC, ENABLE);
+  sdram_dma.chunk = chunk;
+  DMA_Cmd(SDRAM_DMA_STREAM, ENABLE);
+}
+
+
+void
+DMA2_Stream0_IRQHandler(void)
+{
+  uint16_t *buf;
+  uint32_t words;
+
+  if (!DMA_GetITStatus(SDRAM_DMA_STREAM, DMA_IT_TCIF0))
+    return;
+  DMA_ClearITPendingBit(SDRAM_DMA_STREAM, DMA_IT_TCIF0);
+
+  sdram_dma.left -= sdram_dma.chunk;
+  sdram_dma.buf_pos += sdram_dma.chunk;
+  if (sdram_dma.buf_pos < sdram_dma.buf_words && sdram_dma.left > 0)
+  {
+    sdram_dma_next_chunk();
+    return;
+  }
+
+  /* Buffer done; continue with the other one before the callback. */
+  buf = sdram_dma.bufs[sdram_dma.cur_buf];
+  words = sdram_dma.buf_pos;
+  sdram_dma.cur_buf ^= 1;
+  sdram_dma.buf_pos = 0;
+  if (sdram_dma.left > 0)
+    sdram_dma_next_chunk();
+  else
+  {
+    if (!sdram_dma.is_write)
+      write_fpga(PERIPH_REG_STREAM_ADR, 1);   /* Stop prefetching */
+    sdram_dma.busy = 0;
+  }
+  if (sdram_dma.cb)
+    (*sdram_dma.cb)(sdram_dma.cb_arg, buf, words);
+}
+
+
+/*
+  Start a DMA transfer of COUNT words at SDRAM byte address SDRAM_ADDR,
+  through buffers BUF0 and BUF1 (which may be the same) of BUF_WORDS words.
+  For writes, both buffers must be filled before starting.
+*/
+static void
+sdram_dma_start(int is_write, uint32_t sdram_addr, uint32_t count,
+                uint16_t *buf0, uint16_t *buf1, uint32_t buf_words,
+                sdram_dma_callback cb, void *cb_arg)
+{
+  while (sdram_dma.busy)
+    wait_poll();
+  if (count == 0)
+    return;
+  sdram_dma.bufs[0] = buf0;
+  sdram_dma.bufs[1] = buf1;
+  sdram_dma.buf_words = buf_words;
+  sdram_dma.left = count;
+  sdram_dma.cur_buf = 0;
+  sdram_dma.buf_pos = 0;
+  sdram_dma.is_write = is_write;
+  sdram_dma.cb = cb;
+  sdram_dma.cb_arg = cb_arg;
+  sdram_stream_start(sdram_addr, is_write);
+  sdram_dma.busy = 1;
+  sdram_dma_next_chunk();
+}
+
+
+__attribute__((unused))
+static void
+sdram_dma_read(uint16_t *dst, uint32_t sdram_addr, uint32_t count,
+               sdram_dma_callback cb, void *cb_arg)
+{
+  sdram_dma_start(0, sdram_addr, count, dst, dst, count, cb, cb_arg);
+}
+
+
+__attribute__((unused))
+static void
+sdram_dma_write(uint32_t sdram_addr, const uint16_t *src, uint32_t count,
+                sdram_dma_callback cb, void *cb_arg)
+{
+  /* The buffer is only read from when writing to SDRAM. */
+  sdram_dma_start(1, sdram_addr, count, (uint16_t *)src, (uint16_t *)src,
+                  count, cb, cb_arg);
+}
+
+
+__attribute__((unused))
+static void
+sdram_dma_read_double(uint32_t sdram_addr, uint32_t count,
+                      uint16_t *buf0, uint16_t *buf1, uint32_t buf_words,
+                      sdram_dma_callback cb, void *cb_arg)
+{
+  sdram_dma_start(0, sdram_addr, count, buf0, buf1, buf_words, cb, cb_arg);
+}
+
+
+__attribute__((unused))
+static void
+sdram_dma_write_double(uint32_t sdram_addr, uint32_t count,
+                       uint16_t *buf0, uint16_t *buf1, uint32_t buf_words,
+                       sdram_dma_callback cb, void *cb_arg)
+{
+  sdram_dma_start(1, sdram_addr, count, buf0, buf1, buf_words, cb, cb_arg);
+}
+
+
+/*
+  Wait for a DMA transfer to complete. After a write, the data may still be
+  in the FPGA write queue; use sdram_flush() to wait for that.
+*/
+__attribute__((unused))
+static void
+sdram_dma_wait(void)
+{
+  while (sdram_dma.busy)
+    wait_poll();
+}
+
+
+/* Read FPGA performance counter IDX (32 bits, low half first). */
+__attribute__((unused))
+static uint32_t
+perf_read(uint32_t idx)
+{
+  uint32_t lo;
+
+  write_fpga(PERIPH_REG_PERF_SEL, idx);
+  lo = read_fpga(PERIPH_REG_PERF_LO);
+  return lo | ((uint32_t)read_fpga(PERIPH_REG_PERF_HI) << 16);
+}
+
+
+__attribute__((unused))
+static void
+perf_clear(void)
+{
+  write_fpga(PERIPH_REG_PERF_SEL, PERF_SEL_CLEAR);
+}
+
+
+/*
+  SDRAM power management. The FPGA puts the SDRAM in power-down after
+  PD_CLOCKS FPGA clocks without a request, and in self-refresh after
+  SR_UNITS*256 clocks; 0 disables either. The next access wakes it up, which
+  costs a clock or two from power-down, and the exit time tXSR plus tRAS at
+  worst from self-refresh.
+*/
+__attribute__((unused))
+static void
+sdram_power_config(uint16_t pd_clocks, uint16_t sr_units)
+{
+  write_fpga(PERIPH_REG_PWR_PD_IDLE, pd_clocks);
+  write_fpga(PERIPH_REG_PWR_SR_IDLE, sr_units);
+}
+
+
+/*
+  Wake-up latency, in FPGA clocks, of the last access that found the SDRAM in
+  power-down or self-refresh. The total is in the "wake" performance counter.
+*/
+__attribute__((unused))
+static uint16_t
+sdram_wake_latency(void)
+{
+  return read_fpga(PERIPH_REG_PWR_WAKE);
+}
+
+
+/*
+  Print all FPGA performance counters on one line. The FSMC accesses done
+  to read them are counted too.
+*/
+__attribute__((unused))
+static void
+perf_dump(USART_TypeDef *usart)
+{
+  static const char * const names[PERF_NUM_COUNTERS] = {
+    "act", "rd", "wr", "pre", "ref", "idle", "busy", "refstall",
+    "fsmc_rd", "fsmc_wr", "pwrdn", "selfref", "wake"
+  };
+  uint32_t i;
+
+  serial_puts(usart, "perf:");
+  for (i = 0; i < PERF_NUM_COUNTERS; ++i)
+  {
+    serial_puts(usart, " ");
+    serial_puts(usart, names[i]);
+    serial_puts(usart, "=");
+    print_uint32(usart, perf_read(i));
+  }
+  serial_puts(usart, "\r\n");
+}
+
+
+/*
+  FPGA memory self-test. sdram_bist_start() starts test PATTERN (one of
+  BIST_PAT_*, varied by SEED) over WORDS words from SDRAM byte address ADDR,
+  which then runs at SDRAM burst rate without any FSMC traffic. Other SDRAM
+  accesses stall until it is done; sdram_bist_busy() can be polled.
+*/
+__attribute__((unused))
+static void
+sdram_bist_start(uint32_t addr, uint32_t words, uint32_t pattern,
+                 uint8_t seed)
+{
+  // The test is not started while anything is outstanding.
+  sdram_flush();
+  write_fpga32(PERIPH_REG_ADR32, addr);
+  write_fpga32(PERIPH_REG_BIST_LEN, words);
+  write_fpga(PERIPH_REG_BIST_CTRL, ((uint16_t)seed << 8) | pattern);
+}
+
+
+__attribute__((unused))
+static int
+sdram_bist_busy(void)
+{
+  return (read_fpga(PERIPH_REG_BIST_CTRL) & BIST_CTRL_BUSY) != 0;
+}
+
+
+/*
+  Wait for the self-test to finish and return its error count. The or of
+  all failing bits goes to *FAIL_MASK and the byte addresses of the first
+  (up to BIST_MAX_FAILS) failing words to FAIL_ADDRS, and the number of
+  those is returned in *NUM_FAILS.
+*/
+__attribute__((unused))
+static uint32_t
+sdram_bist_result(uint16_t *fail_mask, uint32_t *fail_addrs,
+                  uint32_t *num_fails)
+{
+  uint32_t i, n;
+
+  while (sdram_bist_busy())
+    ;
+  n = (read_fpga(PERIPH_REG_BIST_CTRL) >> 8) & 0xf;
+  for (i = 0; i < n; ++i)
+  {
+    write_fpga(PERIPH_REG_BIST_FAIL_SEL, i);
+    fail_addrs[i] = read_fpga32(PERIPH_REG_BIST_FAIL);
+  }
+  *num_fails = n;
+  *fail_mask = read_fpga(PERIPH_REG_BIST_FAIL_MASK);
+  return read_fpga32(PERIPH_REG_BIST_ERR);
+}
+
+
+/*
+  FPGA copy engine. sdram_copy() and sdram_fill() queue a copy of WORDS
+  words from SDRAM byte address SRC to DST, or a fill of WORDS words at DST
+  with VAL, and return at once; the data does not cross the FSMC. Up to
+  CP_QUEUE_SIZE descriptors are queued, beyond that the call stalls (NWAIT)
+  until one is done. With IRQ set, the FPGA raises its interrupt line
+  (sdram_gpio2) when the descriptor is done. Descriptors run in order, in
+  the background of other accesses, which do not wait for them; use
+  sdram_copy_wait() (or sdram_flush()) before touching the memory involved.
+  Copies go upwards, so an overlapping copy to a higher address needs
+  DST - SRC >= 1024 bytes.
+*/
+__attribute__((unused))
+static void
+sdram_copy(uint32_t dst, uint32_t src, uint32_t words, int irq)
+{
+  write_fpga32(PERIPH_REG_CP_SRC, src);
+  write_fpga32(PERIPH_REG_CP_DST, dst);
+  write_fpga32(PERIPH_REG_CP_LEN, words);
+  write_fpga(PERIPH_REG_CP_CTRL, irq ? CP_CTRL_IRQ : 0);
+}
+
+
+__attribute__((unused))
+static void
+sdram_fill(uint32_t dst, uint16_t val, uint32_t words, int irq)
+{
+  write_fpga(PERIPH_REG_CP_FILL, val);
+  write_fpga32(PERIPH_REG_CP_DST, dst);
+  write_fpga32(PERIPH_REG_CP_LEN, words);
+  write_fpga(PERIPH_REG_CP_CTRL, CP_CTRL_FILL | (irq ? CP_CTRL_IRQ : 0));
+}
+
+
+/*
+  Atomic read-modify-write of the SDRAM word at byte address ADDR: OP is one
+  of AT_OP_*, or'ed with AT_OP_32 for a 32-bit word (ADDR 4-byte aligned).
+  The FPGA reads the word and writes back the result of the operation with
+  ARG without letting anything in between; AT_OP_CAS writes ARG only if the
+  old value equals CMP. Returns the old value. The FSMC read of the result
+  is stalled until the operation is done.
+*/
+__attribute__((unused))
+static uint32_t
+sdram_atomic(uint32_t addr, uint32_t op, uint32_t arg, uint32_t cmp)
+{
+  write_fpga32(PERIPH_REG_ADR32, addr);
+  write_fpga32(PERIPH_REG_AT_ARG, arg);
+  if ((op & ~AT_OP_32) == AT_OP_CAS)
+    write_fpga32(PERIPH_REG_AT_CMP, cmp);
+  write_fpga(PERIPH_REG_AT_OP, op);
+  if (op & AT_OP_32)
+    return read_fpga32(PERIPH_REG_AT_RESULT);
+  else
+    return read_fpga(PERIPH_REG_AT_RESULT);
+}
+
+
+__attribute__((unused))
+static uint32_t
+sdram_fetch_add32(uint32_t addr, uint32_t val)
+{
+  return sdram_atomic(addr, AT_OP_ADD | AT_OP_32, val, 0);
+}
+
+
+/* Returns non-zero if *ADDR was EXPECTED and has been replaced by VAL. */
+__attribute__((unused))
+static int
+sdram_cas32(uint32_t addr, uint32_t expected, uint32_t val)
+{
+  return sdram_atomic(addr, AT_OP_CAS | AT_OP_32, val, expected) == expected;
+}
+
+
+/* Wait until all queued copies and fills are done, and clear the interrupt. */
+__attribute__((unused))
+static void
+sdram_copy_wait(void)
+{
+  while (read_fpga(PERIPH_REG_CP_STATUS) & CP_STATUS_PENDING)
+    ;
+  write_fpga(PERIPH_REG_CP_STATUS, CP_STATUS_IRQ);
+}
+
+
+/*
+  CRC-32 of WORDS words at P, taken as bytes in memory order, continuing
+  from CRC (0 to start). The same as zlib's crc32(), and as the FPGA
+  computes it. A nibble at a time, to keep the table small.
+*/
+__attribute__((unused))
+static uint32_t
+crc32_words(uint32_t crc, const uint16_t *p, uint32_t words)
+{
+  static const uint32_t tab[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+    0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+    0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+  };
+  uint32_t i, k, v;
+
+  crc = ~crc;
+  for (i = 0; i < words; ++i) {
+    v = p[i];
+    for (k = 0; k < 4; ++k) {
+      crc = (crc >> 4) ^ tab[(crc ^ v) & 0xf];
+      v >>= 4;
+    }
+  }
+  return ~crc;
+}
+
+
+/*
+  Near-memory CRC. sdram_crc_start() has the FPGA read WORDS words from
+  SDRAM byte address ADDR at burst rate, in the background of other
+  accesses, and compute their CRC-32 (as crc32_words()) and the sum of the
+  words. Writes done before the call are included. sdram_crc_result() waits
+  for it and returns the CRC, and the sum in *SUM if not NULL.
+*/
+__attribute__((unused))
+static void
+sdram_crc_start(uint32_t addr, uint32_t words)
+{
+  while (read_fpga(PERIPH_REG_CRC_CTRL) & CRC_CTRL_BUSY)
+    ;
+  write_fpga32(PERIPH_REG_ADR32, addr);
+  write_fpga32(PERIPH_REG_RANGE_LEN, words);
+  write_fpga(PERIPH_REG_CRC_CTRL, 0);
+}
+
+
+__attribute__((unused))
+static uint32_t
+sdram_crc_result(uint32_t *sum)
+{
+  while (read_fpga(PERIPH_REG_CRC_CTRL) & CRC_CTRL_BUSY)
+    ;
+  if (sum)
+    *sum = read_fpga32(PERIPH_REG_SUM);
+  return read_fpga32(PERIPH_REG_CRC);
+}
+
+
+/*
+  Check that the WORDS words at SDRAM byte address ADDR hold DATA, by
+  comparing the FPGA's CRC and sum with those of DATA, computed while the
+  FPGA works. Returns non-zero if they match.
+*/
+__attribute__((unused))
+static int
+sdram_crc_check(uint32_t addr, const uint16_t *data, uint32_t words)
+{
+  uint32_t i, crc, sum, hw_sum;
+
+  sdram_crc_start(addr, words);
+  crc = crc32_words(0, data, words);
+  sum = 0;
+  for (i = 0; i < words; ++i)
+    sum += data[i];
+  return sdram_crc_result(&hw_sum) == crc && hw_sum == sum;
+}
+
+
+/*
+  Near-memory scan. The FPGA reads WORDS words from SDRAM byte address ADDR
+  at burst rate, like for sdram_crc_start(), and looks at every STRIDE'th
+  (up to SCAN_MAX_STRIDE, 0 means 1) from the first, and'ed with MASK. OP
+  is one of SCAN_OP_*, or'ed with SCAN_OP_SIGNED to compare and sum the
+  values as signed. Returns the result, and in *INDEX the word offset from
+  ADDR that goes with it (SCAN_NONE if nothing matched):
+    SCAN_OP_FIND   the first word equal to KEY under MASK, and its offset.
+                   Reading stops soon after it is found.
+    SCAN_OP_COUNT  the number of words equal to KEY under MASK, and the
+                   offset of the first.
+    SCAN_OP_MIN,   the smallest or largest value (sign extended with
+    SCAN_OP_MAX    SCAN_OP_SIGNED), and the offset of its first occurrence.
+    SCAN_OP_SUM    the sum of the values, and how many there were.
+*/
+__attribute__((unused))
+static uint32_t
+sdram_scan(uint32_t addr, uint32_t words, uint32_t op, uint16_t key,
+           uint16_t mask, uint32_t stride, uint32_t *index)
+{
+  while (read_fpga(PERIPH_REG_SCAN_CTRL) & SCAN_CTRL_BUSY)
+    ;
+  write_fpga32(PERIPH_REG_ADR32, addr);
+  write_fpga32(PERIPH_REG_RANGE_LEN, words);
+  write_fpga(PERIPH_REG_SCAN_KEY, key);
+  write_fpga(PERIPH_REG_SCAN_MASK, mask);
+  write_fpga(PERIPH_REG_SCAN_CTRL, (stride << 8) | op);
+  while (read_fpga(PERIPH_REG_SCAN_CTRL) & SCAN_CTRL_BUSY)
+    ;
+  *index = read_fpga32(PERIPH_REG_SCAN_INDEX);
+  return read_fpga32(PERIPH_REG_SCAN_RESULT);
+}
+
+
+/*
+  The same as sdram_scan(), done by the MCU with streaming reads. For when
+  the FPGA engine is not there, and to check it.
+*/
+__attribute__((unused))
+static uint32_t
+sdram_scan_sw(uint32_t addr, uint32_t words, uint32_t op, uint16_t key,
+              uint16_t mask, uint32_t stride, uint32_t *index)
+{
+  uint32_t i, w, v, res, idx, hit, skip, flip;
+  uint32_t kind = op & ~SCAN_OP_SIGNED;
+
+  flip = (op & SCAN_OP_SIGNED) ? 0x8000 : 0;
+  res = 0;
+  idx = (kind == SCAN_OP_SUM) ? 0 : SCAN_NONE;
+  hit = 0;
+  skip = 0;
+  sdram_stream_start(addr, 0);
+  for (i = 0; i < words; ++i) {
+    w = sdram_stream_get();
+    if (skip) {
+      --skip;
+      continue;
+    }
+    skip = stride ? stride - 1 : 0;
+    v = w & mask;
+    if (flip && (v & 0x8000))
+      v |= 0xffff0000;
+    switch (kind) {
+    case SCAN_OP_FIND:
+      if (!hit && (uint16_t)v == (key & mask)) {
+        hit = 1;
+        res = w;
+        idx = i;
+      }
+      break;
+    case SCAN_OP_COUNT:
+      if ((uint16_t)v == (key & mask)) {
+        if (!hit)
+          idx = i;
+        hit = 1;
+        ++res;
+      }
+      break;
+    case SCAN_OP_MIN:
+    case SCAN_OP_MAX:
+      if (!hit ||
+          (kind == SCAN_OP_MIN ?
+           ((v ^ flip) & 0xffff) < ((res ^ flip) & 0xffff) :
+           ((v ^ flip) & 0xffff) > ((res ^ flip) & 0xffff))) {
+        hit = 1;
+        res = v;
+        idx = i;
+      }
+      break;
+    default:
+      res += v;
+      ++idx;
+      break;
+    }
+    if (kind == SCAN_OP_FIND && hit)
+      break;
+  }
+  sdram_stream_stop();
+  *index = idx;
+  return res;
+}
+
+
+__attribute__((unused))
+static void
+ice40_sdram_test1(void)
+{
+  uint16_t val;
+  uint32_t ledstate;
+  uint16_t counter;
+  uint16_t v1, v2, v3, v4;
+  uint16_t status1, status2, status3, status4;
+
+  ledstate = 0;
+  counter = 0;
+  for(;;) {
+    val = read_fpga(PERIPH_REG_ADR_LOW);
+    serial_puts(CONSOLE, "Read adr_low: ");
+    serial_output_hex(CONSOLE, val);
+    serial_puts(CONSOLE, "\r\n");
+    val = read_fpga(PERIPH_REG_ADR_HIGH);
+    serial_puts(CONSOLE, "Read adr_high: ");
+    serial_output_hex(CONSOLE, val);
+    serial_puts(CONSOLE, "\r\n");
+    val = read_fpga(PERIPH_REG_DATA);
+    serial_puts(CONSOLE, "Read data: ");
+    serial_output_hex(CONSOLE, val);
+    serial_puts(CONSOLE, "\r\n");
+
+    write_fpga(PERIPH_REG_ADR_HIGH, (uint16_t)0x0800 + counter);
+    val = read_fpga(PERIPH_REG_ADR_HIGH);
+    serial_puts(CONSOLE, "Read after write adr_high: ");
+    serial_output_hex(CONSOLE, val);
+    serial_puts(CONSOLE, "\r\n");
+    write_fpga(PERIPH_REG_DATA, counter);
+    val = read_fpga(PERIPH_REG_DATA);
+    serial_puts(CONSOLE, "Read after write data: ");
+    serial_output_hex(CONSOLE, val);
+    serial_puts(CONSOLE, "\r\n");
+
+    // Execute a write-to-SDRAM.
+    status1 = read_fpga(PERIPH_REG_ADR_LOW) & 1;
+    serial_puts(CONSOLE, "Status pre: ");
+    serial_output_hex(CONSOLE, status1);
+    serial_puts(CONSOLE, "\r\n");
+
+    write_fpga(PERIPH_REG_ADR_HIGH, 0x0006);
+    write_fpga(PERIPH_REG_DATA, 0xfd00 | (counter & 0xffff));
+    write_fpga(PERIPH_REG_ADR_LOW, 0x0101);
+    v1 = read_fpga(PERIPH_REG_ADR_LOW);
+    v2 = read_fpga(PERIPH_REG_ADR_LOW);
+    v3 = read_fpga(PERIPH_REG_ADR_LOW);
+    v4 = read_fpga(PERIPH_REG_ADR_LOW);
+    serial_puts(CONSOLE, "Attempt to do write: ");
+    serial_output_hex(CONSOLE, v1);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v2);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v3);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v4);
+    serial_puts(CONSOLE, "\r\n");
+    // Execute a write-to-SDRAM.
+    status2 = read_fpga(PERIPH_REG_ADR_LOW) & 1;
+    serial_puts(CONSOLE, "Status post-write: ");
+    serial_output_hex(CONSOLE, status2);
+    serial_puts(CONSOLE, "\r\n");
+
+    // Execute a read-from-SDRAM.
+    write_fpga(PERIPH_REG_DATA, 0xabad);
+    status3 = read_fpga(PERIPH_REG_ADR_LOW) & 1;
+    serial_puts(CONSOLE, "Status pre-read: ");
+    serial_output_hex(CONSOLE, status3);
+    serial_puts(CONSOLE, "\r\n");
+    write_fpga(PERIPH_REG_ADR_LOW, 0x0100);
+    v1 = read_fpga(PERIPH_REG_ADR_LOW);
+    v2 = read_fpga(PERIPH_REG_ADR_LOW);
+    v3 = read_fpga(PERIPH_REG_ADR_LOW);
+    val = read_fpga(PERIPH_REG_DATA);
+    v4 = read_fpga(PERIPH_REG_ADR_LOW);
+    serial_puts(CONSOLE, "Attempt to do read: ");
+    serial_output_hex(CONSOLE, v1);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v2);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v3);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, val);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v4);
+    serial_puts(CONSOLE, "\r\n");
+    status4 = read_fpga(PERIPH_REG_ADR_LOW) & 1;
+    serial_puts(CONSOLE, "Status post-read: ");
+    serial_output_hex(CONSOLE, status4);
+    serial_puts(CONSOLE, "\r\n");
+
+    ++counter;
+    if ((ledstate = !ledstate))
+      led1_on();
+    else
+      led1_off();
+    test_round_end();
+  }
+}
+
+
+__attribute__((unused))
+static void
+ice40_sdram_test2(void)
+{
+  uint32_t ledstate;
+  uint16_t counter;
+  uint16_t v1, v2, v3, v4, v5;
+
+  ledstate = 0;
+  counter = 0;
+  for(;;) {
+    write_sdram(0x1238, (counter+3)&0xffff);
+    write_sdram(0x1232, counter&0xffff);
+    write_sdram(0x1236, (counter+2)&0xffff);
+    write_sdram(0x1234, (counter+1)&0xffff);
+    v1 = read_sdram(0x1232);
+    //delay(MCU_HZ/3/1000000*100);
+    v2 = read_sdram(0x1234);
+    v3 = read_sdram(0x1236);
+    v4 = read_sdram(0x1238);
+    v5 = read_sdram(0x1232);
+    serial_puts(CONSOLE, "Readback after write ");
+    serial_output_hex(CONSOLE, (counter&0xffff));
+    serial_puts(CONSOLE, ": ");
+    serial_output_hex(CONSOLE, v1);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v2);
+    serial_puts(CONSOLE, ": ");
+    serial_output_hex(CONSOLE, v3);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v4);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v5);
+    serial_puts(CONSOLE, "\r\n");
+
+    ++counter;
+    if ((ledstate = !ledstate))
+      led1_on();
+    else
+      led1_off();
+    if (counter & 2)
+      led2_on();
+    else
+      led2_off();
+    test_round_end();
+  }
+}
+
+
+__attribute__((unused))
+static void
+ice40_sdram_test3(void)
+{
+  uint32_t ledstate;
+  uint16_t counter;
+  uint16_t v1, v2, v3, v4, v5;
+
+  ledstate = 0;
+  counter = 0;
+  for(;;) {
+    write_fpga(PERIPH_REG_ADR_HIGH, 0x2222);
+    v1 = read_fpga(PERIPH_REG_ADR_HIGH);
+    write_fpga(PERIPH_REG_ADR_HIGH, 0x4444);
+    v2 = read_fpga(PERIPH_REG_ADR_HIGH);
+    write_fpga(PERIPH_REG_ADR_HIGH, 0x6666);
+    v3 = read_fpga(PERIPH_REG_ADR_HIGH);
+    write_fpga(PERIPH_REG_ADR_HIGH, 0x8888);
+    v4 = read_fpga(PERIPH_REG_ADR_HIGH);
+    write_fpga(PERIPH_REG_ADR_HIGH, 0xaaaa);
+    v5 = read_fpga(PERIPH_REG_ADR_HIGH);
+
+    serial_puts(CONSOLE, "FSMC interface readback: ");
+    serial_output_hex(CONSOLE, v1);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v2);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v3);
+    serial_puts(CONSOLE, ": ");
+    serial_output_hex(CONSOLE, v4);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v5);
+    serial_puts(CONSOLE, "\r\n");
+
+    ++counter;
+    if ((ledstate = !ledstate))
+      led1_on();
+    else
+      led1_off();
+    if (counter & 2)
+      led2_on();
+    else
+      led2_off();
+    test_round_end();
+  }
+}
+
+
+__attribute__((unused))
+static void
+ice40_sdram_test4(void)
+{
+  uint32_t i, j;
+  static const uint32_t fixadr = 0x00000000;
+  static const uint32_t SHIFT = 0;
+
+  for(;;) {
+    for (i = 0; i < 128; ++i) {
+      write_sdram(((i<<SHIFT)+fixadr)<<1, ((i|(i<<8)))&0xffff);
+      if (i & 1)
+        led1_off();
+      else
+        led1_on();
+    }
+    for (i = 0; i < 128; i += 8) {
+      serial_output_hex(CONSOLE, (((i+0)<<SHIFT)+fixadr) << 1);
+      serial_puts(CONSOLE, ":");
+      for (j = 0; j < 8; ++j) {
+        uint16_t v = read_sdram( (((i+j)<<SHIFT)+fixadr) << 1 );
+        serial_puts(CONSOLE, " ");
+        serial_output_hex(CONSOLE, v);
+        if (j & 1)
+          led2_off();
+        else
+          led2_on();
+      }
+      serial_puts(CONSOLE, "\r\n");
+    }
+    serial_puts(CONSOLE, "Cache hits: ");
+    print_uint32(CONSOLE, read_fpga(PERIPH_REG_CACHE_HITS));
+    serial_puts(CONSOLE, "  misses: ");
+    print_uint32(CONSOLE, read_fpga(PERIPH_REG_CACHE_MISSES));
+    serial_puts(CONSOLE, "\r\n");
+    write_fpga(PERIPH_REG_CACHE_HITS, 0);
+    write_fpga(PERIPH_REG_CACHE_MISSES, 0);
+    serial_puts(CONSOLE, "\r\n");
+
+    test_round_end();
+  }
+}
+
+
+__attribute__((unused))
+static void
+ice40_sdram_test5(void)
+{
+  uint32_t i, j;
+
+  for(;;) {
+    led1_on();
+    for (i = 0; i < 0x10000; ++i) {
+      write_sdram(i<<1, i&0xffff);
+    }
     led1_off();
     led2_on();
     j = 0;
@@ -629,84 +1717,297 @@ ice40_sdram_test5(void)
       if (v != (i&0xffff)) {
         ++j;
         if (j <= 10) {
-          serial_puts(USART1, "  ");
-          serial_output_hex(USART1, i);
-          serial_puts(USART1, "  ");
-          print_uint32(USART1, v);
-          serial_puts(USART1, " != ");
-          print_uint32(USART1, (i&0xffff));
-          serial_puts(USART1, "\r\n");
+          serial_puts(CONSOLE, "  ");
+          serial_output_hex(CONSOLE, i);
+          serial_puts(CONSOLE, "  ");
+          print_uint32(CONSOLE, v);
+          serial_puts(CONSOLE, " != ");
+          print_uint32(CONSOLE, (i&0xffff));
+          serial_puts(CONSOLE, "\r\n");
         }
       }
     }
     led2_off();
-    serial_puts(USART1, "Errors: ");
-    println_uint32(USART1, j);
+    serial_puts(CONSOLE, "Errors: ");
+    println_uint32(CONSOLE, j);
+
+    test_round_end();
+  }
+}
+
+
+__attribute__((unused))
+static void
+ice40_sdram_test6(void)
+{
+  uint32_t i;
+
+  i = 0;
+  for(;;) {
+    uint16_t v1, v2;
+
+    led1_on();
+    write_sdram(0, i&0xffff);
+    write_sdram(8, (~i)&0xffff);
+    v2 = read_sdram(8);
+    v1 = read_sdram(0);
+    serial_output_hex(CONSOLE, i);
+    serial_puts(CONSOLE, "  ");
+    serial_output_hex(CONSOLE, v1);
+    serial_puts(CONSOLE, " ");
+    serial_output_hex(CONSOLE, v2);
+    serial_puts(CONSOLE, "\r\n");
+    led1_off();
+
+    ++i;
+    test_round_end();
+  }
+}
+
+
+__attribute__((unused))
+static void
+ice40_sdram_test7(void)
+{
+  uint32_t i, j;
+
+  i = 0;
+  for(;;) {
+    uint16_t v1, v2;
+
+    led1_on();
+    for (j = 0; j < 24; ++j) {
+      write_sdram((1<<j)<<1, i&0xffff);
+      write_sdram(0, (~i)&0xffff);
+    }
+    for (j = 0; j < 24; ++j) {
+      v1 = read_sdram((1<<j)<<1);
+      v2 = read_sdram(0);
+      print_uint32(CONSOLE, j);
+      serial_puts(CONSOLE, "  ");
+      serial_output_hex(CONSOLE, v1);
+      serial_puts(CONSOLE, "  ");
+      serial_output_hex(CONSOLE, v2);
+      serial_puts(CONSOLE, "\r\n");
+    }
+    led1_off();
+
+    ++i;
+    test_round_end();
+  }
+}
+
+
+/* Enable the DWT cycle counter, used for timing. */
+static void
+cyccnt_enable(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+
+__attribute__((unused))
+static void
+print_words_per_sec(USART_TypeDef* usart, uint32_t words, uint32_t cycles)
+{
+  print_uint32(usart, (uint32_t)((float)words*(float)MCU_HZ/(float)cycles));
+}
+
+
+/*
+  Latency histograms. Each timed operation is recorded with its duration in
+  CPU cycles (DWT CYCCNT, see cyccnt_enable()) into log2 buckets: bucket n
+  counts durations in [2**n, 2**(n+1)). Totals give the throughput.
+*/
+#define LAT_BUCKETS 32
+
+enum {
+  LAT_READ, LAT_WRITE_POST, LAT_WRITE_DONE, LAT_BURST_READ, LAT_BURST_WRITE,
+  LAT_DMA_READ, LAT_DMA_WRITE, LAT_NUM
+};
+
+struct lat_hist {
+  const char *name;
+  uint32_t count;
+  uint32_t min, max;
+  uint64_t cycles;
+  uint64_t words;
+  uint32_t bucket[LAT_BUCKETS];
+};
+
+/* As lat_reset() leaves them. */
+#define LAT_HIST(n) { .name = n, .min = 0xffffffff }
+
+static struct lat_hist lat_hists[LAT_NUM] = {
+  LAT_HIST("read"), LAT_HIST("write_post"), LAT_HIST("write_done"),
+  LAT_HIST("burst_read"), LAT_HIST("burst_write"),
+  LAT_HIST("dma_read"), LAT_HIST("dma_write")
+};
+
+
+__attribute__((unused))
+static void
+lat_reset(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < LAT_NUM; ++i)
+  {
+    struct lat_hist *h = &lat_hists[i];
+    h->count = 0;
+    h->min = 0xffffffff;
+    h->max = 0;
+    h->cycles = 0;
+    h->words = 0;
+    memset(h->bucket, 0, sizeof(h->bucket));
+  }
+}
+
+
+static void
+lat_record(uint32_t which, uint32_t cycles, uint32_t words)
+{
+  struct lat_hist *h = &lat_hists[which];
+
+  ++h->count;
+  if (cycles < h->min)
+    h->min = cycles;
+  if (cycles > h->max)
+    h->max = cycles;
+  h->cycles += cycles;
+  h->words += words;
+  ++h->bucket[31 - __builtin_clz(cycles | 1)];
+}
+
+
+/*
+  Dump the histograms that have entries, one line each:
+    lat <name> <count> <min> <max> <avg> <words/s> <b0>,<b1>,...
+  with buckets up to the highest non-empty one.
+*/
+__attribute__((unused))
+static void
+lat_dump(USART_TypeDef *usart)
+{
+  uint32_t i, j, last;
+
+  for (i = 0; i < LAT_NUM; ++i)
+  {
+    struct lat_hist *h = &lat_hists[i];
+    if (h->count == 0)
+      continue;
+    serial_puts(usart, "lat ");
+    serial_puts(usart, h->name);
+    serial_puts(usart, " ");
+    print_uint32(usart, h->count);
+    serial_puts(usart, " ");
+    print_uint32(usart, h->min);
+    serial_puts(usart, " ");
+    print_uint32(usart, h->max);
+    serial_puts(usart, " ");
+    print_uint32(usart, (uint32_t)(h->cycles / h->count));
+    serial_puts(usart, " ");
+    print_uint32(usart, (uint32_t)((float)h->words*(float)MCU_HZ/
+                                   (float)h->cycles));
+    serial_puts(usart, " ");
+    last = 0;
+    for (j = 0; j < LAT_BUCKETS; ++j)
+      if (h->bucket[j])
+        last = j;
+    for (j = 0; j <= last; ++j)
+    {
+      if (j > 0)
+        serial_puts(usart, ",");
+      print_uint32(usart, h->bucket[j]);
+    }
+    serial_puts(usart, "\r\n");
+  }
+}
+
 
-    delay(MCU_HZ/3);
-  }
+/* Timed versions of the SDRAM access functions, recording into lat_hists. */
+__attribute__((unused))
+static uint16_t
+timed_read_sdram(uint32_t addr)
+{
+  uint32_t start = cycle_count();
+  uint16_t v = read_sdram(addr);
+  lat_record(LAT_READ, cycle_count() - start, 1);
+  return v;
 }
 
 
+/*
+  Writes are posted into the FPGA write queue and complete later. COUNT
+  writes of VALS[i] to ADDRS[i] are done back to back, each one recorded
+  until write_sdram() returns (write_post), which includes the stalls while
+  the queue is full. The whole run is recorded once more, until all of it
+  has reached the SDRAM, waited for with sdram_flush() (write_done).
+*/
 __attribute__((unused))
 static void
-ice40_sdram_test6(void)
+timed_write_sdram(const uint32_t *addrs, const uint16_t *vals,
+                  uint32_t count)
 {
-  uint32_t i;
+  uint32_t start = cycle_count();
+  uint32_t t0, t1, i;
 
-  i = 0;
-  for(;;) {
-    uint16_t v1, v2;
+  t0 = start;
+  for (i = 0; i < count; ++i)
+  {
+    write_sdram(addrs[i], vals[i]);
+    t1 = cycle_count();
+    lat_record(LAT_WRITE_POST, t1 - t0, 1);
+    t0 = t1;
+  }
+  sdram_flush();
+  lat_record(LAT_WRITE_DONE, cycle_count() - start, count);
+}
 
-    led1_on();
-    write_sdram(0, i&0xffff);
-    write_sdram(8, (~i)&0xffff);
-    v2 = read_sdram(8);
-    v1 = read_sdram(0);
-    serial_output_hex(USART1, i);
-    serial_puts(USART1, "  ");
-    serial_output_hex(USART1, v1);
-    serial_puts(USART1, " ");
-    serial_output_hex(USART1, v2);
-    serial_puts(USART1, "\r\n");
-    led1_off();
 
-    ++i;
-    delay(MCU_HZ/3);
-  }
+__attribute__((unused))
+static void
+timed_burst_read(uint32_t addr, uint16_t *buf, uint32_t count)
+{
+  uint32_t start = cycle_count();
+  sdram_burst_read(addr, buf, count);
+  lat_record(LAT_BURST_READ, cycle_count() - start, count);
 }
 
 
 __attribute__((unused))
 static void
-ice40_sdram_test7(void)
+timed_burst_write(uint32_t addr, const uint16_t *buf, uint32_t count)
 {
-  uint32_t i, j;
+  uint32_t start = cycle_count();
+  sdram_burst_write(addr, buf, count);
+  lat_record(LAT_BURST_WRITE, cycle_count() - start, count);
+}
 
-  i = 0;
-  for(;;) {
-    uint16_t v1, v2;
 
-    led1_on();
-    for (j = 0; j < 24; ++j) {
-      write_sdram((1<<j)<<1, i&0xffff);
-      write_sdram(0, (~i)&0xffff);
-    }
-    for (j = 0; j < 24; ++j) {
-      v1 = read_sdram((1<<j)<<1);
-      v2 = read_sdram(0);
-      print_uint32(USART1, j);
-      serial_puts(USART1, "  ");
-      serial_output_hex(USART1, v1);
-      serial_puts(USART1, "  ");
-      serial_output_hex(USART1, v2);
-      serial_puts(USART1, "\r\n");
-    }
-    led1_off();
+/* DMA transfers, timed until complete (including the posted writes). */
+__attribute__((unused))
+static void
+timed_dma_read(uint16_t *dst, uint32_t sdram_addr, uint32_t count)
+{
+  uint32_t start = cycle_count();
+  sdram_dma_read(dst, sdram_addr, count, NULL, NULL);
+  sdram_dma_wait();
+  lat_record(LAT_DMA_READ, cycle_count() - start, count);
+}
 
-    ++i;
-    delay(MCU_HZ/3);
-  }
+
+__attribute__((unused))
+static void
+timed_dma_write(uint32_t sdram_addr, const uint16_t *src, uint32_t count)
+{
+  uint32_t start = cycle_count();
+  sdram_dma_write(sdram_addr, src, count, NULL, NULL);
+  sdram_dma_wait();
+  sdram_flush();
+  lat_record(LAT_DMA_WRITE, cycle_count() - start, count);
 }
 
 
@@ -718,52 +2019,64 @@ __attribute__((unused))
 static void
 ice40_sdram_test8(void)
 {
-  static const uint32_t TOP = (1<<24);
+  static const uint32_t TOP = SDRAM_TEST_WORDS;
   uint32_t i, j;
   uint32_t errors, first_error_adr, first_error_val, first_error_expected;
+  uint32_t start, write_cycles, read_cycles;
 
+  cyccnt_enable();
   i = 0;
   for(;;) {
     led1_on();
+    perf_clear();
+    start = cycle_count();
+    sdram_stream_start(0, 1);
     for (j = 0; j < TOP; ++j) {
-      //uint32_t byte_adr = ( ((j&0xffffff00)<<1) | (j&0xff) )<<1;
-      uint32_t byte_adr = j<<1;
       uint16_t v = (i+j+(j>>8)+(j>>16)+(j>>24)) & 0xffff;
-      write_sdram(byte_adr, v);
+      sdram_stream_put(v);
     }
+    sdram_stream_stop();
+    write_cycles = cycle_count() - start;
     errors = 0;
     first_error_adr = 0;
     first_error_val = 0;
     first_error_expected = 0;
+    start = cycle_count();
+    sdram_stream_start(0, 0);
     for (j = 0; j < TOP; ++j) {
-      //uint32_t byte_adr = ( ((j&0xffffff00)<<1) | (j&0xff) )<<1;
-      uint32_t byte_adr = j<<1;
       uint16_t expected = (i+j+(j>>8)+(j>>16)+(j>>24)) & 0xffff;
-      uint16_t v = read_sdram(byte_adr);
+      uint16_t v = sdram_stream_get();
       if (v != expected) {
         if (errors == 0) {
-          first_error_adr = byte_adr>>1;
+          first_error_adr = j;
           first_error_val = v;
           first_error_expected = expected;
         }
         ++errors;
       }
     }
-
-    serial_output_hex(USART1, i);
-    serial_puts(USART1, "  Errors: ");
-    print_uint32(USART1, errors);
-    serial_puts(USART1, "  adr=");
-    serial_output_hex(USART1, first_error_adr);
-    serial_puts(USART1, "  val=");
-    serial_output_hex(USART1, first_error_val);
-    serial_puts(USART1, "  expected=");
-    serial_output_hex(USART1, first_error_expected);
-    serial_puts(USART1, "\r\n");
+    read_cycles = cycle_count() - start;
+    sdram_stream_stop();
+
+    serial_output_hex(CONSOLE, i);
+    serial_puts(CONSOLE, "  Errors: ");
+    print_uint32(CONSOLE, errors);
+    serial_puts(CONSOLE, "  adr=");
+    serial_output_hex(CONSOLE, first_error_adr);
+    serial_puts(CONSOLE, "  val=");
+    serial_output_hex(CONSOLE, first_error_val);
+    serial_puts(CONSOLE, "  expected=");
+    serial_output_hex(CONSOLE, first_error_expected);
+    serial_puts(CONSOLE, "  write words/s=");
+    print_words_per_sec(CONSOLE, TOP, write_cycles);
+    serial_puts(CONSOLE, "  read words/s=");
+    print_words_per_sec(CONSOLE, TOP, read_cycles);
+    serial_puts(CONSOLE, "\r\n");
+    perf_dump(CONSOLE);
     ++i;
     led1_off();
 
-    delay(MCU_HZ/3);
+    test_round_end();
   }
 }
 
@@ -782,16 +2095,604 @@ ice40_sdram_test9(void)
     v2 = read_sdram(512+a8_row_word);
 
 /*
-    serial_output_hex(USART1, v1);
-    serial_puts(USART1, "  ");
-    serial_output_hex(USART1, v2);
-    serial_puts(USART1, "\r\n");
+    serial_output_hex(CONSOLE, v1);
+    serial_puts(CONSOLE, "  ");
+    serial_output_hex(CONSOLE, v2);
+    serial_puts(CONSOLE, "\r\n");
+*/
+    test_round_end();
+  }
+}
+
+
+/*
+  Test of DMA transfers with double buffering. The callbacks generate the
+  next block of the test pattern while writing, and check the previous block
+  while reading, so the CPU works in parallel with the transfer.
+*/
+#define TEST10_BUF_WORDS 1024
+
+struct test10_state {
+  uint32_t seed;
+  uint32_t pos;           /* Word index of the next block in the callback */
+  uint32_t errors;
+};
+
+static uint16_t
+test10_pattern(uint32_t seed, uint32_t j)
+{
+  return (seed+j+(j>>8)+(j>>16)) & 0xffff;
+}
+
+static void
+test10_fill(struct test10_state *st, uint16_t *buf, uint32_t words)
+{
+  uint32_t j;
+
+  for (j = 0; j < words; ++j)
+    buf[j] = test10_pattern(st->seed, st->pos + j);
+  st->pos += words;
+}
+
+static void
+test10_write_cb(void *arg, uint16_t *buf, uint32_t words)
+{
+  /* Refill the buffer just written with the block after the next one. */
+  test10_fill((struct test10_state *)arg, buf, words);
+}
+
+static void
+test10_read_cb(void *arg, uint16_t *buf, uint32_t words)
+{
+  struct test10_state *st = (struct test10_state *)arg;
+  uint32_t j;
+
+  for (j = 0; j < words; ++j)
+    if (buf[j] != test10_pattern(st->seed, st->pos + j))
+      ++st->errors;
+  st->pos += words;
+}
+
+__attribute__((unused))
+static void
+ice40_sdram_test10(void)
+{
+  static const uint32_t TOP = SDRAM_TEST_WORDS;
+  static uint16_t buf0[TEST10_BUF_WORDS], buf1[TEST10_BUF_WORDS];
+  struct test10_state st;
+  uint32_t start, write_cycles, read_cycles;
+
+  cyccnt_enable();
+  st.seed = 0;
+  for (;;) {
+    led1_on();
+    st.pos = 0;
+    test10_fill(&st, buf0, TEST10_BUF_WORDS);
+    test10_fill(&st, buf1, TEST10_BUF_WORDS);
+    start = cycle_count();
+    sdram_dma_write_double(0, TOP, buf0, buf1, TEST10_BUF_WORDS,
+                           test10_write_cb, &st);
+    sdram_dma_wait();
+    sdram_flush();
+    write_cycles = cycle_count() - start;
+
+    st.pos = 0;
+    st.errors = 0;
+    start = cycle_count();
+    sdram_dma_read_double(0, TOP, buf0, buf1, TEST10_BUF_WORDS,
+                          test10_read_cb, &st);
+    sdram_dma_wait();
+    read_cycles = cycle_count() - start;
+
+    serial_output_hex(CONSOLE, st.seed);
+    serial_puts(CONSOLE, "  Errors: ");
+    print_uint32(CONSOLE, st.errors);
+    serial_puts(CONSOLE, "  write words/s=");
+    print_words_per_sec(CONSOLE, TOP, write_cycles);
+    serial_puts(CONSOLE, "  read words/s=");
+    print_words_per_sec(CONSOLE, TOP, read_cycles);
+    serial_puts(CONSOLE, "\r\n");
+    ++st.seed;
+    led1_off();
+
+    test_round_end();
+  }
+}
+
+
+/*
+  Latency test: random single-word writes and reads, bursts and DMA
+  transfers, dumping the latency histograms after each round. The writes
+  go in runs of TEST11_RUN, more than the FPGA write queue holds.
+*/
+#define TEST11_RUN 1000
+
+__attribute__((unused))
+static void
+ice40_sdram_test11(void)
+{
+  static uint16_t buf[TEST10_BUF_WORDS];
+  static uint32_t addrs[TEST11_RUN];
+  static uint16_t vals[TEST11_RUN];
+  uint32_t i, j, k, x;
+
+  cyccnt_enable();
+  x = 0x12345678;
+  i = 0;
+  for (;;) {
+    led1_on();
+    lat_reset();
+    for (j = 0; j < 10000; j += TEST11_RUN) {
+      /* xorshift32 for the addresses. */
+      for (k = 0; k < TEST11_RUN; ++k) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        addrs[k] = x & 0x1fffffe;
+        vals[k] = x >> 16;
+      }
+      timed_write_sdram(addrs, vals, TEST11_RUN);
+      for (k = 0; k < TEST11_RUN; ++k) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        timed_read_sdram(x & 0x1fffffe);
+      }
+    }
+    for (j = 0; j < 1000; ++j) {
+      timed_burst_write(j*BURST_MAX_WORDS*2, buf, BURST_MAX_WORDS);
+      timed_burst_read(j*BURST_MAX_WORDS*2, buf, BURST_MAX_WORDS);
+    }
+    for (j = 0; j < 100; ++j) {
+      timed_dma_write(j*TEST10_BUF_WORDS*2, buf, TEST10_BUF_WORDS);
+      timed_dma_read(buf, j*TEST10_BUF_WORDS*2, TEST10_BUF_WORDS);
+    }
+    serial_puts(CONSOLE, "round ");
+    print_uint32(CONSOLE, i);
+    serial_puts(CONSOLE, "\r\n");
+    lat_dump(CONSOLE);
+    ++i;
+    led1_off();
+
+    test_round_end();
+  }
+}
+
+
+/*
+  Byte write test: fill a block with words, overwrite every other byte with
+  write_sdram_byte(), and check that the other byte of each word is intact.
+*/
+__attribute__((unused))
+static void
+ice40_sdram_test12(void)
+{
+  static const uint32_t TOP = 4096;
+  uint32_t i, a, errs;
+  uint16_t v, expect;
+
+  i = 0;
+  for (;;) {
+    led1_on();
+    errs = 0;
+    for (a = 0; a < TOP; ++a)
+      write_sdram(a*2, (uint16_t)(a*0x9e37 + i));
+    for (a = 0; a < TOP; ++a)
+      write_sdram_byte(a*2 + ((a + i) & 1), (uint8_t)(a ^ 0x5a));
+    for (a = 0; a < TOP; ++a) {
+      expect = (uint16_t)(a*0x9e37 + i);
+      if ((a + i) & 1)
+        expect = (expect & 0x00ff) | ((uint16_t)(uint8_t)(a ^ 0x5a) << 8);
+      else
+        expect = (expect & 0xff00) | (uint8_t)(a ^ 0x5a);
+      v = read_sdram(a*2);
+      if (v != expect)
+        ++errs;
+    }
+    serial_puts(CONSOLE, "bytes round ");
+    print_uint32(CONSOLE, i);
+    serial_puts(CONSOLE, " errors ");
+    print_uint32(CONSOLE, errs);
+    serial_puts(CONSOLE, "\r\n");
+    ++i;
+    led1_off();
+
+    test_round_end();
+  }
+}
+
+
+/*
+  32-bit access test: write a block with sdram_write32(), check it both
+  with sdram_read32() and word by word with read_sdram(), and time the
+  32-bit path against pairs of 16-bit single-word accesses.
 */
-    delay(MCU_HZ/3);
+__attribute__((unused))
+static void
+ice40_sdram_test13(void)
+{
+  static const uint32_t TOP = 4096;
+  uint32_t i, a, errs, v, t32, t16;
+
+  cyccnt_enable();
+  i = 0;
+  for (;;) {
+    led1_on();
+    errs = 0;
+    t32 = cycle_count();
+    for (a = 0; a < TOP; ++a)
+      sdram_write32(a*4, a*0x9e3779b9 + i);
+    for (a = 0; a < TOP; ++a) {
+      if (sdram_read32(a*4) != a*0x9e3779b9 + i)
+        ++errs;
+    }
+    t32 = cycle_count() - t32;
+    for (a = 0; a < TOP; ++a) {
+      v = a*0x9e3779b9 + i;
+      if (read_sdram(a*4) != (uint16_t)v ||
+          read_sdram(a*4 + 2) != (uint16_t)(v >> 16))
+        ++errs;
+    }
+    t16 = cycle_count();
+    for (a = 0; a < TOP; ++a) {
+      write_sdram(a*4, (uint16_t)a);
+      write_sdram(a*4 + 2, (uint16_t)i);
+    }
+    for (a = 0; a < TOP; ++a) {
+      if (read_sdram(a*4) != (uint16_t)a || read_sdram(a*4 + 2) != (uint16_t)i)
+        ++errs;
+    }
+    t16 = cycle_count() - t16;
+    serial_puts(CONSOLE, "32-bit round ");
+    print_uint32(CONSOLE, i);
+    serial_puts(CONSOLE, " errors ");
+    print_uint32(CONSOLE, errs);
+    serial_puts(CONSOLE, " cycles32 ");
+    print_uint32(CONSOLE, t32);
+    serial_puts(CONSOLE, " cycles16 ");
+    print_uint32(CONSOLE, t16);
+    serial_puts(CONSOLE, "\r\n");
+    ++i;
+    led1_off();
+
+    test_round_end();
+  }
+}
+
+
+/*
+  Soak test with the FPGA self-test: run each pattern over all of the SDRAM
+  with a new seed each round, and print the results and the test rate.
+*/
+__attribute__((unused))
+static void
+ice40_sdram_test14(void)
+{
+  static const uint32_t TOP = SDRAM_TEST_WORDS;
+  static const char * const names[BIST_NUM_PATTERNS] = {
+    "addr", "lfsr", "walk", "march"
+  };
+  uint32_t i, p, j, errors, nfail, start, cycles;
+  uint32_t fail_addrs[BIST_MAX_FAILS];
+  uint16_t fail_mask;
+
+  cyccnt_enable();
+  i = 0;
+  for (;;) {
+    led1_on();
+    for (p = 0; p < BIST_NUM_PATTERNS; ++p) {
+      start = cycle_count();
+      sdram_bist_start(0, TOP, p, (uint8_t)i);
+      errors = sdram_bist_result(&fail_mask, fail_addrs, &nfail);
+      cycles = cycle_count() - start;
+
+      serial_output_hex(CONSOLE, i);
+      serial_puts(CONSOLE, " bist ");
+      serial_puts(CONSOLE, names[p]);
+      serial_puts(CONSOLE, "  Errors: ");
+      print_uint32(CONSOLE, errors);
+      serial_puts(CONSOLE, "  mask=");
+      serial_output_hex(CONSOLE, fail_mask);
+      for (j = 0; j < nfail; ++j) {
+        serial_puts(CONSOLE, " ");
+        serial_output_hex(CONSOLE, fail_addrs[j]);
+      }
+      serial_puts(CONSOLE, "  words/s=");
+      print_words_per_sec(CONSOLE, TOP, cycles);
+      serial_puts(CONSOLE, "\r\n");
+    }
+    ++i;
+    led1_off();
+
+    test_round_end();
+  }
+}
+
+
+/*
+  Copy engine test: fill a block with a few queued fills, copy it to a
+  second block, and check the copy with streaming reads.
+*/
+__attribute__((unused))
+static void
+ice40_sdram_test15(void)
+{
+  static const uint32_t TOP = (SDRAM_TEST_WORDS >> 4);
+  static const uint32_t PARTS = 8;
+  uint32_t i, k, j, errors, start, fill_cycles, copy_cycles;
+
+  cyccnt_enable();
+  i = 0;
+  for (;;) {
+    led1_on();
+    start = cycle_count();
+    for (k = 0; k < PARTS; ++k)
+      sdram_fill(k*(TOP/PARTS)*2, (uint16_t)(i*PARTS + k), TOP/PARTS, 0);
+    sdram_copy_wait();
+    fill_cycles = cycle_count() - start;
+    start = cycle_count();
+    sdram_copy(TOP*2, 0, TOP, 1);
+    sdram_copy_wait();
+    copy_cycles = cycle_count() - start;
+
+    errors = 0;
+    sdram_stream_start(TOP*2, 0);
+    for (k = 0; k < PARTS; ++k) {
+      for (j = 0; j < TOP/PARTS; ++j) {
+        if (sdram_stream_get() != (uint16_t)(i*PARTS + k))
+          ++errors;
+      }
+    }
+    sdram_stream_stop();
+
+    serial_output_hex(CONSOLE, i);
+    serial_puts(CONSOLE, " copy  Errors: ");
+    print_uint32(CONSOLE, errors);
+    serial_puts(CONSOLE, "  fill words/s=");
+    print_words_per_sec(CONSOLE, TOP, fill_cycles);
+    serial_puts(CONSOLE, "  copy words/s=");
+    print_words_per_sec(CONSOLE, TOP, copy_cycles);
+    serial_puts(CONSOLE, "\r\n");
+    ++i;
+    led1_off();
+
+    test_round_end();
+  }
+}
+
+
+/*
+  Atomic operation test: bump a set of 32-bit counters in SDRAM with
+  sdram_fetch_add32() and with read_sdram()/write_sdram(), check all the
+  operations against a software model, and compare the time per update.
+*/
+__attribute__((unused))
+static void
+ice40_sdram_test16(void)
+{
+  static const uint32_t NCOUNT = 64;
+  static const uint32_t ROUNDS = 1000;
+  static const uint32_t BASE = 0x100000;
+  uint32_t i, j, k, a, v, old, errors, start, at_cycles, rw_cycles;
+
+  cyccnt_enable();
+  i = 0;
+  for (;;) {
+    led1_on();
+    errors = 0;
+    for (k = 0; k < NCOUNT; ++k)
+      sdram_atomic(BASE + k*4, AT_OP_SWAP | AT_OP_32, 0, 0);
+
+    start = cycle_count();
+    for (j = 0; j < ROUNDS; ++j)
+      for (k = 0; k < NCOUNT; ++k)
+        sdram_fetch_add32(BASE + k*4, k + 1);
+    at_cycles = cycle_count() - start;
+
+    start = cycle_count();
+    for (j = 0; j < ROUNDS; ++j)
+      for (k = 0; k < NCOUNT; ++k) {
+        a = BASE + (NCOUNT + k)*4;
+        v = read_sdram(a) + k + 1;
+        write_sdram(a, (uint16_t)v);
+      }
+    rw_cycles = cycle_count() - start;
+
+    for (k = 0; k < NCOUNT; ++k) {
+      a = BASE + k*4;
+      v = ROUNDS*(k + 1);
+      if (sdram_atomic(a, AT_OP_XOR | AT_OP_32, 0x5a5a0000, 0) != v)
+        ++errors;
+      v ^= 0x5a5a0000;
+      if (sdram_atomic(a, AT_OP_AND | AT_OP_32, 0xff00ffff, 0) != v)
+        ++errors;
+      v &= 0xff00ffff;
+      if (sdram_atomic(a, AT_OP_OR | AT_OP_32, 0x00010000, 0) != v)
+        ++errors;
+      v |= 0x00010000;
+      if (sdram_cas32(a, v + 1, i) || !sdram_cas32(a, v, i))
+        ++errors;
+      old = sdram_atomic(a, AT_OP_ADD, 0xffff, 0);
+      if (old != (i & 0xffff) || read_sdram(a) != ((i - 1) & 0xffff) ||
+          read_sdram(a + 2) != (i >> 16))
+        ++errors;
+    }
+
+    serial_output_hex(CONSOLE, i);
+    serial_puts(CONSOLE, " atomic  Errors: ");
+    print_uint32(CONSOLE, errors);
+    serial_puts(CONSOLE, "  cycles/op atomic=");
+    print_uint32(CONSOLE, at_cycles/(ROUNDS*NCOUNT));
+    serial_puts(CONSOLE, " read+write=");
+    print_uint32(CONSOLE, rw_cycles/(ROUNDS*NCOUNT));
+    serial_puts(CONSOLE, "\r\n");
+    ++i;
+    led1_off();
+
+    test_round_end();
+  }
+}
+
+
+/*
+  Near-memory CRC test: write pseudo-random data with streaming writes,
+  keeping its CRC, then compare the FPGA's CRC of it against that, and
+  against the CRC of streaming reads of it. One changed word must make
+  sdram_crc_check() fail.
+*/
+__attribute__((unused))
+static void
+ice40_sdram_test17(void)
+{
+  static const uint32_t TOP = (SDRAM_TEST_WORDS >> 4);
+  static const uint32_t BLOCK = 1024;
+  static uint16_t buf[1024];
+  uint32_t i, j, k, v, errors, crc, sw_crc, fpga_crc;
+  uint32_t start, fpga_cycles, sw_cycles;
+
+  cyccnt_enable();
+  i = 0;
+  for (;;) {
+    led1_on();
+    errors = 0;
+    crc = 0;
+    v = i*0x9e3779b9 + 1;
+    sdram_stream_start(0, 1);
+    for (k = 0; k < TOP/BLOCK; ++k) {
+      for (j = 0; j < BLOCK; ++j) {
+        v = v*1103515245 + 12345;
+        buf[j] = (uint16_t)(v >> 16);
+        sdram_stream_put(buf[j]);
+      }
+      crc = crc32_words(crc, buf, BLOCK);
+    }
+    sdram_stream_stop();
+
+    start = cycle_count();
+    sdram_crc_start(0, TOP);
+    fpga_crc = sdram_crc_result(NULL);
+    fpga_cycles = cycle_count() - start;
+    if (fpga_crc != crc)
+      ++errors;
+
+    start = cycle_count();
+    sw_crc = 0;
+    sdram_stream_start(0, 0);
+    for (k = 0; k < TOP/BLOCK; ++k) {
+      for (j = 0; j < BLOCK; ++j)
+        buf[j] = sdram_stream_get();
+      sw_crc = crc32_words(sw_crc, buf, BLOCK);
+    }
+    sdram_stream_stop();
+    sw_cycles = cycle_count() - start;
+    if (sw_crc != crc)
+      ++errors;
+
+    /* buf now holds the last block. */
+    if (!sdram_crc_check((TOP - BLOCK)*2, buf, BLOCK))
+      ++errors;
+    write_sdram((TOP - BLOCK/2)*2, buf[BLOCK/2] ^ 0x0100);
+    if (sdram_crc_check((TOP - BLOCK)*2, buf, BLOCK))
+      ++errors;
+
+    serial_output_hex(CONSOLE, i);
+    serial_puts(CONSOLE, " crc  Errors: ");
+    print_uint32(CONSOLE, errors);
+    serial_puts(CONSOLE, "  crc=");
+    serial_output_hex(CONSOLE, fpga_crc);
+    serial_puts(CONSOLE, "  words/s fpga=");
+    print_words_per_sec(CONSOLE, TOP, fpga_cycles);
+    serial_puts(CONSOLE, " stream=");
+    print_words_per_sec(CONSOLE, TOP, sw_cycles);
+    serial_puts(CONSOLE, "\r\n");
+    ++i;
+    led1_off();
+
+    test_round_end();
+  }
+}
+
+
+/*
+  Near-memory scan test: write pseudo-random samples with one sentinel
+  word, then run each kind of scan in the FPGA and with sdram_scan_sw(),
+  and compare results and speed.
+*/
+__attribute__((unused))
+static void
+ice40_sdram_test18(void)
+{
+  static const uint32_t TOP = (SDRAM_TEST_WORDS >> 4);
+  static const uint16_t SENTINEL = 0xdead;
+  static const struct {
+    uint32_t op;
+    uint16_t key, mask;
+    uint32_t stride;
+  } scans[] = {
+    { SCAN_OP_FIND, 0xdead, 0xffff, 1 },
+    { SCAN_OP_COUNT, 0x0000, 0x000f, 1 },
+    { SCAN_OP_MIN | SCAN_OP_SIGNED, 0, 0xffff, 1 },
+    { SCAN_OP_MAX, 0, 0xffff, 3 },
+    { SCAN_OP_SUM | SCAN_OP_SIGNED, 0, 0xffff, 1 },
+    { SCAN_OP_SUM, 0, 0x00ff, 4 }
+  };
+  uint32_t i, j, k, v, pos, errors, res, idx, sw_res, sw_idx;
+  uint32_t start, fpga_cycles, sw_cycles;
+  uint16_t w;
+
+  cyccnt_enable();
+  i = 0;
+  for (;;) {
+    led1_on();
+    errors = 0;
+    pos = (i*7919 + 1000) % TOP;
+    v = i*0x9e3779b9 + 1;
+    sdram_stream_start(0, 1);
+    for (j = 0; j < TOP; ++j) {
+      v = v*1103515245 + 12345;
+      w = (uint16_t)(v >> 16);
+      if (j == pos)
+        w = SENTINEL;
+      else if (w == SENTINEL)
+        w = 0;
+      sdram_stream_put(w);
+    }
+    sdram_stream_stop();
+
+    fpga_cycles = 0;
+    sw_cycles = 0;
+    for (k = 0; k < sizeof(scans)/sizeof(scans[0]); ++k) {
+      start = cycle_count();
+      res = sdram_scan(0, TOP, scans[k].op, scans[k].key, scans[k].mask,
+                       scans[k].stride, &idx);
+      fpga_cycles += cycle_count() - start;
+      start = cycle_count();
+      sw_res = sdram_scan_sw(0, TOP, scans[k].op, scans[k].key,
+                             scans[k].mask, scans[k].stride, &sw_idx);
+      sw_cycles += cycle_count() - start;
+      if (res != sw_res || idx != sw_idx)
+        ++errors;
+      if (k == 0 && (res != SENTINEL || idx != pos))
+        ++errors;
+    }
+
+    serial_output_hex(CONSOLE, i);
+    serial_puts(CONSOLE, " scan  Errors: ");
+    print_uint32(CONSOLE, errors);
+    serial_puts(CONSOLE, "  words/s fpga=");
+    print_words_per_sec(CONSOLE, k*TOP, fpga_cycles);
+    serial_puts(CONSOLE, " sw=");
+    print_words_per_sec(CONSOLE, k*TOP, sw_cycles);
+    serial_puts(CONSOLE, "\r\n");
+    ++i;
+    led1_off();
+
+    test_round_end();
   }
 }
 
 
+#ifndef HOST_BUILD
 static void
 fsmc_manual_init(void)
 {
@@ -806,7 +2707,7 @@ fsmc_manual_init(void)
   RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOG, ENABLE);
 
   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_0|GPIO_Pin_1|GPIO_Pin_4|GPIO_Pin_5|
-    GPIO_Pin_7|GPIO_Pin_8|GPIO_Pin_9|GPIO_Pin_10|GPIO_Pin_11|
+    GPIO_Pin_6|GPIO_Pin_7|GPIO_Pin_8|GPIO_Pin_9|GPIO_Pin_10|GPIO_Pin_11|
     GPIO_Pin_12|GPIO_Pin_13|GPIO_Pin_14|GPIO_Pin_15;
   GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_100MHz;
@@ -817,6 +2718,7 @@ fsmc_manual_init(void)
   GPIO_PinAFConfig(GPIOD, GPIO_PinSource1, GPIO_AF_FSMC);
   GPIO_PinAFConfig(GPIOD, GPIO_PinSource4, GPIO_AF_FSMC);
   GPIO_PinAFConfig(GPIOD, GPIO_PinSource5, GPIO_AF_FSMC);
+  GPIO_PinAFConfig(GPIOD, GPIO_PinSource6, GPIO_AF_FSMC);   /* NWAIT */
   GPIO_PinAFConfig(GPIOD, GPIO_PinSource7, GPIO_AF_FSMC);
   GPIO_PinAFConfig(GPIOD, GPIO_PinSource8, GPIO_AF_FSMC);
   GPIO_PinAFConfig(GPIOD, GPIO_PinSource9, GPIO_AF_FSMC);
@@ -826,6 +2728,12 @@ fsmc_manual_init(void)
   GPIO_PinAFConfig(GPIOD, GPIO_PinSource13, GPIO_AF_FSMC);
   GPIO_PinAFConfig(GPIOD, GPIO_PinSource14, GPIO_AF_FSMC);
   GPIO_PinAFConfig(GPIOD, GPIO_PinSource15, GPIO_AF_FSMC);
+#ifdef FSMC_SYNC
+  /* FSMC_CLK, wired to sdram_gpio3 on the FPGA. */
+  GPIO_InitStructure.GPIO_Pin = GPIO_Pin_3;
+  GPIO_Init(GPIOD, &GPIO_InitStructure);
+  GPIO_PinAFConfig(GPIOD, GPIO_PinSource3, GPIO_AF_FSMC);
+#endif
 
   GPIO_InitStructure.GPIO_Pin = GPIO_Pin_0|GPIO_Pin_1|GPIO_Pin_3|GPIO_Pin_4|
     GPIO_Pin_7|GPIO_Pin_8|GPIO_Pin_9|GPIO_Pin_10|GPIO_Pin_11|
@@ -892,7 +2800,11 @@ fsmc_manual_init(void)
   fsmc_init.FSMC_MemoryType = FSMC_MemoryType_SRAM;
   fsmc_init.FSMC_MemoryDataWidth = FSMC_MemoryDataWidth_16b;
   fsmc_init.FSMC_BurstAccessMode = FSMC_BurstAccessMode_Disable;
-  fsmc_init.FSMC_AsynchronousWait = FSMC_AsynchronousWait_Disable;
+  /*
+    The FPGA asserts NWAIT from the start of each access until it is done,
+    so data setup times need only cover the NWAIT detection by the FSMC.
+  */
+  fsmc_init.FSMC_AsynchronousWait = FSMC_AsynchronousWait_Enable;
   fsmc_init.FSMC_WaitSignalPolarity = FSMC_WaitSignalPolarity_Low;
   fsmc_init.FSMC_WrapMode = FSMC_WrapMode_Disable;
   fsmc_init.FSMC_WaitSignalActive = FSMC_WaitSignalActive_BeforeWaitState;
@@ -906,21 +2818,44 @@ fsmc_manual_init(void)
   /* Read timing. */
   timing.FSMC_AddressSetupTime = 2;
   timing.FSMC_AddressHoldTime = 0xf;
-  timing.FSMC_DataSetupTime = 12;
+  timing.FSMC_DataSetupTime = 8;
   timing.FSMC_BusTurnAroundDuration = 2;
   timing.FSMC_CLKDivision = 0xf;
   timing.FSMC_DataLatency = 0xf;
   timing.FSMC_AccessMode = FSMC_AccessMode_A;
 
-  /* Write timing. */
+  /*
+    Write timing. A write takes as long as the FPGA holds NWAIT, so the data
+    phase only needs the 4 HCLK the FSMC wants before it looks at NWAIT
+    (NWAIT is already low by then, from NE falling), plus one for margin.
+  */
   alttiming.FSMC_AddressSetupTime = 2;
   alttiming.FSMC_AddressHoldTime = 0xf;
-  alttiming.FSMC_DataSetupTime = 8;
+  alttiming.FSMC_DataSetupTime = 5;
   alttiming.FSMC_BusTurnAroundDuration = 2;
   alttiming.FSMC_CLKDivision = 0xf;
   alttiming.FSMC_DataLatency = 0xf;
   alttiming.FSMC_AccessMode = FSMC_AccessMode_A;
 
+#ifdef FSMC_SYNC
+  /*
+    Synchronous PSRAM mode, for an FPGA built with FSMC_SYNC. FSMC_CLK is
+    HCLK/3 (56 MHz), reads and writes are bursts of one word per clock, and
+    the FPGA inserts wait states with NWAIT. The FPGA expects the first data
+    at clock 2 of an access, which is DataLatency 0.
+  */
+  fsmc_init.FSMC_MemoryType = FSMC_MemoryType_PSRAM;
+  fsmc_init.FSMC_BurstAccessMode = FSMC_BurstAccessMode_Enable;
+  fsmc_init.FSMC_AsynchronousWait = FSMC_AsynchronousWait_Disable;
+  fsmc_init.FSMC_WaitSignal = FSMC_WaitSignal_Enable;
+  fsmc_init.FSMC_WaitSignalActive = FSMC_WaitSignalActive_DuringWaitState;
+  fsmc_init.FSMC_ExtendedMode = FSMC_ExtendedMode_Disable;
+  fsmc_init.FSMC_WriteBurst = FSMC_WriteBurst_Enable;
+  timing.FSMC_BusTurnAroundDuration = 1;
+  timing.FSMC_CLKDivision = 2;
+  timing.FSMC_DataLatency = 0;
+#endif
+
   FSMC_NORSRAMInit(&fsmc_init);
   fsmc_init.FSMC_Bank = FSMC_Bank1_NORSRAM2;
   FSMC_NORSRAMInit(&fsmc_init);
@@ -930,18 +2865,50 @@ fsmc_manual_init(void)
 }
 
 
+#endif
+
+
+#ifdef HOST_BUILD
+/*
+  Host build: run one of the tests against the simulation model, chosen on
+  the command line (see host_bus_init()).
+*/
+int main(int argc, char **argv)
+{
+  static void (* const tests[])(void) = {
+    ice40_sdram_test8, ice40_sdram_test9, ice40_sdram_test10,
+    ice40_sdram_test11, ice40_sdram_test12, ice40_sdram_test13,
+    ice40_sdram_test14, ice40_sdram_test15, ice40_sdram_test16,
+    ice40_sdram_test17, ice40_sdram_test18
+  };
+  uint32_t n = host_bus_init(argc, argv);
+
+  if (n < 8 || n > 18)
+  {
+    serial_puts(CONSOLE, "No such test: ");
+    println_uint32(CONSOLE, n);
+    return 2;
+  }
+  serial_puts(CONSOLE, "Hello world, ready to blink!\r\n");
+  tests[n - 8]();
+
+  return 0;
+}
+#else
 int main(void)
 {
   delay(2000000);
   setup_serial();
   setup_leds();
-  serial_puts(USART1, "Initialising...\r\n");
+  serial_puts(CONSOLE, "Initialising...\r\n");
   delay(2000000);
   fsmc_manual_init();
+  sdram_dma_init();
 
-  serial_puts(USART1, "Hello world, ready to blink!\r\n");
+  serial_puts(CONSOLE, "Hello world, ready to blink!\r\n");
 
   ice40_sdram_test8();
 
   return 0;
 }
+#endif